@@ -5,6 +5,7 @@
 #include "../util/i18n.h"
 #include "../util/MultiplayerCommon.h"
 #include "../util/ScopedTimer.h"
+#include "../util/StringInterner.h"
 #include "../util/Random.h"
 #include "../util/Logger.h"
 #include "../util/OptionsDB.h"
@@ -37,36 +38,24 @@ namespace {
     /** sets the .allocated_rp, value for each Tech in the queue.  Only sets
       * nonzero funding to a Tech if it is researchable this turn.  Also
       * determines total number of spent RP (returning by reference in
-      * total_RPs_spent) */
-    void SetTechQueueElementSpending(float RPs, const std::map<std::string, float>& research_progress,
-                                     const std::map<std::string, TechStatus>& research_status,
+      * total_RPs_spent).  The progress, cost, per turn cost and whether each
+      * queued tech is researchable are passed in vectors indexed by queue
+      * position. */
+    void SetTechQueueElementSpending(float RPs, const std::vector<float>& queue_element_progress,
+                                     const std::vector<float>& queue_element_costs,
+                                     const std::vector<float>& queue_element_per_turn_costs,
+                                     const std::vector<bool>& queue_element_researchable,
                                      ResearchQueue::QueueType& queue,
-                                     float& total_RPs_spent, int& projects_in_progress, int empire_id)
+                                     float& total_RPs_spent, int& projects_in_progress)
     {
         total_RPs_spent = 0.0;
         projects_in_progress = 0;
         int i = 0;
 
         for (ResearchQueue::iterator it = queue.begin(); it != queue.end(); ++it, ++i) {
-            // get details on what is being researched...
-            const Tech* tech = GetTech(it->name);
-            if (!tech) {
-                Logger().errorStream() << "SetTechQueueElementSpending found null tech on research queue?!";
-                continue;
-            }
-            std::map<std::string, TechStatus>::const_iterator status_it = research_status.find(it->name);
-            if (status_it == research_status.end()) {
-                Logger().errorStream() << "SetTechQueueElementSpending couldn't find tech with name " << it->name << " in the research status map";
-                continue;
-            }
-            bool researchable = false;
-            if (status_it->second == TS_RESEARCHABLE) researchable = true;
-
-            if (researchable) {
-                std::map<std::string, float>::const_iterator progress_it = research_progress.find(it->name);
-                float progress = progress_it == research_progress.end() ? 0.0 : progress_it->second;
-                float RPs_needed = tech->ResearchCost(empire_id) - progress;
-                float RPs_per_turn_limit = tech->PerTurnCost(empire_id);
+            if (queue_element_researchable[i]) {
+                float RPs_needed = queue_element_costs[i] - queue_element_progress[i];
+                float RPs_per_turn_limit = queue_element_per_turn_costs[i];
                 float RPs_to_spend = std::min(RPs_needed, RPs_per_turn_limit);
 
                 if (total_RPs_spent + RPs_to_spend <= RPs - EPSILON) {
@@ -93,13 +82,17 @@ namespace {
       * production location (which is itself limited by the resource supply
       * system groups that are able to exchange resources with the build
       * location and the amount of minerals and industry produced in the group).
-      * Elements will not receive funding if they cannot be produced by the
-      * empire with the indicated \a empire_id this turn at their build location. */
+      * The cost and time of each element, and whether it can be produced by
+      * its empire this turn at its build location, are passed in
+      * \a queue_element_costs_and_times and \a queue_element_producible.
+      * Elements will not receive funding if they cannot be produced. */
     void SetProdQueueElementSpending(std::map<std::set<int>, float> available_pp,
                                      const std::vector<std::set<int> >& queue_element_resource_sharing_object_groups,
+                                     const std::vector<std::pair<float, int> >& queue_element_costs_and_times,
+                                     const std::vector<bool>& queue_element_producible,
                                      ProductionQueue::QueueType& queue,
                                      std::map<std::set<int>, float>& allocated_pp,
-                                     int& projects_in_progress, int empire_id)
+                                     int& projects_in_progress)
     {
         //Logger().debugStream() << "========SetProdQueueElementSpending========";
         //Logger().debugStream() << "production status: ";
@@ -109,8 +102,11 @@ namespace {
         //for (ProductionQueue::QueueType::const_iterator it = queue.begin(); it != queue.end(); ++it)
         //    Logger().debugStream() << " ... name: " << it->item.name << "id: " << it->item.design_id << " allocated: " << it->allocated_pp << " locationid: " << it->location << " ordered: " << it->ordered;
 
-        if (queue.size() != queue_element_resource_sharing_object_groups.size()) {
-            Logger().errorStream() << "SetProdQueueElementSpending queue size and sharing groups size inconsistent. aborting";
+        if (queue.size() != queue_element_resource_sharing_object_groups.size() ||
+            queue.size() != queue_element_costs_and_times.size() ||
+            queue.size() != queue_element_producible.size())
+        {
+            Logger().errorStream() << "SetProdQueueElementSpending queue size and sharing groups, costs or producibility sizes inconsistent. aborting";
             return;
         }
 
@@ -118,24 +114,6 @@ namespace {
         allocated_pp.clear();
 
         //Logger().debugStream() << "queue size: " << queue.size();
-        const Empire* empire = Empires().Lookup(empire_id);
-        if (!empire)
-            return;
-
-        // cache production item costs and times
-        std::map<std::pair<ProductionQueue::ProductionItem, int>,
-                 std::pair<float, int> >                           queue_item_costs_and_times;
-        for (ProductionQueue::iterator it = queue.begin(); it != queue.end(); ++it) {
-            ProductionQueue::Element& elem = *it;
-
-            // for items that don't depend on location, only store cost/time once
-            int location_id = (elem.item.CostIsProductionLocationInvariant() ? INVALID_OBJECT_ID : elem.location);
-            std::pair<ProductionQueue::ProductionItem, int> key(elem.item, location_id);
-
-            if (queue_item_costs_and_times.find(key) == queue_item_costs_and_times.end())
-                queue_item_costs_and_times[key] = empire->ProductionCostAndTime(elem);
-        }
-
 
         int i = 0;
         for (ProductionQueue::iterator it = queue.begin(); it != queue.end(); ++it, ++i) {
@@ -169,7 +147,7 @@ namespace {
             //Logger().debugStream() << "group has " << group_pp_available << " PP available";
 
             // see if item is buildable this turn...
-            if (!empire->ProducibleItem(queue_element.item, queue_element.location)) {
+            if (!queue_element_producible[i]) {
                 // can't be built at this location this turn.
                 queue_element.allocated_pp = 0.0;
                 //Logger().debugStream() << "item can't be built at location this turn";
@@ -178,11 +156,9 @@ namespace {
 
 
             // get max contribution per turn and turns to build at max contribution rate
-            int location_id = (queue_element.item.CostIsProductionLocationInvariant() ? INVALID_OBJECT_ID : queue_element.location);
-            std::pair<ProductionQueue::ProductionItem, int> key(queue_element.item, location_id);
             float item_cost;
             int build_turns;
-            boost::tie(item_cost, build_turns) = queue_item_costs_and_times[key];
+            boost::tie(item_cost, build_turns) = queue_element_costs_and_times[i];
             //Logger().debugStream() << "item " << queue_element.item.name << " costs " << item_cost << " for " << build_turns << " turns";
 
             item_cost *= queue_element.blocksize;
@@ -278,18 +254,52 @@ void ResearchQueue::Update(float RPs, const std::map<std::string, float>& resear
     const Empire* empire = Empires().Lookup(m_empire_id);
     if (!empire)
         return;
-    TechManager& tech_manager = GetTechManager();
-
 
-
-    std::map<std::string, TechStatus> sim_tech_status_map;
-    for (TechManager::iterator tech_it = tech_manager.begin(); tech_it != tech_manager.end(); ++tech_it) {
-        std::string tech_name = (*tech_it)->Name();
-        sim_tech_status_map[tech_name] = empire->GetTechStatus(tech_name);
+    ScopedTimer update_timer("ResearchQueue::Update", false, true);
+    const TechManager& tech_manager = GetTechManager();
+
+    // techs are simulated by their indices in the tech manager's tech graph,
+    // with the set of researched techs stored as a bitset
+    std::size_t num_techs = tech_manager.NumTechs();
+    boost::dynamic_bitset<> researched(num_techs);
+    for (std::size_t tech_index = 0; tech_index < num_techs; ++tech_index) {
+        if (empire->TechResearched(tech_manager.TechNameID(tech_index)))
+            researched.set(tech_index);
+    }
+
+    // get the tech index, progress, costs and status of each queued tech once
+    std::size_t queue_size = m_queue.size();
+    std::vector<int>    queue_tech_indices(queue_size, -1);
+    std::vector<float>  progress(queue_size, 0.0f);
+    std::vector<float>  costs(queue_size, 0.0f);
+    std::vector<float>  per_turn_costs(queue_size, 1.0f);
+    std::vector<bool>   researchable(queue_size, false);
+    std::vector<int>    queue_positions(num_techs, -1);     // queue position of each tech, or -1 if not queued
+    std::vector<int>    missing_prereqs(queue_size, 0);     // number of unresearched prerequisites of each queued tech
+    for (std::size_t i = 0; i < queue_size; ++i) {
+        int tech_index = tech_manager.TechIndex(m_queue[i].name);
+        if (tech_index == -1) {
+            Logger().errorStream() << "ResearchQueue::Update found unknown tech " << m_queue[i].name << " on research queue";
+            continue;
+        }
+        const Tech* tech = tech_manager.TechAt(tech_index);
+        queue_tech_indices[i] = tech_index;
+        queue_positions[tech_index] = i;
+
+        std::map<std::string, float>::const_iterator progress_it = research_progress.find(m_queue[i].name);
+        progress[i] = progress_it == research_progress.end() ? 0.0f : progress_it->second;
+        costs[i] = tech->ResearchCost(m_empire_id);
+        per_turn_costs[i] = tech->PerTurnCost(m_empire_id);
+
+        if (!researched.test(tech_index)) {
+            boost::dynamic_bitset<> unresearched_prereqs = tech_manager.PrerequisiteSet(tech_index) - researched;
+            missing_prereqs[i] = unresearched_prereqs.count();
+            researchable[i] = missing_prereqs[i] == 0;
+        }
     }
 
-    SetTechQueueElementSpending(RPs, research_progress, sim_tech_status_map, m_queue,
-                                m_total_RPs_spent, m_projects_in_progress, m_empire_id);
+    SetTechQueueElementSpending(RPs, progress, costs, per_turn_costs, researchable, m_queue,
+                                m_total_RPs_spent, m_projects_in_progress);
 
     if (m_queue.empty()) {
         ResearchQueueChangedSignal();
@@ -307,132 +317,67 @@ void ResearchQueue::Update(float RPs, const std::map<std::string, float>& resear
         return;    // nothing more to do if not enough RP...
     }
 
-    boost::posix_time::ptime dp_time_start;
-    boost::posix_time::ptime dp_time_end;
-
-    // "Dynamic Programming" version of research queue simulator -- copy the queue simulator containers
-    // perform dynamic programming calculation of completion times, then after regular simulation is done compare results (if both enabled)
-
-    //record original order & progress
-    // will take advantage of fact that sets (& map keys) are by default kept in sorted order lowest to highest
-    std::map<std::string, float> dp_prog = research_progress;
-    std::map< std::string, int > origQueueOrder;
-    std::map<int, float> dpsim_research_progress;
-    for (unsigned int i = 0; i < m_queue.size(); ++i) {
-        std::string tname = m_queue[i].name;
-        origQueueOrder[tname] = i;
-        dpsim_research_progress[i] = dp_prog[tname];
-    }
-
-    std::map<std::string, TechStatus> dpsim_tech_status_map = sim_tech_status_map;
-
-    // initialize simulation_results with -1 for all techs, so that any techs that aren't
-    // finished in simulation by turn TOO_MANY_TURNS will be left marked as never to be finished
-    std::vector<int>  dpsimulation_results(m_queue.size(), -1);
-
+    // "Dynamic Programming" version of research queue simulator.  each turn,
+    // RP are spent on researchable techs in queue order.  when a tech is
+    // completed, queued techs it unlocks whose prerequisites have all been
+    // completed become researchable from the next turn on.  techs that aren't
+    // finished in simulation by turn TOO_MANY_TURNS are left marked as never
+    // to be finished
     const int DP_TURNS = TOO_MANY_TURNS; // track up to this many turns
 
-    std::map<std::string, std::set<std::string> > waitingForPrereqs;
-    std::set<int> dpResearchableTechs;
- 
-    for (unsigned int i = 0; i < m_queue.size(); ++i) {
-        std::string techname = m_queue[i].name;
-        const Tech* tech = GetTech( techname );
-        if (!tech)
-            continue;
-        if ( dpsim_tech_status_map[ techname ] == TS_RESEARCHABLE ) {
-            dpResearchableTechs.insert(i);
-        } else if ( dpsim_tech_status_map[ techname  ] == TS_UNRESEARCHABLE ) {
-            std::set<std::string> thesePrereqs = tech->Prerequisites();
-            for (std::set<std::string>::iterator ptech_it = thesePrereqs.begin(); ptech_it != thesePrereqs.end(); ++ptech_it){
-                if (dpsim_tech_status_map[ *ptech_it ] == TS_COMPLETE ) {
-                    std::set<std::string>::iterator eraseit = ptech_it--;
-                    thesePrereqs.erase( eraseit);
-                }
-            }
-            waitingForPrereqs[ techname ] = thesePrereqs;
-        }
+    std::vector<int> researchable_positions;    // queue positions of researchable techs, in queue order
+    for (std::size_t i = 0; i < queue_size; ++i) {
+        if (researchable[i])
+            researchable_positions.push_back(i);
     }
 
+    std::vector<int> next_researchable_positions;
+    std::vector<int> unlocked_positions;
     int dpturns = 0;
-    //ppStillAvailable[turn-1] gives the RP still available in this resource pool at turn "turn"
-    std::vector<float> rpStillAvailable(DP_TURNS, RPs );  // initialize to the  full RP allocation for every turn
-
-    while ((dpturns < DP_TURNS) && !(dpResearchableTechs.empty())) {// if we haven't used up our turns and still have techs to process
+    while ((dpturns < DP_TURNS) && !researchable_positions.empty()) {// if we haven't used up our turns and still have techs to process
         ++dpturns;
-        std::map<int, bool> alreadyProcessed;
-        std::set<int>::iterator curTechIt;
-        for (curTechIt = dpResearchableTechs.begin(); curTechIt != dpResearchableTechs.end(); ++curTechIt) {
-            alreadyProcessed[ *curTechIt ] = false;
-        }
-        curTechIt = dpResearchableTechs.begin();
-        while ((rpStillAvailable[dpturns-1] > EPSILON)) { // try to use up this turns RPs
-            if (curTechIt == dpResearchableTechs.end()) {
-                break; //will be wasting some RP this turn
+        float rpStillAvailable = RPs;
+        next_researchable_positions.clear();
+        unlocked_positions.clear();
+
+        for (std::vector<int>::const_iterator it = researchable_positions.begin();
+             it != researchable_positions.end(); ++it)
+        {
+            int i = *it;
+            if (rpStillAvailable <= EPSILON) {  // this turn's RP are used up
+                next_researchable_positions.push_back(i);
+                continue;
             }
-            int curTech = *curTechIt;
-            if (alreadyProcessed[curTech]) {
-                ++curTechIt;
+
+            float RPs_to_spend = std::min(std::min(costs[i] - progress[i], per_turn_costs[i]), rpStillAvailable);
+            progress[i] += RPs_to_spend;
+            rpStillAvailable -= RPs_to_spend;
+
+            if (costs[i] - EPSILON > progress[i]) {
+                next_researchable_positions.push_back(i);
                 continue;
             }
-            alreadyProcessed[curTech] = true;
-            const std::string& tech_name = m_queue[curTech].name;
-            const Tech* tech = GetTech(tech_name);
-            float progress = dpsim_research_progress[curTech];
-            float RPs_needed = tech ? tech->ResearchCost(m_empire_id) - progress : 0.0;
-            float RPs_per_turn_limit = tech ? tech->PerTurnCost(m_empire_id) : 1.0;
-            float RPs_to_spend = std::min(std::min(RPs_needed, RPs_per_turn_limit), rpStillAvailable[dpturns-1]);
-            progress += RPs_to_spend;
-            dpsim_research_progress[curTech] = progress;
-            rpStillAvailable[dpturns-1] -= RPs_to_spend;
-            std::set<int>::iterator nextResTechIt = curTechIt;
-            int nextResTechIdx;
-            if (++nextResTechIt == dpResearchableTechs.end()) {
-                nextResTechIdx = m_queue.size()+1;
-            } else {
-                nextResTechIdx = *(nextResTechIt);
+
+            m_queue[i].turns_left = dpturns;
+
+            const std::vector<int>& unlocked_techs = tech_manager.UnlockedTechIndices(queue_tech_indices[i]);
+            for (std::vector<int>::const_iterator unlocked_it = unlocked_techs.begin();
+                 unlocked_it != unlocked_techs.end(); ++unlocked_it)
+            {
+                int unlocked_position = queue_positions[*unlocked_it];
+                if (unlocked_position != -1 && missing_prereqs[unlocked_position] > 0 &&
+                    --missing_prereqs[unlocked_position] == 0)
+                { unlocked_positions.push_back(unlocked_position); }
             }
-            float tech_cost = tech ? tech->ResearchCost(m_empire_id) : 0.0;
-            if (tech_cost - EPSILON <= progress) {
-                dpsim_tech_status_map[tech_name] = TS_COMPLETE;
-                dpsimulation_results[curTech] = dpturns;
-#ifndef ORIG_RES_SIMULATOR
-                m_queue[curTech].turns_left = dpturns;
-#endif
-                dpResearchableTechs.erase(curTechIt);
-                std::set<std::string> unlockedTechs;
-                if (tech)
-                    unlockedTechs = tech->UnlockedTechs();
-                for (std::set<std::string>::iterator utechIt = unlockedTechs.begin(); utechIt!=unlockedTechs.end(); ++utechIt) {
-                    std::string utechName = *utechIt;
-                    std::map<std::string,std::set<std::string> >::iterator prereqTechIt = waitingForPrereqs.find(utechName);
-                    if (prereqTechIt != waitingForPrereqs.end() ){
-                        std::set<std::string> &thesePrereqs = prereqTechIt->second;
-                        std::set<std::string>::iterator justFinishedIt = thesePrereqs.find( tech_name );
-                        if (justFinishedIt != thesePrereqs.end() ) {  //should always find it
-                            thesePrereqs.erase( justFinishedIt );
-                            if ( thesePrereqs.empty() ) { // tech now fully unlocked
-                                int thisTechIdx = origQueueOrder[utechName];
-                                dpResearchableTechs.insert(thisTechIdx);
-                                waitingForPrereqs.erase( prereqTechIt );
-                                alreadyProcessed[ thisTechIdx ] = true;//doesn't get any allocation on current turn
-                                if (thisTechIdx < nextResTechIdx ) {
-                                    nextResTechIdx = thisTechIdx;
-                                }
-                            }
-                        } else { //couldnt find tech_name in prereqs list  
-                            Logger().debugStream() << "ResearchQueue::Update tech unlocking problem:"<< tech_name << "thought it was a prereq for " << utechName << "but the latter disagreed";
-                        }
-                    } //else { //tech_name thinks itself a prereq for ytechName, but utechName not in prereqs -- not a problem so long as utechName not in our queue at all
-                      //  Logger().debugStream() << "ResearchQueue::Update tech unlocking problem:"<< tech_name << "thought it was a prereq for " << utechName << "but the latter disagreed";
-                      //}
-                }
-            }// if (tech->ResearchCost() - EPSILON <= progress)
-            curTechIt = dpResearchableTechs.find(nextResTechIdx);
-        }//while ((rpStillAvailable[dpturns-1]> EPSILON))
-        //dp_time = dpsim_queue_timer.elapsed() * 1000;
-        // Logger().debugStream() << "ProductionQueue::Update queue dynamic programming sim time: " << dpsim_queue_timer.elapsed() * 1000.0;
-    } // while ((dpturns < DP_TURNS ) && !(dpResearchableTechs.empty() ) )
+        }
+
+        // techs unlocked this turn don't get any allocation until next turn
+        std::sort(unlocked_positions.begin(), unlocked_positions.end());
+        researchable_positions.clear();
+        std::merge(next_researchable_positions.begin(), next_researchable_positions.end(),
+                   unlocked_positions.begin(), unlocked_positions.end(),
+                   std::back_inserter(researchable_positions));
+    }
 
     ResearchQueueChangedSignal();
 }
@@ -606,9 +551,60 @@ ProductionQueue::Element::Element(BuildType build_type, int design_id, int empir
 /////////////////////
 // ProductionQueue //
 /////////////////////
+//////////////////////////////////////////
+// ProductionQueue::ProjectedElement    //
+//////////////////////////////////////////
+ProductionQueue::ProjectedElement::ProjectedElement() :
+    item(),
+    location(INVALID_OBJECT_ID),
+    blocksize(1),
+    remaining(0),
+    progress(0.0f),
+    item_cost(0.0f),
+    build_turns(0),
+    simulated(false),
+    projected(false),
+    turns_left_to_next_item(-1),
+    turns_left_to_completion(-1),
+    first_turn_pp_available(1),
+    pp_still_available()
+{}
+
+bool ProductionQueue::ProjectedElement::SameInputs(const ProjectedElement& rhs) const {
+    return !(item < rhs.item) && !(rhs.item < item) &&
+           location == rhs.location &&
+           blocksize == rhs.blocksize &&
+           remaining == rhs.remaining &&
+           progress == rhs.progress &&
+           item_cost == rhs.item_cost &&
+           build_turns == rhs.build_turns &&
+           simulated == rhs.simulated;
+}
+
+void ProductionQueue::ProjectedElement::SetProjected(const Element& element, unsigned int first_turn_pp_available_,
+                                                     const std::vector<float>& group_pp_still_available)
+{
+    projected = true;
+    turns_left_to_next_item = element.turns_left_to_next_item;
+    turns_left_to_completion = element.turns_left_to_completion;
+    first_turn_pp_available = first_turn_pp_available_;
+    // the PP available before first_turn_pp_available is never used again
+    std::size_t first_index = std::min<std::size_t>(first_turn_pp_available - 1, group_pp_still_available.size());
+    pp_still_available.assign(group_pp_still_available.begin() + first_index, group_pp_still_available.end());
+}
+
+
+//////////////////////////////////////////
+// ProductionQueue                      //
+//////////////////////////////////////////
 ProductionQueue::ProductionQueue(int empire_id) :
     m_projects_in_progress(0),
-    m_empire_id(empire_id)
+    m_empire_id(empire_id),
+    m_projection(),
+    m_projection_available_pp(),
+    m_projection_turn(INVALID_GAME_TURN),
+    m_costs_and_times(),
+    m_costs_and_times_turn(INVALID_GAME_TURN)
 {}
 
 int ProductionQueue::ProjectsInProgress() const
@@ -699,14 +695,11 @@ const ProductionQueue::Element& ProductionQueue::operator[](int i) const {
 }
 
 ProductionQueue::const_iterator ProductionQueue::UnderfundedProject() const {
-    const Empire* empire = Empires().Lookup(m_empire_id);
-    if (!empire)
-        return end();
     for (const_iterator it = begin(); it != end(); ++it) {
 
         float item_cost;
         int build_turns;
-        boost::tie(item_cost, build_turns) = empire->ProductionCostAndTime(*it);
+        boost::tie(item_cost, build_turns) = ProductionCostAndTime(*it);
 
         item_cost *= it->blocksize;
         float maxPerTurn = item_cost / std::max(build_turns,1);
@@ -716,27 +709,86 @@ ProductionQueue::const_iterator ProductionQueue::UnderfundedProject() const {
     return end();
 }
 
+std::pair<float, int> ProductionQueue::ProductionCostAndTime(const Element& element) const {
+    const Empire* empire = Empires().Lookup(m_empire_id);
+    if (!empire)
+        return std::make_pair(-1.0f, -1);
+
+    if (m_costs_and_times_turn != CurrentTurn()) {
+        m_costs_and_times.clear();
+        m_costs_and_times_turn = CurrentTurn();
+    }
+
+    // for items that don't depend on location, only store cost/time once
+    int location_id = (element.item.CostIsProductionLocationInvariant() ? INVALID_OBJECT_ID : element.location);
+    std::pair<ProductionItem, int> key(element.item, location_id);
+
+    CostAndTimeMap::const_iterator it = m_costs_and_times.find(key);
+    if (it != m_costs_and_times.end())
+        return it->second;
+
+    std::pair<float, int> cost_and_time = empire->ProductionCostAndTime(element);
+    m_costs_and_times[key] = cost_and_time;
+    return cost_and_time;
+}
+
 void ProductionQueue::Update() {
     const Empire* empire = Empires().Lookup(m_empire_id);
     if (!empire) {
         Logger().errorStream() << "ProductionQueue::Update passed null empire.  doing nothing.";
         m_projects_in_progress = 0;
         m_object_group_allocated_pp.clear();
+        m_projection.clear();
         return;
     }
 
+    std::map<std::set<int>, float> available_pp = AvailablePP(empire->GetResourcePool(RE_INDUSTRY));
+
+    // get the cost and time of each queue item, and whether it can be produced
+    // at its location this turn, once for both allocating PP this turn and
+    // simulating future turns.  items outside any resource sharing group
+    // can't be produced, so their location conditions aren't evaluated
+    std::vector<std::pair<float, int> > queue_element_costs_and_times;
+    std::vector<bool>                   queue_element_producible;
+    queue_element_costs_and_times.reserve(m_queue.size());
+    queue_element_producible.reserve(m_queue.size());
+    for (unsigned int i = 0; i < m_queue.size(); ++i) {
+        bool in_group = false;
+        for (std::map<std::set<int>, float>::const_iterator groups_it = available_pp.begin();
+             groups_it != available_pp.end(); ++groups_it)
+        {
+            if (groups_it->first.find(m_queue[i].location) != groups_it->first.end()) {
+                in_group = true;
+                break;
+            }
+        }
+        queue_element_costs_and_times.push_back(ProductionCostAndTime(m_queue[i]));
+        queue_element_producible.push_back(in_group && empire->ProducibleItem(m_queue[i].item, m_queue[i].location));
+    }
+
+    Update(available_pp, queue_element_costs_and_times, queue_element_producible);
+}
+
+void ProductionQueue::Update(const std::map<std::set<int>, float>& available_pp,
+                             const std::vector<std::pair<float, int> >& queue_element_costs_and_times,
+                             const std::vector<bool>& queue_element_producible)
+{
     if (m_queue.empty()) {
         //Logger().debugStream() << "ProductionQueue::Update aborting early due to an empty queue";
         m_projects_in_progress = 0;
         m_object_group_allocated_pp.clear();
+        m_projection.clear();
 
         ProductionQueueChangedSignal(); // need this so BuildingsPanel updates properly after removing last building
         return;                         // nothing to do for an empty queue
     }
 
-    ScopedTimer update_timer("ProductionQueue::Update");
+    if (queue_element_costs_and_times.size() != m_queue.size() || queue_element_producible.size() != m_queue.size()) {
+        Logger().errorStream() << "ProductionQueue::Update passed costs or producibility inconsistent with queue size.  doing nothing.";
+        return;
+    }
 
-    std::map<std::set<int>, float> available_pp = AvailablePP(empire->GetResourcePool(RE_INDUSTRY));
+    ScopedTimer update_timer("ProductionQueue::Update", false, true);
 
     // determine which resource sharing group each queue item is located in
     std::vector<std::set<int> > queue_element_groups;
@@ -769,8 +821,9 @@ void ProductionQueue::Update() {
 
     // allocate pp to queue elements, returning updated available pp and updated
     // allocated pp for each group of resource sharing objects
-    SetProdQueueElementSpending(available_pp, queue_element_groups, m_queue,
-                                m_object_group_allocated_pp, m_projects_in_progress, m_empire_id);
+    SetProdQueueElementSpending(available_pp, queue_element_groups, queue_element_costs_and_times,
+                                queue_element_producible, m_queue,
+                                m_object_group_allocated_pp, m_projects_in_progress);
 
 
     // if at least one resource-sharing system group have available PP, simulate
@@ -787,7 +840,7 @@ void ProductionQueue::Update() {
 
 
     if (!simulate_future) {
-        Logger().debugStream() << "not enough PP to be worth simulating future turns production.  marking everything as never complete";
+        DebugLogger() << "not enough PP to be worth simulating future turns production.  marking everything as never complete";
         // since there are so few PPs, indicate that the number of turns left is indeterminate by providing a number < 0
         for (ProductionQueue::QueueType::iterator queue_it = m_queue.begin();
              queue_it != m_queue.end(); ++queue_it)
@@ -795,13 +848,14 @@ void ProductionQueue::Update() {
             queue_it->turns_left_to_next_item = -1;     // -1 is sentinel value indicating never to be complete.  ProductionWnd checks for turns to completeion less than 0 and displays "NEVER" when appropriate
             queue_it->turns_left_to_completion = -1;
         }
+        m_projection.clear();
         ProductionQueueChangedSignal();
         return;
     }
 
 
     // there are enough PP available in at least one group to make it worthwhile to simulate the future.
-    Logger().debugStream() << "ProductionQueue::Update: Simulating future turns of production queue";
+    DebugLogger() << "ProductionQueue::Update: Simulating future turns of production queue";
 
 
     // duplicate production queue state for future simulation
@@ -834,7 +888,7 @@ void ProductionQueue::Update() {
 
         // if any removal condition is met, remove item from queue
         bool remove = false;
-        if (group.empty() || !empire->ProducibleItem(sim_queue[i].item, sim_queue[i].location)) {        // empty group or not buildable
+        if (group.empty() || !queue_element_producible[sim_queue_original_indices[i]]) {           // empty group or not buildable
             remove = true;
         } else {
             std::map<std::set<int>, float>::const_iterator available_it = available_pp.find(group);
@@ -885,19 +939,32 @@ void ProductionQueue::Update() {
         elementsByGroup[sim_queue_element_groups[i]].push_back(i);
 
 
-    // cache production item costs and times
-    std::map<std::pair<ProductionQueue::ProductionItem, int>,
-                std::pair<float, int> >                           queue_item_costs_and_times;
-    for (ProductionQueue::iterator it = m_queue.begin(); it != m_queue.end(); ++it) {
-        ProductionQueue::Element& elem = *it;
-
-        // for items that don't depend on location, only store cost/time once
-        int location_id = (elem.item.CostIsProductionLocationInvariant() ? INVALID_OBJECT_ID : elem.location);
-        std::pair<ProductionQueue::ProductionItem, int> key(elem.item, location_id);
+    // record the inputs to the simulation of each queue item, and find the
+    // first item whose inputs differ from those of the last simulation.  an
+    // item's simulation only depends on the items before it in its group, so
+    // the results of the last simulation can be reused for the items before
+    // the first changed item, if the PP available to each group is unchanged
+    std::vector<ProjectedElement> projection(m_queue.size());
+    for (unsigned int i = 0; i < m_queue.size(); ++i) {
+        ProjectedElement& projected = projection[i];
+        projected.item =        m_queue[i].item;
+        projected.location =    m_queue[i].location;
+        projected.blocksize =   m_queue[i].blocksize;
+        projected.remaining =   m_queue[i].remaining;
+        projected.progress =    m_queue[i].progress;
+        boost::tie(projected.item_cost, projected.build_turns) = queue_element_costs_and_times[i];
+    }
+    for (unsigned int i = 0; i < sim_queue_original_indices.size(); ++i)
+        projection[sim_queue_original_indices[i]].simulated = true;
 
-        if (queue_item_costs_and_times.find(key) == queue_item_costs_and_times.end())
-            queue_item_costs_and_times[key] = empire->ProductionCostAndTime(elem);
+    unsigned int first_changed = 0;
+    if (m_projection_turn == CurrentTurn() && m_projection_available_pp == available_pp) {
+        unsigned int num_comparable = std::min(projection.size(), m_projection.size());
+        while (first_changed < num_comparable && projection[first_changed].SameInputs(m_projection[first_changed]))
+            ++first_changed;
     }
+    if (GetOptionsDB().Get<bool>("verbose-logging"))
+        DebugLogger() << "ProductionQueue::Update: Reusing projections of " << first_changed << " unchanged items at start of queue";
 
 
     // within each group, allocate PP to queue items
@@ -913,15 +980,35 @@ void ProductionQueue::Update() {
         std::vector<int>::const_iterator groupBegin = thisGroupsElements.begin();
         std::vector<int>::const_iterator groupEnd = thisGroupsElements.end();
 
+        // reuse the results for this group's items before the first changed
+        // item, and resume simulating from the group's state after them
+        std::vector<int>::const_iterator el_it = groupBegin;
+        const ProjectedElement* last_reused = 0;
+        for (; el_it != groupEnd; ++el_it) {
+            unsigned int original_index = sim_queue_original_indices[*el_it];
+            if (original_index >= first_changed || !m_projection[original_index].projected)
+                break;
+            last_reused = &m_projection[original_index];
+            projection[original_index] = *last_reused;
+            m_queue[original_index].turns_left_to_next_item = last_reused->turns_left_to_next_item;
+            m_queue[original_index].turns_left_to_completion = last_reused->turns_left_to_completion;
+        }
+        if (last_reused) {
+            firstTurnPPAvailable = last_reused->first_turn_pp_available;
+            if (firstTurnPPAvailable <= DP_TURNS)
+                std::copy(last_reused->pp_still_available.begin(), last_reused->pp_still_available.end(),
+                          ppStillAvailable.begin() + (firstTurnPPAvailable - 1));
+        }
+
         // cycle through items on queue, if in this resource group then allocate production costs over time against those available to group
-        for (std::vector<int>::const_iterator el_it = groupBegin;
+        for (;
              (el_it != groupEnd) && ((boost::posix_time::ptime(boost::posix_time::microsec_clock::local_time())-dp_time_start).total_microseconds()*1e-6 < DP_TOO_LONG_TIME);
              ++el_it)
         {
             firstTurnPPAvailable += turnJump;
             turnJump = 0;
             if (firstTurnPPAvailable > DP_TURNS) {
-                Logger().debugStream()  << "ProductionQueue::Update: Projections for Resource Group halted at " 
+                DebugLogger()  << "ProductionQueue::Update: Projections for Resource Group halted at " 
                                         << DP_TURNS << " turns; remaining items in this RG marked completing 'Never'.";
                 break; // this resource group is allocated-out for span of simulation; remaining items in group left as never completing
             }
@@ -930,12 +1017,10 @@ void ProductionQueue::Update() {
             ProductionQueue::Element& element = dpsim_queue[i];
             //Logger().debugStream()  << "     checking element " << element.item.name << " " << element.item.design_id << " at planet id " << element.location;
 
-            // get cost and time from cache
-            int location_id = (element.item.CostIsProductionLocationInvariant() ? INVALID_OBJECT_ID : element.location);
-            std::pair<ProductionQueue::ProductionItem, int> key(element.item, location_id);
+            // get cost and time
             float item_cost;
             int build_turns;
-            boost::tie(item_cost, build_turns) = queue_item_costs_and_times[key];
+            boost::tie(item_cost, build_turns) = queue_element_costs_and_times[sim_queue_original_indices[i]];
 
 
             item_cost *= element.blocksize;
@@ -947,6 +1032,8 @@ void ProductionQueue::Update() {
                 //Logger().debugStream()  << "     will complete next turn";
                 m_queue[sim_queue_original_indices[i]].turns_left_to_next_item = 1;
                 m_queue[sim_queue_original_indices[i]].turns_left_to_completion = 1;
+                projection[sim_queue_original_indices[i]].SetProjected(m_queue[sim_queue_original_indices[i]],
+                                                                       firstTurnPPAvailable, ppStillAvailable);
                 continue;
             }
 
@@ -1007,17 +1094,23 @@ void ProductionQueue::Update() {
                     break; // this element all done
                 }
             } //j-loop : turns relative to firstTurnPPAvailable
+
+            projection[sim_queue_original_indices[i]].SetProjected(m_queue[sim_queue_original_indices[i]],
+                                                                   firstTurnPPAvailable + turnJump, ppStillAvailable);
         } // queue element loop
     } // resource groups loop
 
+    m_projection.swap(projection);
+    m_projection_available_pp = available_pp;
+    m_projection_turn = CurrentTurn();
+
     dp_time_end = boost::posix_time::ptime(boost::posix_time::microsec_clock::local_time()); 
     dp_time = (dp_time_end - dp_time_start).total_microseconds();
     if ((dp_time * 1e-6) >= DP_TOO_LONG_TIME)
-        Logger().debugStream()  << "ProductionQueue::Update: Projections timed out after " << dp_time 
+        DebugLogger()  << "ProductionQueue::Update: Projections timed out after " << dp_time 
                                 << " microseconds; all remaining items in queue marked completing 'Never'.";
-    Logger().debugStream()  << "ProductionQueue::Update: Projections took " 
-                            << ((dp_time_end - dp_time_start).total_microseconds()) << " microseconds with "
-                            << empire->ProductionPoints() << " total Production Points";
+    DebugLogger()  << "ProductionQueue::Update: Projections took " 
+                            << ((dp_time_end - dp_time_start).total_microseconds()) << " microseconds";
     ProductionQueueChangedSignal();
 }
 
@@ -1052,15 +1145,11 @@ ProductionQueue::Element& ProductionQueue::operator[](int i) {
 }
 
 ProductionQueue::iterator ProductionQueue::UnderfundedProject() {
-    const Empire* empire = Empires().Lookup(m_empire_id);
-    if (!empire)
-        return end();
-
     for (iterator it = begin(); it != end(); ++it) {
 
         float item_cost;
         int build_turns;
-        boost::tie(item_cost, build_turns) = empire->ProductionCostAndTime(*it);
+        boost::tie(item_cost, build_turns) = ProductionCostAndTime(*it);
 
         item_cost *= it->blocksize;
         float maxPerTurn = item_cost / std::max(build_turns,1);
@@ -1070,6 +1159,11 @@ ProductionQueue::iterator ProductionQueue::UnderfundedProject() {
     return end();
 }
 
+void ProductionQueue::ClearCachedCostsAndTimes() {
+    m_costs_and_times.clear();
+    m_costs_and_times_turn = INVALID_GAME_TURN;
+}
+
 void ProductionQueue::clear() {
     m_queue.clear();
     m_projects_in_progress = 0;
@@ -1127,22 +1221,22 @@ namespace {
 
         s_instance = this;
 
-        Logger().debugStream() << "Initializing AlignmentManager";
+        DebugLogger() << "Initializing AlignmentManager";
 
         parse::alignments(GetResourceDir() / "alignments.txt", m_alignments, m_effects_groups);
 
         if (GetOptionsDB().Get<bool>("verbose-logging")) {
-            Logger().debugStream() << "Alignments:";
+            DebugLogger() << "Alignments:";
             for (std::vector<Alignment>::const_iterator it = m_alignments.begin(); it != m_alignments.end(); ++it) {
                 const Alignment& p = *it;
-                Logger().debugStream() << " ... " << p.Name();
+                DebugLogger() << " ... " << p.Name();
             }
-            Logger().debugStream() << "Alignment Effects:";
+            DebugLogger() << "Alignment Effects:";
             for (std::vector<boost::shared_ptr<const Effect::EffectsGroup> >::const_iterator it = m_effects_groups.begin();
                  it != m_effects_groups.end(); ++it)
             {
                 //const boost::shared_ptr<const Effect::EffectsGroup>& p = *it;
-                Logger().debugStream() << " ... " /*<< p->Dump()*/;
+                DebugLogger() << " ... " /*<< p->Dump()*/;
             }
         }
     }
@@ -1174,7 +1268,7 @@ Empire::Empire(const std::string& name, const std::string& player_name,
     m_research_queue(m_id),
     m_production_queue(m_id)
 {
-    Logger().debugStream() << "Empire::Empire(" << name << ", " << player_name << ", " << empire_id << ", colour)";
+    DebugLogger() << "Empire::Empire(" << name << ", " << player_name << ", " << empire_id << ", colour)";
     Init();
 }
 
@@ -1288,6 +1382,11 @@ const std::set<std::string>& Empire::AvailableTechs() const
 bool Empire::TechResearched(const std::string& name) const
 { return m_techs.find(name) != m_techs.end(); }
 
+bool Empire::TechResearched(int name_id) const {
+    return name_id >= 0 && static_cast<std::size_t>(name_id) < m_researched_tech_ids.size() &&
+           m_researched_tech_ids[name_id];
+}
+
 TechStatus Empire::GetTechStatus(const std::string& name) const {
     if (TechResearched(name)) return TS_COMPLETE;
     if (ResearchableTech(name)) return TS_RESEARCHABLE;
@@ -2238,7 +2337,7 @@ const unsigned int MAX_PROD_QUEUE_SIZE = 500;
 
 void Empire::PlaceBuildInQueue(BuildType build_type, const std::string& name, int number, int location, int pos/* = -1*/) {
     if (!ProducibleItem(build_type, name, location))
-        Logger().debugStream() << "Empire::PlaceBuildInQueue() : Placed a non-buildable item in queue...";
+        DebugLogger() << "Empire::PlaceBuildInQueue() : Placed a non-buildable item in queue...";
 
     if (m_production_queue.size() >= MAX_PROD_QUEUE_SIZE)
         return;
@@ -2252,7 +2351,7 @@ void Empire::PlaceBuildInQueue(BuildType build_type, const std::string& name, in
 
 void Empire::PlaceBuildInQueue(BuildType build_type, int design_id, int number, int location, int pos/* = -1*/) {
     if (!ProducibleItem(build_type, design_id, location))
-        Logger().debugStream() << "Empire::PlaceBuildInQueue() : Placed a non-buildable item in queue...";
+        DebugLogger() << "Empire::PlaceBuildInQueue() : Placed a non-buildable item in queue...";
 
     if (m_production_queue.size() >= MAX_PROD_QUEUE_SIZE)
         return;
@@ -2274,7 +2373,7 @@ void Empire::PlaceBuildInQueue(const ProductionQueue::ProductionItem& item, int
 }
 
 void Empire::SetBuildQuantityAndBlocksize(int index, int quantity, int blocksize) {
-    Logger().debugStream() << "Empire::SetBuildQuantityAndBlocksize() called for item "<< m_production_queue[index].item.name << "with new quant " << quantity << " and new blocksize " << blocksize;
+    DebugLogger() << "Empire::SetBuildQuantityAndBlocksize() called for item "<< m_production_queue[index].item.name << "with new quant " << quantity << " and new blocksize " << blocksize;
     if (index < 0 || static_cast<int>(m_production_queue.size()) <= index)
         throw std::runtime_error("Empire::SetBuildQuantity() : Attempted to adjust the quantity of items to be built in a nonexistent production queue item.");
     if (quantity < 1)
@@ -2309,7 +2408,7 @@ void Empire::MoveBuildWithinQueue(int index, int new_index) {
     if (index < 0 || static_cast<int>(m_production_queue.size()) <= index ||
         new_index < 0 || static_cast<int>(m_production_queue.size()) <= new_index)
     {
-        Logger().debugStream() << "Empire::MoveBuildWithinQueue index: " << index << "  new index: "
+        DebugLogger() << "Empire::MoveBuildWithinQueue index: " << index << "  new index: "
                                << new_index << "  queue size: " << m_production_queue.size();
         Logger().errorStream() << "Attempted to move a production queue item to or from an invalid index.";
         return;
@@ -2321,7 +2420,7 @@ void Empire::MoveBuildWithinQueue(int index, int new_index) {
 
 void Empire::RemoveBuildFromQueue(int index) {
     if (index < 0 || static_cast<int>(m_production_queue.size()) <= index) {
-        Logger().debugStream() << "Empire::RemoveBuildFromQueue index: " << index << "  queue size: " << m_production_queue.size();
+        DebugLogger() << "Empire::RemoveBuildFromQueue index: " << index << "  queue size: " << m_production_queue.size();
         Logger().errorStream() << "Attempted to delete a production queue item with an invalid index.";
         return;
     }
@@ -2334,7 +2433,7 @@ void Empire::ConquerProductionQueueItemsAtLocation(int location_id, int empire_i
         return;
     }
 
-    Logger().debugStream() << "Empire::ConquerProductionQueueItemsAtLocation: conquering items located at "
+    DebugLogger() << "Empire::ConquerProductionQueueItemsAtLocation: conquering items located at "
                            << location_id << " to empire " << empire_id;
 
     Empire* to_empire = Empires().Lookup(empire_id);    // may be null
@@ -2416,8 +2515,13 @@ void Empire::AddTech(const std::string& name) {
     for (unsigned int i = 0; i < unlocked_items.size(); ++i)
         UnlockItem(unlocked_items[i]);  // potential infinite if a tech (in)directly unlocks itself?
 
-    if (m_techs.find(name) == m_techs.end())
+    if (m_techs.find(name) == m_techs.end()) {
         m_techs.insert(name);
+        std::size_t name_id = InternString(name);
+        if (m_researched_tech_ids.size() <= name_id)
+            m_researched_tech_ids.resize(name_id + 1, false);
+        m_researched_tech_ids[name_id] = true;
+    }
 }
 
 void Empire::UnlockItem(const ItemSpec& item) {
@@ -2570,15 +2674,29 @@ void Empire::RemoveShipDesign(int ship_design_id) {
         m_ship_designs.erase(ship_design_id);
         ShipDesignsChangedSignal();
     } else {
-        Logger().debugStream() << "Empire::RemoveShipDesign: this empire did not have design with id " << ship_design_id;
+        DebugLogger() << "Empire::RemoveShipDesign: this empire did not have design with id " << ship_design_id;
     }
 }
 
 void Empire::AddSitRepEntry(const SitRepEntry& entry)
 { m_sitrep_entries.push_back(entry); }
 
-void Empire::RemoveTech(const std::string& name)
-{ m_techs.erase(name); }
+void Empire::RemoveTech(const std::string& name) {
+    m_techs.erase(name);
+    int name_id = FindInternedString(name);
+    if (name_id != INVALID_STRING_ID && static_cast<std::size_t>(name_id) < m_researched_tech_ids.size())
+        m_researched_tech_ids[name_id] = false;
+}
+
+void Empire::UpdateResearchedTechIDs() {
+    m_researched_tech_ids.clear();
+    for (std::set<std::string>::const_iterator it = m_techs.begin(); it != m_techs.end(); ++it) {
+        std::size_t name_id = InternString(*it);
+        if (m_researched_tech_ids.size() <= name_id)
+            m_researched_tech_ids.resize(name_id + 1, false);
+        m_researched_tech_ids[name_id] = true;
+    }
+}
 
 void Empire::LockItem(const ItemSpec& item) {
     switch (item.type) {
@@ -2605,21 +2723,21 @@ void Empire::LockItem(const ItemSpec& item) {
 void Empire::RemoveBuildingType(const std::string& name) {
     std::set<std::string>::const_iterator it = m_available_building_types.find(name);
     if (it == m_available_building_types.end())
-        Logger().debugStream() << "Empire::RemoveBuildingType asked to remove building type " << name << " that was no available to this empire";
+        DebugLogger() << "Empire::RemoveBuildingType asked to remove building type " << name << " that was no available to this empire";
     m_available_building_types.erase(name);
 }
 
 void Empire::RemovePartType(const std::string& name) {
     std::set<std::string>::const_iterator it = m_available_part_types.find(name);
     if (it == m_available_part_types.end())
-        Logger().debugStream() << "Empire::RemovePartType asked to remove part type " << name << " that was no available to this empire";
+        DebugLogger() << "Empire::RemovePartType asked to remove part type " << name << " that was no available to this empire";
     m_available_part_types.erase(name);
 }
 
 void Empire::RemoveHullType(const std::string& name) {
     std::set<std::string>::const_iterator it = m_available_hull_types.find(name);
     if (it == m_available_hull_types.end())
-        Logger().debugStream() << "Empire::RemoveHullType asked to remove hull type " << name << " that was no available to this empire";
+        DebugLogger() << "Empire::RemoveHullType asked to remove hull type " << name << " that was no available to this empire";
     m_available_hull_types.erase(name);
 }
 
@@ -2676,7 +2794,7 @@ void Empire::CheckResearchProgress() {
 }
 
 void Empire::CheckProductionProgress() {
-    Logger().debugStream() << "========Empire::CheckProductionProgress=======";
+    DebugLogger() << "========Empire::CheckProductionProgress=======";
     // following commented line should be redundant, as previous call to
     // UpdateResourcePools should have generated necessary info
     // m_production_queue.Update();
@@ -2705,7 +2823,7 @@ void Empire::CheckProductionProgress() {
         std::pair<ProductionQueue::ProductionItem, int> key(elem.item, location_id);
 
         if (queue_item_costs_and_times.find(key) == queue_item_costs_and_times.end())
-            queue_item_costs_and_times[key] = ProductionCostAndTime(elem);
+            queue_item_costs_and_times[key] = m_production_queue.ProductionCostAndTime(elem);
     }
 
     //for (std::map<std::pair<ProductionQueue::ProductionItem, int>, std::pair<float, int> >::const_iterator
@@ -2743,7 +2861,7 @@ void Empire::CheckProductionProgress() {
             elem.progress -= item_cost;
 
             elem.progress_memory = elem.progress;
-            Logger().debugStream() << "Completed an item: " << elem.item.name;
+            DebugLogger() << "Completed an item: " << elem.item.name;
 
             switch (elem.item.build_type) {
             case BT_BUILDING: {
@@ -2763,7 +2881,7 @@ void Empire::CheckProductionProgress() {
                 // that buildings being produced can prevent subsequent
                 // buildings completions on the same turn from going through
                 if (!this->ProducibleItem(elem.item, elem.location)) {
-                    Logger().debugStream() << "Location test failed for building " << elem.item.name << " on planet " << planet->Name();
+                    DebugLogger() << "Location test failed for building " << elem.item.name << " on planet " << planet->Name();
                     break;
                 }
 
@@ -2774,7 +2892,7 @@ void Empire::CheckProductionProgress() {
                 system->Insert(building);
 
                 AddSitRepEntry(CreateBuildingBuiltSitRep(building->ID(), planet->ID()));
-                Logger().debugStream() << "New Building created on turn: " << CurrentTurn();
+                DebugLogger() << "New Building created on turn: " << CurrentTurn();
                 break;
             }
 
@@ -2852,22 +2970,22 @@ void Empire::CheckProductionProgress() {
                 // add sitrep
                 if (elem.blocksize == 1) {
                     AddSitRepEntry(CreateShipBuiltSitRep(ship->ID(), system->ID(), ship->DesignID()));
-                    Logger().debugStream() << "New Ship, id " << ship->ID() << ", created on turn: " << ship->CreationTurn();
+                    DebugLogger() << "New Ship, id " << ship->ID() << ", created on turn: " << ship->CreationTurn();
                 } else {
                     AddSitRepEntry(CreateShipBlockBuiltSitRep(system->ID(), ship->DesignID(), elem.blocksize));
-                    Logger().debugStream() << "New block of "<< elem.blocksize << " ships created on turn: " << ship->CreationTurn();
+                    DebugLogger() << "New block of "<< elem.blocksize << " ships created on turn: " << ship->CreationTurn();
                 }
                 break;
             }
 
             default:
-                Logger().debugStream() << "Build item of unknown build type finished on production queue.";
+                DebugLogger() << "Build item of unknown build type finished on production queue.";
                 break;
             }
 
             if (!--m_production_queue[i].remaining) {   // decrement number of remaining items to be produced in current queue element
                 to_erase.push_back(i);                  // remember completed element so that it can be removed from queue
-                Logger().debugStream() << "Marking completed production queue item to be removed form queue";
+                DebugLogger() << "Marking completed production queue item to be removed form queue";
             }
         }
     }
@@ -2917,13 +3035,16 @@ void Empire::CheckProductionProgress() {
             // rename fleet, given its id and the ship that is in it
             fleet->Rename(Fleet::GenerateFleetName(ship_ids, fleet->ID()));
 
-            Logger().debugStream() << "New Fleet \"" + fleet->Name() + "\" created on turn: " << fleet->CreationTurn();
+            DebugLogger() << "New Fleet \"" + fleet->Name() + "\" created on turn: " << fleet->CreationTurn();
         }
     }
 
     // removed completed items from queue
     for (std::vector<int>::reverse_iterator it = to_erase.rbegin(); it != to_erase.rend(); ++it)
         m_production_queue.erase(*it);
+
+    // the objects produced may change the costs of other items
+    m_production_queue.ClearCachedCostsAndTimes();
 }
 
 void Empire::CheckTradeSocialProgress()
@@ -3005,6 +3126,8 @@ void Empire::UpdateResourcePools() {
     // updating queues, allocated_rp, distribution and growth each update their respective pools,
     // (as well as the ways in which the resources are used, which needs to be done
     // simultaneously to keep things consistent)
+    // production costs may have changed since they were cached, eg. due to effects
+    m_production_queue.ClearCachedCostsAndTimes();
     UpdateResearchQueue();
     UpdateProductionQueue();
     UpdateTradeSpending();
@@ -3018,7 +3141,7 @@ void Empire::UpdateResearchQueue() {
 }
 
 void Empire::UpdateProductionQueue() {
-    Logger().debugStream() << "========= Production Update for empire: " << EmpireID() << " ========";
+    DebugLogger() << "========= Production Update for empire: " << EmpireID() << " ========";
 
     m_resource_pools[RE_INDUSTRY]->Update();
     m_production_queue.Update();
@@ -222,6 +222,12 @@ struct FO_COMMON_API ProductionQueue {
 
     /** Returns an iterator to the underfunded production project, or end() if none exists. */
     const_iterator                  UnderfundedProject() const;
+
+    /** Returns the cost and number of turns to produce the item of \a element
+      * at its location, as Empire::ProductionCostAndTime() does.  Results are
+      * cached per item and location until the end of the current turn, or
+      * until ClearCachedCostsAndTimes() is called. */
+    std::pair<float, int>           ProductionCostAndTime(const Element& element) const;
     //@}
 
     /** \name Mutators */ //@{
@@ -232,6 +238,15 @@ struct FO_COMMON_API ProductionQueue {
       * in the universe. */
     void                            Update();
 
+    /** Recalculates the queue as Update() does, but with the PP available to
+      * each resource-sharing group \a available_pp, and the cost and time and
+      * producibility of each element in \a queue_element_costs_and_times and
+      * \a queue_element_producible, rather than determining them from the
+      * empire and universe. */
+    void                            Update(const std::map<std::set<int>, float>& available_pp,
+                                           const std::vector<std::pair<float, int> >& queue_element_costs_and_times,
+                                           const std::vector<bool>& queue_element_producible);
+
     // STL container-like interface
     void                            push_back(const Element& element);
     void                            insert(iterator it, const Element& element);
@@ -248,15 +263,61 @@ struct FO_COMMON_API ProductionQueue {
     /** Returns an iterator to the underfunded production project, or end() if none exists. */
     iterator                        UnderfundedProject();
 
+    /** Discards the cached results of ProductionCostAndTime().  Should be
+      * called when the gamestate changes in ways that may change production
+      * costs or times during a turn, such as when effects are applied. */
+    void                            ClearCachedCostsAndTimes();
+
     mutable boost::signals2::signal<void ()> ProductionQueueChangedSignal;
     //@}
 
 private:
+    /** The inputs to the projection of one queue element by the last Update(),
+      * its results, and the state of its resource sharing group after it was
+      * projected.  Update() only needs to project the elements of each group
+      * from the first element whose inputs have changed since the last
+      * Update(), and can resume from the state after the element before it. */
+    struct ProjectedElement {
+        ProjectedElement();
+
+        /** Returns true iff \a rhs has the same projection inputs. */
+        bool    SameInputs(const ProjectedElement& rhs) const;
+
+        /** Records the projection results of \a element, and the state of its
+          * group after it: the first turn with PP available and the PP
+          * available on each turn. */
+        void    SetProjected(const Element& element, unsigned int first_turn_pp_available_,
+                             const std::vector<float>& group_pp_still_available);
+
+        ProductionItem      item;
+        int                 location;
+        int                 blocksize;
+        int                 remaining;
+        float               progress;
+        float               item_cost;
+        int                 build_turns;
+        bool                simulated;                  ///< false if the element was not projected due to not being producible or not having PP available
+        bool                projected;                  ///< true if the element was simulated and the group state after it was recorded
+        int                 turns_left_to_next_item;
+        int                 turns_left_to_completion;
+        unsigned int        first_turn_pp_available;    ///< the first turn on which the element's group had PP available after the element
+        std::vector<float>  pp_still_available;         ///< the PP the element's group had available after the element, from first_turn_pp_available on
+    };
+
+    typedef std::map<std::pair<ProductionItem, int>, std::pair<float, int> > CostAndTimeMap;
+
     QueueType                       m_queue;
     int                             m_projects_in_progress;
     std::map<std::set<int>, float>  m_object_group_allocated_pp;
     int                             m_empire_id;
 
+    std::vector<ProjectedElement>   m_projection;               ///< projection of each queue element by the last Update()
+    std::map<std::set<int>, float>  m_projection_available_pp;  ///< the PP available to each group for the projection
+    int                             m_projection_turn;          ///< the turn on which the projection was made
+
+    mutable CostAndTimeMap          m_costs_and_times;          ///< cached results of ProductionCostAndTime(), indexed by item and location
+    mutable int                     m_costs_and_times_turn;     ///< the turn on which the cached costs and times were determined
+
     friend class boost::serialization::access;
     template <class Archive>
     void serialize(Archive& ar, const unsigned int version);
@@ -319,6 +380,7 @@ public:
     const       ResearchQueue& GetResearchQueue() const;                ///< Returns the queue of techs being or queued to be researched.
     float       ResearchProgress(const std::string& name) const;        ///< Returns the RPs spent towards tech \a name if it has partial research progress, or 0.0 if it is already researched.
     bool        TechResearched(const std::string& name) const;          ///< Returns true iff this tech has been completely researched.
+    bool        TechResearched(int name_id) const;                      ///< Returns true iff the tech whose name has interned id \a name_id has been completely researched.
     TechStatus  GetTechStatus(const std::string& name) const;           ///< Returns the status (researchable, researched, unresearchable) for this tech for this
 
     bool        BuildingTypeAvailable(const std::string& name) const;   ///< Returns true if the given building type is known to this empire, false if it is not
@@ -576,6 +638,9 @@ public:
 private:
     void        Init();
 
+    /** Rebuilds m_researched_tech_ids from m_techs. */
+    void        UpdateResearchedTechIDs();
+
     int                             m_id;                       ///< Empire's unique numeric id
     std::string                     m_name;                     ///< Empire's name
     std::string                     m_player_name;              ///< Empire's Player's name
@@ -583,6 +648,7 @@ private:
     int                             m_capital_id;               ///< the ID of the empire's capital planet
 
     std::set<std::string>           m_techs;                    ///< list of acquired technologies.  These are string names referencing Tech objects
+    std::vector<bool>               m_researched_tech_ids;      ///< flags indexed by the interned ids of the names in m_techs; kept in sync with m_techs
 
     std::map<std::string, Meter>    m_meters;                   ///< empire meters, including ratings scales used by species to judge empires
 
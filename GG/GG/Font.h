@@ -39,6 +39,7 @@
 
 #include <set>
 #include <stack>
+#include <vector>
 
 #include <boost/unordered_map.hpp>
 
@@ -323,6 +324,43 @@ public:
         std::stack<Clr> colors;
     };
 
+    /** \brief Holds the vertices, texture coordinates and colors of the
+        glyphs of a piece of laid-out text.
+
+        A RenderCache is filled by PreRenderText() and drawn by
+        RenderCachedText(), which draws all the glyphs that are in the same
+        texture with a single array draw call, rather than one quad at a time.
+        Text that does not change can be drawn repeatedly from the same
+        RenderCache, without redoing its layout. */
+    struct GG_API RenderCache
+    {
+        /** \brief The quads of the glyphs found in one texture. */
+        struct GG_API TextureBatch
+        {
+            TextureBatch(); ///< Default ctor.
+
+            const Texture*          texture;    ///< The texture containing the glyphs
+            std::vector<GLfloat>    vertices;   ///< Two coordinates per vertex, four vertices per glyph
+            std::vector<GLfloat>    tex_coords; ///< Two coordinates per vertex
+            std::vector<GLubyte>    colors;     ///< Four color components per vertex
+        };
+
+        /** Removes all glyphs and underlines. */
+        void Clear();
+
+        /** Returns true iff there are no glyphs or underlines. */
+        bool Empty() const;
+
+        /** The glyph quads, grouped by the texture containing them. */
+        std::vector<TextureBatch>   batches;
+
+        /** The untextured quads of any underlines. */
+        std::vector<GLfloat>        underline_vertices;
+
+        /** The colors of the underline vertices. */
+        std::vector<GLubyte>        underline_colors;
+    };
+
     /** \name Structors */ ///@{
     /** Ctor.  Construct a font using only the printable ASCII characters.
         \throw Font::Exception Throws a subclass of Font::Exception if the
@@ -409,6 +447,26 @@ public:
                     std::size_t begin_line, CPSize begin_char,
                     std::size_t end_line, CPSize end_char) const;
 
+    /** Fills \a cache with the glyphs that RenderText() would render for the
+        same parameters, using \a color for text that is not colored by
+        formatting tags.  Any previous contents of \a cache are removed. */
+    void PreRenderText(const Pt& pt1, const Pt& pt2, const std::string& text, Flags<TextFormat>& format,
+                       const std::vector<LineData>& line_data, Clr color, RenderCache& cache) const;
+
+    /** Fills \a cache with the glyphs that RenderText() would render for the
+        same parameters over a subset of lines and code points, using \a color
+        for text that is not colored by formatting tags.  Any previous contents
+        of \a cache are removed. */
+    void PreRenderText(const Pt& pt1, const Pt& pt2, const std::string& text, Flags<TextFormat>& format,
+                       const std::vector<LineData>& line_data, RenderState& render_state,
+                       std::size_t begin_line, CPSize begin_char,
+                       std::size_t end_line, CPSize end_char,
+                       Clr color, RenderCache& cache) const;
+
+    /** Renders the glyphs in \a cache, as filled by PreRenderText(), with
+        one array draw call per glyph texture, plus one for any underlines. */
+    void RenderCachedText(const RenderCache& cache) const;
+
     /** Sets \a render_state as if all the text before (<i>begin_line</i>,
         <i>begin_char</i>) had just been rendered. */
     void ProcessTagsBefore(const std::vector<LineData>& line_data, RenderState& render_state,
@@ -528,6 +586,8 @@ private:
     void              ValidateFormat(Flags<TextFormat>& format) const;
     inline X          RenderGlyph(const Pt& pt, const Glyph& glyph,
                                   const RenderState* render_state) const;
+    X                 StoreGlyph(const Pt& pt, const Glyph& glyph, const RenderState& render_state,
+                                 Clr color, RenderCache& cache) const;
     void              HandleTag(const boost::shared_ptr<FormattingTag>& tag, double* orig_color,
                                 RenderState& render_state) const;
     bool              IsDefaultFont();
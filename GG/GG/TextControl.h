@@ -260,6 +260,10 @@ private:
     bool                        m_fit_to_text; ///< when true, this window will maintain a minimum width and height that encloses the text
     Pt                          m_text_ul;     ///< stored relative to the control's UpperLeft()
     Pt                          m_text_lr;     ///< stored relative to the control's UpperLeft()
+    Font::RenderCache           m_render_cache;        ///< the glyphs of the text, laid out relative to the control's UpperLeft()
+    bool                        m_render_cache_valid;  ///< false when the text or its layout has changed since m_render_cache was filled
+    Pt                          m_render_cache_size;   ///< the size of the control when m_render_cache was filled
+    Clr                         m_render_cache_color;  ///< the text color with which m_render_cache was filled
 };
 
 } // namespace GG
@@ -0,0 +1,253 @@
+// -*- C++ -*-
+/* GG is a GUI for SDL and OpenGL.
+   Copyright (C) 2003-2008 T. Zachary Laine
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1
+   of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free
+   Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+   02111-1307 USA
+
+   If you do not wish to comply with the terms of the LGPL please
+   contact the author as other terms are available for a fee.
+
+   Zach Laine
+   whatwasthataddress@gmail.com */
+
+/** \file VirtualListBox.h \brief Contains the VirtualListBox class, a list
+    control that displays rows supplied by a data model, using only as many
+    row windows as are needed to cover the visible rows. */
+
+#ifndef _GG_VirtualListBox_h_
+#define _GG_VirtualListBox_h_
+
+#include <GG/ListBox.h>
+
+#include <set>
+#include <vector>
+
+
+namespace GG {
+
+class Scroll;
+
+/** \brief A list control for very large numbers of rows.
+
+    Unlike ListBox, which keeps a Row window for every row, VirtualListBox
+    gets its rows from a Model, and keeps only a small pool of row windows,
+    enough to cover the rows that are visible.  As the list is scrolled, the
+    row windows are moved and reused for other rows, by having the Model
+    update them to show those rows.  Rows are identified by their index in the
+    Model.
+
+    Finding the rows at a scroll position or a point is done by a binary
+    search over the cumulative row heights, and sorting rearranges only an
+    array of row indices, so neither depends on windows for rows that are not
+    visible.
+
+    The ListBoxStyle flags LIST_NOSEL, LIST_SINGLESEL, LIST_QUICKSEL,
+    LIST_NOSORT, LIST_SORTDESCENDING and LIST_BROWSEUPDATES have the same
+    meaning as for ListBox; the others are ignored. */
+class GG_API VirtualListBox : public Control
+{
+public:
+    /** \brief The source of the rows displayed by a VirtualListBox. */
+    class GG_API Model
+    {
+    public:
+        virtual ~Model(); ///< Virtual dtor.
+
+        /** Returns the number of rows. */
+        virtual std::size_t NumRows() const = 0;
+
+        /** Returns the height of row \a row. */
+        virtual Y           RowHeight(std::size_t row) const = 0;
+
+        /** Returns true iff row \a lhs should be shown before row \a rhs when
+            sorting by column \a column.  By default, rows are shown in index
+            order. */
+        virtual bool        RowLess(std::size_t lhs, std::size_t rhs, std::size_t column) const;
+
+        /** Returns a new window of width \a width that can display any row.
+            The VirtualListBox takes ownership of the window.  The window
+            should not be INTERACTIVE, so that mouse events in it go to the
+            VirtualListBox. */
+        virtual Wnd*        CreateRowWnd(X width) = 0;
+
+        /** Sets \a wnd, which was created by CreateRowWnd(), to display row
+            \a row.  \a selected is true iff the row is selected.  \a wnd has
+            already been sized to the width of the client area and the
+            height of the row. */
+        virtual void        UpdateRowWnd(Wnd* wnd, std::size_t row, bool selected) = 0;
+    };
+
+    typedef std::set<std::size_t> SelectionSet;
+
+    /** \name Signal Types */ ///@{
+    /** emitted when one or more rows are selected or deselected */
+    typedef boost::signals2::signal<void (const SelectionSet&)>     SelChangedSignalType;
+    /** emitted when a row is clicked; provides the row and the clicked point */
+    typedef boost::signals2::signal<void (std::size_t, const Pt&)>  RowClickSignalType;
+    /** emitted when a row is double-clicked or browsed (rolled over) */
+    typedef boost::signals2::signal<void (std::size_t)>             RowSignalType;
+    //@}
+
+    /** \name Structors */ ///@{
+    VirtualListBox(X x, Y y, X w, Y h, Clr color, Clr interior = CLR_ZERO,
+                   Flags<WndFlag> flags = INTERACTIVE);
+
+    ~VirtualListBox();
+    //@}
+
+    /** \name Accessors */ ///@{
+    virtual Pt          ClientUpperLeft() const;
+    virtual Pt          ClientLowerRight() const;
+
+    /** Returns the model, or 0 if none has been set. */
+    Model*              GetModel() const;
+
+    /** Returns the number of rows. */
+    std::size_t         NumRows() const;
+
+    /** Returns the row shown at position \a position in the list, from the
+        top, after sorting. */
+    std::size_t         RowAtPosition(std::size_t position) const;
+
+    /** Returns the row under screen point \a pt, or NumRows() if there is
+        none. */
+    std::size_t         RowUnderPt(const Pt& pt) const;
+
+    /** Returns the row shown at the top of the list, or NumRows() if there
+        are no rows. */
+    std::size_t         FirstRowShown() const;
+
+    /** Returns the selected rows. */
+    const SelectionSet& Selections() const;
+
+    /** Returns true iff row \a row is selected. */
+    bool                Selected(std::size_t row) const;
+
+    /** Returns the style flags of the list. \see GG::ListBoxStyle */
+    Flags<ListBoxStyle> Style() const;
+
+    /** Returns the column by which rows are sorted. */
+    std::size_t         SortCol() const;
+
+    /** Returns the color painted into the client area of the list. */
+    Clr                 InteriorColor() const;
+
+    /** Returns the color behind selected rows. */
+    Clr                 HiliteColor() const;
+
+    /** Returns the number of row windows, which is the most rows that have
+        been visible at once, rather than the number of rows. */
+    std::size_t         NumRowWnds() const;
+
+    mutable SelChangedSignalType    SelChangedSignal;       ///< the selection change signal object for this VirtualListBox
+    mutable RowClickSignalType      LeftClickedSignal;      ///< the left click signal object for this VirtualListBox
+    mutable RowClickSignalType      RightClickedSignal;     ///< the right click signal object for this VirtualListBox
+    mutable RowSignalType           DoubleClickedSignal;    ///< the double click signal object for this VirtualListBox
+    mutable RowSignalType           BrowsedSignal;          ///< the browsed signal object for this VirtualListBox
+    //@}
+
+    /** \name Mutators */ ///@{
+    virtual void    Render();
+    virtual void    SizeMove(const Pt& ul, const Pt& lr);
+    virtual void    LClick(const Pt& pt, Flags<ModKey> mod_keys);
+    virtual void    LDoubleClick(const Pt& pt, Flags<ModKey> mod_keys);
+    virtual void    RClick(const Pt& pt, Flags<ModKey> mod_keys);
+    virtual void    MouseHere(const Pt& pt, Flags<ModKey> mod_keys);
+    virtual void    MouseWheel(const Pt& pt, int move, Flags<ModKey> mod_keys);
+
+    /** Sets the model from which rows are shown to \a model, which is not
+        owned by the VirtualListBox and must outlive it, or be replaced.
+        Removes all existing row windows and selections. */
+    void            SetModel(Model* model);
+
+    /** Updates the list after rows have been added to or removed from the
+        model, or their heights or sort order have changed.  Selections are
+        removed. */
+    void            RowsReset();
+
+    /** Updates the visible row windows after the contents of rows have
+        changed, without the number, heights or order of rows changing. */
+    void            RowsChanged();
+
+    /** Sets the style flags of the list to \a s. \see GG::ListBoxStyle */
+    void            SetStyle(Flags<ListBoxStyle> s);
+
+    /** Sorts the rows by column \a n, unless LIST_NOSORT is in effect. */
+    void            SetSortCol(std::size_t n);
+
+    /** Sets the selected rows to \a s, emitting SelChangedSignal if
+        \a signal is true. */
+    void            SetSelections(const SelectionSet& s, bool signal = false);
+
+    /** Deselects all rows, emitting SelChangedSignal if \a signal is true. */
+    void            DeselectAll(bool signal = false);
+
+    /** Scrolls the list so that the row at position \a position is shown at
+        the top, or as near to it as scrolling allows. */
+    void            SetFirstRowShown(std::size_t position);
+
+    /** Scrolls the list as little as possible to show row \a row. */
+    void            BringRowIntoView(std::size_t row);
+
+    /** Sets the color painted into the client area of the list. */
+    void            SetInteriorColor(Clr c);
+
+    /** Sets the color behind selected rows. */
+    void            SetHiliteColor(Clr c);
+    //@}
+
+    static const unsigned int BORDER_THICK; ///< the thickness with which to render the border of the control
+
+protected:
+    /** \name Accessors */ ///@{
+    /** Returns the position in the list of the row at distance \a y from the
+        top of all the rows, or the number of rows if there is none. */
+    std::size_t     PositionAtOffset(Y y) const;
+    //@}
+
+private:
+    void            ResetRowOffsets();
+    void            SortRows();
+    void            AdjustScroll();
+    void            LayoutRowWnds(bool update_all);
+    void            VScrolled(int tab_low, int tab_high, int low, int high);
+    void            ClickAtRow(std::size_t row, Flags<ModKey> mod_keys);
+
+    Model*                      m_model;
+    Flags<ListBoxStyle>         m_style;
+    std::size_t                 m_sort_col;
+    Clr                         m_int_color;
+    Clr                         m_hilite_color;
+    Scroll*                     m_vscroll;
+
+    std::vector<std::size_t>    m_rows;             ///< the rows, by position in the list after sorting
+    std::vector<std::size_t>    m_row_positions;    ///< the position in the list of each row
+    std::vector<Y>              m_row_offsets;      ///< the distance from the top of all rows to the top of the row at each position, plus the total height at the end
+    Y                           m_scroll_offset;    ///< the distance from the top of all rows to the top of the client area
+
+    std::vector<Wnd*>           m_row_wnds;         ///< the pool of row windows
+    std::vector<std::size_t>    m_row_wnd_rows;     ///< the row each row window shows, or NumRows() if it is unused
+    std::vector<bool>           m_row_wnd_selected; ///< whether the row each row window shows was selected when last updated
+
+    SelectionSet                m_selections;
+    std::size_t                 m_last_clicked_row;
+    std::size_t                 m_lclick_row;
+    std::size_t                 m_browsed_row;
+};
+
+} // namespace GG
+
+#endif
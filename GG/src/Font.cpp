@@ -479,6 +479,24 @@ Font::RenderState::RenderState() :
 {}
 
 
+///////////////////////////////////////
+// class GG::Font::RenderCache
+///////////////////////////////////////
+Font::RenderCache::TextureBatch::TextureBatch() :
+    texture(0)
+{}
+
+void Font::RenderCache::Clear()
+{
+    batches.clear();
+    underline_vertices.clear();
+    underline_colors.clear();
+}
+
+bool Font::RenderCache::Empty() const
+{ return batches.empty() && underline_vertices.empty(); }
+
+
 ///////////////////////////////////////
 // class GG::Font::LineData::CharData
 ///////////////////////////////////////
@@ -626,13 +644,23 @@ X Font::RenderGlyph(const Pt& pt, boost::uint32_t c) const
 
 X Font::RenderText(const Pt& pt_, const std::string& text) const
 {
+    double orig_color[4];
+    glGetDoublev(GL_CURRENT_COLOR, orig_color);
+    Clr color = FloatClr(orig_color[0], orig_color[1], orig_color[2], orig_color[3]);
+
+    RenderState render_state;
+    RenderCache cache;
     Pt pt = pt_;
     X orig_x = pt.x;
     std::string::const_iterator it = text.begin();
     std::string::const_iterator end_it = text.end();
     while (it != end_it) {
-        pt.x += RenderGlyph(pt, utf8::next(it, end_it));
+        GlyphMap::const_iterator glyph_it = m_glyphs.find(utf8::next(it, end_it));
+        if (glyph_it == m_glyphs.end())
+            glyph_it = m_glyphs.find(WIDE_SPACE); // print a space when an unrendered glyph is requested
+        pt.x += StoreGlyph(pt, glyph_it->second, render_state, color, cache);
     }
+    RenderCachedText(cache);
     return pt.x - orig_x;
 }
 
@@ -662,8 +690,34 @@ void Font::RenderText(const Pt& ul, const Pt& lr, const std::string& text, Flags
     double orig_color[4];
     glGetDoublev(GL_CURRENT_COLOR, orig_color);
 
-    if (!render_state.colors.empty())
-        glColor(render_state.colors.top());
+    RenderCache cache;
+    PreRenderText(ul, lr, text, format, line_data, render_state, begin_line, begin_char, end_line, end_char,
+                  FloatClr(orig_color[0], orig_color[1], orig_color[2], orig_color[3]), cache);
+    RenderCachedText(cache);
+}
+
+void Font::PreRenderText(const Pt& ul, const Pt& lr, const std::string& text, Flags<TextFormat>& format,
+                         const std::vector<LineData>& line_data, Clr color, RenderCache& cache) const
+{
+    cache.Clear();
+    if (line_data.empty())
+        return;
+    RenderState render_state;
+    PreRenderText(ul, lr, text, format, line_data, render_state,
+                  0, CP0, line_data.size(), CPSize(line_data.back().char_data.size()), color, cache);
+}
+
+void Font::PreRenderText(const Pt& ul, const Pt& lr, const std::string& text, Flags<TextFormat>& format,
+                         const std::vector<LineData>& line_data, RenderState& render_state,
+                         std::size_t begin_line, CPSize begin_char,
+                         std::size_t end_line, CPSize end_char,
+                         Clr color, RenderCache& cache) const
+{
+    cache.Clear();
+
+    // HandleTag() sets the current color as it goes, which is restored below
+    double orig_color[4];
+    glGetDoublev(GL_CURRENT_COLOR, orig_color);
 
     Y y_origin = ul.y; // default value for FORMAT_TOP
     if (format & FORMAT_BOTTOM)
@@ -694,16 +748,72 @@ void Font::RenderText(const Pt& ul, const Pt& lr, const std::string& text, Flags
             if (c == WIDE_NEWLINE)
                 continue;
             GlyphMap::const_iterator it = m_glyphs.find(c);
-            if (it == m_glyphs.end())
+            if (it == m_glyphs.end()) {
                 x = x_origin + line.char_data[Value(j)].extent; // move forward by the extent of the character when a whitespace or unprintable glyph is requested
-            else
-                x += RenderGlyph(Pt(x, y), it->second, &render_state);
+            } else {
+                Clr glyph_color = render_state.colors.empty() ? color : render_state.colors.top();
+                x += StoreGlyph(Pt(x, y), it->second, render_state, glyph_color, cache);
+            }
         }
     }
 
     glColor4dv(orig_color);
 }
 
+void Font::RenderCachedText(const RenderCache& cache) const
+{
+    if (cache.Empty())
+        return;
+
+    // drawing with a color array leaves the current color undefined
+    double orig_color[4];
+    glGetDoublev(GL_CURRENT_COLOR, orig_color);
+
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+
+    for (std::size_t i = 0; i < cache.batches.size(); ++i) {
+        const RenderCache::TextureBatch& batch = cache.batches[i];
+        if (batch.vertices.empty() || !batch.texture->OpenGLId())
+            continue;
+
+        glBindTexture(GL_TEXTURE_2D, batch.texture->OpenGLId());
+
+        // glyphs are always drawn unscaled; as in Texture::OrthoBlit(), use
+        // nearest filtering so that they are reproduced exactly
+        bool need_min_filter_change = batch.texture->MinFilter() != GL_NEAREST;
+        bool need_mag_filter_change = batch.texture->MagFilter() != GL_NEAREST;
+        if (need_min_filter_change)
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        if (need_mag_filter_change)
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+        glVertexPointer(2, GL_FLOAT, 0, &batch.vertices[0]);
+        glTexCoordPointer(2, GL_FLOAT, 0, &batch.tex_coords[0]);
+        glColorPointer(4, GL_UNSIGNED_BYTE, 0, &batch.colors[0]);
+        glDrawArrays(GL_QUADS, 0, batch.vertices.size() / 2);
+
+        if (need_min_filter_change)
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, batch.texture->MinFilter());
+        if (need_mag_filter_change)
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, batch.texture->MagFilter());
+    }
+
+    if (!cache.underline_vertices.empty()) {
+        glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+        glDisable(GL_TEXTURE_2D);
+        glVertexPointer(2, GL_FLOAT, 0, &cache.underline_vertices[0]);
+        glColorPointer(4, GL_UNSIGNED_BYTE, 0, &cache.underline_colors[0]);
+        glDrawArrays(GL_QUADS, 0, cache.underline_vertices.size() / 2);
+        glEnable(GL_TEXTURE_2D);
+    }
+
+    glPopClientAttrib();
+    glColor4dv(orig_color);
+}
+
 void Font::ProcessTagsBefore(const std::vector<LineData>& line_data, RenderState& render_state,
                              std::size_t begin_line, CPSize begin_char) const
 {
@@ -1449,6 +1559,76 @@ X Font::RenderGlyph(const Pt& pt, const Glyph& glyph, const Font::RenderState* r
     return glyph.advance;
 }
 
+X Font::StoreGlyph(const Pt& pt, const Glyph& glyph, const Font::RenderState& render_state,
+                   Clr color, RenderCache& cache) const
+{
+    const Texture* texture = glyph.sub_texture.GetTexture();
+    if (texture) {
+        RenderCache::TextureBatch* batch = 0;
+        for (std::size_t i = 0; i < cache.batches.size() && !batch; ++i) {
+            if (cache.batches[i].texture == texture)
+                batch = &cache.batches[i];
+        }
+        if (!batch) {
+            cache.batches.push_back(RenderCache::TextureBatch());
+            batch = &cache.batches.back();
+            batch->texture = texture;
+        }
+
+        // italic glyphs are drawn to a rhombus instead of a rectangle
+        double italics_offset = render_state.use_italics ? m_italics_offset : 0.0;
+        double x1 = Value(pt.x + glyph.left_bearing);
+        double x2 = x1 + Value(glyph.sub_texture.Width());
+        double y1 = Value(pt.y + glyph.y_offset);
+        double y2 = y1 + Value(glyph.sub_texture.Height());
+        GLfloat vertices[8] = {
+            static_cast<GLfloat>(x1 + italics_offset), static_cast<GLfloat>(y1),
+            static_cast<GLfloat>(x2 + italics_offset), static_cast<GLfloat>(y1),
+            static_cast<GLfloat>(x2 - italics_offset), static_cast<GLfloat>(y2),
+            static_cast<GLfloat>(x1 - italics_offset), static_cast<GLfloat>(y2)
+        };
+        batch->vertices.insert(batch->vertices.end(), vertices, vertices + 8);
+
+        const GLfloat* tex_coords = glyph.sub_texture.TexCoords();
+        GLfloat quad_tex_coords[8] = {
+            tex_coords[0], tex_coords[1],
+            tex_coords[2], tex_coords[1],
+            tex_coords[2], tex_coords[3],
+            tex_coords[0], tex_coords[3]
+        };
+        batch->tex_coords.insert(batch->tex_coords.end(), quad_tex_coords, quad_tex_coords + 8);
+
+        for (int i = 0; i < 4; ++i) {
+            batch->colors.push_back(color.r);
+            batch->colors.push_back(color.g);
+            batch->colors.push_back(color.b);
+            batch->colors.push_back(color.a);
+        }
+    }
+
+    if (render_state.draw_underline) {
+        GLfloat x1 = Value(pt.x);
+        GLfloat y1 = Value(pt.y + m_height + m_descent) - m_underline_offset;
+        GLfloat x2 = x1 + Value(glyph.advance);
+        GLfloat y2 = y1 + m_underline_height;
+        GLfloat vertices[8] = {
+            x1, y2,
+            x1, y1,
+            x2, y1,
+            x2, y2
+        };
+        cache.underline_vertices.insert(cache.underline_vertices.end(), vertices, vertices + 8);
+        for (int i = 0; i < 4; ++i) {
+            cache.underline_colors.push_back(color.r);
+            cache.underline_colors.push_back(color.g);
+            cache.underline_colors.push_back(color.b);
+            cache.underline_colors.push_back(color.a);
+        }
+    }
+
+    return glyph.advance;
+}
+
 void Font::HandleTag(const boost::shared_ptr<FormattingTag>& tag, double* orig_color,
                      RenderState& render_state) const
 {
@@ -45,7 +45,8 @@ TextControl::TextControl() :
     m_clip_text(false),
     m_set_min_size(false),
     m_code_points(0),
-    m_fit_to_text(false)
+    m_fit_to_text(false),
+    m_render_cache_valid(false)
 {}
 
 TextControl::TextControl(X x, Y y, X w, Y h, const std::string& str, const boost::shared_ptr<Font>& font, Clr color/* = CLR_BLACK*/,
@@ -57,7 +58,8 @@ TextControl::TextControl(X x, Y y, X w, Y h, const std::string& str, const boost
     m_set_min_size(false),
     m_code_points(0),
     m_font(font),
-    m_fit_to_text(false)
+    m_fit_to_text(false),
+    m_render_cache_valid(false)
 {
     ValidateFormat();
     SetText(str);
@@ -72,7 +74,8 @@ TextControl::TextControl(X x, Y y, const std::string& str, const boost::shared_p
     m_set_min_size(false),
     m_code_points(0),
     m_font(font),
-    m_fit_to_text(true)
+    m_fit_to_text(true),
+    m_render_cache_valid(false)
 {
     ValidateFormat();
     SetText(str);
@@ -128,9 +131,21 @@ void TextControl::Render()
     Clr clr_to_use = Disabled() ? DisabledColor(TextColor()) : TextColor();
     glColor(clr_to_use);
     if (m_font) {
+        // the glyph quads are laid out relative to the control, so that they
+        // need only be redone when the text, size or color changes
+        if (!m_render_cache_valid || m_render_cache_size != Size() || m_render_cache_color != clr_to_use) {
+            m_font->PreRenderText(Pt(X0, Y0), Size(), m_text, m_format, m_line_data, clr_to_use, m_render_cache);
+            m_render_cache_valid = true;
+            m_render_cache_size = Size();
+            m_render_cache_color = clr_to_use;
+        }
         if (m_clip_text)
             BeginClipping();
-        m_font->RenderText(UpperLeft(), LowerRight(), m_text, m_format, &m_line_data);
+        Pt ul = UpperLeft();
+        glPushMatrix();
+        glTranslated(Value(ul.x), Value(ul.y), 0.0);
+        m_font->RenderCachedText(m_render_cache);
+        glPopMatrix();
         if (m_clip_text)
             EndClipping();
     }
@@ -139,6 +154,7 @@ void TextControl::Render()
 void TextControl::SetText(const std::string& str)
 {
     m_text = str;
+    m_render_cache_valid = false;
     if (m_font) {
         m_code_points = CPSize(utf8::distance(str.begin(), str.end()));
         m_text_elements.clear();
@@ -177,6 +193,7 @@ void TextControl::SizeMove(const Pt& ul, const Pt& lr)
         }
         m_text_ul = Pt();
         m_text_lr = text_sz;
+        m_render_cache_valid = false;
         AdjustMinimumSize();
     }
     RecomputeTextBounds();
@@ -186,6 +203,7 @@ void TextControl::SetTextFormat(Flags<TextFormat> format)
 {
     m_format = format;
     ValidateFormat();
+    m_render_cache_valid = false;
     if (m_format != format)
         SetText(m_text);
 }
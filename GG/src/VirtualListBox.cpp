@@ -0,0 +1,471 @@
+/* GG is a GUI for SDL and OpenGL.
+   Copyright (C) 2003-2008 T. Zachary Laine
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1
+   of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free
+   Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+   02111-1307 USA
+
+   If you do not wish to comply with the terms of the LGPL please
+   contact the author as other terms are available for a fee.
+
+   Zach Laine
+   whatwasthataddress@gmail.com */
+
+#include <GG/VirtualListBox.h>
+
+#include <GG/DrawUtil.h>
+#include <GG/Scroll.h>
+#include <GG/StyleFactory.h>
+#include <GG/WndEvent.h>
+
+#include <boost/next_prior.hpp>
+
+#include <algorithm>
+
+
+using namespace GG;
+
+namespace {
+    const int SCROLL_WIDTH = 14;
+
+    class RowSorter // orders rows by the model's comparison of a certain column
+    {
+    public:
+        RowSorter(const VirtualListBox::Model& model, std::size_t column, bool descending) :
+            m_model(model),
+            m_column(column),
+            m_descending(descending)
+        {}
+
+        bool operator()(std::size_t lhs, std::size_t rhs) const
+        { return m_descending ? m_model.RowLess(rhs, lhs, m_column) : m_model.RowLess(lhs, rhs, m_column); }
+
+    private:
+        const VirtualListBox::Model&    m_model;
+        std::size_t                     m_column;
+        bool                            m_descending;
+    };
+}
+
+////////////////////////////////////////////////
+// GG::VirtualListBox::Model
+////////////////////////////////////////////////
+VirtualListBox::Model::~Model()
+{}
+
+bool VirtualListBox::Model::RowLess(std::size_t lhs, std::size_t rhs, std::size_t column) const
+{ return lhs < rhs; }
+
+
+////////////////////////////////////////////////
+// GG::VirtualListBox
+////////////////////////////////////////////////
+// static(s)
+const unsigned int VirtualListBox::BORDER_THICK = 2;
+
+VirtualListBox::VirtualListBox(X x, Y y, X w, Y h, Clr color, Clr interior/* = CLR_ZERO*/,
+                               Flags<WndFlag> flags/* = INTERACTIVE*/) :
+    Control(x, y, w, h, flags),
+    m_model(0),
+    m_style(LIST_NONE),
+    m_sort_col(0),
+    m_int_color(interior),
+    m_hilite_color(CLR_SHADOW),
+    m_vscroll(0),
+    m_rows(),
+    m_row_positions(),
+    m_row_offsets(1, Y0),
+    m_scroll_offset(Y0),
+    m_row_wnds(),
+    m_row_wnd_rows(),
+    m_row_wnd_selected(),
+    m_selections(),
+    m_last_clicked_row(0),
+    m_lclick_row(0),
+    m_browsed_row(0)
+{
+    Control::SetColor(color);
+    SetChildClippingMode(ClipToClientAndWindowSeparately);
+}
+
+VirtualListBox::~VirtualListBox()
+{}
+
+Pt VirtualListBox::ClientUpperLeft() const
+{ return UpperLeft() + Pt(X(BORDER_THICK), Y(BORDER_THICK)); }
+
+Pt VirtualListBox::ClientLowerRight() const
+{ return LowerRight() - Pt(static_cast<int>(BORDER_THICK) + X(m_vscroll ? SCROLL_WIDTH : 0), Y(BORDER_THICK)); }
+
+VirtualListBox::Model* VirtualListBox::GetModel() const
+{ return m_model; }
+
+std::size_t VirtualListBox::NumRows() const
+{ return m_rows.size(); }
+
+std::size_t VirtualListBox::RowAtPosition(std::size_t position) const
+{ return position < m_rows.size() ? m_rows[position] : m_rows.size(); }
+
+std::size_t VirtualListBox::RowUnderPt(const Pt& pt) const
+{
+    if (!InClient(pt))
+        return m_rows.size();
+    return RowAtPosition(PositionAtOffset(m_scroll_offset + (pt.y - ClientUpperLeft().y)));
+}
+
+std::size_t VirtualListBox::FirstRowShown() const
+{ return RowAtPosition(PositionAtOffset(m_scroll_offset)); }
+
+const VirtualListBox::SelectionSet& VirtualListBox::Selections() const
+{ return m_selections; }
+
+bool VirtualListBox::Selected(std::size_t row) const
+{ return m_selections.find(row) != m_selections.end(); }
+
+Flags<ListBoxStyle> VirtualListBox::Style() const
+{ return m_style; }
+
+std::size_t VirtualListBox::SortCol() const
+{ return m_sort_col; }
+
+Clr VirtualListBox::InteriorColor() const
+{ return m_int_color; }
+
+Clr VirtualListBox::HiliteColor() const
+{ return m_hilite_color; }
+
+std::size_t VirtualListBox::NumRowWnds() const
+{ return m_row_wnds.size(); }
+
+void VirtualListBox::Render()
+{
+    Pt ul = UpperLeft(), lr = LowerRight();
+    Clr color_to_use = Disabled() ? DisabledColor(Color()) : Color();
+    Clr int_color_to_use = Disabled() ? DisabledColor(m_int_color) : m_int_color;
+    Clr hilite_color_to_use = Disabled() ? DisabledColor(m_hilite_color) : m_hilite_color;
+
+    BeveledRectangle(ul, lr, int_color_to_use, color_to_use, false, BORDER_THICK);
+
+    // draw selection hiliting behind the visible selected rows
+    if (m_selections.empty())
+        return;
+    Pt cl_ul = ClientUpperLeft(), cl_lr = ClientLowerRight();
+    BeginClipping();
+    for (std::size_t i = 0; i < m_row_wnds.size(); ++i) {
+        if (m_row_wnd_rows[i] == m_rows.size() || !Selected(m_row_wnd_rows[i]))
+            continue;
+        Pt row_ul = m_row_wnds[i]->UpperLeft();
+        Pt row_lr = m_row_wnds[i]->LowerRight();
+        FlatRectangle(Pt(cl_ul.x, row_ul.y), Pt(cl_lr.x, row_lr.y), hilite_color_to_use, CLR_ZERO, 0);
+    }
+    EndClipping();
+}
+
+void VirtualListBox::SizeMove(const Pt& ul, const Pt& lr)
+{
+    Pt old_size = Size();
+    Wnd::SizeMove(ul, lr);
+    if (Size() != old_size) {
+        AdjustScroll();
+        LayoutRowWnds(true);
+    }
+}
+
+void VirtualListBox::LClick(const Pt& pt, Flags<ModKey> mod_keys)
+{
+    if (Disabled())
+        return;
+    std::size_t row = RowUnderPt(pt);
+    if (row == m_rows.size())
+        return;
+    if (!(m_style & LIST_NOSEL))
+        ClickAtRow(row, mod_keys);
+    m_lclick_row = row;
+    LeftClickedSignal(row, pt);
+}
+
+void VirtualListBox::LDoubleClick(const Pt& pt, Flags<ModKey> mod_keys)
+{
+    if (Disabled())
+        return;
+    std::size_t row = RowUnderPt(pt);
+    if (row != m_rows.size() && row == m_lclick_row)
+        DoubleClickedSignal(row);
+    else
+        LClick(pt, mod_keys);
+}
+
+void VirtualListBox::RClick(const Pt& pt, Flags<ModKey> mod_keys)
+{
+    if (Disabled())
+        return;
+    std::size_t row = RowUnderPt(pt);
+    if (row != m_rows.size())
+        RightClickedSignal(row, pt);
+}
+
+void VirtualListBox::MouseHere(const Pt& pt, Flags<ModKey> mod_keys)
+{
+    if (Disabled() || !(m_style & LIST_BROWSEUPDATES))
+        return;
+    std::size_t row = RowUnderPt(pt);
+    if (row != m_rows.size() && row != m_browsed_row) {
+        m_browsed_row = row;
+        BrowsedSignal(row);
+    }
+}
+
+void VirtualListBox::MouseWheel(const Pt& pt, int move, Flags<ModKey> mod_keys)
+{
+    if (Disabled() || !m_vscroll)
+        return;
+    m_vscroll->ScrollLineIncr(-move);
+    SignalScroll(*m_vscroll, true);
+}
+
+void VirtualListBox::SetModel(Model* model)
+{
+    for (std::size_t i = 0; i < m_row_wnds.size(); ++i)
+        DeleteChild(m_row_wnds[i]);
+    m_row_wnds.clear();
+    m_row_wnd_rows.clear();
+    m_row_wnd_selected.clear();
+    m_model = model;
+    RowsReset();
+}
+
+void VirtualListBox::RowsReset()
+{
+    bool had_selections = !m_selections.empty();
+    m_selections.clear();
+    m_last_clicked_row = 0;
+    m_lclick_row = m_browsed_row = m_model ? m_model->NumRows() : 0;
+    SortRows();
+    ResetRowOffsets();
+    AdjustScroll();
+    LayoutRowWnds(true);
+    if (had_selections)
+        SelChangedSignal(m_selections);
+}
+
+void VirtualListBox::RowsChanged()
+{ LayoutRowWnds(true); }
+
+void VirtualListBox::SetStyle(Flags<ListBoxStyle> s)
+{
+    Flags<ListBoxStyle> old_style = m_style;
+    m_style = s;
+    if ((old_style & (LIST_NOSORT | LIST_SORTDESCENDING)) != (m_style & (LIST_NOSORT | LIST_SORTDESCENDING))) {
+        SortRows();
+        ResetRowOffsets();
+        LayoutRowWnds(true);
+    }
+    if (m_style & LIST_NOSEL)
+        DeselectAll();
+    else if ((m_style & LIST_SINGLESEL) && 1u < m_selections.size())
+        SetSelections(SelectionSet(m_selections.begin(), boost::next(m_selections.begin())));
+}
+
+void VirtualListBox::SetSortCol(std::size_t n)
+{
+    if (n == m_sort_col)
+        return;
+    m_sort_col = n;
+    if (m_style & LIST_NOSORT)
+        return;
+    SortRows();
+    ResetRowOffsets();
+    LayoutRowWnds(true);
+}
+
+void VirtualListBox::SetSelections(const SelectionSet& s, bool signal/* = false*/)
+{
+    if (s == m_selections)
+        return;
+    m_selections = s;
+    LayoutRowWnds(false);
+    if (signal)
+        SelChangedSignal(m_selections);
+}
+
+void VirtualListBox::DeselectAll(bool signal/* = false*/)
+{ SetSelections(SelectionSet(), signal); }
+
+void VirtualListBox::SetFirstRowShown(std::size_t position)
+{
+    if (m_rows.empty())
+        return;
+    position = std::min(position, m_rows.size() - 1);
+    if (m_vscroll) {
+        m_vscroll->ScrollTo(Value(m_row_offsets[position]));
+        SignalScroll(*m_vscroll, true);
+    }
+}
+
+void VirtualListBox::BringRowIntoView(std::size_t row)
+{
+    if (row >= m_rows.size() || !m_vscroll)
+        return;
+    std::size_t position = m_row_positions[row];
+    Y client_height = ClientHeight();
+    if (m_row_offsets[position] < m_scroll_offset)
+        m_vscroll->ScrollTo(Value(m_row_offsets[position]));
+    else if (m_scroll_offset + client_height < m_row_offsets[position + 1])
+        m_vscroll->ScrollTo(Value(m_row_offsets[position + 1] - client_height));
+    else
+        return;
+    SignalScroll(*m_vscroll, true);
+}
+
+void VirtualListBox::SetInteriorColor(Clr c)
+{ m_int_color = c; }
+
+void VirtualListBox::SetHiliteColor(Clr c)
+{ m_hilite_color = c; }
+
+std::size_t VirtualListBox::PositionAtOffset(Y y) const
+{
+    if (y < Y0)
+        return 0;
+    // m_row_offsets is sorted, so the position whose extent contains y is
+    // found by binary search
+    std::vector<Y>::const_iterator it = std::upper_bound(m_row_offsets.begin(), m_row_offsets.end(), y);
+    std::size_t position = (it - m_row_offsets.begin()) - 1;
+    return std::min(position, m_rows.size());
+}
+
+void VirtualListBox::ResetRowOffsets()
+{
+    m_row_offsets.resize(m_rows.size() + 1);
+    m_row_offsets[0] = Y0;
+    for (std::size_t position = 0; position < m_rows.size(); ++position)
+        m_row_offsets[position + 1] = m_row_offsets[position] + m_model->RowHeight(m_rows[position]);
+}
+
+void VirtualListBox::SortRows()
+{
+    std::size_t num_rows = m_model ? m_model->NumRows() : 0;
+    m_rows.resize(num_rows);
+    for (std::size_t row = 0; row < num_rows; ++row)
+        m_rows[row] = row;
+    if (m_model && !(m_style & LIST_NOSORT))
+        std::stable_sort(m_rows.begin(), m_rows.end(), RowSorter(*m_model, m_sort_col, m_style & LIST_SORTDESCENDING));
+    m_row_positions.resize(num_rows);
+    for (std::size_t position = 0; position < num_rows; ++position)
+        m_row_positions[m_rows[position]] = position;
+}
+
+void VirtualListBox::AdjustScroll()
+{
+    Y visible_height = Height() - static_cast<int>(2 * BORDER_THICK);
+    Y total_height = m_row_offsets.back();
+    bool vertical_needed = visible_height < total_height;
+
+    if (m_vscroll && !vertical_needed) {
+        DeleteChild(m_vscroll);
+        m_vscroll = 0;
+    } else if (vertical_needed) {
+        X scroll_x = Width() - static_cast<int>(2 * BORDER_THICK) - SCROLL_WIDTH;
+        if (!m_vscroll) {
+            m_vscroll = GetStyleFactory()->NewListBoxVScroll(scroll_x, Y0, X(SCROLL_WIDTH), visible_height,
+                                                             Color(), CLR_SHADOW);
+            m_vscroll->NonClientChild(true);
+            AttachChild(m_vscroll);
+            Connect(m_vscroll->ScrolledSignal, &VirtualListBox::VScrolled, this);
+        } else {
+            m_vscroll->SizeMove(Pt(scroll_x, Y0), Pt(scroll_x + SCROLL_WIDTH, visible_height));
+        }
+        unsigned int line_size = m_rows.empty() ? 1u : std::max(1, Value(m_row_offsets[1]));
+        unsigned int page_size = std::max(1, Value(visible_height));
+        m_vscroll->SizeScroll(0, Value(total_height - 1), line_size, std::max(line_size, page_size));
+    }
+
+    // keep the scroll position within range, as the rows may now be shorter
+    Y max_offset = std::max(Y0, total_height - visible_height);
+    m_scroll_offset = std::min(m_scroll_offset, max_offset);
+    if (m_vscroll)
+        m_vscroll->ScrollTo(Value(m_scroll_offset));
+}
+
+void VirtualListBox::LayoutRowWnds(bool update_all)
+{
+    std::size_t num_rows = m_rows.size();
+    std::size_t first_position = PositionAtOffset(m_scroll_offset);
+    Y client_height = ClientHeight();
+    X client_width = ClientWidth();
+
+    std::size_t i = 0;
+    for (std::size_t position = first_position;
+         position < num_rows && m_row_offsets[position] < m_scroll_offset + client_height;
+         ++position, ++i)
+    {
+        if (i == m_row_wnds.size()) {
+            Wnd* wnd = m_model->CreateRowWnd(client_width);
+            AttachChild(wnd);
+            m_row_wnds.push_back(wnd);
+            m_row_wnd_rows.push_back(num_rows);
+            m_row_wnd_selected.push_back(false);
+        }
+        Wnd* wnd = m_row_wnds[i];
+        std::size_t row = m_rows[position];
+        bool selected = Selected(row);
+        Y row_height = m_row_offsets[position + 1] - m_row_offsets[position];
+        if (wnd->Size() != Pt(client_width, row_height))
+            wnd->Resize(Pt(client_width, row_height));
+        wnd->MoveTo(Pt(X0, m_row_offsets[position] - m_scroll_offset));
+        if (update_all || m_row_wnd_rows[i] != row || m_row_wnd_selected[i] != selected) {
+            m_model->UpdateRowWnd(wnd, row, selected);
+            m_row_wnd_rows[i] = row;
+            m_row_wnd_selected[i] = selected;
+        }
+        wnd->Show();
+    }
+
+    // hide the row windows that aren't needed
+    for (; i < m_row_wnds.size(); ++i) {
+        m_row_wnds[i]->Hide();
+        m_row_wnd_rows[i] = num_rows;
+    }
+}
+
+void VirtualListBox::VScrolled(int tab_low, int tab_high, int low, int high)
+{
+    m_scroll_offset = Y(tab_low);
+    LayoutRowWnds(false);
+}
+
+void VirtualListBox::ClickAtRow(std::size_t row, Flags<ModKey> mod_keys)
+{
+    SelectionSet selections = m_selections;
+    if (m_style & LIST_SINGLESEL) {
+        selections.clear();
+        selections.insert(row);
+    } else if ((mod_keys & MOD_KEY_SHIFT) && m_last_clicked_row < m_rows.size()) {
+        // select the range of positions between the last clicked row and this one
+        std::size_t low = std::min(m_row_positions[m_last_clicked_row], m_row_positions[row]);
+        std::size_t high = std::max(m_row_positions[m_last_clicked_row], m_row_positions[row]);
+        if (!(mod_keys & MOD_KEY_CTRL))
+            selections.clear();
+        for (std::size_t position = low; position <= high; ++position)
+            selections.insert(m_rows[position]);
+    } else if ((m_style & LIST_QUICKSEL) || (mod_keys & MOD_KEY_CTRL)) {
+        if (!selections.erase(row))
+            selections.insert(row);
+    } else {
+        selections.clear();
+        selections.insert(row);
+    }
+    m_last_clicked_row = row;
+    SetSelections(selections, true);
+}
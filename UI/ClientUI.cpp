@@ -631,7 +631,9 @@ bool ClientUI::ZoomToField(int id) {
 }
 
 bool ClientUI::ZoomToCombatLog(int id) {
-    if (GetCombatLogManager().LogAvailable(id)) {
+    // logs that aren't available yet are requested by the encyclopedia
+    // panel, which displays them once they arrive
+    if (GetCombatLogManager().LogAvailable(id) || GetCombatLogManager().LogExists(id)) {
         m_map_wnd->ShowCombatLog(id);
         return true;
     }
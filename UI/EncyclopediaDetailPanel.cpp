@@ -222,10 +222,9 @@ namespace {
             }
 
         } else if (dir_name == "ENC_GRAPH") {
-            const std::map<std::string, std::map<int, std::map<int, double> > >&
-                stat_records = universe.GetStatRecords();
-            for (std::map<std::string, std::map<int, std::map<int, double> > >::const_iterator
-                 it = stat_records.begin(); it != stat_records.end(); ++it)
+            const StatHistory::StatColumnMap& stat_columns = universe.GetStatHistory().Columns();
+            for (StatHistory::StatColumnMap::const_iterator it = stat_columns.begin();
+                 it != stat_columns.end(); ++it)
             { sorted_entries_list.insert(std::make_pair(UserString(it->first),   LinkTaggedText(TextLinker::GRAPH_TAG, it->first) + "\n")); }
 
         } else {
@@ -1691,6 +1690,22 @@ namespace {
     {
         int log_id = boost::lexical_cast<int>(item_name);
         bool available = CombatLogAvailable(log_id);
+        if (!available && HumanClientApp::GetApp()->CombatLogUnavailable(log_id)) {
+            name = UserString("ENC_COMBAT_LOG");
+            texture = ClientUI::GetTexture(ClientUI::ArtDir() / "/icons/sitrep/combat.png", true);
+            general_type = UserString("ENC_COMBAT_LOG");
+            detailed_description = UserString("ENC_COMBAT_LOG_UNAVAILABLE");
+            return;
+        }
+        if (!available && GetCombatLogManager().LogExists(log_id)) {
+            // fetch the log from the server; the panel is refreshed when it arrives
+            HumanClientApp::GetApp()->RequestCombatLog(log_id);
+            name = UserString("ENC_COMBAT_LOG");
+            texture = ClientUI::GetTexture(ClientUI::ArtDir() / "/icons/sitrep/combat.png", true);
+            general_type = UserString("ENC_COMBAT_LOG");
+            detailed_description = UserString("ENC_COMBAT_LOG_LOADING");
+            return;
+        }
         if (!available) {
             Logger().errorStream() << "EncyclopediaDetailPanel::Refresh couldn't find combat log with id: " << item_name;
             return;
@@ -1856,17 +1871,15 @@ void EncyclopediaDetailPanel::Refresh() {
     if (m_items_it->first == TextLinker::GRAPH_TAG) {
         const std::string& graph_id = m_items_it->second;
 
-        const std::map<std::string, std::map<int, std::map<int, double> > >&
-            stat_records = GetUniverse().GetStatRecords();
+        const StatHistory::StatColumnMap& stat_columns = GetUniverse().GetStatHistory().Columns();
 
-        std::map<std::string, std::map<int, std::map<int, double> > >::const_iterator
-            stat_name_it = stat_records.find(graph_id);
-        if (stat_name_it != stat_records.end()) {
-            const std::map<int, std::map<int, double> >& empire_lines = stat_name_it->second;
+        StatHistory::StatColumnMap::const_iterator stat_name_it = stat_columns.find(graph_id);
+        if (stat_name_it != stat_columns.end()) {
+            const StatHistory::EmpireColumnMap& empire_lines = stat_name_it->second;
             m_graph->Clear();
 
             // add lines for each empire
-            for (std::map<int, std::map<int, double> >::const_iterator empire_it = empire_lines.begin();
+            for (StatHistory::EmpireColumnMap::const_iterator empire_it = empire_lines.begin();
                  empire_it != empire_lines.end(); ++empire_it)
             {
                 int empire_id = empire_it->first;
@@ -1875,12 +1888,8 @@ void EncyclopediaDetailPanel::Refresh() {
                 if (const Empire* empire = Empires().Lookup(empire_id))
                     empire_clr = empire->Color();
 
-                const std::map<int, double>& empire_line = empire_it->second;
-                // convert formats...
                 std::vector<std::pair<double, double> > line_data_pts;
-                for (std::map<int, double>::const_iterator line_it = empire_line.begin();
-                     line_it != empire_line.end(); ++line_it)
-                { line_data_pts.push_back(std::make_pair<double, double>(line_it->first, line_it->second)); }
+                empire_it->second.GetPoints(line_data_pts);
 
                 m_graph->AddSeries(line_data_pts, empire_clr);
             }
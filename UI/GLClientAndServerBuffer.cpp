@@ -15,6 +15,15 @@
 #include "../client/human/HumanClientApp.h"
 
 
+namespace {
+    // client side arrays are only used if no server buffer is bound, as
+    // one may remain bound after drawing from another buffer
+    void UnbindServerBuffer() {
+        if (HumanClientApp::GetApp()->GLVersion() >= 1.5f)
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////
 // implementation for GLBufferBase
 ///////////////////////////////////////////////////////////////////////////
@@ -143,6 +152,7 @@ void GLRGBAColorBuffer::activate(void) const
     }
     else
     {
+        UnbindServerBuffer();
         glColorPointer(4, GL_UNSIGNED_BYTE, 0, &b_data[0]);
     }
 }
@@ -166,6 +176,7 @@ void GL2DVertexBuffer::activate(void) const
     }
     else
     {
+        UnbindServerBuffer();
         glVertexPointer(2, GL_FLOAT, 0, &b_data[0]);
     }
 }
@@ -187,6 +198,7 @@ void GLTexCoordBuffer::activate(void) const
     }
     else
     {
+        UnbindServerBuffer();
         glTexCoordPointer(2, GL_FLOAT, 0, &b_data[0]);
     }
 }
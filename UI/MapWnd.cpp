@@ -55,6 +55,8 @@
 #include <GG/WndEvent.h>
 #include <GG/Layout.h>
 
+#include <algorithm>
+#include <functional>
 #include <vector>
 #include <deque>
 #include <valarray>
@@ -227,9 +229,84 @@ namespace {
                                                          dist_along_lane);
     }
 
-    /* Updated each frame to shift rendered posistion of dots that are drawn to
-     * show fleet move lines. */
-    double move_line_animation_shift = 0.0;   // in pixels
+    /* Number of slices into which circles drawn from vertex buffers are
+     * divided.  Divisible by 12, so that ETA indicator wedges are whole
+     * numbers of slices. */
+    const int CIRCLE_SLICES = 48;
+
+    /* Returns the coordinates of CIRCLE_SLICES + 1 points around the unit
+     * circle, going clockwise on screen from angle 0, as CircleArc does. */
+    const std::vector<std::pair<double, double> >& UnitCirclePoints() {
+        static std::vector<std::pair<double, double> > points;
+        if (points.empty()) {
+            const double TWO_PI = 2.0*3.1415926536;
+            for (int i = 0; i <= CIRCLE_SLICES; ++i) {
+                double theta = TWO_PI * i / CIRCLE_SLICES;
+                points.push_back(std::make_pair(std::cos(-theta), std::sin(-theta)));
+            }
+        }
+        return points;
+    }
+
+    /* Stores in \a vertices the GL_TRIANGLES that fill a circle of radius
+     * \a radius centred at (\a x, \a y). */
+    void StoreCircleTriangles(GL2DVertexBuffer& vertices, double x, double y, double radius) {
+        const std::vector<std::pair<double, double> >& points = UnitCirclePoints();
+        for (int i = 0; i < CIRCLE_SLICES; ++i) {
+            vertices.store(static_cast<float>(x), static_cast<float>(y));
+            vertices.store(static_cast<float>(x + radius * points[i].first),
+                           static_cast<float>(y + radius * points[i].second));
+            vertices.store(static_cast<float>(x + radius * points[i + 1].first),
+                           static_cast<float>(y + radius * points[i + 1].second));
+        }
+    }
+
+    /* Stores in \a vertices the GL_LINES that outline a circle of radius
+     * \a radius centred at (\a x, \a y). */
+    void StoreCircleLines(GL2DVertexBuffer& vertices, double x, double y, double radius) {
+        const std::vector<std::pair<double, double> >& points = UnitCirclePoints();
+        for (int i = 0; i < CIRCLE_SLICES; ++i) {
+            vertices.store(static_cast<float>(x + radius * points[i].first),
+                           static_cast<float>(y + radius * points[i].second));
+            vertices.store(static_cast<float>(x + radius * points[i + 1].first),
+                           static_cast<float>(y + radius * points[i + 1].second));
+        }
+    }
+
+    /* Returns the GL_TRIANGLES that fill a unit circle centred at the origin,
+     * as a vertex array. */
+    const GL2DVertexBuffer& UnitDiscTriangles() {
+        static GL2DVertexBuffer vertices;
+        if (!vertices.size())
+            StoreCircleTriangles(vertices, 0.0, 0.0, 1.0);
+        return vertices;
+    }
+
+    /* Returns the glyphs of \a text in \a font and \a colour, centred in a
+     * box of half size \a half_size about the origin.  These are kept, as
+     * there are only a few different ETA texts. */
+    const GG::Font::RenderCache& CenteredTextRenderCache(const boost::shared_ptr<GG::Font>& font,
+                                                         const std::string& text, GG::Clr colour,
+                                                         int half_size)
+    {
+        // keyed by the font's shared_ptr, which keeps the font and so the
+        // glyph textures that the caches refer to alive
+        typedef std::pair<std::pair<boost::shared_ptr<GG::Font>, std::string>, std::pair<GG::Clr, int> > CacheKey;
+        static std::map<CacheKey, GG::Font::RenderCache> caches;
+        CacheKey key(std::make_pair(font, text), std::make_pair(colour, half_size));
+        std::map<CacheKey, GG::Font::RenderCache>::iterator it = caches.find(key);
+        if (it != caches.end())
+            return it->second;
+
+        GG::Font::RenderCache& cache = caches[key];
+        const GG::Pt lr = GG::Pt(GG::X(half_size), GG::Y(half_size));
+        const GG::Pt ul = -lr;
+        GG::Flags<GG::TextFormat> format = GG::FORMAT_CENTER | GG::FORMAT_VCENTER;
+        std::vector<GG::Font::LineData> line_data;
+        font->DetermineLines(text, format, lr.x - ul.x, line_data);
+        font->PreRenderText(ul, lr, text, format, line_data, colour, cache);
+        return cache;
+    }
 
     GG::X WndLeft(const GG::Wnd* wnd) { return wnd ? wnd->UpperLeft().x : GG::X0; }
     GG::X WndRight(const GG::Wnd* wnd) { return wnd ? wnd->LowerRight().x : GG::X0; }
@@ -553,6 +630,20 @@ MapWnd::MapWnd() :
     m_RC_starlane_vertices(),
     m_RC_starlane_colors(),
     m_resourceCenters(),
+    m_field_vertices_not_visible(),
+    m_field_vertices_visible(),
+    m_field_texture_coords(),
+    m_field_scanline_circles(),
+    m_visibility_radii_vertices(),
+    m_visibility_radii_border_vertices(),
+    m_visibility_radii(),
+    m_visibility_radii_valid(false),
+    m_fleet_line_dot_vertices(),
+    m_fleet_line_dot_tex_coords(),
+    m_fleet_line_dot_colors(),
+    m_fleet_line_dots_valid(false),
+    m_fleet_line_dots_zoom(0.0),
+    m_fleet_line_dots_spacing(0),
     m_drag_offset(-GG::X1, -GG::Y1),
     m_dragged(false),
     m_btn_turn(0),
@@ -591,6 +682,7 @@ MapWnd::MapWnd() :
     SetName("MapWnd");
 
     Connect(GetUniverse().UniverseObjectDeleteSignal, &MapWnd::UniverseObjectDeleted, this);
+    Connect(GetUniverse().UniverseObjectsChangedSignal, &MapWnd::UniverseObjectsChanged, this);
 
     // toolbar
     m_toolbar = new CUIToolBar(GG::X0, GG::Y0, AppWidth(), TOOLBAR_HEIGHT);
@@ -1253,83 +1345,62 @@ void MapWnd::RenderFields() {
     // 1) not visible field textures
     // 2) scanlines on not visible fields
     // 3) visible field textures
-
-    const Universe& universe = GetUniverse();
+    // the buffers are in universe coordinates, so are positioned by the
+    // current zoom and translation, and only change at the start of a turn
     int empire_id = HumanClientApp::GetApp()->EmpireID();
 
+    glPushClientAttrib(GL_CLIENT_ALL_ATTRIB_BITS);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
     glEnable(GL_TEXTURE_2D);
-    glPushMatrix();
-    glLoadIdentity();
     glColor(GG::CLR_WHITE);
 
     // draw not visible fields first
-    for (std::map<int, FieldIcon*>::const_iterator it = m_field_icons.begin();
-         it != m_field_icons.end(); ++it)
+    for (std::map<boost::shared_ptr<GG::Texture>, GL2DVertexBuffer>::const_iterator it = m_field_vertices_not_visible.begin();
+         it != m_field_vertices_not_visible.end(); ++it)
     {
-        if (universe.GetObjectVisibilityByEmpire(it->first, empire_id) > VIS_BASIC_VISIBILITY)
+        if (!it->second.size())
             continue;
-
-        const FieldIcon* icon = it->second;
-        GG::Pt ul = icon->UpperLeft();
-        GG::Pt lr = icon->LowerRight();
-        boost::shared_ptr<GG::Texture> texture = icon->FieldTexture();
-        if (texture)
-            texture->OrthoBlit(ul, lr);
+        glBindTexture(GL_TEXTURE_2D, it->first->OpenGLId());
+        it->second.activate();
+        m_field_texture_coords[it->first].activate();
+        glDrawArrays(GL_QUADS, 0, it->second.size());
     }
 
     // if possible, draw scanlines for not visible fields
     if (m_scanline_shader &&
+        m_field_scanline_circles.size() &&
         empire_id != ALL_EMPIRES &&
         GetOptionsDB().Get<bool>("UI.system-fog-of-war"))
     {
+        glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+        glDisable(GL_TEXTURE_2D);
+
         m_scanline_shader->Use();
         float fog_scanline_spacing = static_cast<float>(GetOptionsDB().Get<double>("UI.system-fog-of-war-spacing"));
         m_scanline_shader->Bind("scanline_spacing", fog_scanline_spacing);
-
-        for (std::map<int, FieldIcon*>::const_iterator it = m_field_icons.begin();
-             it != m_field_icons.end(); ++it)
-        {
-            if (universe.GetObjectVisibilityByEmpire(it->first, empire_id) > VIS_BASIC_VISIBILITY)
-                continue;
-
-            const FieldIcon* icon = it->second;
-            const int ARC_SIZE = Value(icon->Width());
-            const double TWO_PI = 2.0*3.14159;
-            GG::Pt ul = icon->UpperLeft();
-            GG::Pt lr = icon->LowerRight();
-
-            GG::Pt size = lr - ul;
-            GG::Pt half_size = GG::Pt(size.x / 2, size.y / 2);
-            GG::Pt middle = ul + half_size;
-
-            GG::Pt circle_size = GG::Pt(static_cast<GG::X>(ARC_SIZE),
-                                        static_cast<GG::Y>(ARC_SIZE));
-            GG::Pt circle_half_size = GG::Pt(circle_size.x / 2, circle_size.y / 2);
-            GG::Pt circle_ul = middle - circle_half_size;
-            GG::Pt circle_lr = circle_ul + circle_size;
-
-            CircleArc(circle_ul, circle_lr, 0.0, TWO_PI, true);
-        }
-
+        m_field_scanline_circles.activate();
+        glDrawArrays(GL_TRIANGLES, 0, m_field_scanline_circles.size());
         m_scanline_shader->stopUse();
+
+        glEnable(GL_TEXTURE_2D);
+        glEnableClientState(GL_TEXTURE_COORD_ARRAY);
     }
 
     // draw visible fields over top without scanline shader
-    for (std::map<int, FieldIcon*>::const_iterator it = m_field_icons.begin();
-         it != m_field_icons.end(); ++it)
+    for (std::map<boost::shared_ptr<GG::Texture>, GL2DVertexBuffer>::const_iterator it = m_field_vertices_visible.begin();
+         it != m_field_vertices_visible.end(); ++it)
     {
-        if (universe.GetObjectVisibilityByEmpire(it->first, empire_id) <= VIS_BASIC_VISIBILITY)
+        if (!it->second.size())
             continue;
-
-        const FieldIcon* icon = it->second;
-        GG::Pt ul = icon->UpperLeft();
-        GG::Pt lr = icon->LowerRight();
-        boost::shared_ptr<GG::Texture> texture = icon->FieldTexture();
-        if (texture)
-            texture->OrthoBlit(ul, lr);
+        glBindTexture(GL_TEXTURE_2D, it->first->OpenGLId());
+        it->second.activate();
+        m_field_texture_coords[it->first].activate();
+        glDrawArrays(GL_QUADS, 0, it->second.size());
     }
 
-    glPopMatrix();
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glPopClientAttrib();
 }
 
 void MapWnd::RenderGalaxyGas() {
@@ -1546,113 +1617,180 @@ void MapWnd::RenderFleetMovementLines() {
     if (ZoomFactor() < ClientUI::TinyFleetButtonZoomThreshold())
         return;
 
-    // set common animation shift for move lines
-    const int       MOVE_LINE_DOT_SPACING = GetOptionsDB().Get<int>("UI.fleet-supply-line-dot-spacing");
-    const double    RATE                  = GetOptionsDB().Get<double>("UI.fleet-supply-line-dot-rate");
-    move_line_animation_shift = static_cast<double>(static_cast<int>(static_cast<double>(GG::GUI::GetGUI()->Ticks()) * RATE) % MOVE_LINE_DOT_SPACING);
+    // dots are spaced in screen pixels, so are only placed again when the
+    // zoom or spacing change, or the lines or selected fleets do.  they are
+    // animated by shifting their texture coordinates
+    const int MOVE_LINE_DOT_SPACING = GetOptionsDB().Get<int>("UI.fleet-supply-line-dot-spacing");
+    if (!m_fleet_line_dots_valid ||
+        m_fleet_line_dots_zoom != ZoomFactor() ||
+        m_fleet_line_dots_spacing != MOVE_LINE_DOT_SPACING)
+    { InitFleetMovementLineRenderingBuffers(); }
+
+    // render movement lines for all fleets, then selected fleets' and
+    // projected movement lines in white, all with one draw call
+    if (m_fleet_line_dot_vertices.size()) {
+        boost::shared_ptr<GG::Texture> move_line_dot_texture =
+            ClientUI::GetTexture(ClientUI::ArtDir() / "misc" / "move_line_dot.png");
+        const GLfloat*  tex_coords = move_line_dot_texture->DefaultTexCoords();
+        const double    DOT_WIDTH = Value(move_line_dot_texture->DefaultWidth());
+        const double    RATE = GetOptionsDB().Get<double>("UI.fleet-supply-line-dot-rate");
+        const double    SHIFT = static_cast<double>(static_cast<int>(static_cast<double>(GG::GUI::GetGUI()->Ticks()) * RATE) % MOVE_LINE_DOT_SPACING);   // in pixels
+
+        // each dot's quad extends a whole spacing along its line, so the dot
+        // can be moved within it.  outside the dot, the texture is clamped to
+        // its transparent border
+        if (move_line_dot_texture->WrapS() != GL_CLAMP_TO_BORDER)
+            move_line_dot_texture->SetWrap(GL_CLAMP_TO_BORDER, GL_CLAMP_TO_EDGE);
+
+        GG::Pt cl_ul = ClientUpperLeft();
 
+        glPushMatrix();
+        glLoadIdentity();
+        glTranslatef(static_cast<GLfloat>(Value(cl_ul.x)), static_cast<GLfloat>(Value(cl_ul.y)), 0.0f);
 
-    // render movement lines for all fleets
-    for (std::map<int, MovementLineData>::const_iterator it = m_fleet_lines.begin(); it != m_fleet_lines.end(); ++it)
-        RenderMovementLine(it->second);
+        glMatrixMode(GL_TEXTURE);
+        glPushMatrix();
+        glLoadIdentity();
+        glTranslatef(static_cast<GLfloat>(-SHIFT / DOT_WIDTH * (tex_coords[2] - tex_coords[0])), 0.0f, 0.0f);
+        glMatrixMode(GL_MODELVIEW);
+
+        glPushClientAttrib(GL_CLIENT_ALL_ATTRIB_BITS);
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+        glEnableClientState(GL_COLOR_ARRAY);
+
+        glBindTexture(GL_TEXTURE_2D, move_line_dot_texture->OpenGLId());
+        m_fleet_line_dot_vertices.activate();
+        m_fleet_line_dot_tex_coords.activate();
+        m_fleet_line_dot_colors.activate();
+        glDrawArrays(GL_QUADS, 0, m_fleet_line_dot_vertices.size());
+
+        glPopClientAttrib();
 
-    // re-render selected fleets' movement lines in white
+        glMatrixMode(GL_TEXTURE);
+        glPopMatrix();
+        glMatrixMode(GL_MODELVIEW);
+        glPopMatrix();
+    }
+
+    // render move line ETA indicators for selected fleets
     for (std::set<int>::const_iterator it = m_selected_fleet_ids.begin(); it != m_selected_fleet_ids.end(); ++it) {
         int fleet_id = *it;
         std::map<int, MovementLineData>::const_iterator line_it = m_fleet_lines.find(fleet_id);
         if (line_it != m_fleet_lines.end())
-            RenderMovementLine(line_it->second, GG::CLR_WHITE);
+            RenderMovementLineETAIndicators(line_it->second);
     }
 
-    // render move line ETA indicators for selected fleets
+    // render projected move line ETA indicators
+    for (std::map<int, MovementLineData>::const_iterator it = m_projected_fleet_lines.begin(); it != m_projected_fleet_lines.end(); ++it)
+        RenderMovementLineETAIndicators(it->second, GG::CLR_WHITE);
+}
+
+void MapWnd::InitFleetMovementLineRenderingBuffers() {
+    ClearFleetMovementLineRenderingBuffers();
+
+    // movement lines for all fleets
+    for (std::map<int, MovementLineData>::const_iterator it = m_fleet_lines.begin(); it != m_fleet_lines.end(); ++it)
+        StoreMovementLineDots(it->second);
+
+    // selected fleets' movement lines in white, over the others
     for (std::set<int>::const_iterator it = m_selected_fleet_ids.begin(); it != m_selected_fleet_ids.end(); ++it) {
         int fleet_id = *it;
         std::map<int, MovementLineData>::const_iterator line_it = m_fleet_lines.find(fleet_id);
         if (line_it != m_fleet_lines.end())
-            RenderMovementLineETAIndicators(line_it->second);
+            StoreMovementLineDots(line_it->second, GG::CLR_WHITE);
     }
 
-    // render projected move lines
+    // projected move lines
     for (std::map<int, MovementLineData>::const_iterator it = m_projected_fleet_lines.begin(); it != m_projected_fleet_lines.end(); ++it)
-        RenderMovementLine(it->second, GG::CLR_WHITE);
+        StoreMovementLineDots(it->second, GG::CLR_WHITE);
 
-    // render projected move line ETA indicators
-    for (std::map<int, MovementLineData>::const_iterator it = m_projected_fleet_lines.begin(); it != m_projected_fleet_lines.end(); ++it)
-        RenderMovementLineETAIndicators(it->second, GG::CLR_WHITE);
+    m_fleet_line_dots_valid = true;
+    m_fleet_line_dots_zoom = ZoomFactor();
+    m_fleet_line_dots_spacing = GetOptionsDB().Get<int>("UI.fleet-supply-line-dot-spacing");
+}
+
+void MapWnd::ClearFleetMovementLineRenderingBuffers() {
+    m_fleet_line_dot_vertices.clear();
+    m_fleet_line_dot_tex_coords.clear();
+    m_fleet_line_dot_colors.clear();
+    m_fleet_line_dots_valid = false;
 }
 
-void MapWnd::RenderMovementLine(const MapWnd::MovementLineData& move_line, GG::Clr clr) {
+void MapWnd::StoreMovementLineDots(const MapWnd::MovementLineData& move_line, GG::Clr clr) {
     const std::vector<MovementLineData::Vertex>& vertices = move_line.vertices;
     if (vertices.empty())
         return; // nothing to draw.  need at least two nodes at different locations to draw a line
     if (vertices.size() % 2 == 1) {
-        Logger().errorStream() << "RenderMovementLine given an odd number of vertices to render?!";
+        Logger().errorStream() << "StoreMovementLineDots given an odd number of vertices to render?!";
         return;
     }
 
-    glPushMatrix();
-    glLoadIdentity();
-
-    if (clr == GG::CLR_ZERO) {
-        glColor(move_line.colour);
-    } else {
-        glColor(clr);
-    }
+    GG::Clr colour = clr == GG::CLR_ZERO ? move_line.colour : clr;
 
     boost::shared_ptr<GG::Texture> move_line_dot_texture =
         ClientUI::GetTexture(ClientUI::ArtDir() / "misc" / "move_line_dot.png");
-    GG::Pt      texture_half_size = GG::Pt(GG::X(move_line_dot_texture->DefaultWidth() / 2),
-                                           GG::Y(move_line_dot_texture->DefaultHeight() / 2));
-    const int   MOVE_LINE_DOT_SPACING = GetOptionsDB().Get<int>("UI.fleet-supply-line-dot-spacing");
+    const double    DOT_WIDTH = Value(move_line_dot_texture->DefaultWidth());
+    const double    DOT_HEIGHT = Value(move_line_dot_texture->DefaultHeight());
+    const GLfloat*  tex_coords = move_line_dot_texture->DefaultTexCoords();
+    const int       MOVE_LINE_DOT_SPACING = GetOptionsDB().Get<int>("UI.fleet-supply-line-dot-spacing");
+    const double    ZOOM = ZoomFactor();
 
-    double offset = move_line_animation_shift;  // step along line in by move_line_animation_shift to get position of first dot
+    double offset = 0.0;    // position along segment of first dot, before animation shift
 
-    // blit a series of coloured dots along move path
+    // store a quad for each dot along move path, in pixels from the universe
+    // origin at the current zoom.  a dot is drawn in its quad at the animation
+    // shift, between zero and MOVE_LINE_DOT_SPACING, from its unshifted
+    // position, so each quad extends from half a dot before that position to
+    // half a dot after the next one, clipped to its segment
     for (std::vector<MovementLineData::Vertex>::const_iterator verts_it = vertices.begin(); verts_it != vertices.end(); ++verts_it) {
         // get next two vertices
         const MovementLineData::Vertex& vert1 = *verts_it;
         verts_it++;
         const MovementLineData::Vertex& vert2 = *verts_it;
 
-        GG::Pt vert1Pt = ScreenCoordsFromUniversePosition(vert1.x, vert1.y) - texture_half_size;
-        GG::Pt vert2Pt = ScreenCoordsFromUniversePosition(vert2.x, vert2.y) - texture_half_size;
+        double vert1X = vert1.x * ZOOM, vert1Y = vert1.y * ZOOM;
+        double vert2X = vert2.x * ZOOM, vert2Y = vert2.y * ZOOM;
 
-        // get unit vector along line connecting vertices
-        double deltaX = Value(vert2Pt.x - vert1Pt.x), deltaY = Value(vert2Pt.y - vert1Pt.y);
+        // get unit vectors along and across line connecting vertices
+        double deltaX = vert2X - vert1X, deltaY = vert2Y - vert1Y;
         double length = std::sqrt(deltaX*deltaX + deltaY*deltaY);
         if (length == 0.0) // safety check
             length = 1.0;
         double uVecX = deltaX / length, uVecY = deltaY / length;
+        double acrossX = -uVecY * DOT_HEIGHT / 2, acrossY = uVecX * DOT_HEIGHT / 2;
+
+        // start with the previous segment's last dot, which may be shifted
+        // into this segment
+        double dot = offset - MOVE_LINE_DOT_SPACING;
+        for (; dot < length; dot += MOVE_LINE_DOT_SPACING) {
+            double start = std::max(0.0, dot - DOT_WIDTH / 2);
+            double end = std::min(length, dot + MOVE_LINE_DOT_SPACING + DOT_WIDTH / 2);
+            if (start >= end)
+                continue;
 
-
-        // increment along line, rendering dots, until end of line segment is passed
-        while (offset < length) {
-            // find position of dot from initial vertex position, offset length and unit vectors
-            std::pair<double, double> ul(Value(vert1Pt.x) + offset * uVecX,
-                                         Value(vert1Pt.y) + offset * uVecY);
-
-            // blit texture (appropriately coloured) into place
-            glBindTexture(GL_TEXTURE_2D, move_line_dot_texture->OpenGLId());
-            const GLfloat* tex_coords = move_line_dot_texture->DefaultTexCoords();
-            glBegin(GL_TRIANGLE_STRIP);
-            glTexCoord2f(tex_coords[0], tex_coords[1]);
-            glVertex2f(static_cast<GLfloat>(ul.first), static_cast<GLfloat>(ul.second));
-            glTexCoord2f(tex_coords[2], tex_coords[1]);
-            glVertex2f(static_cast<GLfloat>(ul.first + Value(move_line_dot_texture->DefaultWidth())), static_cast<GLfloat>(ul.second));
-            glTexCoord2f(tex_coords[0], tex_coords[3]);
-            glVertex2f(static_cast<GLfloat>(ul.first), static_cast<GLfloat>(ul.second + Value(move_line_dot_texture->DefaultHeight())));
-            glTexCoord2f(tex_coords[2], tex_coords[3]);
-            glVertex2f(static_cast<GLfloat>(ul.first + Value(move_line_dot_texture->DefaultWidth())),
-                       static_cast<GLfloat>(ul.second + Value(move_line_dot_texture->DefaultHeight())));
-            glEnd();
-
-            // move offset to that for next dot
-            offset += MOVE_LINE_DOT_SPACING;
+            float start_x = static_cast<float>(vert1X + start * uVecX), start_y = static_cast<float>(vert1Y + start * uVecY);
+            float end_x = static_cast<float>(vert1X + end * uVecX), end_y = static_cast<float>(vert1Y + end * uVecY);
+            float across_x = static_cast<float>(acrossX), across_y = static_cast<float>(acrossY);
+
+            m_fleet_line_dot_vertices.store(start_x - across_x, start_y - across_y);
+            m_fleet_line_dot_vertices.store(end_x - across_x, end_y - across_y);
+            m_fleet_line_dot_vertices.store(end_x + across_x, end_y + across_y);
+            m_fleet_line_dot_vertices.store(start_x + across_x, start_y + across_y);
+
+            // texture coordinates that place the unshifted dot at dot
+            float start_s = static_cast<float>(tex_coords[0] + (start - dot + DOT_WIDTH / 2) / DOT_WIDTH * (tex_coords[2] - tex_coords[0]));
+            float end_s = static_cast<float>(tex_coords[0] + (end - dot + DOT_WIDTH / 2) / DOT_WIDTH * (tex_coords[2] - tex_coords[0]));
+            m_fleet_line_dot_tex_coords.store(start_s, tex_coords[1]);
+            m_fleet_line_dot_tex_coords.store(end_s, tex_coords[1]);
+            m_fleet_line_dot_tex_coords.store(end_s, tex_coords[3]);
+            m_fleet_line_dot_tex_coords.store(start_s, tex_coords[3]);
+            for (int i = 0; i < 4; ++i)
+                m_fleet_line_dot_colors.store(colour.r, colour.g, colour.b, colour.a);
         }
 
-        offset -= length;   // so next segment's dots meld smoothly into this segment's
+        offset = dot - length;  // so next segment's dots meld smoothly into this segment's
     }
-    glPopMatrix();
 }
 
 void MapWnd::RenderMovementLineETAIndicators(const MapWnd::MovementLineData& move_line, GG::Clr clr) {
@@ -1661,43 +1799,46 @@ void MapWnd::RenderMovementLineETAIndicators(const MapWnd::MovementLineData& mov
         return; // nothing to draw.
 
 
-    const double MARKER_HALF_SIZE = 9;
+    const int MARKER_HALF_SIZE = 9;
     const int MARKER_PTS = ClientUI::Pts();
     boost::shared_ptr<GG::Font> font = ClientUI::GetBoldFont(MARKER_PTS);
-    const double TWO_PI = 2.0*3.1415926536;
-    GG::Flags<GG::TextFormat> flags = GG::FORMAT_CENTER | GG::FORMAT_VCENTER;
+    const int FLAG_BORDER = 5;
+    const int WEDGES = 12;
+    const int VERTICES_PER_WEDGE = 3 * CIRCLE_SLICES / WEDGES;
+
+    // the discs and texts are drawn from cached vertices, translated to each
+    // marker's position
+    const GL2DVertexBuffer& disc_vertices = UnitDiscTriangles();
 
     glPushMatrix();
     glLoadIdentity();
-    int flag_border = 5;
+    glPushClientAttrib(GL_CLIENT_ALL_ATTRIB_BITS);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    disc_vertices.activate();
+
     for (std::vector<MovementLineData::Vertex>::const_iterator verts_it = vertices.begin(); verts_it != vertices.end(); ++verts_it) {
         const MovementLineData::Vertex& vert = *verts_it;
         if (!vert.show_eta)
             continue;
 
-
-        // draw background disc in empire colour, or passed-in colour
         GG::Pt marker_centre = ScreenCoordsFromUniversePosition(vert.x, vert.y);
-        GG::Pt ul = marker_centre - GG::Pt(GG::X(static_cast<int>(MARKER_HALF_SIZE)), GG::Y(static_cast<int>(MARKER_HALF_SIZE)));
-        GG::Pt lr = marker_centre + GG::Pt(GG::X(static_cast<int>(MARKER_HALF_SIZE)), GG::Y(static_cast<int>(MARKER_HALF_SIZE)));
+        glPushMatrix();
+        glTranslatef(static_cast<GLfloat>(Value(marker_centre.x)), static_cast<GLfloat>(Value(marker_centre.y)), 0.0f);
 
+        // draw background disc in empire colour, or passed-in colour,
+        // surrounded by a wedged ring if the fleet is blockaded
         glDisable(GL_TEXTURE_2D);
-        if (vert.flag_blockade) {
-            float wedge = TWO_PI/12.0;
-            for (int n = 0; n<12; n=n+2 ) {
-                glColor(GG::CLR_BLACK);
-                CircleArc(ul + GG::Pt(-flag_border*GG::X1,  -flag_border*GG::Y1), lr + GG::Pt(flag_border*GG::X1,  flag_border*GG::Y1), n*wedge, (n+1)*wedge, true);
-                glColor(GG::CLR_RED);
-                CircleArc(ul + GG::Pt(-(flag_border)*GG::X1,  -(flag_border)*GG::Y1), lr + GG::Pt((flag_border)*GG::X1,  (flag_border)*GG::Y1), (n+1)*wedge, (n+2)*wedge, true);
-            }
-        } else if (vert.flag_supply_block){
-            float wedge = TWO_PI/12.0;
-            for (int n = 0; n<12; n=n+2 ) {
-                glColor(GG::CLR_BLACK);
-                CircleArc(ul + GG::Pt(-flag_border*GG::X1,  -flag_border*GG::Y1), lr + GG::Pt(flag_border*GG::X1,  flag_border*GG::Y1), n*wedge, (n+1)*wedge, true);
-                glColor(GG::CLR_YELLOW);
-                CircleArc(ul + GG::Pt(-(flag_border)*GG::X1,  -(flag_border)*GG::Y1), lr + GG::Pt((flag_border)*GG::X1,  (flag_border)*GG::Y1), (n+1)*wedge, (n+2)*wedge, true);
+        if (vert.flag_blockade || vert.flag_supply_block) {
+            glPushMatrix();
+            glScalef(static_cast<GLfloat>(MARKER_HALF_SIZE + FLAG_BORDER), static_cast<GLfloat>(MARKER_HALF_SIZE + FLAG_BORDER), 1.0f);
+            for (int n = 0; n < WEDGES; ++n) {
+                if (n % 2 == 0)
+                    glColor(GG::CLR_BLACK);
+                else
+                    glColor(vert.flag_blockade ? GG::CLR_RED : GG::CLR_YELLOW);
+                glDrawArrays(GL_TRIANGLES, n * VERTICES_PER_WEDGE, VERTICES_PER_WEDGE);
             }
+            glPopMatrix();
         }
 
         if (clr == GG::CLR_ZERO)
@@ -1705,22 +1846,30 @@ void MapWnd::RenderMovementLineETAIndicators(const MapWnd::MovementLineData& mov
         else
             glColor(clr);
 
-        CircleArc(ul, lr, 0.0, TWO_PI, true);
+        glPushMatrix();
+        glScalef(static_cast<GLfloat>(MARKER_HALF_SIZE), static_cast<GLfloat>(MARKER_HALF_SIZE), 1.0f);
+        glDrawArrays(GL_TRIANGLES, 0, disc_vertices.size());
+        glPopMatrix();
         glEnable(GL_TEXTURE_2D);
 
 
         // render ETA number in white with black shadows
         std::string text = boost::lexical_cast<std::string>(vert.eta);
+        const GG::Font::RenderCache& shadow_cache = CenteredTextRenderCache(font, text, GG::CLR_BLACK, MARKER_HALF_SIZE);
+        const GG::Font::RenderCache& text_cache = CenteredTextRenderCache(font, text, GG::CLR_WHITE, MARKER_HALF_SIZE);
+        const GLfloat SHADOW_OFFSETS[4][2] = {{-1.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, -1.0f}, {0.0f, 1.0f}};
+        for (int i = 0; i < 4; ++i) {
+            glPushMatrix();
+            glTranslatef(SHADOW_OFFSETS[i][0], SHADOW_OFFSETS[i][1], 0.0f);
+            font->RenderCachedText(shadow_cache);
+            glPopMatrix();
+        }
+        font->RenderCachedText(text_cache);
 
-        glColor(GG::CLR_BLACK);
-        font->RenderText(ul + GG::Pt(-GG::X1,  GG::Y0), lr + GG::Pt(-GG::X1,  GG::Y0), text, flags);
-        font->RenderText(ul + GG::Pt( GG::X1,  GG::Y0), lr + GG::Pt( GG::X1,  GG::Y0), text, flags);
-        font->RenderText(ul + GG::Pt( GG::X0, -GG::Y1), lr + GG::Pt( GG::X0, -GG::Y1), text, flags);
-        font->RenderText(ul + GG::Pt( GG::X0,  GG::Y1), lr + GG::Pt( GG::X0,  GG::Y1), text, flags);
-
-        glColor(GG::CLR_WHITE);
-        font->RenderText(ul, lr, text, flags);
+        glPopMatrix();
     }
+
+    glPopClientAttrib();
     glPopMatrix();
 }
 
@@ -1728,6 +1877,62 @@ void MapWnd::RenderVisibilityRadii() {
     if (!GetOptionsDB().Get<bool>("UI.show-detection-range"))
         return;
 
+    if (!m_visibility_radii_valid)
+        InitVisibilityRadiiRenderingBuffers();
+
+    // circles smaller than this on screen aren't drawn.  as each empire's
+    // circles are stored from largest to smallest, the circles to draw are
+    // at the start of its buffers.
+    const double MIN_RADIUS = 20.0 / ZoomFactor();
+
+    glPushClientAttrib(GL_CLIENT_ALL_ATTRIB_BITS);
+    glEnableClientState(GL_VERTEX_ARRAY);
+
+    glPushAttrib(GL_ENABLE_BIT | GL_STENCIL_BUFFER_BIT);
+    glEnable(GL_STENCIL_TEST);
+
+    glLineWidth(1.5);
+    glEnable(GL_LINE_SMOOTH);
+    glDisable(GL_TEXTURE_2D);
+
+    for (std::map<int, std::vector<double> >::const_iterator it = m_visibility_radii.begin();
+         it != m_visibility_radii.end(); ++it)
+    {
+        const Empire* empire = Empires().Lookup(it->first);
+        if (!empire)
+            continue;
+        const std::vector<double>& radii = it->second;
+        std::size_t num_circles = std::upper_bound(radii.begin(), radii.end(), MIN_RADIUS, std::greater<double>()) - radii.begin();
+        if (!num_circles)
+            continue;
+
+        GG::Clr circle_colour = empire->Color();
+        circle_colour.a = 8*GetOptionsDB().Get<int>("UI.detection-range-opacity");
+
+        glClear(GL_STENCIL_BUFFER_BIT);
+        glStencilOp(GL_INCR, GL_INCR, GL_INCR);
+        glStencilFunc(GL_EQUAL, 0x0, 0xff);
+        glColor(circle_colour);
+        m_visibility_radii_vertices[it->first].activate();
+        glDrawArrays(GL_TRIANGLES, 0, num_circles * 3 * CIRCLE_SLICES);
+
+        glStencilFunc(GL_GREATER, 0x2, 0xff);
+        glStencilOp(GL_DECR, GL_KEEP, GL_KEEP);
+        circle_colour.a = std::min(255, circle_colour.a + 80);
+        AdjustBrightness(circle_colour, 2.0, true);
+        glColor(circle_colour);
+        m_visibility_radii_border_vertices[it->first].activate();
+        glDrawArrays(GL_LINES, 0, num_circles * 2 * CIRCLE_SLICES);
+    }
+
+    glLineWidth(1.0);
+    glPopAttrib();
+    glPopClientAttrib();
+}
+
+void MapWnd::InitVisibilityRadiiRenderingBuffers() {
+    ClearVisibilityRadiiRenderingBuffers();
+
     int                     client_empire_id = HumanClientApp::GetApp()->EmpireID();
     const std::set<int>&    destroyed_object_ids = GetUniverse().DestroyedObjectIds();
     const std::set<int>&    stale_object_ids = GetUniverse().EmpireStaleKnowledgeObjectIDs(client_empire_id);
@@ -1793,86 +1998,40 @@ void MapWnd::RenderVisibilityRadii() {
         }
     }
 
-    std::map<GG::Clr, std::vector<std::pair<GG::Pt, GG::Pt> > > circles;
+    // sort each empire's circles from largest to smallest
+    std::map<int, std::vector<std::pair<double, std::pair<double, double> > > > empire_circles;
     for (std::map<std::pair<int, std::pair<double, double> >, float>::const_iterator it =
             empire_position_max_detection_ranges.begin();
          it != empire_position_max_detection_ranges.end(); ++it)
-    {
-        if (const Empire* empire = Empires().Lookup(it->first.first)) {
-            GG::Clr circle_colour = empire->Color();
-            circle_colour.a = 8*GetOptionsDB().Get<int>("UI.detection-range-opacity");
-
-            GG::Pt circle_centre = ScreenCoordsFromUniversePosition(it->first.second.first, it->first.second.second);
-            double radius = it->second*ZoomFactor();
-            if (radius < 20.0)
-                continue;
-
-            GG::Pt ul = circle_centre - GG::Pt(GG::X(static_cast<int>(radius)), GG::Y(static_cast<int>(radius)));
-            GG::Pt lr = circle_centre + GG::Pt(GG::X(static_cast<int>(radius)), GG::Y(static_cast<int>(radius)));
+    { empire_circles[it->first.first].push_back(std::make_pair(static_cast<double>(it->second), it->first.second)); }
 
-            circles[circle_colour].push_back(std::make_pair(ul, lr));
-        }
-    }
-
-
-    glPushClientAttrib(GL_CLIENT_ALL_ATTRIB_BITS);
-    glEnableClientState(GL_VERTEX_ARRAY);
-
-#define USE_STENCILS 1
-
-#if USE_STENCILS
-    glPushAttrib(GL_ENABLE_BIT | GL_STENCIL_BUFFER_BIT);
-    glEnable(GL_STENCIL_TEST);
-#endif
-
-    const double TWO_PI = 2.0*3.1415926536;
-    const GG::Pt UNIT(GG::X1, GG::Y1);
-
-    glLineWidth(1.5);
-    glPushMatrix();
-    glLoadIdentity();
-    glEnable(GL_LINE_SMOOTH);
-    glDisable(GL_TEXTURE_2D);
-
-    for (std::map<GG::Clr, std::vector<std::pair<GG::Pt, GG::Pt> > >::iterator it = circles.begin();
-         it != circles.end(); ++it)
+    // store the circles, in universe coordinates
+    for (std::map<int, std::vector<std::pair<double, std::pair<double, double> > > >::iterator it =
+            empire_circles.begin(); it != empire_circles.end(); ++it)
     {
-        glClear(GL_STENCIL_BUFFER_BIT);
-        glStencilOp(GL_INCR, GL_INCR, GL_INCR);
-        glStencilFunc(GL_EQUAL, 0x0, 0xff);
-        GG::Clr circle_colour = it->first;
-        glColor(circle_colour);
-        const std::vector<std::pair<GG::Pt, GG::Pt> >& circles_in_this_colour = it->second;
-        for (std::size_t i = 0; i < circles_in_this_colour.size(); ++i) {
-            CircleArc(circles_in_this_colour[i].first, circles_in_this_colour[i].second,
-                      0.0, TWO_PI, true);
-        }
-        glStencilFunc(GL_GREATER, 0x2, 0xff);
-        glStencilOp(GL_DECR, GL_KEEP, GL_KEEP);
-        circle_colour.a = std::min(255, circle_colour.a + 80);
-        AdjustBrightness(circle_colour, 2.0, true);
-        glColor(circle_colour);
-        for (std::size_t i = 0; i < circles_in_this_colour.size(); ++i) {
-            CircleArc(circles_in_this_colour[i].first + UNIT, circles_in_this_colour[i].second - UNIT,
-                      0.0, TWO_PI, false);
+        std::vector<std::pair<double, std::pair<double, double> > >& circles = it->second;
+        std::sort(circles.begin(), circles.end(), std::greater<std::pair<double, std::pair<double, double> > >());
+
+        GL2DVertexBuffer& vertices = m_visibility_radii_vertices[it->first];
+        GL2DVertexBuffer& border_vertices = m_visibility_radii_border_vertices[it->first];
+        std::vector<double>& radii = m_visibility_radii[it->first];
+        for (std::size_t i = 0; i < circles.size(); ++i) {
+            StoreCircleTriangles(vertices, circles[i].second.first, circles[i].second.second, circles[i].first);
+            StoreCircleLines(border_vertices, circles[i].second.first, circles[i].second.second, circles[i].first);
+            radii.push_back(circles[i].first);
         }
+        vertices.createServerBuffer();
+        border_vertices.createServerBuffer();
     }
 
-#if !USE_STENCILS
-    glEnable(GL_TEXTURE_2D);
-    glDisable(GL_LINE_SMOOTH);
-#endif
-
-    glPopMatrix();
-    glLineWidth(1.0);
-
-#if USE_STENCILS
-    glPopAttrib();
-#endif
-
-#undef USE_STENCILS
+    m_visibility_radii_valid = true;
+}
 
-    glPopClientAttrib();
+void MapWnd::ClearVisibilityRadiiRenderingBuffers() {
+    m_visibility_radii_vertices.clear();
+    m_visibility_radii_border_vertices.clear();
+    m_visibility_radii.clear();
+    m_visibility_radii_valid = false;
 }
 
 void MapWnd::LButtonDown(const GG::Pt &pt, GG::Flags<GG::ModKey> mod_keys)
@@ -2007,6 +2166,8 @@ void MapWnd::InitTurn() {
     ScopedTimer init_timer("MapWnd::InitTurn", true);
 
     Universe& universe = GetUniverse();
+    // refresh UI bound to objects once for all changes made while initializing
+    ScopedUniverseObjectSignalBatch signal_batch(universe);
     const ObjectMap& objects = Objects();
 
     // FIXME: this is actually only needed when there was no mid-turn update
@@ -2029,14 +2190,17 @@ void MapWnd::InitTurn() {
     // set up system icons, starlanes, galaxy gas rendering
     InitTurnRendering();
 
-    // connect system fleet add and remove signals
+    // connect system fleet add and remove signals.  systems updated in place
+    // by the turn update are still connected from previous turns.
     std::vector<TemporaryPtr<const System> > systems = objects.FindObjects<System>();
     for (std::vector<TemporaryPtr<const System> >::const_iterator it = systems.begin(); it != systems.end(); ++it) {
         TemporaryPtr<const System> system = *it;
-        m_system_fleet_insert_remove_signals[system->ID()].push_back(GG::Connect(system->FleetsInsertedSignal,
-                                                                     &MapWnd::FleetsAddedOrRemoved, this));
-        m_system_fleet_insert_remove_signals[system->ID()].push_back(GG::Connect(system->FleetsRemovedSignal,
-                                                                     &MapWnd::FleetsAddedOrRemoved, this));
+        std::vector<boost::signals2::connection>& connections = m_system_fleet_insert_remove_signals[system->ID()];
+        if (!connections.empty() && connections.front().connected())
+            continue;
+        connections.clear();
+        connections.push_back(GG::Connect(system->FleetsInsertedSignal, &MapWnd::FleetsAddedOrRemoved, this));
+        connections.push_back(GG::Connect(system->FleetsRemovedSignal,  &MapWnd::FleetsAddedOrRemoved, this));
     }
 
     RefreshFleetSignals();
@@ -2206,6 +2370,7 @@ void MapWnd::InitTurnRendering() {
     // that come from the SystemIcons
     m_fleet_lines.clear();
     ClearProjectedFleetMovementLines();
+    m_fleet_line_dots_valid = false;
 
     int client_empire_id = HumanClientApp::GetApp()->EmpireID();
     const std::set<int>& this_client_known_destroyed_objects = GetUniverse().EmpireKnownDestroyedObjectIDs(client_empire_id);
@@ -2286,6 +2451,12 @@ void MapWnd::InitTurnRendering() {
     // position field icons
     DoFieldIconsLayout();
 
+    // create buffers for field rendering
+    InitFieldRenderingBuffers();
+
+    // detection ranges are recalculated when next shown
+    ClearVisibilityRadiiRenderingBuffers();
+
 
     // create fleet buttons and move lines.  needs to be after InitStarlaneRenderingBuffers so that m_starlane_endpoints is populated
     RefreshFleetButtons();
@@ -2432,6 +2603,80 @@ void MapWnd::ClearSystemRenderingBuffers() {
     m_star_texture_coords.clear();
 }
 
+void MapWnd::InitFieldRenderingBuffers() {
+    Logger().debugStream() << "MapWnd::InitFieldRenderingBuffers";
+    ScopedTimer timer("MapWnd::InitFieldRenderingBuffers", true);
+
+    ClearFieldRenderingBuffers();
+
+    const Universe& universe = GetUniverse();
+    int empire_id = HumanClientApp::GetApp()->EmpireID();
+
+    for (std::map<int, FieldIcon*>::const_iterator it = m_field_icons.begin(); it != m_field_icons.end(); ++it) {
+        const FieldIcon* icon = it->second;
+        TemporaryPtr<const Field> field = GetField(it->first);
+        if (!field) {
+            Logger().errorStream() << "MapWnd::InitFieldRenderingBuffers couldn't get field with id " << it->first;
+            continue;
+        }
+
+        // quad covering the field, in universe coordinates
+        const double RADIUS = field->CurrentMeterValue(METER_SIZE);
+        float ul_x = static_cast<float>(field->X() - RADIUS);
+        float ul_y = static_cast<float>(field->Y() - RADIUS);
+        float lr_x = static_cast<float>(field->X() + RADIUS);
+        float lr_y = static_cast<float>(field->Y() + RADIUS);
+
+        bool visible = universe.GetObjectVisibilityByEmpire(it->first, empire_id) > VIS_BASIC_VISIBILITY;
+        if (!visible)
+            StoreCircleTriangles(m_field_scanline_circles, field->X(), field->Y(), RADIUS);
+
+        boost::shared_ptr<GG::Texture> texture = icon->FieldTexture();
+        if (!texture)
+            continue;
+        GL2DVertexBuffer& vertices = visible ? m_field_vertices_visible[texture] : m_field_vertices_not_visible[texture];
+        vertices.store(ul_x, ul_y);
+        vertices.store(lr_x, ul_y);
+        vertices.store(lr_x, lr_y);
+        vertices.store(ul_x, lr_y);
+    }
+
+    // texture coordinates for each texture, enough for either its visible
+    // or its not visible quads, which are drawn separately
+    std::set<boost::shared_ptr<GG::Texture> > textures;
+    for (std::map<boost::shared_ptr<GG::Texture>, GL2DVertexBuffer>::const_iterator it = m_field_vertices_not_visible.begin();
+         it != m_field_vertices_not_visible.end(); ++it)
+    { textures.insert(it->first); }
+    for (std::map<boost::shared_ptr<GG::Texture>, GL2DVertexBuffer>::const_iterator it = m_field_vertices_visible.begin();
+         it != m_field_vertices_visible.end(); ++it)
+    { textures.insert(it->first); }
+
+    for (std::set<boost::shared_ptr<GG::Texture> >::const_iterator it = textures.begin(); it != textures.end(); ++it) {
+        std::size_t num_vertices = std::max(m_field_vertices_not_visible[*it].size(), m_field_vertices_visible[*it].size());
+        const GLfloat* tex_coords = (*it)->DefaultTexCoords();
+        GLTexCoordBuffer& texture_coords = m_field_texture_coords[*it];
+        for (std::size_t i = 0; i < num_vertices; i += 4) {
+            texture_coords.store(tex_coords[0], tex_coords[1]);
+            texture_coords.store(tex_coords[2], tex_coords[1]);
+            texture_coords.store(tex_coords[2], tex_coords[3]);
+            texture_coords.store(tex_coords[0], tex_coords[3]);
+        }
+
+        m_field_vertices_not_visible[*it].createServerBuffer();
+        m_field_vertices_visible[*it].createServerBuffer();
+        texture_coords.createServerBuffer();
+    }
+
+    m_field_scanline_circles.createServerBuffer();
+}
+
+void MapWnd::ClearFieldRenderingBuffers() {
+    m_field_vertices_not_visible.clear();
+    m_field_vertices_visible.clear();
+    m_field_texture_coords.clear();
+    m_field_scanline_circles.clear();
+}
+
 std::vector<int> MapWnd::GetLeastJumps(int startSys, int endSys, const std::set<int>& resGroup,
                                        const std::set<std::pair<int, int> >& supplylanes,
                                        const ObjectMap& objMap)
@@ -2861,6 +3106,11 @@ void MapWnd::ShowCombatLog(int log_id) {
     m_pedia_panel->SetCombatLog(log_id);
 }
 
+void MapWnd::RefreshPedia() {
+    if (m_pedia_panel->Visible())
+        m_pedia_panel->Refresh();
+}
+
 void MapWnd::ShowTech(const std::string& tech_name) {
     if (m_research_wnd->Visible()) {
         m_research_wnd->ShowTech(tech_name);
@@ -3036,6 +3286,7 @@ void MapWnd::ReselectLastFleet() {
     }
     for (std::set<int>::const_iterator it = missing_fleets.begin(); it != missing_fleets.end(); ++it)
         m_selected_fleet_ids.erase(*it);
+    m_fleet_line_dots_valid = false;
 
 
     // select a not-missing fleet, if any
@@ -3189,6 +3440,7 @@ void MapWnd::SetFleetMovementLine(int fleet_id) {
         }
     }
     m_fleet_lines[fleet_id] = MovementLineData(path, m_starlane_endpoints, line_colour, fleet->Owner());
+    m_fleet_line_dots_valid = false;
 }
 
 void MapWnd::SetProjectedFleetMovementLine(int fleet_id, const std::list<int>& travel_route) {
@@ -3242,6 +3494,7 @@ void MapWnd::SetProjectedFleetMovementLine(int fleet_id, const std::list<int>& t
 
     // create and store line
     m_projected_fleet_lines[fleet_id] = MovementLineData(path, m_starlane_endpoints, line_colour, fleet->Owner());
+    m_fleet_line_dots_valid = false;
 }
 
 void MapWnd::SetProjectedFleetMovementLines(const std::vector<int>& fleet_ids,
@@ -3253,12 +3506,16 @@ void MapWnd::SetProjectedFleetMovementLines(const std::vector<int>& fleet_ids,
 
 void MapWnd::RemoveProjectedFleetMovementLine(int fleet_id) {
     std::map<int, MovementLineData>::iterator it = m_projected_fleet_lines.find(fleet_id);
-    if (it != m_projected_fleet_lines.end())
+    if (it != m_projected_fleet_lines.end()) {
         m_projected_fleet_lines.erase(it);
+        m_fleet_line_dots_valid = false;
+    }
 }
 
-void MapWnd::ClearProjectedFleetMovementLines()
-{ m_projected_fleet_lines.clear(); }
+void MapWnd::ClearProjectedFleetMovementLines() {
+    m_projected_fleet_lines.clear();
+    m_fleet_line_dots_valid = false;
+}
 
 bool MapWnd::EventFilter(GG::Wnd* w, const GG::WndEvent& event) {
     if (event.Type() == GG::WndEvent::RClick && FleetUIManager::GetFleetUIManager().empty()) {
@@ -3707,20 +3964,31 @@ void MapWnd::FleetsAddedOrRemoved(const std::vector<TemporaryPtr<Fleet> >& fleet
 }
 
 void MapWnd::RefreshFleetSignals() {
-    // disconnect old fleet statechangedsignal connections
+    const ObjectMap& objects = Objects();
+
+    // disconnect old fleet statechangedsignal connections of fleets that no
+    // longer exist
     for (std::map<int, boost::signals2::connection>::iterator it = m_fleet_state_change_signals.begin();
-         it != m_fleet_state_change_signals.end(); ++it)
-    { it->second.disconnect(); }
-    m_fleet_state_change_signals.clear();
+         it != m_fleet_state_change_signals.end();)
+    {
+        if (objects.Object<Fleet>(it->first)) {
+            ++it;
+        } else {
+            it->second.disconnect();
+            m_fleet_state_change_signals.erase(it++);
+        }
+    }
 
 
     // connect fleet change signals to update fleet movement lines, so that ordering
-    // fleets to move updates their displayed path and rearranges fleet buttons (if necessary)
-    std::vector<TemporaryPtr<Fleet> > fleets = Objects().FindObjects<Fleet>();
-    for (std::vector<TemporaryPtr<Fleet> >::const_iterator it = fleets.begin(); it != fleets.end(); ++it) {
-        TemporaryPtr<Fleet> fleet = *it;
-        m_fleet_state_change_signals[fleet->ID()] =
-            GG::Connect(fleet->StateChangedSignal, &MapWnd::RefreshFleetButtons, this);
+    // fleets to move updates their displayed path and rearranges fleet buttons (if necessary).
+    // fleets updated in place by a turn update are still connected.
+    std::vector<TemporaryPtr<const Fleet> > fleets = objects.FindObjects<Fleet>();
+    for (std::vector<TemporaryPtr<const Fleet> >::const_iterator it = fleets.begin(); it != fleets.end(); ++it) {
+        TemporaryPtr<const Fleet> fleet = *it;
+        boost::signals2::connection& connection = m_fleet_state_change_signals[fleet->ID()];
+        if (!connection.connected())
+            connection = GG::Connect(fleet->StateChangedSignal, &MapWnd::RefreshFleetButtons, this);
     }
 }
 
@@ -4285,6 +4553,7 @@ void MapWnd::SelectedFleetsChanged() {
 
     // set new selected fleets
     m_selected_fleet_ids = selected_fleet_ids;
+    m_fleet_line_dots_valid = false;
 
     // update fleetbutton selection indicators
     RefreshFleetButtonSelectionIndicators();
@@ -4358,9 +4627,14 @@ void MapWnd::UniverseObjectDeleted(TemporaryPtr<const UniverseObject> obj) {
         std::map<int, MovementLineData>::iterator it2 = m_projected_fleet_lines.find(fleet->ID());
         if (it2 != m_projected_fleet_lines.end())
             m_projected_fleet_lines.erase(it2);
+
+        m_fleet_line_dots_valid = false;
     }
 }
 
+void MapWnd::UniverseObjectsChanged(const std::set<int>& object_ids)
+{ m_visibility_radii_valid = false; }
+
 void MapWnd::RegisterPopup(MapWndPopup* popup) {
     if (popup)
         m_popups.push_back(popup);
@@ -4399,6 +4673,9 @@ void MapWnd::Sanitize() {
 
     ClearSystemRenderingBuffers();
     ClearStarlaneRenderingBuffers();
+    ClearFieldRenderingBuffers();
+    ClearVisibilityRadiiRenderingBuffers();
+    ClearFleetMovementLineRenderingBuffers();
 
     if (ClientUI* cui = ClientUI::GetClientUI()) {
         // clearing of message window commented out because scrollbar has quirks
@@ -4469,6 +4746,8 @@ void MapWnd::Sanitize() {
 
     m_projected_fleet_lines.clear();
 
+    m_fleet_line_dots_valid = false;
+
     for (std::map<int, SystemIcon*>::iterator it = m_system_icons.begin(); it != m_system_icons.end(); ++it)
         delete it->second;
     m_system_icons.clear();
@@ -126,6 +126,7 @@ public:
 
     void            ShowPlanet(int planet_id);                              //!< brings up encyclopedia panel and displays info about the planet
     void            ShowCombatLog(int log_id);                              //!< brings up encyclopedia panel and displays info about the combat
+    void            RefreshPedia();                                         //!< redisplays the encyclopedia panel's current item, eg. after a combat log it displays has arrived
     void            ShowTech(const std::string& tech_name);                 //!< brings up the research screen and centers the tech tree on \a tech_name
     void            ShowBuildingType(const std::string& building_type_name);//!< brings up the production screen and displays info about the buildtype \a type_name
     void            ShowPartType(const std::string& part_type_name);        //!< brings up the production screen and displays info about the buildtype \a type_name
@@ -224,6 +225,12 @@ private:
     void            ClearSystemRenderingBuffers();
     void            InitStarlaneRenderingBuffers();             //!< initializes or refreshes buffers for rendering of starlanes
     void            ClearStarlaneRenderingBuffers();
+    void            InitFieldRenderingBuffers();                //!< initializes or refreshes buffers for rendering of fields
+    void            ClearFieldRenderingBuffers();
+    void            InitVisibilityRadiiRenderingBuffers();      //!< initializes or refreshes buffers for rendering of detection ranges
+    void            ClearVisibilityRadiiRenderingBuffers();
+    void            InitFleetMovementLineRenderingBuffers();    //!< initializes or refreshes buffers for rendering of fleet movement line dots at the current zoom
+    void            ClearFleetMovementLineRenderingBuffers();
 
     /* Takes X and Y coordinates of a pair of systems and moves these points inwards along the vector
      * between them by the radius of a system on screen (at zoom 1.0) and return result */ 
@@ -246,9 +253,10 @@ private:
     /* renders the dashed lines indicating where each fleet is going */
     void            RenderFleetMovementLines();
 
-    /* renders a single fleet movement line.  if \a clr is GG::CLR_ZERO, the lane
-     * is rendered with the .colour attribute of \a move_line */
-    void            RenderMovementLine(const MapWnd::MovementLineData& move_line, GG::Clr clr = GG::CLR_ZERO);
+    /* adds the dots of a single fleet movement line to the movement line
+     * buffers.  if \a clr is GG::CLR_ZERO, the dots are coloured with the
+     * .colour attribute of \a move_line */
+    void            StoreMovementLineDots(const MapWnd::MovementLineData& move_line, GG::Clr clr = GG::CLR_ZERO);
 
     /* renders ETA indicators at end-of-turn positions for a single fleet movement
      * line.  if \a clr is GG::CLR_ZERO, the indicators are filled with the .colour
@@ -281,6 +289,7 @@ private:
     void            ShipsRightClicked(const std::vector<int>& fleet_ids);
 
     void            UniverseObjectDeleted(TemporaryPtr<const UniverseObject> obj);
+    void            UniverseObjectsChanged(const std::set<int>& object_ids);
 
     bool            ReturnToMap();
 
@@ -413,6 +422,23 @@ private:
     GLRGBAColorBuffer                   m_RC_starlane_colors;
     std::set<int>                       m_resourceCenters;
 
+    std::map<boost::shared_ptr<GG::Texture>, GL2DVertexBuffer>  m_field_vertices_not_visible;
+    std::map<boost::shared_ptr<GG::Texture>, GL2DVertexBuffer>  m_field_vertices_visible;
+    std::map<boost::shared_ptr<GG::Texture>, GLTexCoordBuffer>  m_field_texture_coords;
+    GL2DVertexBuffer                    m_field_scanline_circles;
+
+    std::map<int, GL2DVertexBuffer>     m_visibility_radii_vertices;        //!< filled detection range circles, indexed by empire
+    std::map<int, GL2DVertexBuffer>     m_visibility_radii_border_vertices; //!< detection range circle borders, indexed by empire
+    std::map<int, std::vector<double> > m_visibility_radii;                 //!< radii of the circles in the buffers, from largest to smallest, indexed by empire
+    bool                                m_visibility_radii_valid;           //!< false if the detection range buffers need to be recreated
+
+    GL2DVertexBuffer                    m_fleet_line_dot_vertices;          //!< a quad for each fleet movement line dot, in pixels at m_fleet_line_dots_zoom
+    GLTexCoordBuffer                    m_fleet_line_dot_tex_coords;
+    GLRGBAColorBuffer                   m_fleet_line_dot_colors;
+    bool                                m_fleet_line_dots_valid;            //!< false if fleet movement lines or selected fleets have changed since the dot buffers were filled
+    double                              m_fleet_line_dots_zoom;             //!< zoom factor at which the dot buffers were filled
+    int                                 m_fleet_line_dots_spacing;          //!< dot spacing, in pixels, with which the dot buffers were filled
+
     boost::shared_ptr<ShaderProgram>    m_scanline_shader;
 
     GG::Pt                      m_drag_offset;      //!< distance the cursor is from the upper-left corner of the window during a drag ((-1, -1) if no drag is occurring)
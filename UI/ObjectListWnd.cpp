@@ -22,6 +22,7 @@
 #include "../universe/ValueRef.h"
 
 #include <GG/DrawUtil.h>
+#include <GG/VirtualListBox.h>
 #include <GG/Layout.h>
 
 std::vector<std::string> SpecialNames();
@@ -966,31 +967,61 @@ namespace {
 ////////////////////////////////////////////////
 // ObjectPanel
 ////////////////////////////////////////////////
+/** Shows one object at a time.  A handful of these are reused by the
+  * ObjectListBox for whichever objects are scrolled into view, so the icons
+  * are drawn in Render() rather than by child controls, and the expand /
+  * collapse button is drawn here but clicked through the list. */
 class ObjectPanel : public GG::Control {
 public:
-    ObjectPanel(GG::X w, GG::Y h, TemporaryPtr<const UniverseObject> obj, bool expanded, bool has_contents, int indent = 0) :
+    ObjectPanel(GG::X w, GG::Y h) :
         Control(GG::X0, GG::Y0, w, h, GG::Flags<GG::WndFlag>()),
-        m_initialized(false),
-        m_object_id(obj ? obj->ID() : INVALID_OBJECT_ID),
-        m_indent(indent),
-        m_expanded(expanded),
-        m_has_contents(has_contents),
-        m_expand_button(0),
-        m_dot(0),
-        m_icon(0),
+        m_object_id(INVALID_OBJECT_ID),
+        m_indent(0),
+        m_expanded(false),
+        m_has_contents(false),
+        m_expand_texture(),
+        m_icon_textures(),
         m_name_label(0),
         m_empire_label(0)
     {
         SetChildClippingMode(ClipToClient);
+
+        boost::shared_ptr<GG::Font> font = ClientUI::GetFont();
+        m_name_label = new GG::TextControl(GG::X0, GG::Y0, GG::X1, h, "", font, ClientUI::TextColor(), GG::FORMAT_LEFT);
+        AttachChild(m_name_label);
+        m_empire_label = new GG::TextControl(GG::X0, GG::Y0, GG::X1, h, "", font, ClientUI::TextColor(), GG::FORMAT_LEFT);
+        AttachChild(m_empire_label);
+
+        DoLayout();
     }
 
     int                 ObjectID() const { return m_object_id; }
 
+    /** Returns the left edge of the expand / collapse button, relative to the
+      * left of a panel of height \a h showing an object at \a indent. */
+    static GG::X        ExpandButtonLeft(GG::Y h, int indent)
+    { return GG::X(Value(h)) * indent; }
+
+    /** Returns the width of the expand / collapse button in a panel of height
+      * \a h. */
+    static GG::X        ExpandButtonWidth(GG::Y h)
+    { return GG::X(Value(h)); }
+
     virtual void        Render() {
-        if (!m_initialized)
-            Init();
         GG::Clr background_clr = this->Disabled() ? ClientUI::WndColor() : ClientUI::CtrlColor();
         GG::FlatRectangle(UpperLeft(), LowerRight(), background_clr, ClientUI::WndOuterBorderColor(), 1u);
+
+        const GG::X ICON_WIDTH(Value(ClientHeight()));
+        const GG::X PAD(3);
+
+        glColor(GG::CLR_WHITE);
+        GG::Pt ul = ClientUpperLeft() + GG::Pt(ExpandButtonLeft(ClientHeight(), m_indent), GG::Y0);
+        RenderFitted(m_expand_texture, ul, ul + GG::Pt(ICON_WIDTH, ClientHeight()));
+        ul.x += ICON_WIDTH + PAD;
+
+        for (std::vector<boost::shared_ptr<GG::Texture> >::const_iterator it = m_icon_textures.begin();
+             it != m_icon_textures.end(); ++it)
+        { RenderFitted(*it, ul, ul + GG::Pt(ICON_WIDTH, ClientHeight())); }
     }
 
     virtual void        SizeMove(const GG::Pt& ul, const GG::Pt& lr) {
@@ -1000,67 +1031,38 @@ public:
             DoLayout();
     }
 
+    /** Sets the panel to show the object with id \a object_id. */
+    void                SetObject(int object_id, bool expanded, bool has_contents, int indent) {
+        m_object_id = object_id;
+        m_expanded = expanded;
+        m_has_contents = has_contents;
+        m_indent = indent;
+        Refresh();
+    }
+
     void                Refresh() {
-        if (!m_initialized)
-            return;
-        boost::shared_ptr<GG::Font> font = ClientUI::GetFont();
-        GG::Clr clr = ClientUI::TextColor();
-        //int client_empire_id = HumanClientApp::GetApp()->EmpireID();
-        GG::Flags<GG::GraphicStyle> style = GG::GRAPHIC_CENTER | GG::GRAPHIC_VCENTER | GG::GRAPHIC_FITGRAPHIC | GG::GRAPHIC_PROPSCALE;
-
-        delete m_dot;           m_dot = 0;
-        delete m_expand_button; m_expand_button = 0;
-        delete m_icon;          m_icon = 0;
-        delete m_name_label;    m_name_label = 0;
-
-        if (m_has_contents) {
-            m_expand_button = new GG::Button(GG::X0, GG::Y0, GG::X(16), GG::Y(16),
-                                                "", font, GG::CLR_WHITE, GG::CLR_ZERO, GG::ONTOP | GG::INTERACTIVE);
-            AttachChild(m_expand_button);
-            GG::Connect(m_expand_button->LeftClickedSignal, &ObjectPanel::ExpandCollapseButtonPressed, this);
-
-            if (m_expanded) {
-                m_expand_button->SetUnpressedGraphic(GG::SubTexture(ClientUI::GetTexture( ClientUI::ArtDir() / "icons" / "buttons" / "minusnormal.png"     , true)));
-                m_expand_button->SetPressedGraphic  (GG::SubTexture(ClientUI::GetTexture( ClientUI::ArtDir() / "icons" / "buttons" / "minusclicked.png"    , true)));
-                m_expand_button->SetRolloverGraphic (GG::SubTexture(ClientUI::GetTexture( ClientUI::ArtDir() / "icons" / "buttons" / "minusmouseover.png"  , true)));
-            } else {
-                m_expand_button->SetUnpressedGraphic(GG::SubTexture(ClientUI::GetTexture( ClientUI::ArtDir() / "icons" / "buttons" / "plusnormal.png"   , true)));
-                m_expand_button->SetPressedGraphic  (GG::SubTexture(ClientUI::GetTexture( ClientUI::ArtDir() / "icons" / "buttons" / "plusclicked.png"  , true)));
-                m_expand_button->SetRolloverGraphic (GG::SubTexture(ClientUI::GetTexture( ClientUI::ArtDir() / "icons" / "buttons" / "plusmouseover.png", true)));
-            }
-        } else {
-            m_dot = new GG::StaticGraphic(GG::X0, GG::Y0, GG::X(16), GG::Y(16),
-                                          ClientUI::GetTexture(ClientUI::ArtDir() / "icons" / "dot.png", true),
-                                          style, GG::Flags<GG::WndFlag>());
-            AttachChild(m_dot);
-        }
+        if (m_has_contents)
+            m_expand_texture = ClientUI::GetTexture(ClientUI::ArtDir() / "icons" / "buttons" / (m_expanded ? "minusnormal.png" : "plusnormal.png"), true);
+        else
+            m_expand_texture = ClientUI::GetTexture(ClientUI::ArtDir() / "icons" / "dot.png", true);
 
         TemporaryPtr<const UniverseObject> obj = GetUniverseObject(m_object_id);
-        std::vector<boost::shared_ptr<GG::Texture> > textures = ObjectTextures(obj);
-
-        m_icon = new MultiTextureStaticGraphic(GG::X0, GG::Y0, GG::X(Value(ClientHeight())), ClientHeight(),
-                                                textures, std::vector<GG::Flags<GG::GraphicStyle> >(textures.size(), style));
-        AttachChild(m_icon);
+        if (obj)
+            m_icon_textures = ObjectTextures(obj);
+        else
+            m_icon_textures.clear();
 
-        m_name_label = new GG::TextControl(GG::X0, GG::Y0, GG::X(Value(ClientHeight())), ClientHeight(), ObjectName(obj), font, clr, GG::FORMAT_LEFT);
-        AttachChild(m_name_label);
+        m_name_label->SetText(ObjectName(obj));
 
         std::pair<std::string, GG::Clr> empire_and_colour = ObjectEmpireNameAndColour(obj);
-        m_empire_label = new GG::TextControl(GG::X0, GG::Y0, GG::X(Value(ClientHeight())), ClientHeight(), empire_and_colour.first, font, empire_and_colour.second, GG::FORMAT_LEFT);
-        AttachChild(m_empire_label);
+        m_empire_label->SetText(empire_and_colour.first);
+        m_empire_label->SetTextColor(empire_and_colour.second);
 
         DoLayout();
     }
 
-    void                SetHasContents(bool has_contents)
-    { m_has_contents = has_contents; }
-
-    mutable boost::signals2::signal<void ()>  ExpandCollapseSignal;
 private:
     void                DoLayout() {
-        if (!m_initialized)
-            return;
-
         const GG::X ICON_WIDTH(Value(ClientHeight()));
 
         GG::X indent(ICON_WIDTH * m_indent);
@@ -1069,19 +1071,11 @@ private:
         GG::Y bottom(ClientHeight());
         GG::X PAD(3);
 
-        GG::X ctrl_width = ICON_WIDTH;
-
-        if (m_expand_button) {
-            m_expand_button->SizeMove(GG::Pt(left, top), GG::Pt(left + ctrl_width, bottom));
-        } else if (m_dot) {
-            m_dot->SizeMove(GG::Pt(left, top), GG::Pt(left + ctrl_width, bottom));
-        }
-        left += ctrl_width + PAD;
-
-        m_icon->SizeMove(GG::Pt(left, top), GG::Pt(left + ctrl_width, bottom));
-        left += ctrl_width + PAD;
+        // expand / collapse button and icon are drawn in Render()
+        left += ICON_WIDTH + PAD;
+        left += ICON_WIDTH + PAD;
 
-        ctrl_width = GG::X(ClientUI::Pts()*14) - indent;    // so second column all line up
+        GG::X ctrl_width = GG::X(ClientUI::Pts()*14) - indent;    // so second column all line up
         m_name_label->SizeMove(GG::Pt(left, top), GG::Pt(left + ctrl_width, bottom));
         left += ctrl_width + PAD;
 
@@ -1090,113 +1084,44 @@ private:
         left += ctrl_width + PAD;
     }
 
-    void                ExpandCollapseButtonPressed() {
-        m_expanded = !m_expanded;
-        ExpandCollapseSignal();
-    }
-
-    void                Init() {
-        if (m_initialized)
+    /** Draws \a texture scaled to fit between \a ul and \a lr, keeping its
+      * proportions, and centred. */
+    static void         RenderFitted(const boost::shared_ptr<GG::Texture>& texture, const GG::Pt& ul, const GG::Pt& lr) {
+        if (!texture || texture->DefaultWidth() <= GG::X0 || texture->DefaultHeight() <= GG::Y0)
             return;
-        m_initialized = true;
-        Refresh();
-    }
-
-    bool                        m_initialized;
-
-    int                         m_object_id;
-    int                         m_indent;
-    bool                        m_expanded;
-    bool                        m_has_contents;
-
-    GG::Button*                 m_expand_button;
-    GG::StaticGraphic*          m_dot;
-    MultiTextureStaticGraphic*  m_icon;
-    GG::TextControl*            m_name_label;
-    GG::TextControl*            m_empire_label;
-};
-
-////////////////////////////////////////////////
-// ObjectRow
-////////////////////////////////////////////////
-class ObjectRow : public GG::ListBox::Row {
-public:
-    ObjectRow(GG::X w, GG::Y h, TemporaryPtr<const UniverseObject> obj, bool expanded,
-              int container_object_panel,
-              const std::set<int>& contained_object_panels, int indent) :
-        GG::ListBox::Row(w, h, "ObjectRow", GG::ALIGN_CENTER, 1),
-        m_panel(0),
-        m_container_object_panel(container_object_panel),
-        m_contained_object_panels(contained_object_panels)
-    {
-        SetName("ObjectRow");
-        SetChildClippingMode(ClipToClient);
-        SetDragDropDataType("ObjectRow");
-        m_panel = new ObjectPanel(w, h, obj, expanded, !m_contained_object_panels.empty(), indent);
-        push_back(m_panel);
-        GG::Connect(m_panel->ExpandCollapseSignal,  &ObjectRow::ExpandCollapseClicked, this);
-    }
-
-    int                     ObjectID() const {
-        if (m_panel)
-            return m_panel->ObjectID();
-        return INVALID_OBJECT_ID;
-    }
-
-    int                     ContainedByPanel() const
-    { return m_container_object_panel; }
-
-    const std::set<int>& ContainedPanels() const
-    { return m_contained_object_panels; }
-
-    void                    SetContainedPanels(const std::set<int>& contained_object_panels) {
-        m_contained_object_panels = contained_object_panels;
-        m_panel->SetHasContents(!m_contained_object_panels.empty());
-        m_panel->Refresh();
+        double scale = std::min(Value(lr.x - ul.x) / static_cast<double>(Value(texture->DefaultWidth())),
+                                Value(lr.y - ul.y) / static_cast<double>(Value(texture->DefaultHeight())));
+        GG::X width(static_cast<int>(Value(texture->DefaultWidth()) * scale));
+        GG::Y height(static_cast<int>(Value(texture->DefaultHeight()) * scale));
+        GG::Pt texture_ul = ul + GG::Pt((lr.x - ul.x - width) / 2, (lr.y - ul.y - height) / 2);
+        texture->OrthoBlit(texture_ul, texture_ul + GG::Pt(width, height));
     }
 
-    void                    Update()
-    { m_panel->Refresh(); }
+    int                                             m_object_id;
+    int                                             m_indent;
+    bool                                            m_expanded;
+    bool                                            m_has_contents;
 
-    /** This function overridden because otherwise, rows don't expand
-        * larger than their initial size when resizing the list. */
-    void                    SizeMove(const GG::Pt& ul, const GG::Pt& lr) {
-        const GG::Pt old_size = Size();
-        GG::ListBox::Row::SizeMove(ul, lr);
-        //std::cout << "ObjectRow::SizeMove size: (" << Value(Width()) << ", " << Value(Height()) << ")" << std::endl;
-        if (!empty() && old_size != Size() && m_panel)
-            m_panel->Resize(Size());
-    }
-
-    void                    ExpandCollapseClicked()
-    { ExpandCollapseSignal(m_panel ? m_panel->ObjectID() : INVALID_OBJECT_ID); }
-
-    mutable boost::signals2::signal<void (int)>   ExpandCollapseSignal;
-private:
-    ObjectPanel*        m_panel;
-    int                 m_container_object_panel;
-    std::set<int>       m_contained_object_panels;
+    boost::shared_ptr<GG::Texture>                  m_expand_texture;
+    std::vector<boost::shared_ptr<GG::Texture> >    m_icon_textures;
+    GG::TextControl*                                m_name_label;
+    GG::TextControl*                                m_empire_label;
 };
 
 ////////////////////////////////////////////////
 // ObjectListBox
 ////////////////////////////////////////////////
-class ObjectListBox : public CUIListBox {
+class ObjectListBox : public GG::VirtualListBox {
 public:
     ObjectListBox() :
-        CUIListBox(GG::X0, GG::Y0, GG::X1, GG::Y1),
+        GG::VirtualListBox(GG::X0, GG::Y0, GG::X1, GG::Y1, ClientUI::CtrlBorderColor(), ClientUI::CtrlColor()),
+        m_object_rows(),
         m_object_change_connections(),
         m_collapsed_objects(),
         m_filter_condition(0),
         m_visibilities()
     {
-        // preinitialize listbox/row column widths, because what
-        // ListBox::Insert does on default is not suitable for this case
-        SetNumCols(1);
-        SetColWidth(0, GG::X0);
-        LockColWidths();
-
-        SetVScrollWheelIncrement(Value(ListRowHeight())*4);
+        SetModel(&m_object_rows);
 
         m_filter_condition = new Condition::All();
 
@@ -1210,24 +1135,10 @@ public:
         //m_visibilities[OBJ_SYSTEM].insert(SHOW_PREVIOUSLY_VISIBLE);
         //m_visibilities[OBJ_FIELD].insert(SHOW_VISIBLE);
 
+        GG::Connect(LeftClickedSignal,                          &ObjectListBox::RowLeftClicked,         this);
         GG::Connect(GetUniverse().UniverseObjectDeleteSignal,   &ObjectListBox::UniverseObjectDeleted,  this);
     }
 
-    virtual void    SizeMove(const GG::Pt& ul, const GG::Pt& lr) {
-        const GG::Pt old_size = Size();
-        CUIListBox::SizeMove(ul, lr);
-        //std::cout << "ObjectListBox::SizeMove size: (" << Value(Width()) << ", " << Value(Height()) << ")" << std::endl;
-        if (old_size != Size()) {
-            const GG::Pt row_size = ListRowSize();
-            //std::cout << "ObjectListBox::SizeMove list row size: (" << Value(row_size.x) << ", " << Value(row_size.y) << ")" << std::endl;
-            for (GG::ListBox::iterator it = begin(); it != end(); ++it)
-                (*it)->Resize(row_size);
-        }
-    }
-
-    GG::Pt          ListRowSize() const
-    { return GG::Pt(Width() - ClientUI::ScrollWidth() - 5, ListRowHeight()); }
-
     static GG::Y    ListRowHeight()
     { return GG::Y(ClientUI::Pts() * 2); }
 
@@ -1237,11 +1148,19 @@ public:
     const std::map<UniverseObjectType, std::set<VIS_DISPLAY> >  Visibilities() const
     { return m_visibilities; }
 
+    /** Returns the id of the object in row \a row, or INVALID_OBJECT_ID if
+      * there is no such row. */
+    int             ObjectInRow(std::size_t row) const {
+        if (row >= m_object_rows.m_rows.size())
+            return INVALID_OBJECT_ID;
+        return m_object_rows.m_rows[row].object_id;
+    }
+
     void            CollapseObject(int object_id = INVALID_OBJECT_ID) {
         if (object_id == INVALID_OBJECT_ID) {
-            for (GG::ListBox::iterator row_it = this->begin(); row_it != this->end(); ++row_it)
-                if (const ObjectRow* object_row = dynamic_cast<const ObjectRow*>(*row_it))
-                    m_collapsed_objects.insert(object_row->ObjectID());
+            for (std::vector<ObjectRowData>::const_iterator row_it = m_object_rows.m_rows.begin();
+                 row_it != m_object_rows.m_rows.end(); ++row_it)
+            { m_collapsed_objects.insert(row_it->object_id); }
         } else {
             m_collapsed_objects.insert(object_id);
         }
@@ -1280,7 +1199,7 @@ public:
     }
 
     void            ClearContents() {
-        Clear();
+        m_object_rows.m_rows.clear();
         for (std::map<int, boost::signals2::connection>::iterator it = m_object_change_connections.begin();
              it != m_object_change_connections.end(); ++it)
         { it->second.disconnect(); }
@@ -1308,7 +1227,6 @@ public:
     }
 
     void            Refresh() {
-        std::size_t first_visible_queue_row = std::distance(this->begin(), this->FirstRowShown());
         ClearContents();
 
         const ObjectMap& objects = GetUniverse().Objects();
@@ -1518,112 +1436,112 @@ public:
         }
 
 
-        if (!this->Empty())
-            this->BringRowIntoView(--this->end());
-        if (first_visible_queue_row < this->NumRows())
-            this->BringRowIntoView(boost::next(this->begin(), first_visible_queue_row));
-    }
-
-    void            UpdateObjectPanel(int object_id = INVALID_OBJECT_ID) {
-        if (object_id == INVALID_OBJECT_ID)
-            return;
-        for (GG::ListBox::iterator it = this->begin(); it != this->end(); ++it) {
-            if (ObjectRow* row = dynamic_cast<ObjectRow*>(*it)) {
-                row->Update();
-                return;
-            }
-        }
+        // the scroll position is kept, so the same rows stay in view if
+        // they're still shown
+        RowsReset();
     }
 
     mutable boost::signals2::signal<void ()> ExpandCollapseSignal;
 
 private:
-    void            AddObjectRow(int object_id, int container, const std::set<int>& contents, int indent)
-    { AddObjectRow(object_id, container, contents, indent, this->end()); }
+    /** An object shown in the list, and where it is in the tree of objects
+      * and their contents. */
+    struct ObjectRowData {
+        ObjectRowData(int object_id_, int container_, const std::set<int>& contents_, int indent_, bool expanded_) :
+            object_id(object_id_),
+            container(container_),
+            contents(contents_),
+            indent(indent_),
+            expanded(expanded_)
+        {}
+        int             object_id;
+        int             container;  ///< id of the object in the row that contains this row, if any
+        std::set<int>   contents;   ///< ids of the objects in the rows contained by this row
+        int             indent;
+        bool            expanded;
+    };
 
-    void            AddObjectRow(int object_id, int container, const std::set<int>& contents,
-                                 int indent, GG::ListBox::iterator it)
-    {
+    /** The objects shown, in the order they are listed. */
+    class ObjectRowModel : public GG::VirtualListBox::Model {
+    public:
+        virtual std::size_t NumRows() const
+        { return m_rows.size(); }
+
+        virtual GG::Y       RowHeight(std::size_t row) const
+        { return ListRowHeight(); }
+
+        virtual GG::Wnd*    CreateRowWnd(GG::X width)
+        { return new ObjectPanel(width, ListRowHeight()); }
+
+        virtual void        UpdateRowWnd(GG::Wnd* wnd, std::size_t row, bool selected) {
+            if (ObjectPanel* panel = dynamic_cast<ObjectPanel*>(wnd)) {
+                const ObjectRowData& data = m_rows[row];
+                panel->SetObject(data.object_id, data.expanded, !data.contents.empty(), data.indent);
+            }
+        }
+
+        std::vector<ObjectRowData>  m_rows;
+    };
+
+    void            AddObjectRow(int object_id, int container, const std::set<int>& contents, int indent) {
         TemporaryPtr<const UniverseObject> obj = GetUniverseObject(object_id);
         if (!obj)
             return;
-        const GG::Pt row_size = ListRowSize();
-        ObjectRow* object_row = new ObjectRow(row_size.x, row_size.y, obj, !ObjectCollapsed(object_id),
-                                              container, contents, indent);
-        this->Insert(object_row, it);
-        object_row->Resize(row_size);
-        GG::Connect(object_row->ExpandCollapseSignal,   &ObjectListBox::ObjectExpandCollapseClicked,
-                    this, boost::signals2::at_front);
+        m_object_rows.m_rows.push_back(ObjectRowData(object_id, container, contents, indent, !ObjectCollapsed(object_id)));
         m_object_change_connections[obj->ID()].disconnect();
         m_object_change_connections[obj->ID()] = GG::Connect(obj->StateChangedSignal,
             boost::bind(&ObjectListBox::ObjectStateChanged, this, obj->ID()), boost::signals2::at_front);
     }
 
-    // Removes row of indicated object, and all contained rows, recursively.
-    // Also updates contents tracking of containing row, if any.
+    // Removes row of indicated object, and all contained rows, which follow
+    // it with greater indents.  Also updates contents tracking of containing
+    // row, if any.
     void            RemoveObjectRow(int object_id) {
         if (object_id == INVALID_OBJECT_ID)
             return;
-        int container_object_id = INVALID_OBJECT_ID;
-        for (GG::ListBox::iterator it = this->begin(); it != this->end(); ++it) {
-            if (ObjectRow* object_row = dynamic_cast<ObjectRow*>(*it)) {
-                if (object_row->ObjectID() == object_id) {
-                    container_object_id = object_row->ContainedByPanel();
-                    RemoveObjectRow(it);
-                    break;
-                }
-            }
-        }
-
-        if (container_object_id == INVALID_OBJECT_ID)
+        std::vector<ObjectRowData>& rows = m_object_rows.m_rows;
+        std::size_t first = 0;
+        while (first < rows.size() && rows[first].object_id != object_id)
+            ++first;
+        if (first == rows.size())
             return;
 
+        int container_object_id = rows[first].container;
+        std::size_t last = first + 1;
+        while (last < rows.size() && rows[last].indent > rows[first].indent)
+            ++last;
+
+        // remove any signals related to the removed rows
+        for (std::size_t i = first; i < last; ++i) {
+            m_object_change_connections[rows[i].object_id].disconnect();
+            m_object_change_connections.erase(rows[i].object_id);
+        }
+        rows.erase(rows.begin() + first, rows.begin() + last);
+
         // remove this row from parent row's contents
-        for (GG::ListBox::iterator it = this->begin(); it != this->end(); ++it) {
-            if (ObjectRow* object_row = dynamic_cast<ObjectRow*>(*it)) {
-                if (object_row->ObjectID() == container_object_id) {
-                    const std::set<int>& contents = object_row->ContainedPanels();
-                    std::set<int> new_contents;
-                    for (std::set<int>::const_iterator contents_it = contents.begin();
-                         contents_it != contents.end(); ++contents_it)
-                    {
-                        if (*contents_it != object_id)
-                            new_contents.insert(*contents_it);
-                    }
-                    object_row->SetContainedPanels(new_contents);
-                    object_row->Update();
+        if (container_object_id != INVALID_OBJECT_ID) {
+            for (std::vector<ObjectRowData>::iterator it = rows.begin(); it != rows.end(); ++it) {
+                if (it->object_id == container_object_id) {
+                    it->contents.erase(object_id);
                     break;
                 }
             }
         }
+
+        RowsReset();
     }
 
-    // Removes row at indicated iterator location and its contained rows.
-    // Does not adjust containing row.
-    void            RemoveObjectRow(GG::ListBox::iterator it) {
-        if (it == this->end())
+    void            RowLeftClicked(std::size_t row, const GG::Pt& pt) {
+        if (row >= m_object_rows.m_rows.size())
+            return;
+        const ObjectRowData& data = m_object_rows.m_rows[row];
+        if (data.contents.empty())
             return;
-        ObjectRow* object_row = dynamic_cast<ObjectRow*>(*it);
-
-        // recursively remove contained rows first
-        const std::set<int>& contents = object_row->ContainedPanels();
-        for (unsigned int i = 0; i < contents.size(); ++i) {
-            GG::ListBox::iterator next_it = it; ++next_it;
-            if (next_it == this->end())
-                break;
-            ObjectRow* contained_row = dynamic_cast<ObjectRow*>(*next_it);
-            if (!contained_row)
-                continue;
-            // remove only rows that are contained by this row
-            if (contained_row->ContainedByPanel() != object_row->ObjectID())
-                break;
-            RemoveObjectRow(next_it);
-        }
 
-        // erase this row and remove any signals related to it
-        m_object_change_connections[object_row->ObjectID()].disconnect();
-        m_object_change_connections.erase(object_row->ObjectID());
-        this->Erase(it);
+        // was the expand / collapse button drawn by the row's panel clicked?
+        GG::X left = ClientUpperLeft().x + ObjectPanel::ExpandButtonLeft(ListRowHeight(), data.indent);
+        if (left <= pt.x && pt.x < left + ObjectPanel::ExpandButtonWidth(ListRowHeight()))
+            ObjectExpandCollapseClicked(data.object_id);
     }
 
     void            ObjectExpandCollapseClicked(int object_id) {
@@ -1640,13 +1558,13 @@ private:
         if (object_id == INVALID_OBJECT_ID)
             return;
         TemporaryPtr<const UniverseObject> obj = GetUniverseObject(object_id);
-        Logger().debugStream() << "ObjectListBox::ObjectStateChanged: " << obj->Name();
         if (!obj)
             return;
+        Logger().debugStream() << "ObjectListBox::ObjectStateChanged: " << obj->Name();
 
         UniverseObjectType type = obj->ObjectType();
         if (type == OBJ_SHIP || type == OBJ_BUILDING)
-            UpdateObjectPanel(object_id);
+            RowsChanged();
         else if (type == OBJ_FLEET || type == OBJ_PLANET || type == OBJ_SYSTEM)
             Refresh();
     }
@@ -1656,6 +1574,7 @@ private:
             RemoveObjectRow(obj->ID());
     }
 
+    ObjectRowModel                                      m_object_rows;
     std::map<int, boost::signals2::connection>          m_object_change_connections;
     std::set<int>                                       m_collapsed_objects;
     Condition::ConditionBase*                           m_filter_condition;
@@ -1740,15 +1659,15 @@ void ObjectListWnd::SizeMove(const GG::Pt& ul, const GG::Pt& lr) {
 void ObjectListWnd::Refresh()
 { m_list_box->Refresh(); }
 
-void ObjectListWnd::ObjectDoubleClicked(GG::ListBox::iterator it) {
-    int object_id = ObjectInRow(it);
+void ObjectListWnd::ObjectDoubleClicked(std::size_t row) {
+    int object_id = m_list_box->ObjectInRow(row);
     if (object_id != INVALID_OBJECT_ID)
         ObjectDoubleClickedSignal(object_id);
     ClientUI::GetClientUI()->ZoomToObject(object_id);
 }
 
-void ObjectListWnd::ObjectRightClicked(GG::ListBox::iterator it, const GG::Pt& pt) {
-    int object_id = ObjectInRow(it);
+void ObjectListWnd::ObjectRightClicked(std::size_t row, const GG::Pt& pt) {
+    int object_id = m_list_box->ObjectInRow(row);
     if (object_id == INVALID_OBJECT_ID)
         return;
     HumanClientApp* app = HumanClientApp::GetApp();
@@ -1803,16 +1722,6 @@ void ObjectListWnd::ObjectRightClicked(GG::ListBox::iterator it, const GG::Pt& p
     }
 }
 
-int ObjectListWnd::ObjectInRow(GG::ListBox::iterator it) const {
-    if (it == m_list_box->end())
-        return INVALID_OBJECT_ID;
-
-    if (ObjectRow* obj_row = dynamic_cast<ObjectRow*>(*it))
-        return obj_row->ObjectID();
-
-    return INVALID_OBJECT_ID;
-}
-
 void ObjectListWnd::FilterClicked() {
     FilterDialog dlg(GG::X(100), GG::Y(100),
                      m_list_box->Visibilities(), m_list_box->FilterCondition());
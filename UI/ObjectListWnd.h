@@ -29,9 +29,8 @@ public:
 private:
     void            DoLayout();
 
-    void            ObjectDoubleClicked(GG::ListBox::iterator it);
-    void            ObjectRightClicked(GG::ListBox::iterator it, const GG::Pt& pt);
-    int             ObjectInRow(GG::ListBox::iterator it) const;
+    void            ObjectDoubleClicked(std::size_t row);
+    void            ObjectRightClicked(std::size_t row, const GG::Pt& pt);
 
     void            FilterClicked();
     void            SortClicked();
@@ -20,6 +20,7 @@
 #include <GG/DrawUtil.h>
 #include <GG/Layout.h>
 #include <GG/StaticGraphic.h>
+#include <GG/VirtualListBox.h>
 
 #include <algorithm>
 
@@ -464,6 +465,21 @@ private:
                           std::pair<std::string,
                                     std::vector<std::pair<double, double> > > > DependencyArcsMap;
 
+    /** The results of laying out a set of techs, kept so that showing the
+      * same techs again, such as when a filter is toggled back, does not
+      * require the graph layout to be redone. */
+    struct CachedLayout {
+        CachedLayout() : tech_positions(), dependency_arcs(), width(GG::X0), height(GG::Y0) {}
+        std::map<std::string, GG::Pt>   tech_positions;
+        DependencyArcsMap               dependency_arcs;
+        GG::X                           width;
+        GG::Y                           height;
+    };
+    /** Layouts are keyed by the spacing and sizes they were done with, and by
+      * the techs in them. */
+    typedef std::pair<std::vector<double>, std::set<std::string> >  LayoutCacheKey;
+    typedef std::map<LayoutCacheKey, CachedLayout>                  LayoutCache;
+
     class LayoutSurface : public GG::Wnd {
     public:
         LayoutSurface() :
@@ -485,6 +501,10 @@ private:
 
     void Layout(bool keep_position);    // lays out tech panels
 
+    /** Returns the layout of the techs in \a key, doing the layout only if
+      * it isn't cached already. */
+    static const CachedLayout& GetCachedLayout(const LayoutCacheKey& key);
+
     void DoLayout();    // arranges child controls (scrolls, buttons) to account for window size
 
     bool TechVisible(const std::string& tech_name);
@@ -509,7 +529,6 @@ private:
     std::set<TechStatus>    m_tech_statuses_shown;
     std::string             m_selected_tech_name;
     std::string             m_browsed_tech_name;
-    TechTreeLayout          m_graph;
 
     std::map<std::string, TechPanel*>   m_techs;
     DependencyArcsMap                   m_dependency_arcs;
@@ -814,7 +833,6 @@ TechTreeWnd::LayoutPanel::LayoutPanel(GG::X w, GG::Y h) :
     m_tech_statuses_shown(),
     m_selected_tech_name(),
     m_browsed_tech_name(),
-    m_graph(),
     m_layout_surface(0),
     m_vscroll(0),
     m_hscroll(0),
@@ -1005,7 +1023,6 @@ void TechTreeWnd::LayoutPanel::Clear() {
     for (std::map<std::string, TechPanel*>::const_iterator it = m_techs.begin(); it != m_techs.end(); ++it)
         delete it->second;
     m_techs.clear();
-    m_graph.Clear();
 
     m_dependency_arcs.clear();
 
@@ -1150,75 +1167,45 @@ void TechTreeWnd::LayoutPanel::Layout(bool keep_position) {
 
     Logger().debugStream() << "Tech Tree Layout Preparing Tech Data";
 
-    // create a node for every tech
+    LayoutCacheKey key;
+    key.first.push_back(WIDTH);
+    key.first.push_back(HEIGHT);
+    key.first.push_back(RANK_SEP);
+    key.first.push_back(NODE_SEP);
+    key.first.push_back(X_MARGIN);
+
     TechManager& manager = GetTechManager();
     for (TechManager::iterator it = manager.begin(); it != manager.end(); ++it) {
         const Tech* tech = *it;
         if (!tech) continue;
         const std::string& tech_name = tech->Name();
         if (!TechVisible(tech_name)) continue;
-        m_techs[tech_name] = new TechPanel(tech_name, this);
-        m_graph.AddNode(tech_name, m_techs[tech_name]->Width(), m_techs[tech_name]->Height());
+        key.second.insert(tech_name);
     }
 
-    // create an edge for every prerequisite
-    for (TechManager::iterator it = manager.begin(); it != manager.end(); ++it) {
-        const Tech* tech = *it;
-        if (!tech) continue;
-        const std::string& tech_name = tech->Name();
-        if (!TechVisible(tech_name)) continue;
-        for (std::set<std::string>::const_iterator prereq_it = tech->Prerequisites().begin();
-             prereq_it != tech->Prerequisites().end(); ++prereq_it)
-        {
-            if (!TechVisible(*prereq_it)) continue;
-            m_graph.AddEdge(*prereq_it, tech_name);
-        }
-    }
-
-    Logger().debugStream() << "Tech Tree Layout Doing Graph Layout";
-
-    //calculate layout
-    m_graph.DoLayout(static_cast<int>(WIDTH + RANK_SEP),
-                     static_cast<int>(HEIGHT + NODE_SEP),
-                     static_cast<int>(X_MARGIN));
+    const CachedLayout& layout = GetCachedLayout(key);
 
     Logger().debugStream() << "Tech Tree Layout Creating Panels";
 
-    // create new tech panels and new dependency arcs 
-    for (TechManager::iterator it = manager.begin(); it != manager.end(); ++it) {
-        const Tech* tech = *it;
-        if (!tech) continue;
-        const std::string& tech_name = tech->Name();
-        if (!TechVisible(tech_name)) continue;
-        //techpanel
-        const TechTreeLayout::Node* node = m_graph.GetNode(tech_name);
-        //move TechPanel
-        TechPanel* tech_panel = m_techs[tech_name];
-        tech_panel->MoveTo(GG::Pt(node->GetX(), node->GetY()));
+    // create new tech panels at their laid out positions
+    for (std::set<std::string>::const_iterator it = key.second.begin(); it != key.second.end(); ++it) {
+        const std::string& tech_name = *it;
+        std::map<std::string, GG::Pt>::const_iterator position_it = layout.tech_positions.find(tech_name);
+        if (position_it == layout.tech_positions.end())
+            continue;
+        TechPanel* tech_panel = new TechPanel(tech_name, this);
+        m_techs[tech_name] = tech_panel;
+        tech_panel->MoveTo(position_it->second);
         m_layout_surface->AttachChild(tech_panel);
         GG::Connect(tech_panel->TechBrowsedSignal,          &TechTreeWnd::LayoutPanel::TechBrowsedSlot,         this);
         GG::Connect(tech_panel->TechClickedSignal,          &TechTreeWnd::LayoutPanel::TechClickedSlot,         this);
         GG::Connect(tech_panel->TechDoubleClickedSignal,    &TechTreeWnd::LayoutPanel::TechDoubleClickedSlot,   this);
-
-        const std::vector<TechTreeLayout::Edge*> edges = m_graph.GetOutEdges(tech_name);
-        //prerequisite edge
-        for (std::vector<TechTreeLayout::Edge*>::const_iterator edge = edges.begin();
-             edge != edges.end(); edge++)
-        {
-            std::vector<std::pair<double, double> > points;
-            const std::string& from = (*edge)->GetTechFrom();
-            const std::string& to   = (*edge)->GetTechTo();
-            if (!GetTech(from) || !GetTech(to)) {
-                Logger().errorStream() << "TechTreeWnd::LayoutPanel::Layout missing arc endpoint tech";
-                continue;
-            }
-            (*edge)->ReadPoints(points);
-            m_dependency_arcs.insert(std::make_pair(from, std::make_pair(to, points)));
-        }
     }
+    m_dependency_arcs = layout.dependency_arcs;
+
     // format window
     GG::Pt client_sz = ClientSize();
-    GG::Pt layout_size(client_sz.x + m_graph.GetWidth(), client_sz.y + m_graph.GetHeight());
+    GG::Pt layout_size(client_sz.x + layout.width, client_sz.y + layout.height);
     m_layout_surface->Resize(layout_size);
     // format scrollbar
     m_vscroll->SizeScroll(0, Value(layout_size.y - 1), std::max(50, Value(std::min(layout_size.y / 10, client_sz.y))), Value(client_sz.y));
@@ -1256,6 +1243,83 @@ void TechTreeWnd::LayoutPanel::Layout(bool keep_position) {
     MoveChildUp(m_hscroll);
 }
 
+const TechTreeWnd::LayoutPanel::CachedLayout& TechTreeWnd::LayoutPanel::GetCachedLayout(const LayoutCacheKey& key) {
+    // each combination of shown categories and statuses gives a different
+    // set of techs, so the cache is emptied if it grows unreasonably large
+    const std::size_t MAX_CACHED_LAYOUTS = 64;
+    static LayoutCache s_layout_cache;
+
+    LayoutCache::const_iterator cache_it = s_layout_cache.find(key);
+    if (cache_it != s_layout_cache.end()) {
+        Logger().debugStream() << "Tech Tree Layout Using Cached Layout";
+        return cache_it->second;
+    }
+    if (MAX_CACHED_LAYOUTS <= s_layout_cache.size())
+        s_layout_cache.clear();
+
+    Logger().debugStream() << "Tech Tree Layout Doing Graph Layout";
+
+    const double WIDTH = key.first[0];
+    const double HEIGHT = key.first[1];
+    const double RANK_SEP = key.first[2];
+    const double NODE_SEP = key.first[3];
+    const double X_MARGIN = key.first[4];
+
+    // create a node for every tech, in the tech manager's order, as the
+    // layout depends on the order in which nodes are added
+    TechTreeLayout graph;
+    TechManager& manager = GetTechManager();
+    for (TechManager::iterator it = manager.begin(); it != manager.end(); ++it) {
+        const Tech* tech = *it;
+        if (!tech || key.second.find(tech->Name()) == key.second.end()) continue;
+        graph.AddNode(tech->Name(), GG::X(static_cast<int>(WIDTH)), GG::Y(static_cast<int>(HEIGHT)));
+    }
+
+    // create an edge for every prerequisite
+    for (TechManager::iterator it = manager.begin(); it != manager.end(); ++it) {
+        const Tech* tech = *it;
+        if (!tech || key.second.find(tech->Name()) == key.second.end()) continue;
+        for (std::set<std::string>::const_iterator prereq_it = tech->Prerequisites().begin();
+             prereq_it != tech->Prerequisites().end(); ++prereq_it)
+        {
+            if (key.second.find(*prereq_it) == key.second.end()) continue;
+            graph.AddEdge(*prereq_it, tech->Name());
+        }
+    }
+
+    //calculate layout
+    graph.DoLayout(static_cast<int>(WIDTH + RANK_SEP),
+                   static_cast<int>(HEIGHT + NODE_SEP),
+                   static_cast<int>(X_MARGIN));
+
+    // record the positions of the techs and the points of their dependency arcs
+    CachedLayout& layout = s_layout_cache[key];
+    for (std::set<std::string>::const_iterator it = key.second.begin(); it != key.second.end(); ++it) {
+        const TechTreeLayout::Node* node = graph.GetNode(*it);
+        if (!node) continue;
+        layout.tech_positions[*it] = GG::Pt(node->GetX(), node->GetY());
+
+        const std::vector<TechTreeLayout::Edge*>& edges = graph.GetOutEdges(*it);
+        for (std::vector<TechTreeLayout::Edge*>::const_iterator edge = edges.begin();
+             edge != edges.end(); edge++)
+        {
+            std::vector<std::pair<double, double> > points;
+            const std::string& from = (*edge)->GetTechFrom();
+            const std::string& to   = (*edge)->GetTechTo();
+            if (!GetTech(from) || !GetTech(to)) {
+                Logger().errorStream() << "TechTreeWnd::LayoutPanel::GetCachedLayout missing arc endpoint tech";
+                continue;
+            }
+            (*edge)->ReadPoints(points);
+            layout.dependency_arcs.insert(std::make_pair(from, std::make_pair(to, points)));
+        }
+    }
+    layout.width = graph.GetWidth();
+    layout.height = graph.GetHeight();
+
+    return layout;
+}
+
 bool TechTreeWnd::LayoutPanel::TechVisible(const std::string& tech_name) {
     const Tech* tech = GetTech(tech_name);
     if (!tech)
@@ -1370,7 +1434,7 @@ void TechTreeWnd::LayoutPanel::TreeZoomOutClicked()
 //////////////////////////////////////////////////
 // TechTreeWnd::TechListBox                     //
 //////////////////////////////////////////////////
-class TechTreeWnd::TechListBox : public CUIListBox {
+class TechTreeWnd::TechListBox : public GG::VirtualListBox {
 public:
     /** \name Structors */ //@{
     TechListBox(GG::X x, GG::Y y, GG::X w, GG::Y h);
@@ -1400,30 +1464,105 @@ public:
     mutable TechClickSignalType TechDoubleClickedSignal;///< emitted when a technology is double-clicked
 
 private:
-    class TechRow : public CUIListBox::Row {
+    /** Shows one tech at a time.  A handful of these are reused for whichever
+      * techs are scrolled into view. */
+    class TechRow : public GG::Control {
     public:
-        TechRow(GG::X w, const std::string& tech_name);
-        const std::string&          GetTech() { return m_tech; }
+        TechRow(GG::X w, GG::Y h);
+        void                        SetTech(const std::string& tech_name);
         virtual void                Render();
+        virtual void                SizeMove(const GG::Pt& ul, const GG::Pt& lr);
         static std::vector<GG::X>   ColWidths(GG::X total_width);
 
     private:
-        std::string m_tech;
+        void                        DoLayout();
+
+        boost::shared_ptr<GG::Texture>  m_icon;
+        GG::Clr                         m_icon_color;
+        std::vector<GG::TextControl*>   m_texts;
+    };
+
+    /** The names of the shown techs, in the order they are listed. */
+    class TechRowModel : public GG::VirtualListBox::Model {
+    public:
+        virtual std::size_t NumRows() const;
+        virtual GG::Y       RowHeight(std::size_t row) const;
+        virtual GG::Wnd*    CreateRowWnd(GG::X width);
+        virtual void        UpdateRowWnd(GG::Wnd* wnd, std::size_t row, bool selected);
+
+        std::vector<std::string>    m_techs;
     };
 
     void    Populate();
-    void    PropagateDoubleClickSignal(GG::ListBox::iterator it);
-    void    PropagateLeftClickSignal(GG::ListBox::iterator it, const GG::Pt& pt);
+    void    PropagateDoubleClickSignal(std::size_t row);
+    void    PropagateLeftClickSignal(std::size_t row, const GG::Pt& pt);
 
-    std::set<std::string>                   m_categories_shown;
-    std::set<TechStatus>                    m_tech_statuses_shown;
-    std::multimap<std::string, TechRow*>    m_all_tech_rows;
+    std::set<std::string>   m_categories_shown;
+    std::set<TechStatus>    m_tech_statuses_shown;
+    TechRowModel            m_tech_rows;
 };
 
+TechTreeWnd::TechListBox::TechRow::TechRow(GG::X w, GG::Y h) :
+    GG::Control(GG::X0, GG::Y0, w, h, GG::Flags<GG::WndFlag>()),
+    m_icon(),
+    m_icon_color(GG::CLR_WHITE),
+    m_texts()
+{
+    boost::shared_ptr<GG::Font> font = ClientUI::GetFont();
+    for (int i = 0; i < 6; ++i) {
+        GG::TextControl* text = new GG::TextControl(GG::X0, GG::Y0, GG::X1, h, "", font, ClientUI::TextColor(),
+                                                    GG::FORMAT_LEFT | GG::FORMAT_VCENTER);
+        text->ClipText(true);
+        AttachChild(text);
+        m_texts.push_back(text);
+    }
+    DoLayout();
+}
+
+void TechTreeWnd::TechListBox::TechRow::SetTech(const std::string& tech_name) {
+    const Tech* this_row_tech = ::GetTech(tech_name);
+    if (!this_row_tech) {
+        m_icon.reset();
+        for (unsigned int i = 0; i < m_texts.size(); ++i)
+            m_texts[i]->SetText("");
+        return;
+    }
+
+    m_icon = ClientUI::TechIcon(tech_name);
+    m_icon_color = ClientUI::CategoryColor(this_row_tech->Category());
+
+    m_texts[0]->SetText(UserString(tech_name));
+    m_texts[1]->SetText(boost::lexical_cast<std::string>(static_cast<int>(this_row_tech->ResearchCost(HumanClientApp::GetApp()->EmpireID()) + 0.5)));
+    m_texts[2]->SetText(boost::lexical_cast<std::string>(this_row_tech->ResearchTime(HumanClientApp::GetApp()->EmpireID())));
+    m_texts[3]->SetText(UserString(this_row_tech->Category()));
+    m_texts[4]->SetText(UserString(boost::lexical_cast<std::string>(this_row_tech->Type())));
+    m_texts[5]->SetText(UserString(this_row_tech->ShortDescription()));
+}
+
 void TechTreeWnd::TechListBox::TechRow::Render() {
     GG::Pt ul = UpperLeft();
     GG::Pt lr = LowerRight();
     GG::FlatRectangle(ul, lr, ClientUI::WndColor(), GG::CLR_WHITE, 1);
+
+    if (!m_icon || m_icon->DefaultWidth() <= GG::X0 || m_icon->DefaultHeight() <= GG::Y0)
+        return;
+
+    // draw the icon scaled to fit the first column, keeping its proportions
+    const GG::X GRAPHIC_WIDTH = ColWidths(Width())[0];
+    double scale = std::min(Value(GRAPHIC_WIDTH) / static_cast<double>(Value(m_icon->DefaultWidth())),
+                            Value(Height()) / static_cast<double>(Value(m_icon->DefaultHeight())));
+    GG::X icon_width(static_cast<int>(Value(m_icon->DefaultWidth()) * scale));
+    GG::Y icon_height(static_cast<int>(Value(m_icon->DefaultHeight()) * scale));
+    GG::Pt icon_ul = ul + GG::Pt((GRAPHIC_WIDTH - icon_width) / 2, (Height() - icon_height) / 2);
+    glColor(m_icon_color);
+    m_icon->OrthoBlit(icon_ul, icon_ul + GG::Pt(icon_width, icon_height));
+}
+
+void TechTreeWnd::TechListBox::TechRow::SizeMove(const GG::Pt& ul, const GG::Pt& lr) {
+    GG::Pt old_size = Size();
+    GG::Control::SizeMove(ul, lr);
+    if (Size() != old_size)
+        DoLayout();
 }
 
 std::vector<GG::X> TechTreeWnd::TechListBox::TechRow::ColWidths(GG::X total_width) {
@@ -1446,70 +1585,39 @@ std::vector<GG::X> TechTreeWnd::TechListBox::TechRow::ColWidths(GG::X total_widt
     return retval;
 }
 
-TechTreeWnd::TechListBox::TechRow::TechRow(GG::X w, const std::string& tech_name) :
-    CUIListBox::Row(w, GG::Y(ClientUI::Pts() * 2 + 5), "TechListBox::TechRow"),
-    m_tech(tech_name)
-{
-    const Tech* this_row_tech = ::GetTech(m_tech);
-    if (!this_row_tech)
-        return;
-
-    std::vector<GG::X> col_widths = ColWidths(w);
-    const GG::X GRAPHIC_WIDTH =   col_widths[0];
-    const GG::X NAME_WIDTH =      col_widths[1];
-    const GG::X COST_WIDTH =      col_widths[2];
-    const GG::X TIME_WIDTH =      col_widths[3];
-    const GG::X CATEGORY_WIDTH =  col_widths[4];
-    const GG::X TYPE_WIDTH =      col_widths[5];
-    const GG::X DESC_WIDTH =      col_widths[6];
-    const GG::Y HEIGHT(Value(GRAPHIC_WIDTH));
-
-    GG::StaticGraphic* graphic = new GG::StaticGraphic(GG::X0, GG::Y0, GRAPHIC_WIDTH, HEIGHT,
-                                                       ClientUI::TechIcon(m_tech),
-                                                       GG::GRAPHIC_PROPSCALE | GG::GRAPHIC_FITGRAPHIC);
-    graphic->SetColor(ClientUI::CategoryColor(this_row_tech->Category()));
-    push_back(graphic);
-
-    boost::shared_ptr<GG::Font> font = ClientUI::GetFont();
-
-    GG::TextControl* text = new GG::TextControl(GG::X0, GG::Y0, NAME_WIDTH, HEIGHT, UserString(m_tech),
-                                                font, ClientUI::TextColor(), GG::FORMAT_LEFT | GG::FORMAT_VCENTER);
-    text->ClipText(true);
-    push_back(text);
-
-    std::string cost_str = boost::lexical_cast<std::string>(static_cast<int>(this_row_tech->ResearchCost(HumanClientApp::GetApp()->EmpireID()) + 0.5));
-    text = new GG::TextControl(GG::X0, GG::Y0, COST_WIDTH, HEIGHT, cost_str, font, ClientUI::TextColor(),
-                               GG::FORMAT_LEFT | GG::FORMAT_VCENTER);
-    push_back(text);
+void TechTreeWnd::TechListBox::TechRow::DoLayout() {
+    // the first column is the icon, which is drawn in Render()
+    std::vector<GG::X> col_widths = ColWidths(Width());
+    GG::X x = col_widths[0];
+    for (unsigned int i = 0; i < m_texts.size(); ++i) {
+        m_texts[i]->SizeMove(GG::Pt(x, GG::Y0), GG::Pt(x + col_widths[i + 1], Height()));
+        x += col_widths[i + 1];
+    }
+}
 
-    std::string time_str = boost::lexical_cast<std::string>(this_row_tech->ResearchTime(HumanClientApp::GetApp()->EmpireID()));
-    text = new GG::TextControl(GG::X0, GG::Y0, TIME_WIDTH, HEIGHT, time_str, font, ClientUI::TextColor(),
-                               GG::FORMAT_LEFT | GG::FORMAT_VCENTER);
-    push_back(text);
+std::size_t TechTreeWnd::TechListBox::TechRowModel::NumRows() const
+{ return m_techs.size(); }
 
-    std::string category_str = UserString(this_row_tech->Category());
-    text = new GG::TextControl(GG::X0, GG::Y0, CATEGORY_WIDTH, HEIGHT, category_str, font, ClientUI::TextColor(),
-                               GG::FORMAT_LEFT | GG::FORMAT_VCENTER);
-    push_back(text);
+GG::Y TechTreeWnd::TechListBox::TechRowModel::RowHeight(std::size_t row) const
+{ return GG::Y(ClientUI::Pts() * 2 + 5); }
 
-    std::string type_str = UserString(boost::lexical_cast<std::string>(this_row_tech->Type()));
-    text = new GG::TextControl(GG::X0, GG::Y0, TYPE_WIDTH, HEIGHT, type_str, font, ClientUI::TextColor(),
-                               GG::FORMAT_LEFT | GG::FORMAT_VCENTER);
-    push_back(text);
+GG::Wnd* TechTreeWnd::TechListBox::TechRowModel::CreateRowWnd(GG::X width)
+{ return new TechRow(width, GG::Y(ClientUI::Pts() * 2 + 5)); }
 
-    std::string desc_str = UserString(this_row_tech->ShortDescription());
-    text = new GG::TextControl(GG::X0, GG::Y0, DESC_WIDTH, HEIGHT, desc_str, font, ClientUI::TextColor(),
-                               GG::FORMAT_LEFT | GG::FORMAT_VCENTER);
-    push_back(text);
+void TechTreeWnd::TechListBox::TechRowModel::UpdateRowWnd(GG::Wnd* wnd, std::size_t row, bool selected) {
+    if (TechRow* tech_row = dynamic_cast<TechRow*>(wnd))
+        tech_row->SetTech(m_techs[row]);
 }
 
 TechTreeWnd::TechListBox::TechListBox(GG::X x, GG::Y y, GG::X w, GG::Y h) :
-    CUIListBox(x, y, w, h)
+    GG::VirtualListBox(x, y, w, h, ClientUI::CtrlBorderColor(), ClientUI::CtrlColor())
 {
     GG::Connect(DoubleClickedSignal,    &TechListBox::PropagateDoubleClickSignal,   this);
     GG::Connect(LeftClickedSignal,      &TechListBox::PropagateLeftClickSignal,     this);
 
+    // techs are listed in the order of their names, which Populate() sorts
     SetStyle(GG::LIST_NOSORT | GG::LIST_NOSEL);
+    SetModel(&m_tech_rows);
 
     // show all categories...
     m_categories_shown.clear();
@@ -1522,22 +1630,10 @@ TechTreeWnd::TechListBox::TechListBox(GG::X x, GG::Y y, GG::X w, GG::Y h) :
     //m_tech_statuses_shown.insert(TS_UNRESEARCHABLE);
     m_tech_statuses_shown.insert(TS_RESEARCHABLE);
     m_tech_statuses_shown.insert(TS_COMPLETE);
-
-    std::vector<GG::X> col_widths = TechRow::ColWidths(w - ClientUI::ScrollWidth() - 6);
-    SetNumCols(col_widths.size());
-    LockColWidths();
-    for (unsigned int i = 0; i < col_widths.size(); ++i) {
-        SetColWidth(i, col_widths[i]);
-        SetColAlignment(i, GG::ALIGN_LEFT);
-    }
 }
 
-TechTreeWnd::TechListBox::~TechListBox() {
-    for (std::multimap<std::string, TechRow*>::iterator it = m_all_tech_rows.begin();
-         it != m_all_tech_rows.end(); ++it)
-    { delete it->second; }
-    m_all_tech_rows.clear();
-}
+TechTreeWnd::TechListBox::~TechListBox()
+{}
 
 std::set<std::string> TechTreeWnd::TechListBox::GetCategoriesShown() const
 { return m_categories_shown; }
@@ -1555,45 +1651,27 @@ void TechTreeWnd::TechListBox::Populate() {
 
     Logger().debugStream() << "Tech List Box Populating";
 
-    double creation_elapsed = 0.0;
-    double insertion_elapsed = 0.0;
-    boost::timer creation_timer;
-    boost::timer insertion_timer;
-    // HACK! This caching of TechRows works only if there are no "hidden" techs
-    // that are added to the manager mid-game.
-    TechManager& manager = GetTechManager();
-    if (m_all_tech_rows.empty()) {
-        for (TechManager::iterator it = manager.begin(); it != manager.end(); ++it) {
-            const Tech* tech = *it;
-            const std::string& tech_name = UserString(tech->Name());
-            creation_timer.restart();
-            m_all_tech_rows.insert(std::make_pair(tech_name,
-                new TechRow(Width() - ClientUI::ScrollWidth() - 6, tech->Name())));
-            creation_elapsed += creation_timer.elapsed();
-        }
-    }
+    boost::timer populate_timer;
 
-    // remove techs in listbox, then reset the rest of its state
-    for (iterator it = begin(); it != end(); ) {
-        iterator temp_it = it++;
-        Erase(temp_it);
+    // only the names of the shown techs are kept; the row windows that show
+    // them are created by the list as they are scrolled into view
+    std::multimap<std::string, std::string> sorted_techs;
+    TechManager& manager = GetTechManager();
+    for (TechManager::iterator it = manager.begin(); it != manager.end(); ++it) {
+        const Tech* tech = *it;
+        if (TechVisible(tech->Name()))
+            sorted_techs.insert(std::make_pair(UserString(tech->Name()), tech->Name()));
     }
-    Clear();
 
-    for (std::multimap<std::string, TechRow*>::iterator it = m_all_tech_rows.begin();
-         it != m_all_tech_rows.end(); ++it)
-    {
-        TechRow* tech_row = it->second;
-        if (TechVisible(tech_row->GetTech())) {
-            insertion_timer.restart();
-            Insert(tech_row);
-            insertion_elapsed += insertion_timer.elapsed();
-        }
-    }
+    m_tech_rows.m_techs.clear();
+    m_tech_rows.m_techs.reserve(sorted_techs.size());
+    for (std::multimap<std::string, std::string>::const_iterator it = sorted_techs.begin();
+         it != sorted_techs.end(); ++it)
+    { m_tech_rows.m_techs.push_back(it->second); }
+    RowsReset();
 
     Logger().debugStream() << "Tech List Box Done Populating";
-    Logger().debugStream() << "    Creation time=" << (creation_elapsed * 1000) << "ms";
-    Logger().debugStream() << "    Insertion time=" << (insertion_elapsed * 1000) << "ms";
+    Logger().debugStream() << "    Populate time=" << (populate_timer.elapsed() * 1000) << "ms";
 }
 
 void TechTreeWnd::TechListBox::ShowCategory(const std::string& category) {
@@ -1661,20 +1739,14 @@ bool TechTreeWnd::TechListBox::TechVisible(const std::string& tech_name) {
     return true;
 }
 
-void TechTreeWnd::TechListBox::PropagateLeftClickSignal(GG::ListBox::iterator it, const GG::Pt& pt) {
-    // determine type of row that was clicked, and emit appropriate signal
-
-    TechRow* tech_row = dynamic_cast<TechRow*>(*it);
-    if (tech_row)
-        TechClickedSignal(tech_row->GetTech(), GG::Flags<GG::ModKey>());
+void TechTreeWnd::TechListBox::PropagateLeftClickSignal(std::size_t row, const GG::Pt& pt) {
+    if (row < m_tech_rows.m_techs.size())
+        TechClickedSignal(m_tech_rows.m_techs[row], GG::Flags<GG::ModKey>());
 }
 
-void TechTreeWnd::TechListBox::PropagateDoubleClickSignal(GG::ListBox::iterator it) {
-    // determine type of row that was clicked, and emit appropriate signal
-
-    TechRow* tech_row = dynamic_cast<TechRow*>(*it);
-    if (tech_row)
-        TechDoubleClickedSignal(tech_row->GetTech(), GG::Flags<GG::ModKey>());
+void TechTreeWnd::TechListBox::PropagateDoubleClickSignal(std::size_t row) {
+    if (row < m_tech_rows.m_techs.size())
+        TechDoubleClickedSignal(m_tech_rows.m_techs[row], GG::Flags<GG::ModKey>());
 }
 
 
@@ -43,7 +43,7 @@ AIClientApp::AIClientApp(const std::vector<std::string>& args) :
     }
 
     InitLogger(AICLIENT_LOG_FILENAME, "%d %p AI : %m%n");
-    Logger().setPriority(log4cpp::Priority::DEBUG);
+    Logger().setPriority(PriorityValue(GetOptionsDB().Get<std::string>("log-level")));
     Logger().debug(PlayerName() + " logger initialized.");
 }
 
@@ -92,16 +92,17 @@ void AIClientApp::Run() {
     // join game
     Networking().SendMessage(JoinGameMessage(PlayerName(), Networking::CLIENT_TYPE_AI_PLAYER));
 
-    // respond to messages until disconnected
+    // respond to messages until disconnected.  messages are handled as soon
+    // as they arrive, so that order generation for a new turn starts without
+    // waiting out a polling interval; the timeout only bounds how long it
+    // takes to notice a disconnection
     while (1) {
         if (!Networking().Connected())
             break;
-        if (Networking().MessageAvailable()) {
+        if (Networking().WaitForMessage(boost::posix_time::milliseconds(250))) {
             Message msg;
             Networking().GetMessage(msg);
             HandleMessage(msg);
-        } else {
-            boost::this_thread::sleep(boost::posix_time::milliseconds(250));
         }
     }
 }
@@ -152,6 +153,7 @@ void AIClientApp::HandleMessage(const Message& msg) {
             bool state_string_available;    // ignored, as save_state_string is sent even if not set by ExtractMessageData
             std::string save_state_string;
             m_player_status.clear();
+            ClearCombatLogs();
 
             ExtractMessageData(msg,                     single_player_game,     m_empire_id,
                                m_current_turn,          m_empires,              m_universe,
@@ -290,6 +292,11 @@ void AIClientApp::HandleMessage(const Message& msg) {
         break;
     }
 
+    case Message::DISPATCH_COMBAT_LOGS: {
+        UpdateCombatLogs(msg);
+        break;
+    }
+
     default: {
         Logger().errorStream() << "AIClientApp::HandleMessage : Received unknown Message type code " << msg.Type();
         break;
@@ -1,5 +1,6 @@
 #include "ClientApp.h"
 
+#include "../combat/CombatLogManager.h"
 #include "../combat/CombatOrder.h"
 #include "../util/Logger.h"
 #include "../util/Serialize.h"
@@ -170,6 +171,43 @@ int ClientApp::GetNewDesignID() {
     return boost::lexical_cast<int>(text);
 }
 
+bool ClientApp::CombatLogUnavailable(int log_id) const
+{ return m_unavailable_combat_log_ids.find(log_id) != m_unavailable_combat_log_ids.end(); }
+
+void ClientApp::RequestCombatLog(int log_id) {
+    CombatLogManager& log_manager = GetCombatLogManager();
+    if (!log_manager.LogExists(log_id) || log_manager.LogAvailable(log_id) || CombatLogUnavailable(log_id))
+        return;
+    if (!m_requested_combat_log_ids.insert(log_id).second)
+        return;
+    m_networking.SendMessage(RequestCombatLogsMessage(PlayerID(), std::vector<int>(1, log_id)));
+}
+
+void ClientApp::UpdateCombatLogs(const Message& msg) {
+    std::map<int, CombatLog> logs;
+    std::vector<int> unavailable_log_ids;
+    ExtractMessageData(msg, logs, unavailable_log_ids);
+
+    CombatLogManager& log_manager = GetCombatLogManager();
+    for (std::map<int, CombatLog>::const_iterator it = logs.begin(); it != logs.end(); ++it) {
+        log_manager.SetLog(it->first, it->second);
+        m_requested_combat_log_ids.erase(it->first);
+    }
+
+    // logs the server won't send aren't asked for again
+    for (std::vector<int>::const_iterator it = unavailable_log_ids.begin(); it != unavailable_log_ids.end(); ++it) {
+        Logger().debugStream() << "ClientApp::UpdateCombatLogs combat log " << *it << " is unavailable";
+        m_requested_combat_log_ids.erase(*it);
+        m_unavailable_combat_log_ids.insert(*it);
+    }
+}
+
+void ClientApp::ClearCombatLogs() {
+    GetCombatLogManager().Clear();
+    m_requested_combat_log_ids.clear();
+    m_unavailable_combat_log_ids.clear();
+}
+
 ClientApp* ClientApp::GetApp()
 { return static_cast<ClientApp*>(s_app); }
 
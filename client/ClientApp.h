@@ -76,6 +76,25 @@ public:
         Can return INVALID_OBJECT_ID if an ID cannot be created. */
     int                     GetNewDesignID();
 
+    /** returns true if the server has replied that the combat log with id
+        \a log_id is not available to this client. */
+    bool                    CombatLogUnavailable(int log_id) const;
+
+    /** asks the server for the combat log with id \a log_id, unless it is
+        already available, has already been requested, or the server has
+        replied that it is unavailable.  The log is stored by
+        UpdateCombatLogs when the server's reply arrives. */
+    void                    RequestCombatLog(int log_id);
+
+    /** stores the combat logs in DISPATCH_COMBAT_LOGS message \a msg, and
+        records which of the requested logs are unavailable. */
+    void                    UpdateCombatLogs(const Message& msg);
+
+    /** removes all combat logs, and forgets which logs have been requested
+        or are unavailable; done when a game ends or a new one starts, as
+        log ids are reused between games. */
+    void                    ClearCombatLogs();
+
     /** Emitted when a player is eliminated; in many places in the code, empires
         are refered to by ID.  This allows such places to listen for
         notification that one of these IDs has become invalidated.*/
@@ -95,6 +114,8 @@ protected:
     std::map<int, PlayerInfo>   m_player_info;      ///< indexed by player id, contains info about all players in the game
     std::map<int, Message::PlayerStatus>
                                 m_player_status;    ///< indexed by player id, the last known PlayerStatus for each player
+    std::set<int>               m_requested_combat_log_ids;     ///< ids of combat logs requested from the server, for which no reply has arrived yet
+    std::set<int>               m_unavailable_combat_log_ids;   ///< ids of combat logs the server has replied it won't send to this client
 
 private:
     const ClientApp& operator=(const ClientApp&); // disabled
@@ -41,6 +41,7 @@ struct MessageEventBase
     (PlayerChat)                               \
     (Diplomacy)                                \
     (DiplomaticStatusUpdate)                   \
+    (DispatchCombatLogs)                       \
     (VictoryDefeat)                            \
     (PlayerEliminated)                         \
     (EndGame)
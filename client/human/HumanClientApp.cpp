@@ -176,6 +176,10 @@ HumanClientApp::HumanClientApp(Ogre::Root* root,
 #endif
     m_fsm = new HumanClientFSM(*this);
 
+    // keep the objects that UI is bound to across turn updates, rather than
+    // replacing all objects each turn
+    GetUniverse().SetUpdateObjectsInPlace(true);
+
     const std::string HUMAN_CLIENT_LOG_FILENAME((GetUserDir() / "freeorion.log").string());
 
     InitLogger(HUMAN_CLIENT_LOG_FILENAME, "%d %p Client : %m%n");
@@ -843,6 +847,7 @@ void HumanClientApp::HandleMessage(Message& msg) {
     case Message::PLAYER_CHAT:          m_fsm->process_event(PlayerChat(msg));              break;
     case Message::DIPLOMACY:            m_fsm->process_event(Diplomacy(msg));               break;
     case Message::DIPLOMATIC_STATUS:    m_fsm->process_event(DiplomaticStatusUpdate(msg));  break;
+    case Message::DISPATCH_COMBAT_LOGS: m_fsm->process_event(DispatchCombatLogs(msg));      break;
     case Message::VICTORY_DEFEAT :      m_fsm->process_event(VictoryDefeat(msg));           break;
     case Message::PLAYER_ELIMINATED:    m_fsm->process_event(PlayerEliminated(msg));        break;
     case Message::END_GAME:             m_fsm->process_event(::EndGame(msg));               break;
@@ -1106,7 +1111,7 @@ void HumanClientApp::EndGame(bool suppress_FSM_reset) {
     m_empires.Clear();
     m_orders.Reset();
     m_combat_orders.clear();
-    GetCombatLogManager().Clear();
+    ClearCombatLogs();
 
     if (!suppress_FSM_reset)
         m_fsm->process_event(ResetToIntroMenu());
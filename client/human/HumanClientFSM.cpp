@@ -404,6 +404,13 @@ boost::statechart::result PlayingGame::react(const DiplomaticStatusUpdate& u) {
     return discard_event();
 }
 
+boost::statechart::result PlayingGame::react(const DispatchCombatLogs& msg) {
+    if (TRACE_EXECUTION) Logger().debugStream() << "(HumanClientFSM) PlayingGame.DispatchCombatLogs";
+    Client().UpdateCombatLogs(msg.m_message);
+    Client().GetClientUI()->GetMapWnd()->RefreshPedia();
+    return discard_event();
+}
+
 boost::statechart::result PlayingGame::react(const VictoryDefeat& msg) {
     if (TRACE_EXECUTION) Logger().debugStream() << "(HumanClientFSM) PlayingGame.VictoryDefeat";
     Message::VictoryOrDefeat victory_or_defeat;
@@ -541,6 +548,7 @@ boost::statechart::result WaitingForGameStart::react(const GameStart& msg) {
     int empire_id = ALL_EMPIRES;
     int current_turn = INVALID_GAME_TURN;
     Client().PlayerStatus().clear();
+    Client().ClearCombatLogs();
 
     ExtractMessageData(msg.m_message,       single_player_game,             empire_id,
                        current_turn,        Empires(),                      GetUniverse(),
@@ -217,6 +217,7 @@ struct PlayingGame : boost::statechart::state<PlayingGame, HumanClientFSM, Waiti
         boost::statechart::custom_reaction<PlayerStatus>,
         boost::statechart::custom_reaction<Diplomacy>,
         boost::statechart::custom_reaction<DiplomaticStatusUpdate>,
+        boost::statechart::custom_reaction<DispatchCombatLogs>,
         boost::statechart::custom_reaction<VictoryDefeat>,
         boost::statechart::custom_reaction<PlayerEliminated>,
         boost::statechart::custom_reaction<EndGame>,
@@ -235,6 +236,7 @@ struct PlayingGame : boost::statechart::state<PlayingGame, HumanClientFSM, Waiti
     boost::statechart::result react(const PlayerStatus& msg);
     boost::statechart::result react(const Diplomacy& d);
     boost::statechart::result react(const DiplomaticStatusUpdate& u);
+    boost::statechart::result react(const DispatchCombatLogs& msg);
     boost::statechart::result react(const VictoryDefeat& msg);
     boost::statechart::result react(const PlayerEliminated& msg);
     boost::statechart::result react(const EndGame& msg);
@@ -1,5 +1,24 @@
 #include "CombatLogManager.h"
 #include "../universe/UniverseObject.h"
+#include "../util/i18n.h"
+#include "../util/Logger.h"
+#include "../util/OptionsDB.h"
+#include "../util/Serialize.h"
+
+#include <boost/filesystem/fstream.hpp>
+#include <boost/serialization/set.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <sstream>
+
+namespace {
+    void AddOptions(OptionsDB& db) {
+        db.Add("combat-logs-in-memory", UserStringNop("OPTIONS_DB_COMBAT_LOGS_IN_MEMORY_DESC"), 100, RangedValidator<int>(1, 100000));
+    }
+    bool temp_bool = RegisterOptions(&AddOptions);
+
+    OptionHandle<int>   logs_in_memory("combat-logs-in-memory");
+}
 
 ////////////////////////////////////////////////
 // CombatLog
@@ -31,50 +50,159 @@ CombatLog::CombatLog(const CombatInfo& combat_info) :
 ////////////////////////////////////////////////
 CombatLogManager::CombatLogManager() :
     m_logs(),
+    m_log_order(),
+    m_loaded_logs(),
+    m_store_path(),
+    m_store_index(),
     m_latest_log_id(-1)
 {}
 
-std::map<int, CombatLog>::const_iterator CombatLogManager::begin() const
-{ return m_logs.begin(); }
-
-std::map<int, CombatLog>::const_iterator CombatLogManager::end() const
-{ return m_logs.end(); }
-
-std::map<int, CombatLog>::const_iterator CombatLogManager::find(int log_id) const
-{ return m_logs.find(log_id); }
-
 bool CombatLogManager::LogAvailable(int log_id) const
-{ return m_logs.begin() != m_logs.end(); }
+{ return m_logs.find(log_id) != m_logs.end() || m_store_index.find(log_id) != m_store_index.end(); }
+
+bool CombatLogManager::LogExists(int log_id) const
+{ return log_id >= 0 && log_id <= m_latest_log_id; }
 
 const CombatLog& CombatLogManager::GetLog(int log_id) const {
     std::map<int, CombatLog>::const_iterator it = m_logs.find(log_id);
     if (it != m_logs.end())
         return it->second;
+
+    it = m_loaded_logs.find(log_id);
+    if (it != m_loaded_logs.end())
+        return it->second;
+
+    CombatLog log;
+    if (LoadLog(log_id, log)) {
+        if (m_loaded_logs.size() >= static_cast<std::size_t>(logs_in_memory.Get()))
+            m_loaded_logs.clear();
+        return m_loaded_logs[log_id] = log;
+    }
+
     static CombatLog EMPTY_LOG;
     return EMPTY_LOG;
 }
 
 int CombatLogManager::AddLog(const CombatLog& log) {
     int new_log_id = ++m_latest_log_id;
-    m_logs[new_log_id] = log;
+    SetLog(new_log_id, log);
     return new_log_id;
 }
 
-void CombatLogManager::RemoveLog(int log_id)
-{ m_logs.erase(log_id); }
+void CombatLogManager::SetLog(int log_id, const CombatLog& log) {
+    std::pair<std::map<int, CombatLog>::iterator, bool> result = m_logs.insert(std::make_pair(log_id, log));
+    if (!result.second) {
+        result.first->second = log;
+        return;
+    }
+    m_log_order.push_back(log_id);
+    m_loaded_logs.erase(log_id);
+    EvictLogs();
+}
+
+void CombatLogManager::SetLatestLogID(int log_id)
+{ m_latest_log_id = log_id; }
+
+void CombatLogManager::RemoveLog(int log_id) {
+    m_logs.erase(log_id);
+    m_loaded_logs.erase(log_id);
+    m_store_index.erase(log_id);    // the stored copy remains in the file, but can't be found
+}
 
-void CombatLogManager::Clear()
-{ m_logs.clear(); }
+void CombatLogManager::Clear() {
+    m_logs.clear();
+    m_log_order.clear();
+    m_loaded_logs.clear();
+    SetLogStoreFile(m_store_path);
+}
+
+void CombatLogManager::SetLogStoreFile(const boost::filesystem::path& path) {
+    m_store_path = path;
+    m_store_index.clear();
+    m_loaded_logs.clear();
+    if (m_store_path.empty())
+        return;
+    boost::filesystem::ofstream ofs(m_store_path, std::ios_base::binary | std::ios_base::trunc);
+    if (!ofs)
+        Logger().errorStream() << "CombatLogManager::SetLogStoreFile couldn't create combat log store file " << m_store_path;
+}
 
 void CombatLogManager::GetLogsToSerialize(std::map<int, CombatLog>& logs, int encoding_empire) const {
     if (&logs == &m_logs)
         return;
     // TODO: filter logs by who should have access to them
     logs = m_logs;
+    for (std::map<int, std::pair<std::streamoff, std::size_t> >::const_iterator it = m_store_index.begin();
+         it != m_store_index.end(); ++it)
+    {
+        if (logs.find(it->first) != logs.end())
+            continue;
+        CombatLog log;
+        if (LoadLog(it->first, log))
+            logs[it->first] = log;
+    }
+}
+
+void CombatLogManager::EvictLogs() {
+    std::size_t max_logs = static_cast<std::size_t>(std::max(1, logs_in_memory.Get()));
+    while (m_logs.size() > max_logs && !m_log_order.empty()) {
+        int log_id = m_log_order.front();
+        m_log_order.pop_front();
+        std::map<int, CombatLog>::iterator it = m_logs.find(log_id);
+        if (it == m_logs.end())
+            continue;   // already removed
+        if (!m_store_path.empty() && m_store_index.find(log_id) == m_store_index.end())
+            StoreLog(log_id, it->second);
+        m_logs.erase(it);
+    }
 }
 
-void CombatLogManager::SetLog(int log_id, const CombatLog& log)
-{ m_logs[log_id] = log; }
+void CombatLogManager::StoreLog(int log_id, const CombatLog& log) {
+    std::ostringstream os;
+    {
+        freeorion_oarchive oa(os);
+        oa << BOOST_SERIALIZATION_NVP(log);
+    }
+    const std::string bytes = os.str();
+
+    boost::filesystem::ofstream ofs(m_store_path, std::ios_base::binary | std::ios_base::app);
+    ofs.seekp(0, std::ios_base::end);
+    std::streamoff offset = ofs.tellp();
+    ofs.write(bytes.data(), bytes.size());
+    if (!ofs) {
+        Logger().errorStream() << "CombatLogManager::StoreLog couldn't write combat log " << log_id
+                               << " to " << m_store_path;
+        return;
+    }
+    m_store_index[log_id] = std::make_pair(offset, bytes.size());
+}
+
+bool CombatLogManager::LoadLog(int log_id, CombatLog& log) const {
+    std::map<int, std::pair<std::streamoff, std::size_t> >::const_iterator it = m_store_index.find(log_id);
+    if (it == m_store_index.end())
+        return false;
+
+    std::string bytes(it->second.second, '\0');
+    boost::filesystem::ifstream ifs(m_store_path, std::ios_base::binary);
+    ifs.seekg(it->second.first);
+    ifs.read(&bytes[0], bytes.size());
+    if (!ifs) {
+        Logger().errorStream() << "CombatLogManager::LoadLog couldn't read combat log " << log_id
+                               << " from " << m_store_path;
+        return false;
+    }
+
+    try {
+        std::istringstream is(bytes);
+        freeorion_iarchive ia(is);
+        ia >> BOOST_SERIALIZATION_NVP(log);
+    } catch (const std::exception& e) {
+        Logger().errorStream() << "CombatLogManager::LoadLog couldn't deserialize combat log " << log_id
+                               << ": " << e.what();
+        return false;
+    }
+    return true;
+}
 
 CombatLogManager& CombatLogManager::GetCombatLogManager() {
     static CombatLogManager manager;
@@ -6,6 +6,11 @@
 
 #include "../util/Export.h"
 
+#include <boost/filesystem/path.hpp>
+
+#include <deque>
+#include <ios>
+
 struct FO_COMMON_API CombatLog {
     CombatLog();
     CombatLog(const CombatInfo& combat_info);
@@ -24,21 +29,34 @@ struct FO_COMMON_API CombatLog {
 };
 
 
-/** Stores and retreives combat logs. */
+/** Stores and retreives combat logs.  At most combat-logs-in-memory logs are
+  * kept in memory.  If a log store file has been set with SetLogStoreFile(),
+  * older logs are appended to that file when they are evicted from memory,
+  * and are read back from it on demand; otherwise evicted logs are dropped,
+  * which clients use to keep only logs they have recently fetched from the
+  * server.  The logs themselves are serialized only into saves; turn updates
+  * only include the id of the latest log, and clients request the logs they
+  * need with REQUEST_COMBAT_LOGS messages. */
 class FO_COMMON_API CombatLogManager {
 public:
     /** \name Accessors */ //@{
-    std::map<int, CombatLog>::const_iterator    begin() const;
-    std::map<int, CombatLog>::const_iterator    end() const;
-    std::map<int, CombatLog>::const_iterator    find(int log_id) const;
-    bool                                        LogAvailable(int log_id) const; // returns whether a log with the indicated id is available
-    const CombatLog&                            GetLog(int log_id) const;       // returns requested combat log, or an empty default log if no log with the requested id exists
+    bool                LogAvailable(int log_id) const; // returns whether a log with the indicated id is available
+    bool                LogExists(int log_id) const;    // returns whether a log with the indicated id was created, even if it isn't available locally
+    const CombatLog&    GetLog(int log_id) const;       // returns requested combat log, or an empty default log if no log with the requested id exists.  the returned reference is valid until the next call to GetLog or to a mutator
+    int                 LatestLogID() const { return m_latest_log_id; }
     //@}
 
     /** \name Mutators */ //@{
     int     AddLog(const CombatLog& log);   // adds log, returns unique log id
+    void    SetLog(int log_id, const CombatLog& log);
+    void    SetLatestLogID(int log_id);
     void    RemoveLog(int log_id);
     void    Clear();
+
+    /** Sets the file to which logs evicted from memory are appended.  The
+      * file is truncated, and logs previously stored in another file are
+      * lost.  An empty \a path disables storing evicted logs. */
+    void    SetLogStoreFile(const boost::filesystem::path& path);
     //@}
 
     static CombatLogManager& GetCombatLogManager();
@@ -46,11 +64,18 @@ public:
 private:
     CombatLogManager();
 
-    void GetLogsToSerialize(std::map<int, CombatLog>& logs, int encoding_empire) const;
-    void SetLog(int log_id, const CombatLog& log);
-
-    std::map<int, CombatLog>    m_logs;
-    int                         m_latest_log_id;
+    void        GetLogsToSerialize(std::map<int, CombatLog>& logs, int encoding_empire) const;
+    void        EvictLogs();                                    // moves the least recently added logs out of memory until at most combat-logs-in-memory remain
+    void        StoreLog(int log_id, const CombatLog& log);     // appends log to the log store file
+    bool        LoadLog(int log_id, CombatLog& log) const;      // reads log from the log store file
+
+    std::map<int, CombatLog>                            m_logs;         // logs in memory
+    std::deque<int>                                     m_log_order;    // ids of logs in memory, in the order they were added
+    mutable std::map<int, CombatLog>                    m_loaded_logs;  // logs recently read back from the log store file
+    boost::filesystem::path                             m_store_path;
+    std::map<int, std::pair<std::streamoff, std::size_t> >
+                                                        m_store_index;  // offset and size of each log in the log store file
+    int                                                 m_latest_log_id;
 
     friend class boost::serialization::access;
     template <class Archive>
@@ -233,6 +233,8 @@ void CombatInfo::GetEmpireObjectVisibilityToSerialize(Universe::EmpireObjectVisi
 // AutoResolveCombat
 ////////////////////////////////////////////////
 namespace {
+    OptionHandle<bool> verbose_logging("verbose-logging");
+
     void AttackShipShip(TemporaryPtr<Ship> attacker, float damage, TemporaryPtr<Ship> target, CombatInfo& combat_info, int round) {
         if (!attacker || ! target) return;
 
@@ -247,7 +249,7 @@ namespace {
         Meter* target_shield = target->UniverseObject::GetMeter(METER_SHIELD);
         float shield = (target_shield ? target_shield->Current() : 0.0f);
 
-        Logger().debugStream() << "AttackShipShip: attacker: " << attacker->Name() << " damage: " << damage
+        DebugLogger() << "AttackShipShip: attacker: " << attacker->Name() << " damage: " << damage
                                << "  target: " << target->Name() << " shield: " << target_shield->Current()
                                                                  << " structure: " << target_structure->Current();
 
@@ -256,8 +258,8 @@ namespace {
         if (damage > 0.0f) {
             target_structure->AddToCurrent(-damage);
             damaged_object_ids.insert(target->ID());
-            if (GetOptionsDB().Get<bool>("verbose-logging"))
-                Logger().debugStream() << "COMBAT: Ship " << attacker->Name() << " (" << attacker->ID() << ") does " << damage << " damage to Ship " << target->Name() << " (" << target->ID() << ")";
+            if (verbose_logging.Get())
+                DebugLogger() << "COMBAT: Ship " << attacker->Name() << " (" << attacker->ID() << ") does " << damage << " damage to Ship " << target->Name() << " (" << target->ID() << ")";
         }
 
         AttackEvent attack(round, attacker->ID(), target->ID(), damage,
@@ -295,8 +297,8 @@ namespace {
             return;
         }
 
-        if (GetOptionsDB().Get<bool>("verbose-logging")) {
-            Logger().debugStream() << "AttackShipPlanet: attacker: " << attacker->Name() << " damage: " << damage
+        if (verbose_logging.Get()) {
+            DebugLogger() << "AttackShipPlanet: attacker: " << attacker->Name() << " damage: " << damage
                                << "\ntarget: " << target->Name() << " shield: " << target_shield->Current()
                                                                  << " defense: " << target_defense->Current()
                                                                  << " infra: " << target_construction->Current();
@@ -319,18 +321,18 @@ namespace {
 
         if (shield_damage >= 0) {
             target_shield->AddToCurrent(-shield_damage);
-            if (GetOptionsDB().Get<bool>("verbose-logging"))
-                Logger().debugStream() << "COMBAT: Ship " << attacker->Name() << " (" << attacker->ID() << ") does " << shield_damage << " shield damage to Planet " << target->Name() << " (" << target->ID() << ")";
+            if (verbose_logging.Get())
+                DebugLogger() << "COMBAT: Ship " << attacker->Name() << " (" << attacker->ID() << ") does " << shield_damage << " shield damage to Planet " << target->Name() << " (" << target->ID() << ")";
         }
         if (defense_damage >= 0) {
             target_defense->AddToCurrent(-defense_damage);
-            if (GetOptionsDB().Get<bool>("verbose-logging"))
-                Logger().debugStream() << "COMBAT: Ship " << attacker->Name() << " (" << attacker->ID() << ") does " << defense_damage << " defense damage to Planet " << target->Name() << " (" << target->ID() << ")";
+            if (verbose_logging.Get())
+                DebugLogger() << "COMBAT: Ship " << attacker->Name() << " (" << attacker->ID() << ") does " << defense_damage << " defense damage to Planet " << target->Name() << " (" << target->ID() << ")";
         }
         if (construction_damage >= 0) {
             target_construction->AddToCurrent(-construction_damage);
-            if (GetOptionsDB().Get<bool>("verbose-logging"))
-                Logger().debugStream() << "COMBAT: Ship " << attacker->Name() << " (" << attacker->ID() << ") does " << construction_damage << " instrastructure damage to Planet " << target->Name() << " (" << target->ID() << ")";
+            if (verbose_logging.Get())
+                DebugLogger() << "COMBAT: Ship " << attacker->Name() << " (" << attacker->ID() << ") does " << construction_damage << " instrastructure damage to Planet " << target->Name() << " (" << target->ID() << ")";
         }
 
         AttackEvent attack(round, attacker->ID(), target->ID(), damage, false);
@@ -359,8 +361,8 @@ namespace {
         Meter* target_shield = target->UniverseObject::GetMeter(METER_SHIELD);
         float shield = (target_shield ? target_shield->Current() : 0.0f);
 
-        if (GetOptionsDB().Get<bool>("verbose-logging")) {
-            Logger().debugStream() << "AttackPlanetShip: attacker: " << attacker->Name() << " damage: " << damage
+        if (verbose_logging.Get()) {
+            DebugLogger() << "AttackPlanetShip: attacker: " << attacker->Name() << " damage: " << damage
                                << "  target: " << target->Name() << " shield: " << target_shield->Current()
                                                                  << " structure: " << target_structure->Current();
         }
@@ -370,8 +372,8 @@ namespace {
         if (damage > 0.0f) {
             target_structure->AddToCurrent(-damage);
             damaged_object_ids.insert(target->ID());
-            if (GetOptionsDB().Get<bool>("verbose-logging"))
-                Logger().debugStream() << "COMBAT: Planet " << attacker->Name() << " (" << attacker->ID() << ") does " << damage << " damage to Ship " << target->Name() << " (" << target->ID() << ")";
+            if (verbose_logging.Get())
+                DebugLogger() << "COMBAT: Planet " << attacker->Name() << " (" << attacker->ID() << ") does " << damage << " damage to Ship " << target->Name() << " (" << target->ID() << ")";
         }
 
         AttackEvent attack(round, attacker->ID(), target->ID(), damage,
@@ -382,8 +384,8 @@ namespace {
     }
 
     void AttackPlanetPlanet(TemporaryPtr<Planet> attacker, TemporaryPtr<Planet> target, CombatInfo& combat_info, int round) {
-        if (GetOptionsDB().Get<bool>("verbose-logging"))
-            Logger().debugStream() << "AttackPlanetPlanet does nothing!";
+        if (verbose_logging.Get())
+            DebugLogger() << "AttackPlanetPlanet does nothing!";
         // intentionally left empty
     }
 
@@ -502,11 +504,11 @@ void AutoResolveCombat(CombatInfo& combat_info) {
     if (!system)
         Logger().errorStream() << "AutoResolveCombat couldn't get system with id " << combat_info.system_id;
     else
-        Logger().debugStream() << "AutoResolveCombat at " << system->Name();
+        DebugLogger() << "AutoResolveCombat at " << system->Name();
 
-    if (GetOptionsDB().Get<bool>("verbose-logging")) {
-        Logger().debugStream() << "%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%";
-        Logger().debugStream() << "AutoResolveCombat objects before resolution: " << combat_info.objects.Dump();
+    if (verbose_logging.Get()) {
+        DebugLogger() << "%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%";
+        DebugLogger() << "AutoResolveCombat objects before resolution: " << combat_info.objects.Dump();
     }
 
     // reasonably unpredictable but reproducible random seeding
@@ -579,13 +581,13 @@ void AutoResolveCombat(CombatInfo& combat_info) {
 
         // ensure something can attack and something can be attacked
         if (valid_attacker_object_ids.empty()) {
-            if (GetOptionsDB().Get<bool>("verbose-logging"))
-                Logger().debugStream() << "Nothing left can attack; combat over";
+            if (verbose_logging.Get())
+                DebugLogger() << "Nothing left can attack; combat over";
             break;
         }
         if (empire_valid_target_object_ids.empty()) {
-            if (GetOptionsDB().Get<bool>("verbose-logging"))
-                Logger().debugStream() << "Nothing left can be attacked; combat over";
+            if (verbose_logging.Get())
+                DebugLogger() << "Nothing left can be attacked; combat over";
             break;
         }
         // empires may have valid targets, but nothing to attack with.  If all
@@ -600,18 +602,18 @@ void AutoResolveCombat(CombatInfo& combat_info) {
             }
         }
         if (!someone_can_attack_something) {
-            if (GetOptionsDB().Get<bool>("verbose-logging"))
-                Logger().debugStream() << "No empire has valid targets and something to attack with; combat over.";
+            if (verbose_logging.Get())
+                DebugLogger() << "No empire has valid targets and something to attack with; combat over.";
             break;
         }
 
-        if (GetOptionsDB().Get<bool>("verbose-logging"))
-            Logger().debugStream() << "Combat at " << system->Name() << " (" << combat_info.system_id << ") Round " << round;
+        if (verbose_logging.Get())
+            DebugLogger() << "Combat at " << system->Name() << " (" << combat_info.system_id << ") Round " << round;
 
         // select attacking object in battle
         int attacker_idx = RandInt(0, valid_attacker_object_ids.size() - 1);
-        if (GetOptionsDB().Get<bool>("verbose-logging"))
-            Logger().debugStream() << "Battle round " << round << " attacker index: " << attacker_idx << " of " << valid_attacker_object_ids.size() - 1;
+        if (verbose_logging.Get())
+            DebugLogger() << "Battle round " << round << " attacker index: " << attacker_idx << " of " << valid_attacker_object_ids.size() - 1;
         std::set<int>::const_iterator attacker_it = valid_attacker_object_ids.begin();
         std::advance(attacker_it, attacker_idx);
         assert(attacker_it != valid_attacker_object_ids.end());
@@ -622,8 +624,8 @@ void AutoResolveCombat(CombatInfo& combat_info) {
             Logger().errorStream() << "AutoResolveCombat couldn't get object with id " << attacker_id;
             continue;
         }
-        if (GetOptionsDB().Get<bool>("verbose-logging"))
-            Logger().debugStream() << "Attacker: " << attacker->Name();
+        if (verbose_logging.Get())
+            DebugLogger() << "Attacker: " << attacker->Name();
 
 
         TemporaryPtr<Ship> attack_ship = boost::dynamic_pointer_cast<Ship>(attacker);
@@ -638,8 +640,8 @@ void AutoResolveCombat(CombatInfo& combat_info) {
             for (std::vector<PartAttackInfo>::const_iterator part_it = weapons.begin();
                  part_it != weapons.end(); ++part_it)
             {
-                if (GetOptionsDB().Get<bool>("verbose-logging")) {
-                    Logger().debugStream() << "weapon: " << part_it->part_type_name
+                if (verbose_logging.Get()) {
+                    DebugLogger() << "weapon: " << part_it->part_type_name
                                            << " attack: " << part_it->part_attack;
                 }
             }
@@ -648,8 +650,8 @@ void AutoResolveCombat(CombatInfo& combat_info) {
         }
 
         if (weapons.empty()) {
-            if (GetOptionsDB().Get<bool>("verbose-logging"))
-                Logger().debugStream() << "no weapons' can't attack";
+            if (verbose_logging.Get())
+                DebugLogger() << "no weapons' can't attack";
             continue;   // no ability to attack!
         }
 
@@ -657,8 +659,8 @@ void AutoResolveCombat(CombatInfo& combat_info) {
              weapon_it != weapons.end(); ++weapon_it)
         {
             // select object from valid targets for this object's owner   TODO: with this weapon...
-            if (GetOptionsDB().Get<bool>("verbose-logging"))
-                Logger().debugStream() << "Attacking with weapon " << weapon_it->part_type_name << " with power " << weapon_it->part_attack;
+            if (verbose_logging.Get())
+                DebugLogger() << "Attacking with weapon " << weapon_it->part_type_name << " with power " << weapon_it->part_attack;
 
             // get valid targets set for attacker owner.  need to do this for
             // each weapon that is attacking, as the previous shot might have
@@ -667,8 +669,8 @@ void AutoResolveCombat(CombatInfo& combat_info) {
 
             std::map<int, std::set<int> >::iterator target_vec_it = empire_valid_target_object_ids.find(attacker_owner_id);
             if (target_vec_it == empire_valid_target_object_ids.end() || target_vec_it->second.empty()) {
-                if (GetOptionsDB().Get<bool>("verbose-logging"))
-                    Logger().debugStream() << "No targets for attacker with id: " << attacker_owner_id;
+                if (verbose_logging.Get())
+                    DebugLogger() << "No targets for attacker with id: " << attacker_owner_id;
                 break;
             }
 
@@ -680,8 +682,8 @@ void AutoResolveCombat(CombatInfo& combat_info) {
                     target_it != valid_target_ids.end(); ++target_it)
             { id_list += boost::lexical_cast<std::string>(*target_it) + " "; }
 
-            if (GetOptionsDB().Get<bool>("verbose-logging")) { 
-                Logger().debugStream() << "Valid targets for attacker with id: " << attacker_owner_id
+            if (verbose_logging.Get()) { 
+                DebugLogger() << "Valid targets for attacker with id: " << attacker_owner_id
                                     << " owned by empire: " << attacker_owner_id
                                     << " :  " << id_list;
             }
@@ -690,8 +692,8 @@ void AutoResolveCombat(CombatInfo& combat_info) {
 
             // select target object
             int target_idx = RandInt(0, valid_target_ids.size() - 1);
-            if (GetOptionsDB().Get<bool>("verbose-logging"))
-                Logger().debugStream() << " ... target index: " << target_idx << " of " << valid_target_ids.size() - 1;
+            if (verbose_logging.Get())
+                DebugLogger() << " ... target index: " << target_idx << " of " << valid_target_ids.size() - 1;
             std::set<int>::const_iterator target_it = valid_target_ids.begin();
             std::advance(target_it, target_idx);
             assert(target_it != valid_target_ids.end());
@@ -702,8 +704,8 @@ void AutoResolveCombat(CombatInfo& combat_info) {
                 Logger().errorStream() << "AutoResolveCombat couldn't get target object with id " << target_id;
                 continue;
             }
-            if (GetOptionsDB().Get<bool>("verbose-logging"))
-                Logger().debugStream() << "Target: " << target->Name();
+            if (verbose_logging.Get())
+                DebugLogger() << "Target: " << target->Name();
 
 
             // do actual attacks, and mark attackers as valid targets for attacked object's owners
@@ -729,8 +731,8 @@ void AutoResolveCombat(CombatInfo& combat_info) {
             // check for destruction of target object
             if (target->ObjectType() == OBJ_SHIP) {
                 if (target->CurrentMeterValue(METER_STRUCTURE) <= 0.0) {
-                    if (GetOptionsDB().Get<bool>("verbose-logging"))
-                        Logger().debugStream() << "!! Target Ship is destroyed!";
+                    if (verbose_logging.Get())
+                        DebugLogger() << "!! Target Ship is destroyed!";
                     // object id destroyed
                     combat_info.destroyed_object_ids.insert(target_id);
                     // all empires in battle know object was destroyed
@@ -739,8 +741,8 @@ void AutoResolveCombat(CombatInfo& combat_info) {
                     {
                         int empire_id = *it;
                         if (empire_id != ALL_EMPIRES) {
-                            if (GetOptionsDB().Get<bool>("verbose-logging"))
-                                Logger().debugStream() << "Giving knowledge of destroyed object " << target_id << " to empire " << empire_id;
+                            if (verbose_logging.Get())
+                                DebugLogger() << "Giving knowledge of destroyed object " << target_id << " to empire " << empire_id;
                             combat_info.destroyed_object_knowers[empire_id].insert(target_id);
                         }
                     }
@@ -760,8 +762,8 @@ void AutoResolveCombat(CombatInfo& combat_info) {
 
             } else if (target->ObjectType() == OBJ_PLANET) {
                 if (!ObjectCanAttack(target) && valid_attacker_object_ids.find(target_id)!=valid_attacker_object_ids.end()) {
-                    if (GetOptionsDB().Get<bool>("verbose-logging"))
-                        Logger().debugStream() << "!! Target Planet defenses knocked out, can no longer attack";
+                    if (verbose_logging.Get())
+                        DebugLogger() << "!! Target Planet defenses knocked out, can no longer attack";
                     // remove disabled planet's ID from lists of valid attackers
                     valid_attacker_object_ids.erase(target_id);
                 }
@@ -769,8 +771,8 @@ void AutoResolveCombat(CombatInfo& combat_info) {
                     target->CurrentMeterValue(METER_DEFENSE) <= 0.0 &&
                     target->CurrentMeterValue(METER_CONSTRUCTION) <= 0.0)
                 {
-                    if (GetOptionsDB().Get<bool>("verbose-logging"))
-                        Logger().debugStream() << "!! Target Planet is entirely knocked out of battle";
+                    if (verbose_logging.Get())
+                        DebugLogger() << "!! Target Planet is entirely knocked out of battle";
 
                     // remove disabled planet's ID from lists of valid targets
                     valid_target_object_ids.erase(target_id);   // probably not necessary as this set isn't used in this loop
@@ -793,8 +795,8 @@ void AutoResolveCombat(CombatInfo& combat_info) {
             {
                 if (target_vec_it->second.empty()) {
                     temp.erase(target_vec_it->first);
-                    if (GetOptionsDB().Get<bool>("verbose-logging"))
-                        Logger().debugStream() << "No valid targets left for empire with id: " << target_vec_it->first;
+                    if (verbose_logging.Get())
+                        DebugLogger() << "No valid targets left for empire with id: " << target_vec_it->first;
                 }
             }
             empire_valid_target_object_ids = temp;
@@ -805,8 +807,8 @@ void AutoResolveCombat(CombatInfo& combat_info) {
             {
                 if (target_vec_it->second.empty()) {
                     temp.erase(target_vec_it->first);
-                    if (GetOptionsDB().Get<bool>("verbose-logging"))
-                        Logger().debugStream() << "No valid attacking objects left for empire with id: " << target_vec_it->first;
+                    if (verbose_logging.Get())
+                        DebugLogger() << "No valid attacking objects left for empire with id: " << target_vec_it->first;
                 }
             }
             empire_valid_attacker_object_ids = temp;
@@ -822,14 +824,14 @@ void AutoResolveCombat(CombatInfo& combat_info) {
          it != combat_info.empire_known_objects.end(); ++it)
     { it->second.Copy(combat_info.objects); }
 
-    if (GetOptionsDB().Get<bool>("verbose-logging")) {
-        Logger().debugStream() << "AutoResolveCombat objects after resolution: " << combat_info.objects.Dump();
+    if (verbose_logging.Get()) {
+        DebugLogger() << "AutoResolveCombat objects after resolution: " << combat_info.objects.Dump();
 
-        Logger().debugStream() << "combat event log:";
+        DebugLogger() << "combat event log:";
         for (std::vector<AttackEvent>::const_iterator it = combat_info.combat_events.begin();
             it != combat_info.combat_events.end(); ++it)
         {
-            Logger().debugStream() << "rnd: " << it->round << " : "
+            DebugLogger() << "rnd: " << it->round << " : "
                                 << it->attacker_id << " -> " << it->target_id << " : "
                                 << it->damage
                                 << (it->target_destroyed ? " (destroyed)" : "");
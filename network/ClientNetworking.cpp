@@ -129,6 +129,7 @@ ClientNetworking::ClientNetworking() :
     m_socket(m_io_service),
     m_incoming_messages(m_mutex),
     m_connected(false),
+    m_server_accepts_compression(false),
     m_cancel_retries(false)
 {}
 
@@ -140,6 +141,9 @@ bool ClientNetworking::Connected() const {
 bool ClientNetworking::MessageAvailable() const
 { return !m_incoming_messages.Empty(); }
 
+bool ClientNetworking::WaitForMessage(const boost::posix_time::time_duration& timeout) const
+{ return m_incoming_messages.WaitForMessage(timeout); }
+
 int ClientNetworking::PlayerID() const
 { return m_player_id; }
 
@@ -254,6 +258,13 @@ void ClientNetworking::SendMessage(Message message) {
     if (TRACE_EXECUTION)
         Logger().debugStream() << "ClientNetworking::SendMessage() : "
                                << "sending message " << message;
+    bool server_accepts_compression = false;
+    {
+        boost::mutex::scoped_lock lock(m_mutex);
+        server_accepts_compression = m_server_accepts_compression;
+    }
+    if (server_accepts_compression)
+        CompressMessage(message, MessageCompressionThreshold());
     m_io_service.post(boost::bind(&ClientNetworking::SendMessageImpl, this, message));
 }
 
@@ -263,6 +274,7 @@ void ClientNetworking::GetMessage(Message& message) {
         return;
     }
     m_incoming_messages.PopFront(message);
+    DecompressMessage(message);
     if (TRACE_EXECUTION)
         Logger().debugStream() << "ClientNetworking::GetMessage() : received message "
                                << message;
@@ -275,6 +287,7 @@ void ClientNetworking::SendSynchronousMessage(Message message, Message& response
     SendMessage(message);
     // note that this is a blocking operation
     m_incoming_messages.EraseFirstSynchronousResponse(response_message);
+    DecompressMessage(response_message);
     if (TRACE_EXECUTION)
         Logger().debugStream() << "ClientNetworking::SendSynchronousMessage : received "
                                << "response message " << response_message;
@@ -342,6 +355,7 @@ void ClientNetworking::NetworkingThread() {
     m_io_service.reset();
     boost::mutex::scoped_lock lock(m_mutex);
     m_connected = false;
+    m_server_accepts_compression = false;
     if (TRACE_EXECUTION)
         Logger().debugStream() << "ClientNetworking::NetworkingThread() : Networking thread "
                                << "terminated.";
@@ -370,6 +384,10 @@ void ClientNetworking::HandleMessageHeaderRead(boost::system::error_code error,
         assert(static_cast<int>(bytes_transferred) <= HEADER_SIZE);
         if (static_cast<int>(bytes_transferred) == HEADER_SIZE) {
             BufferToHeader(m_incoming_header.c_array(), m_incoming_message);
+            {
+                boost::mutex::scoped_lock lock(m_mutex);
+                m_server_accepts_compression = HeaderAcceptsCompression(m_incoming_header.c_array());
+            }
             m_incoming_message.Resize(m_incoming_header[4]);
             boost::asio::async_read(
                 m_socket,
@@ -406,8 +424,11 @@ void ClientNetworking::HandleMessageWrite(boost::system::error_code error,
 
 void ClientNetworking::AsyncWriteMessage() {
     HeaderToBuffer(m_outgoing_messages.front(), m_outgoing_header.c_array());
+    SetHeaderAcceptsCompression(m_outgoing_header.c_array());
     std::vector<boost::asio::const_buffer> buffers;
     buffers.push_back(boost::asio::buffer(m_outgoing_header));
+    if (const SharedMessageSection& shared_section = m_outgoing_messages.front().SharedSection())
+        buffers.push_back(boost::asio::buffer(shared_section->data(), shared_section->size()));
     buffers.push_back(boost::asio::buffer(m_outgoing_messages.front().Data(),
                                           m_outgoing_messages.front().Size()));
     boost::asio::async_write(m_socket, buffers,
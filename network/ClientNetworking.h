@@ -57,6 +57,12 @@ public:
     /** Returns true iff there is at least one incoming message available. */
     bool MessageAvailable() const;
 
+    /** Blocks until there is at least one incoming message available or \a
+        timeout has elapsed.  Returns true iff there is a message available.
+        Unlike polling MessageAvailable(), this returns as soon as a message
+        arrives. */
+    bool WaitForMessage(const boost::posix_time::time_duration& timeout) const;
+
     /** Returns the ID of the player on this client. */
     int PlayerID() const;
 
@@ -83,14 +89,18 @@ public:
                                   boost::posix_time::seconds(5));
 
     /** Sends \a message to the server.  This function actually just enqueues
-        the message for sending and returns immediately. */
+        the message for sending and returns immediately.  If the server
+        accepts compressed messages, the body of \a message is compressed
+        here, in the calling thread, when it is larger than
+        MessageCompressionThreshold(). */
     void SendMessage(Message message);
 
     /** Gets the next incoming message from the server, places it into \a
         message, and removes it from the incoming message queue.  The function
         assumes that there is at least one message in the incoming queue.
         Users must call MessageAvailable() first to make sure this is the
-        case. */
+        case.  Compressed messages are decompressed here, in the calling
+        thread, rather than in the networking thread. */
     void GetMessage(Message& message);
 
     /** Sends \a message to the server, then blocks until it sees the first
@@ -131,6 +141,7 @@ private:
     MessageQueue                    m_incoming_messages; // accessed from multiple threads, but its interface is threadsafe
     std::list<Message>              m_outgoing_messages;
     bool                            m_connected;         // accessed from multiple threads
+    bool                            m_server_accepts_compression; // accessed from multiple threads
     bool                            m_cancel_retries;
 
     MessageHeaderBuffer             m_incoming_header;
@@ -5,6 +5,8 @@
 #include "../combat/CombatLogManager.h"
 #include "../Empire/EmpireManager.h"
 #include "../Empire/Diplomacy.h"
+#include "../util/AppInterface.h"
+#include "../util/i18n.h"
 #include "../util/Logger.h"
 #include "../util/MultiplayerCommon.h"
 #include "../util/ModeratorAction.h"
@@ -13,6 +15,7 @@
 #include "../universe/Universe.h"
 #include "../universe/Species.h"
 #include "../util/OptionsDB.h"
+#include "../util/Profiler.h"
 #include "../util/Serialize.h"
 #include "../util/ScopedTimer.h"
 #include <boost/lexical_cast.hpp>
@@ -24,10 +27,15 @@
 #include <boost/serialization/set.hpp>
 #include <boost/serialization/vector.hpp>
 #include <boost/serialization/weak_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
 #include <boost/timer.hpp>
 
 #include <zlib.h>
 
+#include <cstring>
 #include <iostream>
 #include <stdexcept>
 #include <sstream>
@@ -37,6 +45,33 @@
 namespace {
     const std::string DUMMY_EMPTY_MESSAGE = "Lathanda";
     const std::string ACKNOWLEDGEMENT = "ACK";
+
+    void AddOptions(OptionsDB& db) {
+        db.Add("network-compression-threshold", UserStringNop("OPTIONS_DB_NETWORK_COMPRESSION_THRESHOLD_DESC"),
+               1 << 16, RangedValidator<int>(0, 1 << 30));
+    }
+    bool temp_bool = RegisterOptions(&AddOptions);
+
+    // bits of the fourth header int
+    const int SYNCHRONOUS_RESPONSE_FLAG =   1 << 0;
+    const int COMPRESSED_FLAG =             1 << 1;
+    const int ACCEPTS_COMPRESSION_FLAG =    1 << 2;
+
+    // compressed bodies are prefixed with the uncompressed size
+    const std::size_t COMPRESSED_SIZE_PREFIX = sizeof(int);
+
+    // limits on the uncompressed size claimed by a compressed body's prefix,
+    // checked before anything is allocated for it.  deflate cannot compress
+    // by more than about 1032:1, and no message body is expected to exceed
+    // 1 GB once inflated.
+    const std::size_t MAX_COMPRESSION_RATIO = 1032;
+    const std::size_t MAX_UNCOMPRESSED_SIZE = 1 << 30;
+
+    boost::mutex            s_compression_stats_mutex;
+    MessageCompressionStats s_compression_stats;
+
+    double MillisecondsSince(const boost::posix_time::ptime& start)
+    { return (boost::posix_time::microsec_clock::universal_time() - start).total_microseconds() / 1000.0; }
 }
 
 ////////////////////////////////////////////////
@@ -71,7 +106,9 @@ Message::Message() :
     m_sending_player(0),
     m_receiving_player(0),
     m_synchronous_response(false),
+    m_compressed(false),
     m_message_size(0),
+    m_shared_section(),
     m_message_text()
 {}
 
@@ -84,7 +121,24 @@ Message::Message(MessageType type,
     m_sending_player(sending_player),
     m_receiving_player(receiving_player),
     m_synchronous_response(synchronous_response),
+    m_compressed(false),
+    m_message_size(text.size()),
+    m_shared_section(),
+    m_message_text(new char[text.size()])
+{ std::copy(text.begin(), text.end(), m_message_text.get()); }
+
+Message::Message(MessageType type,
+                 int sending_player,
+                 int receiving_player,
+                 const SharedMessageSection& shared_section,
+                 const std::string& text) :
+    m_type(type),
+    m_sending_player(sending_player),
+    m_receiving_player(receiving_player),
+    m_synchronous_response(false),
+    m_compressed(false),
     m_message_size(text.size()),
+    m_shared_section(shared_section),
     m_message_text(new char[text.size()])
 { std::copy(text.begin(), text.end(), m_message_text.get()); }
 
@@ -100,17 +154,34 @@ int Message::ReceivingPlayer() const
 bool Message::SynchronousResponse() const
 { return m_synchronous_response; }
 
+bool Message::Compressed() const
+{ return m_compressed; }
+
 std::size_t Message::Size() const
 { return m_message_size; }
 
 const char* Message::Data() const
 { return m_message_text.get(); }
 
-std::string Message::Text() const
-{ return std::string(m_message_text.get(), m_message_size); }
+std::string Message::Text() const {
+    if (!m_shared_section)
+        return std::string(m_message_text.get(), m_message_size);
+    std::string retval;
+    retval.reserve(BodySize());
+    retval.append(*m_shared_section);
+    retval.append(m_message_text.get(), m_message_size);
+    return retval;
+}
+
+const SharedMessageSection& Message::SharedSection() const
+{ return m_shared_section; }
+
+std::size_t Message::BodySize() const
+{ return (m_shared_section ? m_shared_section->size() : 0) + m_message_size; }
 
 void Message::Resize(std::size_t size) {
     m_message_size = size;
+    m_shared_section.reset();
     m_message_text.reset(new char[m_message_size]);
 }
 
@@ -122,7 +193,9 @@ void Message::Swap(Message& rhs) {
     std::swap(m_sending_player, rhs.m_sending_player);
     std::swap(m_receiving_player, rhs.m_receiving_player);
     std::swap(m_synchronous_response, rhs.m_synchronous_response);
+    std::swap(m_compressed, rhs.m_compressed);
     std::swap(m_message_size, rhs.m_message_size);
+    std::swap(m_shared_section, rhs.m_shared_section);
     std::swap(m_message_text, rhs.m_message_text);
 }
 
@@ -144,7 +217,8 @@ void BufferToHeader(const int* header_buf, Message& message) {
     message.m_type = static_cast<Message::MessageType>(header_buf[0]);
     message.m_sending_player = header_buf[1];
     message.m_receiving_player = header_buf[2];
-    message.m_synchronous_response = (header_buf[3] != 0);
+    message.m_synchronous_response = (header_buf[3] & SYNCHRONOUS_RESPONSE_FLAG) != 0;
+    message.m_compressed = (header_buf[3] & COMPRESSED_FLAG) != 0;
     message.m_message_size = header_buf[4];
 }
 
@@ -152,10 +226,120 @@ void HeaderToBuffer(const Message& message, int* header_buf) {
     header_buf[0] = message.Type();
     header_buf[1] = message.SendingPlayer();
     header_buf[2] = message.ReceivingPlayer();
-    header_buf[3] = message.SynchronousResponse();
-    header_buf[4] = message.Size();
+    header_buf[3] = (message.SynchronousResponse() ? SYNCHRONOUS_RESPONSE_FLAG : 0) |
+                    (message.Compressed() ? COMPRESSED_FLAG : 0);
+    header_buf[4] = message.BodySize();
+}
+
+bool HeaderAcceptsCompression(const int* header_buf)
+{ return (header_buf[3] & ACCEPTS_COMPRESSION_FLAG) != 0; }
+
+void SetHeaderAcceptsCompression(int* header_buf)
+{ header_buf[3] |= ACCEPTS_COMPRESSION_FLAG; }
+
+////////////////////////////////////////////////
+// Message compression
+////////////////////////////////////////////////
+MessageCompressionStats::MessageCompressionStats() :
+    messages_compressed(0),
+    messages_decompressed(0),
+    uncompressed_bytes(0.0),
+    compressed_bytes(0.0),
+    compression_time(0.0),
+    decompression_time(0.0)
+{}
+
+bool CompressMessage(Message& message, std::size_t threshold) {
+    if (message.m_compressed || threshold == 0 || message.BodySize() < threshold)
+        return false;
+
+    boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+
+    // the shared section, if any, is compressed together with the rest of
+    // the body, so the compressed message no longer shares it
+    std::string flattened_text;
+    if (message.m_shared_section)
+        flattened_text = message.Text();
+    const char* uncompressed_text = message.m_shared_section ? flattened_text.data() : message.Data();
+    int uncompressed_size = message.BodySize();
+
+    uLongf compressed_size = compressBound(uncompressed_size);
+    boost::shared_array<char> compressed_text(new char[COMPRESSED_SIZE_PREFIX + compressed_size]);
+    std::memcpy(compressed_text.get(), &uncompressed_size, COMPRESSED_SIZE_PREFIX);
+
+    int result = compress2(reinterpret_cast<Bytef*>(compressed_text.get() + COMPRESSED_SIZE_PREFIX),
+                           &compressed_size,
+                           reinterpret_cast<const Bytef*>(uncompressed_text), uncompressed_size,
+                           Z_BEST_SPEED);
+    if (result != Z_OK) {
+        Logger().errorStream() << "CompressMessage : zlib error " << result << " compressing message of size "
+                               << uncompressed_size << "; sending uncompressed";
+        return false;
+    }
+    if (COMPRESSED_SIZE_PREFIX + compressed_size >= static_cast<std::size_t>(uncompressed_size))
+        return false;
+
+    message.m_shared_section.reset();
+    message.m_message_text = compressed_text;
+    message.m_message_size = COMPRESSED_SIZE_PREFIX + compressed_size;
+    message.m_compressed = true;
+
+    boost::mutex::scoped_lock lock(s_compression_stats_mutex);
+    ++s_compression_stats.messages_compressed;
+    s_compression_stats.uncompressed_bytes += uncompressed_size;
+    s_compression_stats.compressed_bytes += message.m_message_size;
+    s_compression_stats.compression_time += MillisecondsSince(start);
+    return true;
+}
+
+void DecompressMessage(Message& message) {
+    if (!message.m_compressed)
+        return;
+
+    boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+
+    if (message.Size() < COMPRESSED_SIZE_PREFIX)
+        throw std::runtime_error("DecompressMessage : compressed message too short to contain its size");
+    int uncompressed_size = 0;
+    std::memcpy(&uncompressed_size, message.Data(), COMPRESSED_SIZE_PREFIX);
+    if (uncompressed_size < 0)
+        throw std::runtime_error("DecompressMessage : compressed message has invalid uncompressed size");
+    std::size_t compressed_size = message.Size() - COMPRESSED_SIZE_PREFIX;
+    if (static_cast<std::size_t>(uncompressed_size) > MAX_UNCOMPRESSED_SIZE ||
+        static_cast<std::size_t>(uncompressed_size) > compressed_size * MAX_COMPRESSION_RATIO)
+    {
+        throw std::runtime_error("DecompressMessage : compressed message of size " +
+                                 boost::lexical_cast<std::string>(compressed_size) +
+                                 " claims implausible uncompressed size " +
+                                 boost::lexical_cast<std::string>(uncompressed_size));
+    }
+
+    boost::shared_array<char> uncompressed_text(new char[uncompressed_size]);
+    uLongf inflated_size = uncompressed_size;
+    int result = uncompress(reinterpret_cast<Bytef*>(uncompressed_text.get()), &inflated_size,
+                            reinterpret_cast<const Bytef*>(message.Data() + COMPRESSED_SIZE_PREFIX),
+                            compressed_size);
+    if (result != Z_OK || static_cast<int>(inflated_size) != uncompressed_size)
+        throw std::runtime_error("DecompressMessage : zlib error " + boost::lexical_cast<std::string>(result) +
+                                 " inflating message of type " + boost::lexical_cast<std::string>(message.Type()));
+
+    message.m_message_text = uncompressed_text;
+    message.m_message_size = uncompressed_size;
+    message.m_compressed = false;
+
+    boost::mutex::scoped_lock lock(s_compression_stats_mutex);
+    ++s_compression_stats.messages_decompressed;
+    s_compression_stats.decompression_time += MillisecondsSince(start);
 }
 
+MessageCompressionStats GetMessageCompressionStats() {
+    boost::mutex::scoped_lock lock(s_compression_stats_mutex);
+    return s_compression_stats;
+}
+
+std::size_t MessageCompressionThreshold()
+{ return GetOptionsDB().Get<int>("network-compression-threshold"); }
+
 ////////////////////////////////////////////////
 // Message named ctors
 ////////////////////////////////////////////////
@@ -221,8 +405,10 @@ Message GameStartMessage(int player_id, bool single_player_game, int empire_id,
            << BOOST_SERIALIZATION_NVP(current_turn);
         GetUniverse().EncodingEmpire() = empire_id;
         oa << BOOST_SERIALIZATION_NVP(empires)
-           << BOOST_SERIALIZATION_NVP(species)
-           << BOOST_SERIALIZATION_NVP(combat_logs);
+           << BOOST_SERIALIZATION_NVP(species);
+        // only the latest log id is sent; clients request logs when needed
+        int latest_combat_log_id = combat_logs.LatestLogID();
+        oa << BOOST_SERIALIZATION_NVP(latest_combat_log_id);
         Serialize(oa, universe);
         bool loaded_game_data = false;
         oa << BOOST_SERIALIZATION_NVP(players)
@@ -248,8 +434,10 @@ Message GameStartMessage(int player_id, bool single_player_game, int empire_id,
            << BOOST_SERIALIZATION_NVP(current_turn);
         GetUniverse().EncodingEmpire() = empire_id;
         oa << BOOST_SERIALIZATION_NVP(empires)
-           << BOOST_SERIALIZATION_NVP(species)
-           << BOOST_SERIALIZATION_NVP(combat_logs);
+           << BOOST_SERIALIZATION_NVP(species);
+        // only the latest log id is sent; clients request logs when needed
+        int latest_combat_log_id = combat_logs.LatestLogID();
+        oa << BOOST_SERIALIZATION_NVP(latest_combat_log_id);
         Serialize(oa, universe);
         bool loaded_game_data = true;
         oa << BOOST_SERIALIZATION_NVP(players)
@@ -282,8 +470,10 @@ Message GameStartMessage(int player_id, bool single_player_game, int empire_id,
            << BOOST_SERIALIZATION_NVP(current_turn);
         GetUniverse().EncodingEmpire() = empire_id;
         oa << BOOST_SERIALIZATION_NVP(empires)
-           << BOOST_SERIALIZATION_NVP(species)
-           << BOOST_SERIALIZATION_NVP(combat_logs);
+           << BOOST_SERIALIZATION_NVP(species);
+        // only the latest log id is sent; clients request logs when needed
+        int latest_combat_log_id = combat_logs.LatestLogID();
+        oa << BOOST_SERIALIZATION_NVP(latest_combat_log_id);
         Serialize(oa, universe);
         bool loaded_game_data = true;
         oa << BOOST_SERIALIZATION_NVP(players)
@@ -341,19 +531,51 @@ Message TurnUpdateMessage(int player_id, int empire_id, int current_turn,
                           const EmpireManager& empires, const Universe& universe,
                           const SpeciesManager& species, const CombatLogManager& combat_logs,
                           const std::map<int, PlayerInfo>& players)
+{
+    return TurnUpdateMessage(player_id, empire_id, TurnUpdateSharedSection(current_turn, species, players),
+                             empires, universe, combat_logs);
+}
+
+SharedMessageSection TurnUpdateSharedSection(int current_turn, const SpeciesManager& species,
+                                             const std::map<int, PlayerInfo>& players)
 {
     std::ostringstream os;
     {
         freeorion_oarchive oa(os);
-        GetUniverse().EncodingEmpire() = empire_id;
+        GetUniverse().EncodingEmpire() = ALL_EMPIRES;
         oa << BOOST_SERIALIZATION_NVP(current_turn)
-           << BOOST_SERIALIZATION_NVP(empires)
            << BOOST_SERIALIZATION_NVP(species)
-           << BOOST_SERIALIZATION_NVP(combat_logs);
+           << BOOST_SERIALIZATION_NVP(players);
+    }
+    // the section is prefixed with its size, so that the recipient can find
+    // where the per-empire sections begin
+    std::string shared_text = os.str();
+    Profiler::Count("turn update bytes serialized", shared_text.size());
+    int shared_size = shared_text.size();
+    std::string section(reinterpret_cast<const char*>(&shared_size), sizeof(shared_size));
+    section.append(shared_text);
+    return SharedMessageSection(new std::string(section));
+}
+
+Message TurnUpdateMessage(int player_id, int empire_id, const SharedMessageSection& shared_section,
+                          const EmpireManager& empires, const Universe& universe,
+                          const CombatLogManager& combat_logs)
+{
+    std::ostringstream os;
+    {
+        freeorion_oarchive oa(os);
+        GetUniverse().EncodingEmpire() = empire_id;
+        int latest_combat_log_id = combat_logs.LatestLogID();
+        oa << BOOST_SERIALIZATION_NVP(empires)
+           << BOOST_SERIALIZATION_NVP(latest_combat_log_id);
+        // the recipient already has the statistics of earlier turns
+        GetUniverse().StatHistoryEncodingTurn() = universe.GetStatHistory().LastTurn();
         Serialize(oa, universe);
-        oa << BOOST_SERIALIZATION_NVP(players);
+        GetUniverse().StatHistoryEncodingTurn() = INVALID_GAME_TURN;
     }
-    return Message(Message::TURN_UPDATE, Networking::INVALID_PLAYER_ID, player_id, os.str());
+    std::string text = os.str();
+    Profiler::Count("turn update bytes serialized", text.size());
+    return Message(Message::TURN_UPDATE, Networking::INVALID_PLAYER_ID, player_id, shared_section, text);
 }
 
 Message TurnPartialUpdateMessage(int player_id, int empire_id, const Universe& universe) {
@@ -361,7 +583,9 @@ Message TurnPartialUpdateMessage(int player_id, int empire_id, const Universe& u
     {
         freeorion_oarchive oa(os);
         GetUniverse().EncodingEmpire() = empire_id;
+        GetUniverse().StatHistoryEncodingTurn() = universe.GetStatHistory().LastTurn();
         Serialize(oa, universe);
+        GetUniverse().StatHistoryEncodingTurn() = INVALID_GAME_TURN;
     }
     return Message(Message::TURN_PARTIAL_UPDATE, Networking::INVALID_PLAYER_ID, player_id, os.str());
 }
@@ -423,6 +647,27 @@ Message DispatchDesignIDMessage(int player_id, int new_id) {
                    boost::lexical_cast<std::string>(new_id), true);
 }
 
+Message RequestCombatLogsMessage(int sender, const std::vector<int>& log_ids) {
+    std::ostringstream os;
+    {
+        freeorion_oarchive oa(os);
+        oa << BOOST_SERIALIZATION_NVP(log_ids);
+    }
+    return Message(Message::REQUEST_COMBAT_LOGS, sender, Networking::INVALID_PLAYER_ID, os.str());
+}
+
+Message DispatchCombatLogsMessage(int receiver, const std::map<int, CombatLog>& logs,
+                                  const std::vector<int>& unavailable_log_ids)
+{
+    std::ostringstream os;
+    {
+        freeorion_oarchive oa(os);
+        oa << BOOST_SERIALIZATION_NVP(logs)
+           << BOOST_SERIALIZATION_NVP(unavailable_log_ids);
+    }
+    return Message(Message::DISPATCH_COMBAT_LOGS, Networking::INVALID_PLAYER_ID, receiver, os.str());
+}
+
 Message HostSaveGameMessage(int sender, const std::string& filename)
 { return Message(Message::SAVE_GAME, sender, Networking::INVALID_PLAYER_ID, filename); }
 
@@ -624,8 +869,10 @@ void ExtractMessageData(const Message& msg, bool& single_player_game, int& empir
         ia >> BOOST_SERIALIZATION_NVP(empires);
         Logger().debugStream() << "ExtractMessage empire deserialization time " << (deserialize_timer.elapsed() * 1000.0);
 
+        int latest_combat_log_id = -1;
         ia >> BOOST_SERIALIZATION_NVP(species)
-           >> BOOST_SERIALIZATION_NVP(combat_logs);
+           >> BOOST_SERIALIZATION_NVP(latest_combat_log_id);
+        combat_logs.SetLatestLogID(latest_combat_log_id);
 
         deserialize_timer.restart();
         Deserialize(ia, universe);
@@ -696,16 +943,42 @@ void ExtractMessageData(const Message& msg, int empire_id, int& current_turn,
                         std::map<int, PlayerInfo>& players)
 {
     try {
-        ScopedTimer timer("Turn Update Unpacking", true);
-        std::istringstream is(msg.Text());
-        freeorion_iarchive ia(is);
+        ScopedTimer timer("Turn Update Unpacking", true, true);
+        // the sections are parsed in place; the shared section is at the
+        // start of the received buffer, or is still referenced separately if
+        // the message has not been sent over the network
+        const SharedMessageSection& shared_section = msg.SharedSection();
+        const char* shared_begin = shared_section ? shared_section->data() : msg.Data();
+        std::size_t shared_buffer_size = shared_section ? shared_section->size() : msg.Size();
+        int shared_size = 0;
+        if (shared_buffer_size >= sizeof(shared_size))
+            std::memcpy(&shared_size, shared_begin, sizeof(shared_size));
+        if (shared_size < 0 || shared_buffer_size < sizeof(shared_size) + shared_size)
+            throw std::runtime_error("TURN_UPDATE message shared section size is inconsistent with message size");
+        shared_begin += sizeof(shared_size);
+
+        const char* empire_section = shared_section ? msg.Data() : shared_begin + shared_size;
+        const char* empire_section_end = msg.Data() + msg.Size();
+
         GetUniverse().EncodingEmpire() = empire_id;
-        ia >> BOOST_SERIALIZATION_NVP(current_turn)
-           >> BOOST_SERIALIZATION_NVP(empires)
-           >> BOOST_SERIALIZATION_NVP(species)
-           >> BOOST_SERIALIZATION_NVP(combat_logs);
-        Deserialize(ia, universe);
-        ia >> BOOST_SERIALIZATION_NVP(players);
+        {
+            boost::iostreams::stream<boost::iostreams::array_source>
+                is(shared_begin, static_cast<std::size_t>(shared_size));
+            freeorion_iarchive ia(is);
+            ia >> BOOST_SERIALIZATION_NVP(current_turn)
+               >> BOOST_SERIALIZATION_NVP(species)
+               >> BOOST_SERIALIZATION_NVP(players);
+        }
+        {
+            boost::iostreams::stream<boost::iostreams::array_source>
+                is(empire_section, empire_section_end);
+            freeorion_iarchive ia(is);
+            int latest_combat_log_id = -1;
+            ia >> BOOST_SERIALIZATION_NVP(empires)
+               >> BOOST_SERIALIZATION_NVP(latest_combat_log_id);
+            combat_logs.SetLatestLogID(latest_combat_log_id);
+            Deserialize(ia, universe);
+        }
     } catch (const std::exception& err) {
         Logger().errorStream() << "ExtractMessageData(const Message& msg, int empire_id, int& "
                                << "current_turn, EmpireManager& empires, Universe& universe, "
@@ -718,7 +991,7 @@ void ExtractMessageData(const Message& msg, int empire_id, int& current_turn,
 
 void ExtractMessageData(const Message& msg, int empire_id, Universe& universe) {
     try {
-        ScopedTimer timer("Mid Turn Update Unpacking", true);
+        ScopedTimer timer("Mid Turn Update Unpacking", true, true);
         std::istringstream is(msg.Text());
         freeorion_iarchive ia(is);
         GetUniverse().EncodingEmpire() = empire_id;
@@ -866,6 +1139,36 @@ void ExtractMessageData(const Message& msg, DiplomaticMessage& diplo_message) {
     }
 }
 
+void ExtractMessageData(const Message& msg, std::vector<int>& log_ids) {
+    try {
+        std::istringstream is(msg.Text());
+        freeorion_iarchive ia(is);
+        ia >> BOOST_SERIALIZATION_NVP(log_ids);
+    } catch (const std::exception& err) {
+        Logger().errorStream() << "ExtractMessageData(const Message& msg, std::vector<int>& log_ids) failed!  Message:\n"
+                               << msg.Text() << "\n"
+                               << "Error: " << err.what();
+        throw err;
+    }
+}
+
+void ExtractMessageData(const Message& msg, std::map<int, CombatLog>& logs,
+                        std::vector<int>& unavailable_log_ids)
+{
+    try {
+        std::istringstream is(msg.Text());
+        freeorion_iarchive ia(is);
+        ia >> BOOST_SERIALIZATION_NVP(logs)
+           >> BOOST_SERIALIZATION_NVP(unavailable_log_ids);
+    } catch (const std::exception& err) {
+        Logger().errorStream() << "ExtractMessageData(const Message& msg, std::map<int, CombatLog>& logs, "
+                               << "std::vector<int>& unavailable_log_ids) failed!  Message:\n"
+                               << msg.Text() << "\n"
+                               << "Error: " << err.what();
+        throw err;
+    }
+}
+
 void ExtractMessageData(const Message& msg, DiplomaticStatusUpdateInfo& diplo_update) {
     try {
         std::istringstream is(msg.Text());
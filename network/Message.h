@@ -7,6 +7,7 @@
 #include <GG/Enum.h>
 
 #include <boost/shared_array.hpp>
+#include <boost/shared_ptr.hpp>
 
 #if defined(_MSC_VER) && defined(int64_t)
 #undef int64_t
@@ -22,6 +23,7 @@ struct CombatSetupGroup;
 class EmpireManager;
 class SpeciesManager;
 class CombatLogManager;
+struct CombatLog;
 class Message;
 struct MultiplayerLobbyData;
 class OrderSet;
@@ -42,12 +44,24 @@ namespace Moderator {
 typedef std::vector<CombatOrder> CombatOrderSet;
 typedef std::map<int, ShipDesign*> ShipDesignMap;
 
+/** An encoded leading section of a message body that is identical for several
+  * recipients, and is shared by their Messages rather than copied into each. */
+typedef boost::shared_ptr<const std::string> SharedMessageSection;
+
 /** Fills in the relevant portions of \a message with the values in the buffer \a header_buf. */
 FO_COMMON_API void BufferToHeader(const int* header_buf, Message& message);
 
 /** Fills \a header_buf from the relevant portions of \a message. */
 FO_COMMON_API void HeaderToBuffer(const Message& message, int* header_buf);
 
+/** Returns true iff the sender of the header in \a header_buf has indicated
+  * that it accepts messages with compressed bodies. */
+FO_COMMON_API bool HeaderAcceptsCompression(const int* header_buf);
+
+/** Marks the header in \a header_buf as coming from a sender that accepts
+  * messages with compressed bodies. */
+FO_COMMON_API void SetHeaderAcceptsCompression(int* header_buf);
+
 /** Encapsulates a variable-length char buffer containing a message to be passed
   * among the server and one or more clients.  Note that std::string is often
   * thread unsafe on many platforms, so a dynamically allocated char array is
@@ -88,6 +102,8 @@ public:
         DISPATCH_NEW_OBJECT_ID, ///< sent by server to client with the new object ID.
         REQUEST_NEW_DESIGN_ID,  ///< sent by client to server requesting a new design ID.
         DISPATCH_NEW_DESIGN_ID, ///< sent by server to client with the new design ID.
+        REQUEST_COMBAT_LOGS,    ///< sent by client to server requesting combat logs the client doesn't have
+        DISPATCH_COMBAT_LOGS,   ///< sent by server to client with requested combat logs
         VICTORY_DEFEAT,         ///< sent by server to all clients when one or more players have met victory or defeat conditions
         PLAYER_ELIMINATED,      ///< sent by server to all clients (except the eliminated player) when a player is eliminated
         END_GAME,               ///< sent by the server when the current game is to ending (see EndGameReason for the possible reasons this message is sent out)
@@ -134,6 +150,14 @@ public:
             int receiving_player,
             const std::string& text,
             bool synchronous_response = false);
+
+    /** Ctor for a message whose body is \a shared_section followed by \a
+      * text.  \a shared_section is not copied. */
+    Message(MessageType message_type,
+            int sending_player,
+            int receiving_player,
+            const SharedMessageSection& shared_section,
+            const std::string& text);
     //@}
 
     /** \name Accessors */ //@{
@@ -141,9 +165,13 @@ public:
     int         SendingPlayer() const;      ///< Returns the ID of the sending player.
     int         ReceivingPlayer() const;    ///< Returns the ID of the receiving player.
     bool        SynchronousResponse() const;///< Returns true if this message is in reponse to a synchronous message
+    bool        Compressed() const;         ///< Returns true if the underlying buffer is zlib-compressed; see DecompressMessage()
     std::size_t Size() const;               ///< Returns the size of the underlying buffer.
     const char* Data() const;               ///< Returns the underlying buffer.
-    std::string Text() const;               ///< Returns the underlying buffer as a std::string.
+    std::string Text() const;               ///< Returns the whole message body, including any shared section, as a std::string.
+    const SharedMessageSection&
+                SharedSection() const;      ///< Returns the shared section that precedes the underlying buffer in the message body, if any.
+    std::size_t BodySize() const;           ///< Returns the size of the whole message body, including any shared section.
     //@}
 
     /** \name Accessors */ //@{
@@ -157,11 +185,15 @@ private:
     int           m_sending_player;
     int           m_receiving_player;
     bool          m_synchronous_response;
+    bool          m_compressed;
     int           m_message_size;
 
+    SharedMessageSection      m_shared_section;
     boost::shared_array<char> m_message_text;
 
     friend void BufferToHeader(const int* header_buf, Message& message);
+    friend bool CompressMessage(Message& message, std::size_t threshold);
+    friend void DecompressMessage(Message& message);
 };
 
 bool operator==(const Message& lhs, const Message& rhs);
@@ -170,6 +202,45 @@ bool operator!=(const Message& lhs, const Message& rhs);
 FO_COMMON_API void swap(Message& lhs, Message& rhs); ///< Swaps the contents of \a lhs and \a rhs.  Does not throw.
 
 
+////////////////////////////////////////////////
+// Message compression
+////////////////////////////////////////////////
+
+/** Totals of the work done by CompressMessage() and DecompressMessage() in
+  * this process, for tuning the "network-compression-threshold" option. */
+struct FO_COMMON_API MessageCompressionStats {
+    MessageCompressionStats();
+
+    int         messages_compressed;
+    int         messages_decompressed;
+    double      uncompressed_bytes;     ///< total body size of compressed messages before compression
+    double      compressed_bytes;       ///< total body size of compressed messages after compression
+    double      compression_time;       ///< total time spent compressing, in ms
+    double      decompression_time;     ///< total time spent decompressing, in ms
+};
+
+/** Replaces the body of \a message with a zlib-compressed copy if it is at
+  * least \a threshold bytes and compression actually makes it smaller.
+  * Returns true if the message was compressed.  The body of any other Message
+  * that shares the original buffer with \a message is left unchanged. */
+FO_COMMON_API bool CompressMessage(Message& message, std::size_t threshold);
+
+/** Replaces a compressed body of \a message with its uncompressed contents.
+  * Does nothing if \a message is not compressed.  Throws std::runtime_error
+  * if the body cannot be inflated, or if the uncompressed size it claims is
+  * larger than 1 GB or than its compressed size could possibly inflate to,
+  * without allocating for it. */
+FO_COMMON_API void DecompressMessage(Message& message);
+
+/** Returns the compression totals accumulated so far in this process. */
+FO_COMMON_API MessageCompressionStats GetMessageCompressionStats();
+
+/** Returns the "network-compression-threshold" option: the minimum message
+  * body size, in bytes, that is compressed before sending, or 0 if
+  * compression of outgoing messages is disabled. */
+FO_COMMON_API std::size_t MessageCompressionThreshold();
+
+
 ////////////////////////////////////////////////
 // Message stringification
 ////////////////////////////////////////////////
@@ -251,6 +322,19 @@ FO_COMMON_API Message TurnUpdateMessage(int player_id, int empire_id, int curren
                                         const CombatLogManager& combat_logs,
                                         const std::map<int, PlayerInfo>& players);
 
+/** encodes the sections of a TURN_UPDATE message that are the same for every
+  * recipient, so that they can be encoded once per turn and shared by all the
+  * TURN_UPDATE messages created from them. */
+FO_COMMON_API SharedMessageSection TurnUpdateSharedSection(int current_turn, const SpeciesManager& species,
+                                                           const std::map<int, PlayerInfo>& players);
+
+/** creates a TURN_UPDATE message from \a shared_section, as returned by
+  * TurnUpdateSharedSection(), and the sections specific to \a empire_id. */
+FO_COMMON_API Message TurnUpdateMessage(int player_id, int empire_id,
+                                        const SharedMessageSection& shared_section,
+                                        const EmpireManager& empires, const Universe& universe,
+                                        const CombatLogManager& combat_logs);
+
 /** create a TURN_PARTIAL_UPDATE message. */
 FO_COMMON_API Message TurnPartialUpdateMessage(int player_id, int empire_id, const Universe& universe);
 
@@ -373,6 +457,18 @@ FO_COMMON_API Message CombatTurnOrdersMessage(int sender, const CombatOrderSet&
 // Message data extractors
 ////////////////////////////////////////////////
 
+/** creates a REQUEST_COMBAT_LOGS message, asking the server for the combat
+  * logs with ids \a log_ids.  The server replies with a DISPATCH_COMBAT_LOGS
+  * message. */
+FO_COMMON_API Message RequestCombatLogsMessage(int sender, const std::vector<int>& log_ids);
+
+/** creates a DISPATCH_COMBAT_LOGS message, containing the combat logs
+  * \a logs requested by player \a receiver, and the ids
+  * \a unavailable_log_ids of requested logs that won't be sent to that
+  * player. */
+FO_COMMON_API Message DispatchCombatLogsMessage(int receiver, const std::map<int, CombatLog>& logs,
+                                                const std::vector<int>& unavailable_log_ids);
+
 FO_COMMON_API void ExtractMessageData(const Message& msg, std::string& problem, bool& fatal);
 
 FO_COMMON_API void ExtractMessageData(const Message& msg, MultiplayerLobbyData& lobby_data);
@@ -415,6 +511,11 @@ FO_COMMON_API void ExtractMessageData(const Message& msg, DiplomaticMessage& dip
 
 FO_COMMON_API void ExtractMessageData(const Message& msg, DiplomaticStatusUpdateInfo& diplo_update);
 
+FO_COMMON_API void ExtractMessageData(const Message& msg, std::vector<int>& log_ids);
+
+FO_COMMON_API void ExtractMessageData(const Message& msg, std::map<int, CombatLog>& logs,
+                                      std::vector<int>& unavailable_log_ids);
+
 FO_COMMON_API void ExtractMessageData(const Message& msg, Message::VictoryOrDefeat& victory_or_defeat,
                         std::string& reason_string, int& empire_id);
 
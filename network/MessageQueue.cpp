@@ -35,6 +35,14 @@ void MessageQueue::PushBack(Message& message) {
     swap(m_queue.back(), message);
     if (m_queue.back().SynchronousResponse())
         m_have_synchronous_response.notify_one();
+    m_have_message.notify_all();
+}
+
+bool MessageQueue::WaitForMessage(const boost::posix_time::time_duration& timeout) const {
+    boost::mutex::scoped_lock lock(m_monitor);
+    if (m_queue.empty())
+        m_have_message.timed_wait(lock, timeout);
+    return !m_queue.empty();
 }
 
 void MessageQueue::PopFront(Message& message) {
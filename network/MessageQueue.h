@@ -4,6 +4,7 @@
 
 #include <boost/thread/condition.hpp>
 #include <boost/thread/mutex.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
 
 #include <list>
 
@@ -33,6 +34,10 @@ public:
     /** Returns the front message in the queue. */
     void PopFront(Message& message);
 
+    /** Blocks the calling thread until the queue is nonempty or \a timeout
+        has elapsed.  Returns true iff the queue is nonempty. */
+    bool WaitForMessage(const boost::posix_time::time_duration& timeout) const;
+
     /** Returns the first synchronous repsonse message in the queue.  If no such message is found, this function blocks
         the calling thread until a synchronous response element is added. */
     void EraseFirstSynchronousResponse(Message& message);
@@ -40,6 +45,8 @@ public:
 private:
     std::list<Message> m_queue;
     boost::condition   m_have_synchronous_response;
+    mutable boost::condition
+                       m_have_message;
     boost::mutex&      m_monitor;
 };
 
@@ -1,6 +1,7 @@
 #include "ServerNetworking.h"
 
 #include "../util/Logger.h"
+#include "../util/RunQueue.h"
 
 #include <GG/SignalsAndSlots.h>
 
@@ -35,8 +36,11 @@ namespace {
     void WriteMessage(boost::asio::ip::tcp::socket& socket, const Message& message) {
         int header_buf[5];
         HeaderToBuffer(message, header_buf);
+        SetHeaderAcceptsCompression(header_buf);
         std::vector<boost::asio::const_buffer> buffers;
         buffers.push_back(boost::asio::buffer(header_buf));
+        if (const SharedMessageSection& shared_section = message.SharedSection())
+            buffers.push_back(boost::asio::buffer(shared_section->data(), shared_section->size()));
         buffers.push_back(boost::asio::buffer(message.Data(), message.Size()));
         boost::asio::write(socket, buffers);
     }
@@ -48,12 +52,57 @@ namespace {
     private:
         int m_id;
     };
+
+    /** Inflates a compressed \a message before passing it on to \a callback.
+        Bound into the events queued by PlayerConnection, so that decompression
+        happens when the event is handled rather than in the socket read
+        handler. */
+    void DecompressAndDispatch(MessageAndConnectionFn callback, Message message,
+                               PlayerConnectionPtr player_connection)
+    {
+        try {
+            DecompressMessage(message);
+        } catch (const std::exception& e) {
+            Logger().errorStream() << "PlayerConnection : unable to decompress message from player "
+                                   << player_connection->PlayerID() << " : " << e.what();
+            return;
+        }
+        callback(message, player_connection);
+    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// CompressMessageWorkItem
+////////////////////////////////////////////////////////////////////////////////
+/** Compresses a message on one of ServerNetworking's compression threads, and
+    then posts the compressed message to the io_service thread. */
+class CompressMessageWorkItem {
+public:
+    CompressMessageWorkItem(boost::asio::io_service& io_service, const Message& message,
+                            std::size_t threshold, const boost::function<void (const Message&)>& done) :
+        m_io_service(io_service),
+        m_message(message),
+        m_threshold(threshold),
+        m_done(done)
+    {}
+
+    void operator()() {
+        CompressMessage(m_message, m_threshold);
+        m_io_service.post(boost::bind(m_done, m_message));
+    }
+
+private:
+    boost::asio::io_service&                    m_io_service;
+    Message                                     m_message;
+    std::size_t                                 m_threshold;
+    boost::function<void (const Message&)>      m_done;
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // PlayerConnection
 ////////////////////////////////////////////////////////////////////////////////
 PlayerConnection::PlayerConnection(boost::asio::io_service& io_service,
+                                   RunQueue<CompressMessageWorkItem>* compression_queue,
                                    MessageAndConnectionFn nonplayer_message_callback,
                                    MessageAndConnectionFn player_message_callback,
                                    ConnectionFn disconnected_callback) :
@@ -61,6 +110,10 @@ PlayerConnection::PlayerConnection(boost::asio::io_service& io_service,
     m_ID(INVALID_PLAYER_ID),
     m_new_connection(true),
     m_client_type(Networking::INVALID_CLIENT_TYPE),
+    m_accepts_compression(false),
+    m_outgoing_messages(),
+    m_first_outgoing_serial(0),
+    m_compression_queue(compression_queue),
     m_nonplayer_message_callback(nonplayer_message_callback),
     m_player_message_callback(player_message_callback),
     m_disconnected_callback(disconnected_callback)
@@ -84,6 +137,9 @@ Networking::ClientType PlayerConnection::GetClientType() const
 bool PlayerConnection::IsLocalConnection() const
 { return (m_socket.remote_endpoint().address().is_loopback()); }
 
+bool PlayerConnection::AcceptsCompression() const
+{ return m_accepts_compression; }
+
 void PlayerConnection::Start()
 { AsyncReadMessage(); }
 
@@ -91,7 +147,53 @@ void PlayerConnection::SendMessage(const Message& message) {
     /*if (TRACE_EXECUTION)
         Logger().debugStream() << "ServerNetworking::SendMessage : sending message "
                                << message;*/
-    WriteMessage(m_socket, message);
+    std::size_t threshold = m_accepts_compression ? MessageCompressionThreshold() : 0;
+    bool compress = threshold != 0 && !message.Compressed() && message.BodySize() >= threshold;
+
+    if (compress && m_compression_queue) {
+        // compress on a worker thread, rather than holding up the io_service
+        // thread, and write the message when it is done
+        unsigned int serial = m_first_outgoing_serial + m_outgoing_messages.size();
+        m_outgoing_messages.push_back(std::make_pair(message, false));
+        m_compression_queue->AddWork(
+            new CompressMessageWorkItem(m_socket.get_io_service(), message, threshold,
+                                        boost::bind(&PlayerConnection::HandleMessageCompressed,
+                                                    shared_from_this(), serial, _1)));
+        return;
+    }
+
+    if (compress) {
+        Message compressed_message(message);
+        if (CompressMessage(compressed_message, threshold)) {
+            SendMessage(compressed_message);
+            return;
+        }
+    }
+
+    if (m_outgoing_messages.empty())
+        WriteMessage(m_socket, message);
+    else
+        m_outgoing_messages.push_back(std::make_pair(message, true));   // wait for messages sent earlier
+}
+
+void PlayerConnection::HandleMessageCompressed(unsigned int serial, const Message& message) {
+    std::size_t index = serial - m_first_outgoing_serial;
+    if (index >= m_outgoing_messages.size()) {
+        Logger().errorStream() << "PlayerConnection::HandleMessageCompressed got unknown message serial " << serial;
+        return;
+    }
+    m_outgoing_messages[index] = std::make_pair(message, true);
+    WriteReadyMessages();
+}
+
+void PlayerConnection::WriteReadyMessages() {
+    while (!m_outgoing_messages.empty() && m_outgoing_messages.front().second) {
+        Message message = m_outgoing_messages.front().first;
+        m_outgoing_messages.pop_front();
+        ++m_first_outgoing_serial;
+        if (m_socket.is_open())
+            WriteMessage(m_socket, message);
+    }
 }
 
 void PlayerConnection::EstablishPlayer(int id, const std::string& player_name,
@@ -133,12 +235,14 @@ void PlayerConnection::SetClientType(Networking::ClientType client_type) {
 
 PlayerConnectionPtr
 PlayerConnection::NewConnection(boost::asio::io_service& io_service,
+                                RunQueue<CompressMessageWorkItem>* compression_queue,
                                 MessageAndConnectionFn nonplayer_message_callback,
                                 MessageAndConnectionFn player_message_callback,
                                 ConnectionFn disconnected_callback)
 {
     return PlayerConnectionPtr(
         new PlayerConnection(io_service,
+                             compression_queue,
                              nonplayer_message_callback,
                              player_message_callback,
                              disconnected_callback));
@@ -178,6 +282,8 @@ namespace {
         case Message::DISPATCH_NEW_OBJECT_ID:   return "Dispatch New Object ID";
         case Message::REQUEST_NEW_DESIGN_ID:    return "Request New Design ID";
         case Message::DISPATCH_NEW_DESIGN_ID:   return "Dispatch New Design ID";
+        case Message::REQUEST_COMBAT_LOGS:      return "Request Combat Logs";
+        case Message::DISPATCH_COMBAT_LOGS:     return "Dispatch Combat Logs";
         case Message::VICTORY_DEFEAT:       return "Victory/Defeat";
         case Message::PLAYER_ELIMINATED:    return "Player Elimination";
         case Message::END_GAME:             return "End Game";
@@ -207,15 +313,18 @@ void PlayerConnection::HandleMessageBodyRead(boost::system::error_code error,
                                        << m_incoming_message.SendingPlayer()
                                        << " of type "
                                        << MessageTypeName(m_incoming_message.Type())
-                                       << " and size "<< m_incoming_message.Size();
+                                       << " and size "<< m_incoming_message.Size()
+                                       << (m_incoming_message.Compressed() ? " (compressed)" : "");
                 //Logger().debugStream() << "     Full message: " << m_incoming_message;
             }
             if (EstablishedPlayer()) {
-                EventSignal(boost::bind(m_player_message_callback,
+                EventSignal(boost::bind(&DecompressAndDispatch,
+                                        m_player_message_callback,
                                         m_incoming_message,
                                         shared_from_this()));
             } else {
-                EventSignal(boost::bind(m_nonplayer_message_callback,
+                EventSignal(boost::bind(&DecompressAndDispatch,
+                                        m_nonplayer_message_callback,
                                         m_incoming_message,
                                         shared_from_this()));
             }
@@ -254,6 +363,7 @@ void PlayerConnection::HandleMessageHeaderRead(boost::system::error_code error,
         assert(static_cast<int>(bytes_transferred) <= HEADER_SIZE);
         if (static_cast<int>(bytes_transferred) == HEADER_SIZE) {
             BufferToHeader(m_incoming_header_buffer.c_array(), m_incoming_message);
+            m_accepts_compression = HeaderAcceptsCompression(m_incoming_header_buffer.c_array());
             m_incoming_message.Resize(m_incoming_header_buffer[4]);
             boost::asio::async_read(
                 m_socket,
@@ -309,14 +419,18 @@ ServerNetworking::ServerNetworking(boost::asio::io_service& io_service,
                                    ConnectionFn disconnected_callback) :
     m_host_player_id(Networking::INVALID_PLAYER_ID),
     m_discovery_server(new DiscoveryServer(io_service)),
+    m_compression_queue(new RunQueue<CompressMessageWorkItem>(
+        std::max(1u, boost::thread::hardware_concurrency()))),
     m_player_connection_acceptor(io_service),
     m_nonplayer_message_callback(nonplayer_message_callback),
     m_player_message_callback(player_message_callback),
     m_disconnected_callback(disconnected_callback)
 { Init(); }
 
-ServerNetworking::~ServerNetworking()
-{ delete m_discovery_server; }
+ServerNetworking::~ServerNetworking() {
+    delete m_discovery_server;
+    delete m_compression_queue;
+}
 
 bool ServerNetworking::empty() const
 { return m_player_connections.empty(); }
@@ -488,6 +602,7 @@ void ServerNetworking::AcceptNextConnection() {
     PlayerConnectionPtr next_connection =
         PlayerConnection::NewConnection(
             m_player_connection_acceptor.get_io_service(),
+            m_compression_queue,
             m_nonplayer_message_callback,
             m_player_message_callback,
             boost::bind(&ServerNetworking::DisconnectImpl, this, _1));
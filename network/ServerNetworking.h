@@ -11,12 +11,15 @@
 #include <boost/iterator/filter_iterator.hpp>
 #include <boost/signals2/signal.hpp>
 
+#include <deque>
 #include <queue>
 #include <set>
 
 
 class DiscoveryServer;
 class PlayerConnection;
+class CompressMessageWorkItem;
+template <class WorkItem> class RunQueue;
 
 typedef boost::shared_ptr<PlayerConnection> PlayerConnectionPtr;
 typedef boost::function<void (Message, PlayerConnectionPtr)> MessageAndConnectionFn;
@@ -143,6 +146,7 @@ private:
     int                             m_host_player_id;
 
     DiscoveryServer*                m_discovery_server;
+    RunQueue<CompressMessageWorkItem>*  m_compression_queue;    ///< worker threads that compress outgoing messages
     boost::asio::ip::tcp::acceptor  m_player_connection_acceptor;
     PlayerConnections               m_player_connections;
     std::queue<NullaryFn>           m_event_queue;
@@ -187,13 +191,22 @@ public:
     /** Checks if client associated with this connection runs on the same
         physical machine as the server */
     bool IsLocalConnection() const;
+
+    /** Returns true iff the client associated with this connection has
+        indicated that it accepts compressed messages. */
+    bool AcceptsCompression() const;
     //@}
 
     /** \name Mutators */ //@{
     /** Starts the connection reading incoming messages on its socket. */
     void Start();
 
-    /** Sends \a message to out on the connection. */
+    /** Sends \a message to out on the connection.  The body of \a message is
+        compressed first if the client accepts compressed messages and it is
+        larger than MessageCompressionThreshold().  Compression is done on a
+        worker thread, and the message is written once it is compressed, so
+        that messages sent after it on this connection are held back until
+        then to keep their order. */
     void SendMessage(const Message& message);
 
     /** Establishes a connection as a player with a specific name and id.
@@ -209,6 +222,7 @@ public:
     /** Creates a new PlayerConnection and returns it as a shared_ptr. */
     static PlayerConnectionPtr
     NewConnection(boost::asio::io_service& io_service,
+                  RunQueue<CompressMessageWorkItem>* compression_queue,
                   MessageAndConnectionFn nonplayer_message_callback,
                   MessageAndConnectionFn player_message_callback,
                   ConnectionFn disconnected_callback);
@@ -217,6 +231,7 @@ private:
     typedef boost::array<int, 5> MessageHeaderBuffer;
 
     PlayerConnection(boost::asio::io_service& io_service,
+                     RunQueue<CompressMessageWorkItem>* compression_queue,
                      MessageAndConnectionFn nonplayer_message_callback,
                      MessageAndConnectionFn player_message_callback,
                      ConnectionFn disconnected_callback);
@@ -225,6 +240,8 @@ private:
     void HandleMessageHeaderRead(boost::system::error_code error,
                                  std::size_t bytes_transferred);
     void AsyncReadMessage();
+    void HandleMessageCompressed(unsigned int serial, const Message& message);
+    void WriteReadyMessages();
 
     boost::asio::ip::tcp::socket    m_socket;
     MessageHeaderBuffer             m_incoming_header_buffer;
@@ -233,6 +250,14 @@ private:
     std::string                     m_player_name;
     bool                            m_new_connection;
     Networking::ClientType          m_client_type;
+    bool                            m_accepts_compression;
+
+    /** Messages waiting to be written, in the order they were sent, each with
+        whether it is ready to write.  Messages are waiting while they, or
+        messages sent before them, are being compressed. */
+    std::deque<std::pair<Message, bool> >   m_outgoing_messages;
+    unsigned int                            m_first_outgoing_serial;    ///< serial number of the front of m_outgoing_messages
+    RunQueue<CompressMessageWorkItem>*      m_compression_queue;
 
     MessageAndConnectionFn m_nonplayer_message_callback;
     MessageAndConnectionFn m_player_message_callback;
@@ -32,6 +32,8 @@ namespace {
     boost::function<std::vector<std::string>(const TechManager*, const std::string&)>
                                                                   TechNamesCategoryMemberFunc =         TechNamesCategory;
 
+    bool                (Empire::*EmpireTechResearched)(const std::string&) const =                     &Empire::TechResearched;
+
     std::vector<std::string>    TechRecursivePrereqs(const Tech& tech, int empire_id)
     { return GetTechManager().RecursivePrereqs(tech.Name(), empire_id); }
     boost::function<std::vector<std::string>(const Tech& tech, int)> TechRecursivePrereqsFunc =         TechRecursivePrereqs;
@@ -265,7 +267,7 @@ namespace FreeOrionPython {
                                                         boost::mpl::vector<std::set<std::set<int> >, const Empire& >()
                                                     ))
 
-            .def("techResearched",                  &Empire::TechResearched)
+            .def("techResearched",                  EmpireTechResearched)
             .add_property("availableTechs",         make_function(&Empire::AvailableTechs,          return_internal_reference<>()))
             .def("getTechStatus",                   &Empire::GetTechStatus)
             .def("researchProgress",                &Empire::ResearchProgress)
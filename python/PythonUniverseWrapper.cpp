@@ -16,7 +16,9 @@
 
 #include <boost/mpl/vector.hpp>
 #include <boost/python.hpp>
+#include <boost/python/stl_iterator.hpp>
 #include <boost/python/suite/indexing/map_indexing_suite.hpp>
+#include <boost/python/suite/indexing/vector_indexing_suite.hpp>
 
 namespace {
     void                    DumpObjects(const Universe& universe)
@@ -55,6 +57,107 @@ namespace {
     std::vector<int>        BuildingIDs(const Universe& universe)
     { return Objects().FindObjectIDs<Building>(); }
 
+    /** Column-oriented table of commonly used data about all the objects of a
+      * type, so that the AI can analyze many objects in one call instead of
+      * fetching each object and each of its meters separately.  Row i of
+      * every column describes the object with id ids[i].  Meter columns are
+      * filled only for the meter types requested, with 0.0 for objects that
+      * lack that meter. */
+    struct ObjectColumns {
+        std::vector<int>                            ids;
+        std::vector<int>                            owners;
+        std::vector<int>                            system_ids;
+        std::vector<double>                         x;
+        std::vector<double>                         y;
+        std::map<MeterType, std::vector<double> >   meter_values;
+
+        int                         Size() const
+        { return ids.size(); }
+
+        const std::vector<double>&  MeterValues(MeterType meter_type) const {
+            static const std::vector<double> EMPTY_COLUMN;
+            std::map<MeterType, std::vector<double> >::const_iterator it = meter_values.find(meter_type);
+            return it == meter_values.end() ? EMPTY_COLUMN : it->second;
+        }
+    };
+
+    template <class T>
+    ObjectColumns*          ObjectColumnsOfType(const Universe& universe, boost::python::list meter_types_list) {
+        std::vector<MeterType> meter_types;
+        int const num_meter_types = boost::python::len(meter_types_list);
+        for (int i = 0; i < num_meter_types; i++)
+            meter_types.push_back(boost::python::extract<MeterType>(meter_types_list[i]));
+
+        const ObjectMap& objects = Objects();
+        int num_objects = objects.NumObjects<T>();
+        ObjectColumns* retval = new ObjectColumns();
+        retval->ids.reserve(num_objects);
+        retval->owners.reserve(num_objects);
+        retval->system_ids.reserve(num_objects);
+        retval->x.reserve(num_objects);
+        retval->y.reserve(num_objects);
+        for (std::vector<MeterType>::const_iterator it = meter_types.begin(); it != meter_types.end(); ++it)
+            retval->meter_values[*it].reserve(num_objects);
+
+        for (ObjectMap::const_iterator<T> it = objects.const_begin<T>(); it != objects.const_end<T>(); ++it) {
+            TemporaryPtr<const UniverseObject> obj = *it;
+            if (!obj)
+                continue;
+            retval->ids.push_back(obj->ID());
+            retval->owners.push_back(obj->Owner());
+            retval->system_ids.push_back(obj->SystemID());
+            retval->x.push_back(obj->X());
+            retval->y.push_back(obj->Y());
+            for (std::vector<MeterType>::const_iterator meter_it = meter_types.begin(); meter_it != meter_types.end(); ++meter_it) {
+                const Meter* meter = obj->GetMeter(*meter_it);
+                retval->meter_values[*meter_it].push_back(meter ? meter->Current() : 0.0);
+            }
+        }
+        return retval;
+    }
+    ObjectColumns*          (*AllObjectColumns)(const Universe&, boost::python::list) =         &ObjectColumnsOfType<UniverseObject>;
+    ObjectColumns*          (*FleetColumns)(const Universe&, boost::python::list) =             &ObjectColumnsOfType<Fleet>;
+    ObjectColumns*          (*ShipColumns)(const Universe&, boost::python::list) =              &ObjectColumnsOfType<Ship>;
+    ObjectColumns*          (*PlanetColumns)(const Universe&, boost::python::list) =            &ObjectColumnsOfType<Planet>;
+    ObjectColumns*          (*SystemColumns)(const Universe&, boost::python::list) =            &ObjectColumnsOfType<System>;
+    ObjectColumns*          (*FieldColumns)(const Universe&, boost::python::list) =             &ObjectColumnsOfType<Field>;
+    ObjectColumns*          (*BuildingColumns)(const Universe&, boost::python::list) =          &ObjectColumnsOfType<Building>;
+
+    /** Returns a Python string (bytes in Python 3) holding the raw contents
+      * of \a column, copied with a single memcpy.  The string is owned by
+      * Python, so it remains valid after the ObjectColumns that owns
+      * \a column is released. */
+    template <class T>
+    boost::python::object   ColumnBuffer(const std::vector<T>& column) {
+        const char* data = column.empty() ? 0 : reinterpret_cast<const char*>(&column[0]);
+        Py_ssize_t size = column.size() * sizeof(T);
+#if PY_MAJOR_VERSION >= 3
+        PyObject* buffer = PyBytes_FromStringAndSize(data, size);
+#else
+        PyObject* buffer = PyString_FromStringAndSize(data, size);
+#endif
+        return boost::python::object(boost::python::handle<>(buffer));
+    }
+
+    boost::python::object   ObjectColumnsBuffer(const ObjectColumns& columns, const std::string& column_name) {
+        if (column_name == "ids")
+            return ColumnBuffer(columns.ids);
+        else if (column_name == "owners")
+            return ColumnBuffer(columns.owners);
+        else if (column_name == "systemIDs")
+            return ColumnBuffer(columns.system_ids);
+        else if (column_name == "x")
+            return ColumnBuffer(columns.x);
+        else if (column_name == "y")
+            return ColumnBuffer(columns.y);
+        PyErr_SetString(PyExc_KeyError, ("no object column named " + column_name).c_str());
+        boost::python::throw_error_already_set();
+        return boost::python::object();
+    }
+
+    boost::python::object   ObjectColumnsMeterBuffer(const ObjectColumns& columns, MeterType meter_type)
+    { return ColumnBuffer(columns.MeterValues(meter_type)); }
+
     std::vector<std::string>SpeciesFoci(const Species& species) {
         std::vector<std::string> retval;
         const std::vector<FocusType>& foci = species.Foci();
@@ -154,6 +257,67 @@ namespace {
     }
     boost::function<std::map<int,double> (const Universe&, int, int)> SystemNeighborsMapFunc =      &SystemNeighborsMapP;
 
+    std::map<int,double>    ShortestPathDistancesP(const Universe& universe, int start_sys, int empire_id) {
+        try {
+            return universe.ShortestPathDistances(start_sys, empire_id);
+        } catch (...) {
+        }
+        return std::map<int,double>();
+    }
+    boost::function<std::map<int,double> (const Universe&, int, int)> ShortestPathDistancesFunc =   &ShortestPathDistancesP;
+
+    std::map<int,int>       LeastJumpsDistancesP(const Universe& universe, int start_sys, int empire_id, int max_jumps) {
+        try {
+            return universe.LeastJumpsDistances(start_sys, empire_id, max_jumps);
+        } catch (...) {
+        }
+        return std::map<int,int>();
+    }
+    boost::function<std::map<int,int> (const Universe&, int, int, int)> LeastJumpsDistancesFunc =   &LeastJumpsDistancesP;
+
+    // accepts any iterable of system ids, so AI code can pass lists or sets directly
+    std::vector<double>     ShortestPathDistanceMatrixP(const Universe& universe, const boost::python::object& from_sys,
+                                                        const boost::python::object& to_sys, int empire_id)
+    {
+        std::vector<int> from_ids((boost::python::stl_input_iterator<int>(from_sys)), boost::python::stl_input_iterator<int>());
+        std::vector<int> to_ids((boost::python::stl_input_iterator<int>(to_sys)), boost::python::stl_input_iterator<int>());
+        try {
+            return universe.ShortestPathDistanceMatrix(from_ids, to_ids, empire_id);
+        } catch (...) {
+        }
+        return std::vector<double>();
+    }
+    boost::function<std::vector<double> (const Universe&, const boost::python::object&, const boost::python::object&, int)>
+                                                        ShortestPathDistanceMatrixFunc =            &ShortestPathDistanceMatrixP;
+
+    /** Adapts a Python callable taking a system id to a C++ predicate. */
+    struct PythonSystemPredicate {
+        PythonSystemPredicate(const boost::python::object& callable) : m_callable(callable) {}
+        bool operator()(int system_id) const
+        { return boost::python::extract<bool>(m_callable(system_id)); }
+        boost::python::object m_callable;
+    };
+
+    // returns a list of (system id, distance) tuples, nearest first
+    boost::python::list     NearestSystemsP(const Universe& universe, int start_sys, const boost::python::object& predicate,
+                                            int count, int empire_id)
+    {
+        boost::python::list retval;
+        std::vector<std::pair<int, double> > nearest;
+        try {
+            nearest = universe.NearestSystems(start_sys, PythonSystemPredicate(predicate),
+                                              static_cast<unsigned int>(std::max(0, count)), empire_id);
+        } catch (const boost::python::error_already_set&) {
+            throw;  // let exceptions raised by the predicate reach the caller
+        } catch (...) {
+        }
+        for (std::vector<std::pair<int, double> >::const_iterator it = nearest.begin(); it != nearest.end(); ++it)
+            retval.append(boost::python::make_tuple(it->first, it->second));
+        return retval;
+    }
+    boost::function<boost::python::list (const Universe&, int, const boost::python::object&, int, int)>
+                                                        NearestSystemsFunc =                        &NearestSystemsP;
+
     int                     VisibilityP(const Universe& universe, int object_id, int empire_id = ALL_EMPIRES) {
         int retval;
         //std::vector<int> retval;
@@ -203,6 +367,11 @@ namespace {
                                                        const std::vector<std::string>& parts) = &ShipDesign::ValidDesign;
     bool                    (*ValidDesignDesign)(const ShipDesign&) =                           &ShipDesign::ValidDesign;
 
+    const Species*          (*GetSpeciesByName)(const std::string&) =                           &GetSpecies;
+    const BuildingType*     (*GetBuildingTypeByName)(const std::string&) =                      &GetBuildingType;
+    const PartType*         (*GetPartTypeByName)(const std::string&) =                          &GetPartType;
+    const Special*          (*GetSpecialByName)(const std::string&) =                           &GetSpecial;
+
     std::vector<int>        DirectFireStatsP(const ShipDesign& ship_design) {
         const std::vector<std::string>& partslist = ship_design.Parts();
         std::vector<int> results;
@@ -239,6 +408,7 @@ namespace FreeOrionPython {
     using boost::python::reference_existing_object;
     using boost::python::return_by_value;
     using boost::python::return_internal_reference;
+    using boost::python::manage_new_object;
 
     /**
      * CallPolicies:
@@ -252,6 +422,9 @@ namespace FreeOrionPython {
      * return_internal_reference<>                      when returning an object or data that is a member of the object
      *                                                  on which the function is called (and shares its lifetime)
      *
+     * return_value_policy<manage_new_object>           when returning a newly allocated object that Python should own,
+     *                                                  such as a large table that would be expensive to copy
+     *
      * return_value_policy<reference_existing_object>   when returning an object from a non-member function, or a
      *                                                  member function where the returned object's lifetime is not
      *                                                  fixed to the lifetime of the object on which the function is
@@ -273,6 +446,24 @@ namespace FreeOrionPython {
         class_<std::map<Visibility,int> >("VisibilityIntMap")
             .def(boost::python::map_indexing_suite<std::map<Visibility, int>, true>())
         ;
+        class_<std::vector<double> >("DoubleVec")
+            .def(boost::python::vector_indexing_suite<std::vector<double> >())
+        ;
+
+        ////////////////////
+        // Object Columns //
+        ////////////////////
+        class_<ObjectColumns, noncopyable>("objectColumns", no_init)
+            .def("__len__",                     &ObjectColumns::Size)
+            .def_readonly("ids",                &ObjectColumns::ids)
+            .def_readonly("owners",             &ObjectColumns::owners)
+            .def_readonly("systemIDs",          &ObjectColumns::system_ids)
+            .def_readonly("x",                  &ObjectColumns::x)
+            .def_readonly("y",                  &ObjectColumns::y)
+            .def("meterValues",                 &ObjectColumns::MeterValues,                return_internal_reference<>())
+            .def("buffer",                      &ObjectColumnsBuffer)
+            .def("meterBuffer",                 &ObjectColumnsMeterBuffer)
+        ;
 
         ////////////////////
         //    Universe    //
@@ -293,6 +484,13 @@ namespace FreeOrionPython {
             .add_property("planetIDs",          make_function(PlanetIDs,            return_value_policy<return_by_value>()))
             .add_property("shipIDs",            make_function(ShipIDs,              return_value_policy<return_by_value>()))
             .add_property("buildingIDs",        make_function(BuildingIDs,          return_value_policy<return_by_value>()))
+            .def("getObjectColumns",            make_function(AllObjectColumns,     return_value_policy<manage_new_object>()))
+            .def("getFleetColumns",             make_function(FleetColumns,         return_value_policy<manage_new_object>()))
+            .def("getShipColumns",              make_function(ShipColumns,          return_value_policy<manage_new_object>()))
+            .def("getPlanetColumns",            make_function(PlanetColumns,        return_value_policy<manage_new_object>()))
+            .def("getSystemColumns",            make_function(SystemColumns,        return_value_policy<manage_new_object>()))
+            .def("getFieldColumns",             make_function(FieldColumns,         return_value_policy<manage_new_object>()))
+            .def("getBuildingColumns",          make_function(BuildingColumns,      return_value_policy<manage_new_object>()))
             .def("destroyedObjectIDs",          make_function(&Universe::EmpireKnownDestroyedObjectIDs,
                                                                                     return_value_policy<return_by_value>()))
 
@@ -341,6 +539,32 @@ namespace FreeOrionPython {
                                                     return_value_policy<return_by_value>(),
                                                     boost::mpl::vector<std::map<int, double>, const Universe&, int, int>()
                                                 ))
+
+            .def("shortestPathDistances",       make_function(
+                                                    ShortestPathDistancesFunc,
+                                                    return_value_policy<return_by_value>(),
+                                                    boost::mpl::vector<std::map<int, double>, const Universe&, int, int>()
+                                                ))
+
+            .def("leastJumpsDistances",         make_function(
+                                                    LeastJumpsDistancesFunc,
+                                                    return_value_policy<return_by_value>(),
+                                                    boost::mpl::vector<std::map<int, int>, const Universe&, int, int, int>()
+                                                ))
+
+            .def("shortestPathDistanceMatrix",  make_function(
+                                                    ShortestPathDistanceMatrixFunc,
+                                                    return_value_policy<return_by_value>(),
+                                                    boost::mpl::vector<std::vector<double>, const Universe&,
+                                                                       const boost::python::object&, const boost::python::object&, int>()
+                                                ))
+
+            .def("nearestSystems",              make_function(
+                                                    NearestSystemsFunc,
+                                                    return_value_policy<return_by_value>(),
+                                                    boost::mpl::vector<boost::python::list, const Universe&, int,
+                                                                       const boost::python::object&, int, int>()
+                                                ))
             .def("getVisibilityMap",            make_function(
                                                     &Universe::GetObjectVisibilityByEmpire,
                                                     return_value_policy<return_by_value>()
@@ -488,7 +712,7 @@ namespace FreeOrionPython {
             .def("productionTime",              &PartType::ProductionTime)
             .def("canMountInSlotType",          &PartType::CanMountInSlotType)
         ;
-        def("getPartType",                      &GetPartType,                               return_value_policy<reference_existing_object>());
+        def("getPartType",                      GetPartTypeByName,                          return_value_policy<reference_existing_object>());
 
         class_<HullType, noncopyable>("hullType", no_init)
             .add_property("name",               make_function(&HullType::Name,              return_value_policy<copy_const_reference>()))
@@ -522,7 +746,7 @@ namespace FreeOrionPython {
             .def("captureResult",               &BuildingType::GetCaptureResult)
             .def("canBeProduced",               &BuildingType::ProductionLocation)  //(int empire_id, int location_id)
         ;
-        def("getBuildingType",                  &GetBuildingType,                           return_value_policy<reference_existing_object>());
+        def("getBuildingType",                  GetBuildingTypeByName,                      return_value_policy<reference_existing_object>());
         ////////////////////
         // ResourceCenter //
         ////////////////////
@@ -606,7 +830,7 @@ namespace FreeOrionPython {
             .add_property("name",               make_function(&Special::Name,           return_value_policy<copy_const_reference>()))
             .add_property("description",        make_function(&Special::Description,    return_value_policy<copy_const_reference>()))
         ;
-        def("getSpecial",                       &GetSpecial,                            return_value_policy<reference_existing_object>());
+        def("getSpecial",                       GetSpecialByName,                       return_value_policy<reference_existing_object>());
 
         /////////////////
         //   Species   //
@@ -623,7 +847,7 @@ namespace FreeOrionPython {
             // TODO: const std::vector<FocusType>& Species::Foci()
             .def("getPlanetEnvironment",        &Species::GetPlanetEnvironment)
         ;
-        def("getSpecies",                       &GetSpecies,                            return_value_policy<reference_existing_object>());
+        def("getSpecies",                       GetSpeciesByName,                       return_value_policy<reference_existing_object>());
     }
 
     void WrapGalaxySetupData() {
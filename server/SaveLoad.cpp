@@ -20,12 +20,16 @@
 
 #include <GG/utf8/checked.h>
 
+#if FREEORION_BINARY_SERIALIZATION
+#  include <boost/archive/binary_iarchive.hpp>
+#endif
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/fstream.hpp>
 #include <boost/serialization/deque.hpp>
 #include <boost/serialization/list.hpp>
 #include <boost/serialization/map.hpp>
 #include <boost/serialization/set.hpp>
+#include <boost/serialization/string.hpp>
 #include <boost/serialization/vector.hpp>
 
 #include <fstream>
@@ -42,6 +46,140 @@ namespace {
         return retval;
     }
     const std::string UNABLE_TO_OPEN_FILE("Unable to open file");
+    const std::string TURN_RECORD_FILE_EXTENSION(".turns");
+
+    fs::path FilePath(const std::string& filename) {
+#ifdef FREEORION_WIN32
+        // convert UTF-8 file name to UTF-16
+        fs::path::string_type file_name_native;
+        utf8::utf8to16(filename.begin(), filename.end(), std::back_inserter(file_name_native));
+        return fs::path(file_name_native);
+#else
+        return fs::path(filename);
+#endif
+    }
+
+    /** Reads the contents of a save file, up to and including the universe. */
+    struct GameReader {
+        GameReader(ServerSaveGameData& server_save_game_data_, std::vector<PlayerSaveGameData>& player_save_game_data_,
+                   Universe& universe_, EmpireManager& empire_manager_, SpeciesManager& species_manager_,
+                   CombatLogManager& combat_log_manager_, GalaxySetupData& galaxy_setup_data_) :
+            server_save_game_data(server_save_game_data_),
+            player_save_game_data(player_save_game_data_),
+            universe(universe_),
+            empire_manager(empire_manager_),
+            species_manager(species_manager_),
+            combat_log_manager(combat_log_manager_),
+            galaxy_setup_data(galaxy_setup_data_)
+        {}
+
+        template <class Archive>
+        void operator()(Archive& ia) const {
+            std::map<int, SaveGameEmpireData> ignored_save_game_empire_data;
+
+            Logger().debugStream() << "LoadGame : Reading Galaxy Setup Data";
+            ia >> BOOST_SERIALIZATION_NVP(galaxy_setup_data);
+
+            Logger().debugStream() << "LoadGame : Reading Server Save Game Data";
+            ia >> BOOST_SERIALIZATION_NVP(server_save_game_data);
+            Logger().debugStream() << "LoadGame : Reading Player Save Game Data";
+            ia >> BOOST_SERIALIZATION_NVP(player_save_game_data);
+
+            Logger().debugStream() << "LoadGame : Reading Empire Save Game Data (Ignored)";
+            ia >> BOOST_SERIALIZATION_NVP(ignored_save_game_empire_data);
+            Logger().debugStream() << "LoadGame : Reading Empires Data";
+            ia >> BOOST_SERIALIZATION_NVP(empire_manager);
+            Logger().debugStream() << "LoadGame : Reading Species Data";
+            ia >> BOOST_SERIALIZATION_NVP(species_manager);
+            Logger().debugStream() << "LoadGame : Reading Combat Logs";
+            ia >> BOOST_SERIALIZATION_NVP(combat_log_manager);
+            Logger().debugStream() << "LoadGame : Reading Universe Data";
+            Deserialize(ia, universe);
+        }
+
+        ServerSaveGameData&                 server_save_game_data;
+        std::vector<PlayerSaveGameData>&    player_save_game_data;
+        Universe&                           universe;
+        EmpireManager&                      empire_manager;
+        SpeciesManager&                     species_manager;
+        CombatLogManager&                   combat_log_manager;
+        GalaxySetupData&                    galaxy_setup_data;
+    };
+
+    /** Reads the galaxy setup data at the start of a save file. */
+    struct GalaxySetupDataReader {
+        GalaxySetupDataReader(GalaxySetupData& galaxy_setup_data_) :
+            galaxy_setup_data(galaxy_setup_data_)
+        {}
+
+        template <class Archive>
+        void operator()(Archive& ia) const {
+            ia >> BOOST_SERIALIZATION_NVP(galaxy_setup_data);
+            // skipping additional deserialization which is not needed for this function
+        }
+
+        GalaxySetupData&    galaxy_setup_data;
+    };
+
+    /** Reads a save file up to and including the player save game data. */
+    struct PlayerSaveGameDataReader {
+        PlayerSaveGameDataReader(std::vector<PlayerSaveGameData>& player_save_game_data_) :
+            player_save_game_data(player_save_game_data_)
+        {}
+
+        template <class Archive>
+        void operator()(Archive& ia) const {
+            ServerSaveGameData  ignored_server_save_game_data;
+            GalaxySetupData     ignored_galaxy_setup_data;
+
+            ia >> BOOST_SERIALIZATION_NVP(ignored_galaxy_setup_data);
+            ia >> BOOST_SERIALIZATION_NVP(ignored_server_save_game_data);
+            ia >> BOOST_SERIALIZATION_NVP(player_save_game_data);
+            // skipping additional deserialization which is not needed for this function
+        }
+
+        std::vector<PlayerSaveGameData>&    player_save_game_data;
+    };
+
+    /** Reads a save file up to and including the empire save game data. */
+    struct EmpireSaveGameDataReader {
+        EmpireSaveGameDataReader(std::map<int, SaveGameEmpireData>& empire_save_game_data_) :
+            empire_save_game_data(empire_save_game_data_)
+        {}
+
+        template <class Archive>
+        void operator()(Archive& ia) const {
+            ServerSaveGameData              ignored_server_save_game_data;
+            std::vector<PlayerSaveGameData> ignored_player_save_game_data;
+            GalaxySetupData                 ignored_galaxy_setup_data;
+
+            ia >> BOOST_SERIALIZATION_NVP(ignored_galaxy_setup_data);
+            ia >> BOOST_SERIALIZATION_NVP(ignored_server_save_game_data);
+            ia >> BOOST_SERIALIZATION_NVP(ignored_player_save_game_data);
+            ia >> BOOST_SERIALIZATION_NVP(empire_save_game_data);
+            // skipping additional deserialization which is not needed for this function
+        }
+
+        std::map<int, SaveGameEmpireData>&  empire_save_game_data;
+    };
+
+    /** Calls \a read with an input archive over save file stream \a is.
+      * Binary saves written before saves used the compact binary archive are
+      * read with boost's standard binary archive; all others with a
+      * freeorion_iarchive. */
+    template <class Reader>
+    void ReadSaveFile(std::istream& is, const Reader& read) {
+#if FREEORION_BINARY_SERIALIZATION
+        if (CompactBinary::IsStandardBinaryArchive(is)) {
+            Logger().debugStream() << "Reading save file written with boost's standard binary archive";
+            boost::archive::binary_iarchive ia(is);
+            read(ia);
+            return;
+        }
+#endif
+        freeorion_iarchive ia(is);
+        read(ia);
+    }
 }
 
 void SaveGame(const std::string& filename, const ServerSaveGameData& server_save_game_data,
@@ -97,8 +235,6 @@ void LoadGame(const std::string& filename, ServerSaveGameData& server_save_game_
 
     GetUniverse().EncodingEmpire() = ALL_EMPIRES;
 
-    std::map<int, SaveGameEmpireData> ignored_save_game_empire_data;
-
     empire_manager.Clear();
     universe.Clear();
 
@@ -115,26 +251,9 @@ void LoadGame(const std::string& filename, ServerSaveGameData& server_save_game_
 
         if (!ifs)
             throw std::runtime_error(UNABLE_TO_OPEN_FILE);
-        freeorion_iarchive ia(ifs);
 
-        Logger().debugStream() << "LoadGame : Reading Galaxy Setup Data";
-        ia >> BOOST_SERIALIZATION_NVP(galaxy_setup_data);
-
-        Logger().debugStream() << "LoadGame : Reading Server Save Game Data";
-        ia >> BOOST_SERIALIZATION_NVP(server_save_game_data);
-        Logger().debugStream() << "LoadGame : Reading Player Save Game Data";
-        ia >> BOOST_SERIALIZATION_NVP(player_save_game_data);
-
-        Logger().debugStream() << "LoadGame : Reading Empire Save Game Data (Ignored)";
-        ia >> BOOST_SERIALIZATION_NVP(ignored_save_game_empire_data);
-        Logger().debugStream() << "LoadGame : Reading Empires Data";
-        ia >> BOOST_SERIALIZATION_NVP(empire_manager);
-        Logger().debugStream() << "LoadGame : Reading Species Data";
-        ia >> BOOST_SERIALIZATION_NVP(species_manager);
-        Logger().debugStream() << "LoadGame : Reading Combat Logs";
-        ia >> BOOST_SERIALIZATION_NVP(combat_log_manager);
-        Logger().debugStream() << "LoadGame : Reading Universe Data";
-        Deserialize(ia, universe);
+        ReadSaveFile(ifs, GameReader(server_save_game_data, player_save_game_data, universe, empire_manager,
+                                     species_manager, combat_log_manager, galaxy_setup_data));
     } catch (const std::exception& e) {
         Logger().errorStream() << UserString("UNABLE_TO_READ_SAVE_FILE") << " LoadGame exception: " << ": " << e.what();
         throw e;
@@ -157,10 +276,8 @@ void LoadGalaxySetupData(const std::string& filename, GalaxySetupData& galaxy_se
 
         if (!ifs)
             throw std::runtime_error(UNABLE_TO_OPEN_FILE);
-        freeorion_iarchive ia(ifs);
 
-        ia >> BOOST_SERIALIZATION_NVP(galaxy_setup_data);
-        // skipping additional deserialization which is not needed for this function
+        ReadSaveFile(ifs, GalaxySetupDataReader(galaxy_setup_data));
     } catch (const std::exception& e) {
         Logger().errorStream() << UserString("UNABLE_TO_READ_SAVE_FILE") << " LoadPlayerSaveGameData exception: " << ": " << e.what();
         throw e;
@@ -169,9 +286,6 @@ void LoadGalaxySetupData(const std::string& filename, GalaxySetupData& galaxy_se
 
 
 void LoadPlayerSaveGameData(const std::string& filename, std::vector<PlayerSaveGameData>& player_save_game_data) {
-    ServerSaveGameData  ignored_server_save_game_data;
-    GalaxySetupData     ignored_galaxy_setup_data;
-
     try {
 #ifdef FREEORION_WIN32
         // convert UTF-8 file name to UTF-16
@@ -185,12 +299,8 @@ void LoadPlayerSaveGameData(const std::string& filename, std::vector<PlayerSaveG
 
         if (!ifs)
             throw std::runtime_error(UNABLE_TO_OPEN_FILE);
-        freeorion_iarchive ia(ifs);
 
-        ia >> BOOST_SERIALIZATION_NVP(ignored_galaxy_setup_data);
-        ia >> BOOST_SERIALIZATION_NVP(ignored_server_save_game_data);
-        ia >> BOOST_SERIALIZATION_NVP(player_save_game_data);
-        // skipping additional deserialization which is not needed for this function
+        ReadSaveFile(ifs, PlayerSaveGameDataReader(player_save_game_data));
     } catch (const std::exception& e) {
         Logger().errorStream() << UserString("UNABLE_TO_READ_SAVE_FILE") << " LoadPlayerSaveGameData exception: " << ": " << e.what();
         throw e;
@@ -198,10 +308,6 @@ void LoadPlayerSaveGameData(const std::string& filename, std::vector<PlayerSaveG
 }
 
 void LoadEmpireSaveGameData(const std::string& filename, std::map<int, SaveGameEmpireData>& empire_save_game_data) {
-    ServerSaveGameData              ignored_server_save_game_data;
-    std::vector<PlayerSaveGameData> ignored_player_save_game_data;
-    GalaxySetupData                 ignored_galaxy_setup_data;
-
     try {
 #ifdef FREEORION_WIN32
         // convert UTF-8 file name to UTF-16
@@ -215,15 +321,45 @@ void LoadEmpireSaveGameData(const std::string& filename, std::map<int, SaveGameE
 
         if (!ifs)
             throw std::runtime_error(UNABLE_TO_OPEN_FILE);
-        freeorion_iarchive ia(ifs);
-        ia >> BOOST_SERIALIZATION_NVP(ignored_galaxy_setup_data);
-        ia >> BOOST_SERIALIZATION_NVP(ignored_server_save_game_data);
-        ia >> BOOST_SERIALIZATION_NVP(ignored_player_save_game_data);
-        ia >> BOOST_SERIALIZATION_NVP(empire_save_game_data);
-        // skipping additional deserialization which is not needed for this function
+
+        ReadSaveFile(ifs, EmpireSaveGameDataReader(empire_save_game_data));
     } catch (const std::exception& e) {
         Logger().errorStream() << UserString("UNABLE_TO_READ_SAVE_FILE") << " LoadEmpireSaveGameData exception: " << ": " << e.what();
         throw e;
     }
 }
 
+
+std::string TurnRecordFilename(const std::string& save_filename)
+{ return save_filename + TURN_RECORD_FILE_EXTENSION; }
+
+void SaveTurnRecords(const std::string& save_filename, const std::vector<TurnRecord>& turn_records) {
+    try {
+        fs::ofstream ofs(FilePath(TurnRecordFilename(save_filename)), std::ios_base::binary);
+
+        if (!ofs)
+            throw std::runtime_error(UNABLE_TO_OPEN_FILE);
+
+        freeorion_oarchive oa(ofs);
+        oa << BOOST_SERIALIZATION_NVP(turn_records);
+    } catch (const std::exception& e) {
+        Logger().errorStream() << "SaveTurnRecords exception: " << e.what();
+        throw e;
+    }
+}
+
+void LoadTurnRecords(const std::string& save_filename, std::vector<TurnRecord>& turn_records) {
+    turn_records.clear();
+    try {
+        fs::ifstream ifs(FilePath(TurnRecordFilename(save_filename)), std::ios_base::binary);
+
+        if (!ifs)
+            throw std::runtime_error(UNABLE_TO_OPEN_FILE);
+
+        freeorion_iarchive ia(ifs);
+        ia >> BOOST_SERIALIZATION_NVP(turn_records);
+    } catch (const std::exception& e) {
+        Logger().errorStream() << "LoadTurnRecords exception: " << e.what();
+        throw e;
+    }
+}
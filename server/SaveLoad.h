@@ -14,6 +14,7 @@ struct GalaxySetupData;
 struct PlayerSaveGameData;
 struct SaveGameEmpireData;
 struct ServerSaveGameData;
+struct TurnRecord;
 
 /** Saves the provided data to savefile \a filename. */
 void SaveGame(const std::string& filename,
@@ -51,4 +52,18 @@ void LoadPlayerSaveGameData(const std::string& filename,
 void LoadEmpireSaveGameData(const std::string& filename,
                             std::map<int, SaveGameEmpireData>& empire_save_game_data);
 
+/** Returns the name of the file in which the turns processed after the game
+  * was saved to savefile \a save_filename are recorded. */
+std::string TurnRecordFilename(const std::string& save_filename);
+
+/** Saves \a turn_records, the turns processed after the game was saved to
+  * savefile \a save_filename, to the turn record file for that savefile. */
+void SaveTurnRecords(const std::string& save_filename,
+                     const std::vector<TurnRecord>& turn_records);
+
+/** Loads the turns processed after the game was saved to savefile
+  * \a save_filename from the turn record file for that savefile. */
+void LoadTurnRecords(const std::string& save_filename,
+                     std::vector<TurnRecord>& turn_records);
+
 #endif
@@ -22,8 +22,11 @@
 #include "../util/OptionsDB.h"
 #include "../util/Order.h"
 #include "../util/OrderSet.h"
+#include "../util/Profiler.h"
+#include "../util/Random.h"
 #include "../util/SitRepEntry.h"
 #include "../util/ScopedTimer.h"
+#include "../util/Serialize.h"
 
 #include <GG/SignalsAndSlots.h>
 
@@ -36,11 +39,20 @@
 
 
 #include <ctime>
+#include <limits>
+#include <sstream>
 
 namespace fs = boost::filesystem;
 
 void Seed(unsigned int seed);
 
+namespace {
+    void AddOptions(OptionsDB& db) {
+        db.Add<std::string>("turn-record-file", UserStringNop("OPTIONS_DB_TURN_RECORD_FILE_DESC"), "");
+    }
+    bool temp_bool = RegisterOptions(&AddOptions);
+}
+
 ////////////////////////////////////////////////
 // PlayerSaveGameData
 ////////////////////////////////////////////////
@@ -78,6 +90,43 @@ ServerSaveGameData::ServerSaveGameData(int current_turn, const std::map<int, std
 {}
 
 
+////////////////////////////////////////////////
+// TurnRecord
+////////////////////////////////////////////////
+TurnRecord::TurnRecord() :
+    m_turn(INVALID_GAME_TURN),
+    m_turn_seed(0),
+    m_effects_seed(0),
+    m_orders(),
+    m_pre_combat_hash(0),
+    m_combat_hash(0),
+    m_post_combat_hash(0)
+{}
+
+OrderSet* TurnRecord::CreateOrderSet(int empire_id) const {
+    OrderSet* order_set = new OrderSet();
+    std::map<int, std::string>::const_iterator it = m_orders.find(empire_id);
+    if (it == m_orders.end())
+        return order_set;
+
+    std::istringstream is(it->second);
+    freeorion_iarchive ia(is);
+    Deserialize(ia, *order_set);
+    return order_set;
+}
+
+void TurnRecord::SetOrderSet(int empire_id, const OrderSet& order_set) {
+    // orders are serialized when recorded, rather than when the record is
+    // written, as executing the orders changes them
+    std::ostringstream os;
+    {
+        freeorion_oarchive oa(os);
+        Serialize(oa, order_set);
+    }
+    m_orders[empire_id] = os.str();
+}
+
+
 ////////////////////////////////////////////////
 // ServerApp
 ////////////////////////////////////////////////
@@ -90,12 +139,26 @@ ServerApp::ServerApp() :
                  boost::bind(&ServerApp::PlayerDisconnected, this, _1)),
     m_fsm(new ServerFSM(*this)),
     m_current_turn(INVALID_GAME_TURN),
-    m_single_player_game(false)
+    m_single_player_game(false),
+    m_hash_turn_phases(false),
+    m_replaying_turn(false),
+    m_combat_log_store_filename()
 {
     const std::string SERVER_LOG_FILENAME((GetUserDir() / "freeoriond.log").string());
 
     InitLogger(SERVER_LOG_FILENAME, "%d %p Server : %m%n");
-    Logger().setPriority(log4cpp::Priority::DEBUG);
+    Logger().setPriority(PriorityValue(GetOptionsDB().Get<std::string>("log-level")));
+
+    // older combat logs are kept on disk until they are saved or requested,
+    // in a file that other servers, such as for other games, won't also use
+    try {
+        boost::filesystem::path store_path = boost::filesystem::temp_directory_path() /
+            boost::filesystem::unique_path("freeoriond_combat_logs_%%%%-%%%%-%%%%-%%%%.dat");
+        m_combat_log_store_filename = store_path.string();
+        GetCombatLogManager().SetLogStoreFile(store_path);
+    } catch (const boost::filesystem::filesystem_error& e) {
+        Logger().errorStream() << "ServerApp couldn't choose a combat log store file, so older combat logs will be dropped: " << e.what();
+    }
 
     m_fsm->initiate();
 
@@ -104,8 +167,9 @@ ServerApp::ServerApp() :
 }
 
 ServerApp::~ServerApp() {
-    Logger().debugStream() << "ServerApp::~ServerApp";
+    DebugLogger() << "ServerApp::~ServerApp";
     CleanupAIs();
+    RemoveCombatLogStoreFile();
     delete m_fsm;
 }
 
@@ -113,8 +177,9 @@ void ServerApp::operator()()
 { Run(); }
 
 void ServerApp::Exit(int code) {
-    Logger().debugStream() << "Initiating Exit (code " << code << " - " << (code ? "error" : "normal") << " termination)";
+    DebugLogger() << "Initiating Exit (code " << code << " - " << (code ? "error" : "normal") << " termination)";
     CleanupAIs();
+    RemoveCombatLogStoreFile();
     exit(code);
 }
 
@@ -134,7 +199,7 @@ namespace {
 #endif
 
 void ServerApp::CreateAIClients(const std::vector<PlayerSetupData>& player_setup_data, int maxAggr) {
-    Logger().debugStream() << "ServerApp::CreateAIClients: " << player_setup_data.size() << " player (maybe not all AIs) at max aggression: " << maxAggr;
+    DebugLogger() << "ServerApp::CreateAIClients: " << player_setup_data.size() << " player (maybe not all AIs) at max aggression: " << maxAggr;
     // check if AI clients are needed for given setup data
     bool need_AIs = false;
     for (int i = 0; i < static_cast<int>(player_setup_data.size()); ++i) {
@@ -192,11 +257,11 @@ void ServerApp::CreateAIClients(const std::vector<PlayerSetupData>& player_setup
         args.push_back("--log-level");
         args.push_back(GetOptionsDB().Get<std::string>("log-level"));
 
-        Logger().debugStream() << "starting " << AI_CLIENT_EXE << " with GameSetup.ai-aggression set to " << maxAggr;
+        DebugLogger() << "starting " << AI_CLIENT_EXE << " with GameSetup.ai-aggression set to " << maxAggr;
 
         m_ai_client_processes.push_back(Process(AI_CLIENT_EXE, args));
 
-        Logger().debugStream() << "done starting " << AI_CLIENT_EXE;
+        DebugLogger() << "done starting " << AI_CLIENT_EXE;
     }
 
     // set initial AI process priority to low
@@ -243,7 +308,7 @@ int ServerApp::GetNewDesignID()
 { return m_universe.GenerateDesignID(); }
 
 void ServerApp::Run() {
-    Logger().debugStream() << "FreeOrion server waiting for network events";
+    DebugLogger() << "FreeOrion server waiting for network events";
     std::cout << "FreeOrion server waiting for network events" << std::endl;
     while (1) {
         if (m_io_service.run_one())
@@ -257,7 +322,7 @@ void ServerApp::CleanupAIs() {
     if (m_ai_client_processes.empty() && m_networking.empty())
         return;
 
-    Logger().debugStream() << "ServerApp::CleanupAIs() telling AIs game is ending";
+    DebugLogger() << "ServerApp::CleanupAIs() telling AIs game is ending";
 
     bool ai_connection_lingering = false;
     try {
@@ -274,11 +339,11 @@ void ServerApp::CleanupAIs() {
 
     if (ai_connection_lingering) {
         // time for AIs to react?
-        Logger().debugStream() << "ServerApp::CleanupAIs() waiting 1 second for AI processes to clean up...";
+        DebugLogger() << "ServerApp::CleanupAIs() waiting 1 second for AI processes to clean up...";
         boost::this_thread::sleep(boost::posix_time::seconds(1));
     }
 
-    Logger().debugStream() << "ServerApp::CleanupAIs() killing " << m_ai_client_processes.size() << " AI clients.";
+    DebugLogger() << "ServerApp::CleanupAIs() killing " << m_ai_client_processes.size() << " AI clients.";
     try {
         for (std::vector<Process>::iterator it = m_ai_client_processes.begin();
             it != m_ai_client_processes.end(); ++it)
@@ -294,6 +359,19 @@ void ServerApp::CleanupAIs() {
     }
 }
 
+void ServerApp::RemoveCombatLogStoreFile() {
+    if (m_combat_log_store_filename.empty())
+        return;
+
+    GetCombatLogManager().SetLogStoreFile(boost::filesystem::path());
+
+    boost::system::error_code ec;
+    boost::filesystem::remove(m_combat_log_store_filename, ec);
+    if (ec)
+        Logger().errorStream() << "ServerApp::RemoveCombatLogStoreFile() couldn't remove " << m_combat_log_store_filename << ": " << ec.message();
+    m_combat_log_store_filename.clear();
+}
+
 void ServerApp::SetAIsProcessPriorityToLow(bool set_to_low) {
     for (std::vector<Process>::iterator it = m_ai_client_processes.begin(); it != m_ai_client_processes.end(); ++it) {
         if(!(it->SetLowPriority(set_to_low))) {
@@ -332,6 +410,7 @@ void ServerApp::HandleMessage(Message& msg, PlayerConnectionPtr player_connectio
     case Message::DIPLOMACY:                m_fsm->process_event(Diplomacy(msg, player_connection));        break;
     case Message::REQUEST_NEW_OBJECT_ID:    m_fsm->process_event(RequestObjectID(msg, player_connection));  break;
     case Message::REQUEST_NEW_DESIGN_ID:    m_fsm->process_event(RequestDesignID(msg, player_connection));  break;
+    case Message::REQUEST_COMBAT_LOGS:      m_fsm->process_event(RequestCombatLogs(msg, player_connection));break;
     case Message::MODERATOR_ACTION:         m_fsm->process_event(ModeratorAct(msg, player_connection));     break;
 
     // TODO: For prototyping only.
@@ -353,10 +432,10 @@ void ServerApp::HandleShutdownMessage(Message& msg, PlayerConnectionPtr player_c
     int player_id = player_connection->PlayerID();
     bool is_host = m_networking.PlayerIsHost(player_id);
     if (!is_host) {
-        Logger().debugStream() << "ServerApp::HandleShutdownMessage rejecting shut down message from non-host player";
+        DebugLogger() << "ServerApp::HandleShutdownMessage rejecting shut down message from non-host player";
         return;
     }
-    Logger().debugStream() << "ServerApp::HandleShutdownMessage shutting down";
+    DebugLogger() << "ServerApp::HandleShutdownMessage shutting down";
     Exit(1);
 }
 
@@ -381,7 +460,7 @@ void ServerApp::SelectNewHost() {
     int new_host_id = Networking::INVALID_PLAYER_ID;
     int old_host_id = m_networking.HostPlayerID();
 
-    Logger().debugStream() << "ServerApp::SelectNewHost old host id: " << old_host_id;
+    DebugLogger() << "ServerApp::SelectNewHost old host id: " << old_host_id;
 
     // scan through players for a human to host
     for (ServerNetworking::established_iterator players_it = m_networking.established_begin();
@@ -396,7 +475,7 @@ void ServerApp::SelectNewHost() {
 
     if (new_host_id == Networking::INVALID_PLAYER_ID) {
         // couldn't find a host... abort
-        Logger().debugStream() << "ServerApp::SelectNewHost : Host disconnected and couldn't find a replacement.";
+        DebugLogger() << "ServerApp::SelectNewHost : Host disconnected and couldn't find a replacement.";
         m_networking.SendMessage(ErrorMessage(UserStringNop("SERVER_UNABLE_TO_SELECT_HOST"), false));
     }
 
@@ -534,7 +613,7 @@ void ServerApp::NewMPGameInit(const MultiplayerLobbyData& multiplayer_lobby_data
 
 void ServerApp::NewGameInit(const GalaxySetupData& galaxy_setup_data,
                             const std::map<int, PlayerSetupData>& player_id_setup_data) {
-    Logger().debugStream() << "ServerApp::NewGameInit";
+    DebugLogger() << "ServerApp::NewGameInit";
 
     m_galaxy_setup_data = galaxy_setup_data;
 
@@ -546,7 +625,7 @@ void ServerApp::NewGameInit(const GalaxySetupData& galaxy_setup_data,
     }
     // ensure number of players connected and for which data are provided are consistent
     if (m_networking.NumEstablishedPlayers() != player_id_setup_data.size())
-        Logger().debugStream() << "ServerApp::NewGameInit has " << m_networking.NumEstablishedPlayers() << " established players but " << player_id_setup_data.size() << " entries in player setup data.";
+        DebugLogger() << "ServerApp::NewGameInit has " << m_networking.NumEstablishedPlayers() << " established players but " << player_id_setup_data.size() << " entries in player setup data.";
 
     // validate some connection info / determine which players need empires created
     std::map<int, PlayerSetupData> active_players_id_setup_data;
@@ -605,7 +684,7 @@ void ServerApp::NewGameInit(const GalaxySetupData& galaxy_setup_data,
 
 
     // create universe and empires for players
-    Logger().debugStream() << "ServerApp::NewGameInit: Creating Universe";
+    DebugLogger() << "ServerApp::NewGameInit: Creating Universe";
     m_networking.SendMessage(TurnProgressMessage(Message::GENERATING_UNIVERSE));
 
 
@@ -637,7 +716,7 @@ void ServerApp::NewGameInit(const GalaxySetupData& galaxy_setup_data,
 
 
     // compile information about players to send out to other players at start of game.
-    Logger().debugStream() << "ServerApp::NewGameInit: Compiling PlayerInfo for each player";
+    DebugLogger() << "ServerApp::NewGameInit: Compiling PlayerInfo for each player";
     std::map<int, PlayerInfo> player_info_map;
     for (ServerNetworking::const_established_iterator player_connection_it = m_networking.established_begin();
          player_connection_it != m_networking.established_end(); ++player_connection_it)
@@ -653,28 +732,17 @@ void ServerApp::NewGameInit(const GalaxySetupData& galaxy_setup_data,
 
 
     // update visibility information to ensure data sent out is up-to-date
-    Logger().debugStream() << "ServerApp::NewGameInit: Updating first-turn Empire stuff";
+    DebugLogger() << "ServerApp::NewGameInit: Updating first-turn Empire stuff";
     m_universe.UpdateEmpireLatestKnownObjectsAndVisibilityTurns();
 
 
     // Determine initial supply distribution and exchanging and resource pools for empires
-    EmpireManager& empires = Empires();
-    for (EmpireManager::iterator it = empires.begin(); it != empires.end(); ++it) {
-        if (empires.Eliminated(it->first))
-            continue;   // skip eliminated empires.  presumably this shouldn't be an issue when initializing a new game, but apparently I thought this was worth checking for...
-        Empire* empire = it->second;
-
-        empire->UpdateSupplyUnobstructedSystems();  // determines which systems can propegate fleet and resource (same for both)
-        empire->UpdateSystemSupplyRanges();         // sets range systems can propegate fleet and resourse supply (separately)
-        empire->UpdateSupply();                     // determines which systems can access fleet supply and which groups of systems can exchange resources
-        empire->InitResourcePools();                // determines population centers and resource centers of empire, tells resource pools the centers and groups of systems that can share resources (note that being able to share resources doesn't mean a system produces resources)
-        empire->UpdateResourcePools();              // determines how much of each resources is available in each resource sharing group
-    }
+    InitEmpireSupplyAndResourcePools();
 
     m_universe.UpdateStatRecords();
 
     // send new game start messages
-    Logger().debugStream() << "ServerApp::NewGameInit: Sending GameStartMessages to players";
+    DebugLogger() << "ServerApp::NewGameInit: Sending GameStartMessages to players";
     for (ServerNetworking::const_established_iterator player_connection_it = m_networking.established_begin();
          player_connection_it != m_networking.established_end(); ++player_connection_it)
     {
@@ -842,7 +910,7 @@ namespace {
             return;
         }
 
-        Logger().debugStream() << "ServerApp::LoadMPGameInit matched player named " << psd.m_player_name
+        DebugLogger() << "ServerApp::LoadMPGameInit matched player named " << psd.m_player_name
                                << " to setup data player id " << player_id
                                << " with setup data empire id " << psd.m_save_game_empire_id;
 
@@ -907,7 +975,7 @@ void ServerApp::LoadGameInit(const std::vector<PlayerSaveGameData>& player_save_
                              const std::vector<std::pair<int, int> >& player_id_to_save_game_data_index,
                              boost::shared_ptr<ServerSaveGameData> server_save_game_data)
 {
-    Logger().debugStream() << "ServerApp::LoadGameInit";
+    DebugLogger() << "ServerApp::LoadGameInit";
 
     // ensure some reasonable inputs
     if (player_save_game_data.empty()) {
@@ -978,7 +1046,7 @@ void ServerApp::LoadGameInit(const std::vector<PlayerSaveGameData>& player_save_
             break;
         }
         if (player_save_game_data_index == -1) {
-            Logger().debugStream() << "No save game data index for player with id " << player_id;
+            DebugLogger() << "No save game data index for player with id " << player_id;
             continue;
         }
 
@@ -1017,22 +1085,11 @@ void ServerApp::LoadGameInit(const std::vector<PlayerSaveGameData>& player_save_
 
 
     // Determine supply distribution and exchanging and resource pools for empires
-    EmpireManager& empires = Empires();
-    for (EmpireManager::iterator it = empires.begin(); it != empires.end(); ++it) {
-        if (empires.Eliminated(it->first))
-            continue;   // skip eliminated empires.  presumably this shouldn't be an issue when initializing a new game, but apparently I thought this was worth checking for...
-        Empire* empire = it->second;
-
-        empire->UpdateSupplyUnobstructedSystems();  // determines which systems can propegate fleet and resource (same for both)
-        empire->UpdateSystemSupplyRanges();         // sets range systems can propegate fleet and resourse supply (separately)
-        empire->UpdateSupply();                     // determines which systems can access fleet supply and which groups of systems can exchange resources
-        empire->InitResourcePools();                // determines population centers and resource centers of empire, tells resource pools the centers and groups of systems that can share resources (note that being able to share resources doesn't mean a system produces resources)
-        empire->UpdateResourcePools();              // determines how much of each resources is available in each resource sharing group
-    }
+    InitEmpireSupplyAndResourcePools();
 
 
     // compile information about players to send out to other players at start of game.
-    Logger().debugStream() << "ServerApp::CommonGameInit: Compiling PlayerInfo for each player";
+    DebugLogger() << "ServerApp::CommonGameInit: Compiling PlayerInfo for each player";
     std::map<int, PlayerInfo> player_info_map;
     for (ServerNetworking::const_established_iterator player_connection_it = m_networking.established_begin();
          player_connection_it != m_networking.established_end(); ++player_connection_it)
@@ -1064,7 +1121,7 @@ void ServerApp::LoadGameInit(const std::vector<PlayerSaveGameData>& player_save_
 
 
     // assemble player state information, and send game start messages
-    Logger().debugStream() << "ServerApp::CommonGameInit: Sending GameStartMessages to players";
+    DebugLogger() << "ServerApp::CommonGameInit: Sending GameStartMessages to players";
 
     for (ServerNetworking::const_established_iterator player_connection_it = m_networking.established_begin();
          player_connection_it != m_networking.established_end(); ++player_connection_it)
@@ -1154,6 +1211,225 @@ bool ServerApp::IsLocalHumanPlayer(int player_id) {
             player_connection->IsLocalConnection());
 }
 
+void ServerApp::NewHeadlessGameInit(const GalaxySetupData& galaxy_setup_data,
+                                    const std::map<int, PlayerSetupData>& player_setup_data)
+{
+    DebugLogger() << "ServerApp::NewHeadlessGameInit";
+
+    m_galaxy_setup_data = galaxy_setup_data;
+    m_single_player_game = false;
+
+    // clear previous game player state info
+    m_turn_sequence.clear();
+    m_eliminated_players.clear();
+    m_player_empire_ids.clear();
+    m_victors.clear();
+
+    // every UniverseObject created before game starts will have m_created_on_turn BEFORE_FIRST_TURN
+    m_current_turn = BEFORE_FIRST_TURN;
+    GenerateUniverse(m_galaxy_setup_data, player_setup_data);
+    m_current_turn = 1;
+
+    // there are no player connections, so record empires and add them to
+    // turn processing directly from the setup data
+    for (std::map<int, PlayerSetupData>::const_iterator player_setup_it = player_setup_data.begin();
+         player_setup_it != player_setup_data.end(); ++player_setup_it)
+    {
+        int player_id = player_setup_it->first;
+        m_player_empire_ids[player_id] = player_id;
+        if (Empires().Lookup(player_id))
+            AddEmpireTurn(player_id);
+    }
+
+    m_universe.UpdateEmpireLatestKnownObjectsAndVisibilityTurns();
+    InitEmpireSupplyAndResourcePools();
+    m_universe.UpdateStatRecords();
+}
+
+void ServerApp::LoadHeadlessGameInit(const std::string& filename,
+                                     std::map<int, boost::shared_ptr<OrderSet> >& saved_orders)
+{
+    DebugLogger() << "ServerApp::LoadHeadlessGameInit loading " << filename;
+
+    ServerSaveGameData server_save_game_data;
+    std::vector<PlayerSaveGameData> player_save_game_data;
+    LoadGame(filename,                  server_save_game_data,
+             player_save_game_data,     m_universe,             m_empires,
+             GetSpeciesManager(),       GetCombatLogManager(),  m_galaxy_setup_data);
+
+    m_single_player_game = false;
+
+    // clear previous game player state info
+    m_turn_sequence.clear();
+    m_eliminated_players.clear();
+    m_player_empire_ids.clear();
+
+    // restore server state info from save
+    m_current_turn = server_save_game_data.m_current_turn;
+    m_victors =      server_save_game_data.m_victors;
+
+    saved_orders.clear();
+    for (std::vector<PlayerSaveGameData>::const_iterator psgd_it = player_save_game_data.begin();
+         psgd_it != player_save_game_data.end(); ++psgd_it)
+    {
+        int empire_id = psgd_it->m_empire_id;
+        if (!Empires().Lookup(empire_id)) {
+            Logger().errorStream() << "ServerApp::LoadHeadlessGameInit couldn't find empire with id " << empire_id << " to add to turn processing";
+            continue;
+        }
+        m_player_empire_ids[empire_id] = empire_id;
+        AddEmpireTurn(empire_id);
+        if (psgd_it->m_orders)
+            saved_orders[empire_id] = psgd_it->m_orders;
+    }
+
+    // the Universe's system graphs for each empire aren't stored when saving
+    // so need to be reinitialized when loading based on the gamestate
+    m_universe.InitializeSystemGraph();
+
+    InitEmpireSupplyAndResourcePools();
+}
+
+void ServerApp::InitEmpireSupplyAndResourcePools() {
+    EmpireManager& empires = Empires();
+    for (EmpireManager::iterator it = empires.begin(); it != empires.end(); ++it) {
+        if (empires.Eliminated(it->first))
+            continue;   // skip eliminated empires.  presumably this shouldn't be an issue when initializing a new game, but apparently I thought this was worth checking for...
+        Empire* empire = it->second;
+
+        empire->UpdateSupplyUnobstructedSystems();  // determines which systems can propegate fleet and resource (same for both)
+        empire->UpdateSystemSupplyRanges();         // sets range systems can propegate fleet and resourse supply (separately)
+        empire->UpdateSupply();                     // determines which systems can access fleet supply and which groups of systems can exchange resources
+        empire->InitResourcePools();                // determines population centers and resource centers of empire, tells resource pools the centers and groups of systems that can share resources (note that being able to share resources doesn't mean a system produces resources)
+        empire->UpdateResourcePools();              // determines how much of each resources is available in each resource sharing group
+    }
+}
+
+void ServerApp::SetReplayTurn(const TurnRecord& record) {
+    if (record.m_turn != m_current_turn)
+        Logger().errorStream() << "ServerApp::SetReplayTurn replaying record of turn " << record.m_turn
+                               << " on turn " << m_current_turn;
+
+    for (std::map<int, OrderSet*>::iterator it = m_turn_sequence.begin(); it != m_turn_sequence.end(); ++it) {
+        delete it->second;
+        it->second = record.CreateOrderSet(it->first);
+    }
+
+    m_current_turn_record = record;
+    m_replaying_turn = true;
+}
+
+void ServerApp::BeginTurnRecord() {
+    if (m_replaying_turn) {
+        // record of this turn was provided by SetReplayTurn
+        m_replaying_turn = false;
+        m_hash_turn_phases = true;
+        Seed(m_current_turn_record.m_turn_seed);
+        return;
+    }
+
+    // reseeding from the generator's own sequence leaves turns as random as
+    // before, but lets a recorded turn be replayed with the same seed
+    m_current_turn_record = TurnRecord();
+    m_current_turn_record.m_turn = m_current_turn;
+    m_current_turn_record.m_turn_seed = static_cast<unsigned int>(RandInt(0, std::numeric_limits<int>::max()));
+    Seed(m_current_turn_record.m_turn_seed);
+
+    std::string record_filename = GetOptionsDB().Get<std::string>("turn-record-file");
+    if (record_filename.empty()) {
+        m_turn_record_filename.clear();
+        m_turn_records.clear();
+        m_hash_turn_phases = false;
+        return;
+    }
+    fs::path record_path(record_filename);
+    if (!record_path.has_root_directory())
+        record_filename = (GetSaveDir() / record_path).string();
+
+    if (record_filename != m_turn_record_filename) {
+        // save the gamestate at the start of this turn, so that the recorded
+        // turns can be replayed from it
+        std::vector<PlayerSaveGameData> player_save_game_data;
+        for (std::map<int, OrderSet*>::const_iterator it = m_turn_sequence.begin(); it != m_turn_sequence.end(); ++it) {
+            const Empire* empire = m_empires.Lookup(it->first);
+            if (!empire)
+                continue;
+            Networking::ClientType client_type = Networking::CLIENT_TYPE_AI_PLAYER;
+            ServerNetworking::const_established_iterator player_it = m_networking.GetPlayer(EmpirePlayerID(it->first));
+            if (player_it != m_networking.established_end())
+                client_type = (*player_it)->GetClientType();
+            player_save_game_data.push_back(
+                PlayerSaveGameData(empire->PlayerName(), it->first, boost::shared_ptr<OrderSet>(),
+                                   boost::shared_ptr<SaveGameUIData>(), "", client_type));
+        }
+
+        try {
+            SaveGame(record_filename,   ServerSaveGameData(m_current_turn, m_victors),
+                     player_save_game_data, m_universe,     m_empires,
+                     GetSpeciesManager(),   GetCombatLogManager(),  m_galaxy_setup_data);
+        } catch (const std::exception&) {
+            Logger().errorStream() << "ServerApp::BeginTurnRecord couldn't save gamestate to " << record_filename
+                                   << " so can't record turns";
+            m_turn_record_filename.clear();
+            m_turn_records.clear();
+            m_hash_turn_phases = false;
+            return;
+        }
+
+        DebugLogger() << "ServerApp::BeginTurnRecord recording turns from turn " << m_current_turn
+                               << " to " << TurnRecordFilename(record_filename);
+        m_turn_record_filename = record_filename;
+        m_turn_records.clear();
+    }
+
+    for (std::map<int, OrderSet*>::const_iterator it = m_turn_sequence.begin(); it != m_turn_sequence.end(); ++it) {
+        if (it->second)
+            m_current_turn_record.SetOrderSet(it->first, *it->second);
+    }
+    m_hash_turn_phases = true;
+}
+
+void ServerApp::EndTurnRecord() {
+    m_hash_turn_phases = false;
+    if (m_turn_record_filename.empty())
+        return;
+
+    // the whole file is rewritten each turn, so that it is complete even if
+    // the server doesn't shut down cleanly
+    m_turn_records.push_back(m_current_turn_record);
+    try {
+        SaveTurnRecords(m_turn_record_filename, m_turn_records);
+    } catch (const std::exception&) {
+        Logger().errorStream() << "ServerApp::EndTurnRecord couldn't write turn records to "
+                               << TurnRecordFilename(m_turn_record_filename);
+    }
+}
+
+boost::uint64_t ServerApp::GamestateHash() {
+    if (!m_hash_turn_phases)
+        return 0;
+    ScopedTimer timer("ServerApp::GamestateHash", false, true);
+
+    std::ostringstream os;
+    {
+        int encoding_empire = m_universe.EncodingEmpire();
+        m_universe.EncodingEmpire() = ALL_EMPIRES;
+        freeorion_oarchive oa(os);
+        Serialize(oa, m_universe);
+        oa << BOOST_SERIALIZATION_NVP(m_empires);
+        m_universe.EncodingEmpire() = encoding_empire;
+    }
+
+    // 64 bit FNV-1a
+    const std::string bytes = os.str();
+    boost::uint64_t hash = 14695981039346656037ULL;
+    for (std::string::const_iterator it = bytes.begin(); it != bytes.end(); ++it) {
+        hash ^= static_cast<unsigned char>(*it);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
 void ServerApp::AddEmpireTurn(int empire_id)
 { m_turn_sequence[empire_id] = 0; } // std::map<int, OrderSet*>
 
@@ -1174,14 +1450,14 @@ void ServerApp::ClearEmpireTurnOrders() {
 
 bool ServerApp::AllOrdersReceived() {
     // debug output
-    Logger().debugStream() << "ServerApp::AllOrdersReceived for turn: " << m_current_turn;
+    DebugLogger() << "ServerApp::AllOrdersReceived for turn: " << m_current_turn;
     for (std::map<int, OrderSet*>::iterator it = m_turn_sequence.begin();
          it != m_turn_sequence.end(); ++it)
     {
         if (!it->second)
-            Logger().debugStream() << " ... no orders from empire id: " << it->first;
+            DebugLogger() << " ... no orders from empire id: " << it->first;
         else
-            Logger().debugStream() << " ... have orders from empire id: " << it->first;
+            DebugLogger() << " ... have orders from empire id: " << it->first;
     }
 
     // Loop through to find empire ID and check for valid orders pointer
@@ -1648,7 +1924,7 @@ namespace {
                 // knows about a change in system ownership
                 for (std::set<int>::const_iterator empire_it = combat_info.empire_ids.begin();
                      empire_it != combat_info.empire_ids.end(); ++empire_it)
-                { universe.EmpireKnownObjects(*empire_it).CopyObject(system, ALL_EMPIRES); }
+                { universe.CopyObjectToEmpireLatestKnownObjects(system, *empire_it, ALL_EMPIRES); }
             }
         }
     }
@@ -2090,7 +2366,7 @@ namespace {
             if (system)
                 system->Remove(ship->ID());
 
-            Logger().debugStream() << "HandleInvasion has accounted for "<< design->TroopCapacity()
+            DebugLogger() << "HandleInvasion has accounted for "<< design->TroopCapacity()
                                    << " troops to invade " << planet->Name()
                                    << " and is destroying ship " << ship->ID()
                                    << " named " << ship->Name();
@@ -2147,10 +2423,10 @@ namespace {
                         all_involved_empires.insert(empire_with_troops_id);
                 }
             } else {
-                Logger().debugStream() << "Ground combat troops on " << planet->Name() << " :";
+                DebugLogger() << "Ground combat troops on " << planet->Name() << " :";
                 for (std::map<int, double>::const_iterator empire_it = empires_troops.begin();
                      empire_it != empires_troops.end(); ++empire_it)
-                { Logger().debugStream() << " ... empire: " << empire_it->first << " : " << empire_it->second; }
+                { DebugLogger() << " ... empire: " << empire_it->first << " : " << empire_it->second; }
 
                 // create sitreps for all empires involved in battle
                 for (std::map<int, double>::const_iterator empire_it = empires_troops.begin();
@@ -2189,26 +2465,26 @@ namespace {
                             empire->AddSitRepEntry(CreatePlanetCapturedSitRep(planet_id, victor_id));
                     }
 
-                    Logger().debugStream() << "Empire conquers planet";
+                    DebugLogger() << "Empire conquers planet";
                     for (std::map<int, double>::const_iterator empire_it = empires_troops.begin();
                          empire_it != empires_troops.end(); ++empire_it)
-                    { Logger().debugStream() << " empire: " << empire_it->first << ": " << empire_it->second; }
+                    { DebugLogger() << " empire: " << empire_it->first << ": " << empire_it->second; }
 
 
                 } else if (!planet->Unowned() && victor_id == ALL_EMPIRES) {
                     planet->Conquer(ALL_EMPIRES);
-                    Logger().debugStream() << "Independents conquer planet";
+                    DebugLogger() << "Independents conquer planet";
                     for (std::map<int, double>::const_iterator empire_it = empires_troops.begin();
                          empire_it != empires_troops.end(); ++empire_it)
-                    { Logger().debugStream() << " empire: " << empire_it->first << ": " << empire_it->second; }
+                    { DebugLogger() << " empire: " << empire_it->first << ": " << empire_it->second; }
 
                     // TODO: planet lost to rebels sitrep
                 } else {
                     // defender held theh planet
-                    Logger().debugStream() << "Defender holds planet";
+                    DebugLogger() << "Defender holds planet";
                     for (std::map<int, double>::const_iterator empire_it = empires_troops.begin();
                          empire_it != empires_troops.end(); ++empire_it)
-                    { Logger().debugStream() << " empire: " << empire_it->first << ": " << empire_it->second; }
+                    { DebugLogger() << " empire: " << empire_it->first << ": " << empire_it->second; }
                 }
 
                 // regardless of whether battle resulted in conquering, it did
@@ -2228,9 +2504,8 @@ namespace {
 
             // knowledge update to ensure previous owner of planet knows who owns it now?
             if (planet_initial_owner_id != ALL_EMPIRES && planet_initial_owner_id != planet->Owner()) {
-                // get empire's knowledge of object
-                ObjectMap& empire_latest_known_objects = EmpireKnownObjects(planet_initial_owner_id);
-                empire_latest_known_objects.CopyObject(planet, planet_initial_owner_id);
+                GetUniverse().CopyObjectToEmpireLatestKnownObjects(planet, planet_initial_owner_id,
+                                                                   planet_initial_owner_id);
             }
         }
     }
@@ -2364,7 +2639,7 @@ namespace {
             if (!ship->OrderedScrapped())
                 continue;
 
-            Logger().debugStream() << "... ship: " << ship->ID() << " ordered scrapped";
+            DebugLogger() << "... ship: " << ship->ID() << " ordered scrapped";
 
             TemporaryPtr<System> system = GetSystem(ship->SystemID());
             if (system)
@@ -2439,13 +2714,15 @@ namespace {
 }
 
 void ServerApp::PreCombatProcessTurns() {
-    ScopedTimer timer("ServerApp::PreCombatProcessTurns", true);
+    ScopedTimer timer("ServerApp::PreCombatProcessTurns", true, true);
     ObjectMap& objects = m_universe.Objects();
 
+    BeginTurnRecord();
+
     m_universe.UpdateEmpireVisibilityFilteredSystemGraphs();
 
 
-    Logger().debugStream() << "ServerApp::ProcessTurns executing orders";
+    DebugLogger() << "ServerApp::ProcessTurns executing orders";
 
     // inform players of order execution
     m_networking.SendMessage(TurnProgressMessage(Message::PROCESSING_ORDERS));
@@ -2458,7 +2735,7 @@ void ServerApp::PreCombatProcessTurns() {
     for (std::map<int, OrderSet*>::iterator it = m_turn_sequence.begin(); it != m_turn_sequence.end(); ++it) {
         OrderSet* order_set = it->second;
         if (!order_set) {
-            Logger().debugStream() << "No OrderSet for empire " << it->first;
+            DebugLogger() << "No OrderSet for empire " << it->first;
             continue;
         }
         for (OrderSet::const_iterator order_it = order_set->begin(); order_it != order_set->end(); ++order_it)
@@ -2481,20 +2758,20 @@ void ServerApp::PreCombatProcessTurns() {
     // player notifications
     m_networking.SendMessage(TurnProgressMessage(Message::COLONIZE_AND_SCRAP));
 
-    Logger().debugStream() << "ServerApp::ProcessTurns colonization";
+    DebugLogger() << "ServerApp::ProcessTurns colonization";
     HandleColonization();
 
-    Logger().debugStream() << "ServerApp::ProcessTurns invasion";
+    DebugLogger() << "ServerApp::ProcessTurns invasion";
     HandleInvasion();
 
-    Logger().debugStream() << "ServerApp::ProcessTurns gifting";
+    DebugLogger() << "ServerApp::ProcessTurns gifting";
     HandleGifting();
 
-    Logger().debugStream() << "ServerApp::ProcessTurns scrapping";
+    DebugLogger() << "ServerApp::ProcessTurns scrapping";
     HandleScrapping();
 
 
-    Logger().debugStream() << "ServerApp::ProcessTurns movement";
+    DebugLogger() << "ServerApp::ProcessTurns movement";
     // process movement phase
 
     // player notifications
@@ -2556,11 +2833,13 @@ void ServerApp::PreCombatProcessTurns() {
         player->SendMessage(TurnPartialUpdateMessage(player_id, PlayerEmpireID(player_id),
                                                      m_universe));
     }
+
+    m_current_turn_record.m_pre_combat_hash = GamestateHash();
 }
 
 void ServerApp::ProcessCombats() {
-    ScopedTimer timer("ServerApp::ProcessCombats", true);
-    Logger().debugStream() << "ServerApp::ProcessCombats";
+    ScopedTimer timer("ServerApp::ProcessCombats", true, true);
+    DebugLogger() << "ServerApp::ProcessCombats";
     m_networking.SendMessage(TurnProgressMessage(Message::COMBAT));
 
     std::set<int> human_controlled_empire_ids = HumanControlledEmpires(this, m_networking);
@@ -2641,6 +2920,8 @@ void ServerApp::ProcessCombats() {
     CreateCombatSitReps(combats);
 
     //CleanupSystemCombatInfo(combats); - NOTE: No longer needed since ObjectMap.Clear doesn't release any resources that aren't released in the destructor.
+
+    m_current_turn_record.m_combat_hash = GamestateHash();
 }
 
 void ServerApp::UpdateMonsterTravelRestrictions() {
@@ -2683,7 +2964,7 @@ void ServerApp::UpdateMonsterTravelRestrictions() {
 }
 
 void ServerApp::PostCombatProcessTurns() {
-    ScopedTimer timer("ServerApp::PostCombatProcessTurns", true);
+    ScopedTimer timer("ServerApp::PostCombatProcessTurns", true, true);
 
     EmpireManager& empires = Empires();
     ObjectMap& objects = m_universe.Objects();
@@ -2709,16 +2990,17 @@ void ServerApp::PostCombatProcessTurns() {
 
     // notify players that production and growth is being processed
     m_networking.SendMessage(TurnProgressMessage(Message::EMPIRE_PRODUCTION));
-    Logger().debugStream() << "ServerApp::PostCombatProcessTurns effects and meter updates";
+    DebugLogger() << "ServerApp::PostCombatProcessTurns effects and meter updates";
 
 
     if (GetOptionsDB().Get<bool>("verbose-logging")) {
-        Logger().debugStream() << "!!!!!!! BEFORE TURN PROCESSING EFFECTS APPLICATION";
-        Logger().debugStream() << objects.Dump();
+        DebugLogger() << "!!!!!!! BEFORE TURN PROCESSING EFFECTS APPLICATION";
+        DebugLogger() << objects.Dump();
     }
 
     // execute all effects and update meters prior to production, research, etc.
-    Seed(CurrentTurn());
+    m_current_turn_record.m_effects_seed = CurrentTurn();
+    Seed(m_current_turn_record.m_effects_seed);
     m_universe.ApplyAllEffectsAndUpdateMeters();
 
     // regenerate system connectivity graph after executing effects, which may
@@ -2726,12 +3008,12 @@ void ServerApp::PostCombatProcessTurns() {
     m_universe.InitializeSystemGraph();
 
     if (GetOptionsDB().Get<bool>("verbose-logging")) {
-        Logger().debugStream() << "!!!!!!! AFTER TURN PROCESSING EFFECTS APPLICATION";
-        Logger().debugStream() << objects.Dump();
+        DebugLogger() << "!!!!!!! AFTER TURN PROCESSING EFFECTS APPLICATION";
+        DebugLogger() << objects.Dump();
     }
 
 
-    Logger().debugStream() << "ServerApp::PostCombatProcessTurns empire resources updates";
+    DebugLogger() << "ServerApp::PostCombatProcessTurns empire resources updates";
 
 
     // Determine how much of each resource is available, and determine how to
@@ -2740,6 +3022,7 @@ void ServerApp::PostCombatProcessTurns() {
         if (empires.Eliminated(it->first))
             continue;   // skip eliminated empires
         Empire* empire = it->second;
+        Profiler::Scope supply_scope("ServerApp::PostCombatProcessTurns empire supply and resources");
 
         empire->UpdateSupplyUnobstructedSystems();  // determines which systems can propegate fleet and resource (same for both)
         empire->UpdateSystemSupplyRanges();         // sets range systems can propegate fleet and resourse supply (separately)
@@ -2759,11 +3042,11 @@ void ServerApp::PostCombatProcessTurns() {
     }
 
     if (GetOptionsDB().Get<bool>("verbose-logging")) {
-        Logger().debugStream() << "!!!!!!! AFTER UPDATING RESOURCE POOLS AND SUPPLY STUFF";
-        Logger().debugStream() << objects.Dump();
+        DebugLogger() << "!!!!!!! AFTER UPDATING RESOURCE POOLS AND SUPPLY STUFF";
+        DebugLogger() << objects.Dump();
     }
 
-    Logger().debugStream() << "ServerApp::PostCombatProcessTurns queue progress checking";
+    DebugLogger() << "ServerApp::PostCombatProcessTurns queue progress checking";
 
     // Consume distributed resources to planets and on queues, create new
     // objects for completed production and give techs to empires that have
@@ -2772,6 +3055,7 @@ void ServerApp::PostCombatProcessTurns() {
         if (empires.Eliminated(it->first))
             continue;   // skip eliminated empires
         Empire* empire = it->second;
+        Profiler::Scope progress_scope("ServerApp::PostCombatProcessTurns empire queue progress");
         empire->CheckResearchProgress();
         empire->CheckProductionProgress();
         empire->CheckTradeSocialProgress();
@@ -2779,8 +3063,8 @@ void ServerApp::PostCombatProcessTurns() {
 
 
     if (GetOptionsDB().Get<bool>("verbose-logging")) {
-        Logger().debugStream() << "!!!!!!! AFTER CHECKING QUEUE AND RESOURCE PROGRESS";
-        Logger().debugStream() << objects.Dump();
+        DebugLogger() << "!!!!!!! AFTER CHECKING QUEUE AND RESOURCE PROGRESS";
+        DebugLogger() << objects.Dump();
     }
 
     // Execute meter-related effects on objects created this turn, so that new
@@ -2790,8 +3074,8 @@ void ServerApp::PostCombatProcessTurns() {
     m_universe.ApplyMeterEffectsAndUpdateMeters();
 
     if (GetOptionsDB().Get<bool>("verbose-logging")) {
-        Logger().debugStream() << "!!!!!!! AFTER UPDATING METERS OF ALL OBJECTS";
-        Logger().debugStream() << objects.Dump();
+        DebugLogger() << "!!!!!!! AFTER UPDATING METERS OF ALL OBJECTS";
+        DebugLogger() << objects.Dump();
     }
 
     // Population growth or loss, resource current meter growth, etc.
@@ -2802,8 +3086,8 @@ void ServerApp::PostCombatProcessTurns() {
 
 
     if (GetOptionsDB().Get<bool>("verbose-logging")) {
-        Logger().debugStream() << "!!!!!!!!!!!!!!!!!!!!!!AFTER GROWTH AND CLAMPING";
-        Logger().debugStream() << objects.Dump();
+        DebugLogger() << "!!!!!!!!!!!!!!!!!!!!!!AFTER GROWTH AND CLAMPING";
+        DebugLogger() << objects.Dump();
     }
 
     // store initial values of meters for this turn.
@@ -2849,15 +3133,15 @@ void ServerApp::PostCombatProcessTurns() {
     }
 
     if (GetOptionsDB().Get<bool>("verbose-logging")) {
-        Logger().debugStream() << "!!!!!!!!!!!!!!!!!!!!!!AFTER TURN PROCESSING POP GROWTH PRODCUTION RESEARCH";
-        Logger().debugStream() << objects.Dump();
+        DebugLogger() << "!!!!!!!!!!!!!!!!!!!!!!AFTER TURN PROCESSING POP GROWTH PRODCUTION RESEARCH";
+        DebugLogger() << objects.Dump();
     }
 
 
     // update current turn number so that following visibility updates and info
     // sent to players will have updated turn associated with them
     ++m_current_turn;
-    Logger().debugStream() << "ServerApp::PostCombatProcessTurns Turn number incremented to " << m_current_turn;
+    DebugLogger() << "ServerApp::PostCombatProcessTurns Turn number incremented to " << m_current_turn;
 
 
     // new turn visibility update
@@ -2870,6 +3154,9 @@ void ServerApp::PostCombatProcessTurns() {
 
     m_universe.UpdateStatRecords();
 
+    m_current_turn_record.m_post_combat_hash = GamestateHash();
+    EndTurnRecord();
+
 
     // indicate that the clients are waiting for their new gamestate
     m_networking.SendMessage(TurnProgressMessage(Message::DOWNLOADING));
@@ -2888,19 +3175,42 @@ void ServerApp::PostCombatProcessTurns() {
                                         m_networking.PlayerIsHost(player_id));
     }
 
-    Logger().debugStream() << "ServerApp::PostCombatProcessTurns Sending turn updates to players";
-    // send new-turn updates to all players
-    for (ServerNetworking::const_established_iterator player_it = m_networking.established_begin();
-         player_it != m_networking.established_end(); ++player_it)
-    {
-        PlayerConnectionPtr player = *player_it;
-        int player_id = player->PlayerID();
-        player->SendMessage(TurnUpdateMessage(player_id,                PlayerEmpireID(player_id),
-                                              m_current_turn,           m_empires,
-                                              m_universe,               GetSpeciesManager(),
-                                              GetCombatLogManager(),    players));
-    }
-    Logger().debugStream() << "ServerApp::PostCombatProcessTurns done";
+    DebugLogger() << "ServerApp::PostCombatProcessTurns Sending turn updates to players";
+    // the parts of the turn update that are the same for all players are
+    // encoded once and shared by every player's message
+    SharedMessageSection turn_update_shared_section =
+        TurnUpdateSharedSection(m_current_turn, GetSpeciesManager(), players);
+
+    // send new-turn updates to all players.  each update is sent as soon as
+    // it is encoded, and AI players' updates are encoded and sent first, so
+    // that the AIs, whose orders are needed before the next turn can be
+    // processed, start generating them while the other updates are encoded
+    for (int send_to_ai_players = 1; send_to_ai_players >= 0; --send_to_ai_players) {
+        for (ServerNetworking::const_established_iterator player_it = m_networking.established_begin();
+             player_it != m_networking.established_end(); ++player_it)
+        {
+            PlayerConnectionPtr player = *player_it;
+            bool is_ai_player = player->GetClientType() == Networking::CLIENT_TYPE_AI_PLAYER;
+            if (is_ai_player != static_cast<bool>(send_to_ai_players))
+                continue;
+            int player_id = player->PlayerID();
+            player->SendMessage(TurnUpdateMessage(player_id,                PlayerEmpireID(player_id),
+                                                  turn_update_shared_section,
+                                                  m_empires,                m_universe,
+                                                  GetCombatLogManager()));
+        }
+    }
+
+    MessageCompressionStats compression_stats = GetMessageCompressionStats();
+    if (compression_stats.messages_compressed > 0)
+        DebugLogger() << "ServerApp::PostCombatProcessTurns message compression totals: "
+                               << compression_stats.messages_compressed << " messages compressed from "
+                               << compression_stats.uncompressed_bytes << " to "
+                               << compression_stats.compressed_bytes << " bytes in "
+                               << compression_stats.compression_time << " ms; "
+                               << compression_stats.messages_decompressed << " messages decompressed in "
+                               << compression_stats.decompression_time << " ms";
+    DebugLogger() << "ServerApp::PostCombatProcessTurns done";
 }
 
 void ServerApp::CheckForEmpireEliminationOrVictory() {
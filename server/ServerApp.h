@@ -9,6 +9,8 @@
 #include "../util/AppInterface.h"
 #include "../util/MultiplayerCommon.h"
 
+#include <boost/cstdint.hpp>
+
 #include <set>
 #include <vector>
 
@@ -53,6 +55,36 @@ private:
     void serialize(Archive& ar, const unsigned int version);
 };
 
+/** contains the inputs needed to reproduce the server's processing of a
+    single turn: the orders of each empire and the seeds of the random number
+    generator.  Also contains hashes of the gamestate after each turn
+    processing phase, against which a replay of the turn can be checked. */
+struct TurnRecord {
+    TurnRecord();                                       ///< default ctor
+
+    /** Returns a new OrderSet containing the recorded orders of the empire
+      * with id \a empire_id, or an empty OrderSet if none were recorded.  The
+      * caller takes ownership of the returned OrderSet. */
+    OrderSet*   CreateOrderSet(int empire_id) const;
+
+    /** Records a copy of \a order_set as the orders of the empire with id
+      * \a empire_id. */
+    void        SetOrderSet(int empire_id, const OrderSet& order_set);
+
+    int                         m_turn;
+    unsigned int                m_turn_seed;        ///< seed used for order execution, movement and combat
+    unsigned int                m_effects_seed;     ///< seed used for effects application and the rest of post-combat processing
+    std::map<int, std::string>  m_orders;           ///< serialized orders of each empire as received from its player, indexed by empire id
+    boost::uint64_t             m_pre_combat_hash;  ///< gamestate hash after PreCombatProcessTurns
+    boost::uint64_t             m_combat_hash;      ///< gamestate hash after ProcessCombats
+    boost::uint64_t             m_post_combat_hash; ///< gamestate hash after PostCombatProcessTurns
+
+private:
+    friend class boost::serialization::access;
+    template <class Archive>
+    void serialize(Archive& ar, const unsigned int version);
+};
+
 /** the application framework class for the FreeOrion server. */
 class ServerApp : public IApp {
 public:
@@ -73,6 +105,11 @@ public:
     /** Checks if player with ID \a player_id is a human player
         who's client runs on the same machine as the server */
     bool    IsLocalHumanPlayer(int player_id);
+
+    /** Returns the record of the most recently processed turn.  Its orders
+      * and gamestate hashes are only filled in when turns are being recorded
+      * or replayed. */
+    const TurnRecord&   LastTurnRecord() const { return m_current_turn_record; }
     //@}
 
     /** \name Mutators */ //@{
@@ -153,6 +190,28 @@ public:
     void    LoadMPGameInit(const MultiplayerLobbyData& lobby_data,
                            const std::vector<PlayerSaveGameData>& player_save_game_data,
                            boost::shared_ptr<ServerSaveGameData> server_save_game_data);
+
+    /** Generates a new game universe with an empire for each entry of
+      * \a player_setup_data, indexed by player and empire id, without any
+      * connected players or AI clients.  Turns can then be processed
+      * headlessly, for example to benchmark turn processing. */
+    void    NewHeadlessGameInit(const GalaxySetupData& galaxy_setup_data,
+                                const std::map<int, PlayerSetupData>& player_setup_data);
+
+    /** Restores the saved gamestate in \a filename without any connected
+      * players or AI clients, so that its turns can be processed headlessly.
+      * Each saved player's empire is added to turn processing, with the
+      * player id equal to the empire id, and the orders saved for each
+      * empire are returned in \a saved_orders, indexed by empire id.
+      * \throw std::exception if the save file can't be read. */
+    void    LoadHeadlessGameInit(const std::string& filename,
+                                 std::map<int, boost::shared_ptr<OrderSet> >& saved_orders);
+
+    /** Sets up the next turn to be processed as a replay of \a record: the
+      * recorded orders of each empire are set as its turn orders, the
+      * recorded random seeds are used, and the gamestate is hashed after each
+      * turn processing phase so that it can be compared with the record. */
+    void    SetReplayTurn(const TurnRecord& record);
     //@}
 
     static ServerApp*           GetApp();         ///< returns a ClientApp pointer to the singleton instance of the app
@@ -200,8 +259,30 @@ private:
                          const std::vector<std::pair<int, int> >& player_id_to_save_game_data_index,
                          boost::shared_ptr<ServerSaveGameData> server_save_game_data);
 
+    /** Determines supply distribution and exchanging and resource pools for
+      * all non-eliminated empires at the start of a new or loaded game. */
+    void    InitEmpireSupplyAndResourcePools();
+
+    /** Starts the record of the turn being processed and seeds the random
+      * number generator for it.  If the "turn-record-file" option is set,
+      * the turn's orders are recorded and the record is written to that file
+      * after the turn is processed.  When recording to a new file starts, the
+      * gamestate is first saved to the file, so replays can start from it. */
+    void    BeginTurnRecord();
+
+    /** Writes the record of the turn that was processed, if recording. */
+    void    EndTurnRecord();
+
+    /** Returns a hash of the serialized universe and empires, or 0 if the
+      * gamestate isn't being hashed for the turn being processed. */
+    boost::uint64_t GamestateHash();
+
     void    CleanupAIs();   ///< cleans up AI processes: kills the process and empties the container of AI processes
 
+    /** Stops storing combat logs evicted from memory, and deletes the file
+      * in which they were stored. */
+    void    RemoveCombatLogStoreFile();
+
     /** Sets the priority for all AI processes */
     void    SetAIsProcessPriorityToLow(bool set_to_low);
 
@@ -253,6 +334,14 @@ private:
     std::map<int, std::set<std::string> >   m_victors;              ///< for each player id, the victory types that player has achived
     std::set<int>                           m_eliminated_players;   ///< ids of players whose connections have been severed by the server after they were eliminated
 
+    std::string                             m_turn_record_filename; ///< save file from which turns are being recorded, or empty if not recording
+    std::vector<TurnRecord>                 m_turn_records;         ///< turns recorded since m_turn_record_filename was saved
+    TurnRecord                              m_current_turn_record;  ///< record of the turn being or most recently processed
+    bool                                    m_hash_turn_phases;     ///< true if the gamestate is hashed after each phase of the turn being processed
+    bool                                    m_replaying_turn;       ///< true if the next turn processed is a replay of m_current_turn_record
+
+    std::string                             m_combat_log_store_filename;    ///< temporary file, unique to this process, to which combat logs evicted from memory are written
+
     // Give FSM and its states direct access.  We are using the FSM code as a
     // control-flow mechanism; it is all notionally part of this class.
     friend struct ServerFSM;
@@ -287,4 +376,16 @@ void ServerSaveGameData::serialize(Archive& ar, const unsigned int version)
         & BOOST_SERIALIZATION_NVP(m_victors);
 }
 
+template <class Archive>
+void TurnRecord::serialize(Archive& ar, const unsigned int version)
+{
+    ar  & BOOST_SERIALIZATION_NVP(m_turn)
+        & BOOST_SERIALIZATION_NVP(m_turn_seed)
+        & BOOST_SERIALIZATION_NVP(m_effects_seed)
+        & BOOST_SERIALIZATION_NVP(m_orders)
+        & BOOST_SERIALIZATION_NVP(m_pre_combat_hash)
+        & BOOST_SERIALIZATION_NVP(m_combat_hash)
+        & BOOST_SERIALIZATION_NVP(m_post_combat_hash);
+}
+
 #endif // _ServerApp_h_
@@ -4,6 +4,7 @@
 #include "ServerApp.h"
 #include "../Empire/Empire.h"
 #include "../Empire/EmpireManager.h"
+#include "../combat/CombatLogManager.h"
 #include "../universe/System.h"
 #include "../universe/Species.h"
 #include "../network/ServerNetworking.h"
@@ -14,6 +15,7 @@
 #include "../util/Order.h"
 #include "../util/OrderSet.h"
 #include "../util/OptionsDB.h"
+#include "../util/Profiler.h"
 #include "../util/Random.h"
 #include "../util/ModeratorAction.h"
 #include "../util/MultiplayerCommon.h"
@@ -22,8 +24,6 @@
 #include <boost/filesystem/fstream.hpp>
 #include <boost/thread/thread.hpp>
 
-class CombatLogManager;
-CombatLogManager&   GetCombatLogManager();
 
 namespace {
     const bool TRACE_EXECUTION = true;
@@ -1121,6 +1121,37 @@ sc::result PlayingGame::react(const ModeratorAct& msg) {
     return discard_event();
 }
 
+sc::result PlayingGame::react(const RequestCombatLogs& msg) {
+    if (TRACE_EXECUTION) Logger().debugStream() << "(ServerFSM) PlayingGame.RequestCombatLogs";
+    const Message& message = msg.m_message;
+    int player_id = message.SendingPlayer();
+    int empire_id = Server().PlayerEmpireID(player_id);
+
+    std::vector<int> log_ids;
+    ExtractMessageData(message, log_ids);
+
+    // players with empires only get logs of combats their empire was in.  the
+    // ids of other requested logs are sent back as unavailable, so that the
+    // client doesn't keep waiting for them
+    const CombatLogManager& log_manager = GetCombatLogManager();
+    std::map<int, CombatLog> logs;
+    std::vector<int> unavailable_log_ids;
+    for (std::vector<int>::const_iterator it = log_ids.begin(); it != log_ids.end(); ++it) {
+        if (!log_manager.LogAvailable(*it)) {
+            unavailable_log_ids.push_back(*it);
+            continue;
+        }
+        const CombatLog& log = log_manager.GetLog(*it);
+        if (empire_id == ALL_EMPIRES || log.empire_ids.find(empire_id) != log.empire_ids.end())
+            logs[*it] = log;
+        else
+            unavailable_log_ids.push_back(*it);
+    }
+
+    msg.m_player_connection->SendMessage(DispatchCombatLogsMessage(player_id, logs, unavailable_log_ids));
+    return discard_event();
+}
+
 
 ////////////////////////////////////////////////////////////
 // WaitingForTurnEnd
@@ -1426,9 +1457,11 @@ sc::result ProcessingTurn::react(const ProcessTurn& u) {
     // make sure all AI client processes are running with low priority
     server.SetAIsProcessPriorityToLow(true);
 
+    Profiler::BeginTurn(server.CurrentTurn());
     server.PreCombatProcessTurns();
     server.ProcessCombats();
     server.PostCombatProcessTurns();
+    Profiler::EndTurn();
 
     // update players that other players are now playing their turn
     for (ServerNetworking::const_established_iterator player_it = server.m_networking.established_begin();
@@ -74,6 +74,7 @@ struct MessageEventBase {
     (ClientSaveData)                        \
     (RequestObjectID)                       \
     (RequestDesignID)                       \
+    (RequestCombatLogs)                     \
     (PlayerChat)                            \
     (Diplomacy)                             \
     (ModeratorAct)
@@ -246,7 +247,8 @@ struct PlayingGame : sc::state<PlayingGame, ServerFSM, WaitingForTurnEnd> {
         sc::in_state_reaction<Disconnection, ServerFSM, &ServerFSM::HandleNonLobbyDisconnection>,
         sc::custom_reaction<PlayerChat>,
         sc::custom_reaction<Diplomacy>,
-        sc::custom_reaction<ModeratorAct>
+        sc::custom_reaction<ModeratorAct>,
+        sc::custom_reaction<RequestCombatLogs>
     > reactions;
 
     PlayingGame(my_context c);
@@ -255,6 +257,7 @@ struct PlayingGame : sc::state<PlayingGame, ServerFSM, WaitingForTurnEnd> {
     sc::result react(const PlayerChat& msg);
     sc::result react(const Diplomacy& msg);
     sc::result react(const ModeratorAct& msg);
+    sc::result react(const RequestCombatLogs& msg);
 
     SERVER_ACCESSOR
 };
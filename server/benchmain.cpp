@@ -0,0 +1,463 @@
+#include "ServerApp.h"
+#include "SaveLoad.h"
+
+#include "../Empire/Empire.h"
+#include "../Empire/EmpireManager.h"
+#include "../parse/Parse.h"
+#include "../universe/Species.h"
+#include "../universe/Tech.h"
+#include "../util/Directories.h"
+#include "../util/i18n.h"
+#include "../util/Logger.h"
+#include "../util/MultiplayerCommon.h"
+#include "../util/OptionsDB.h"
+#include "../util/Order.h"
+#include "../util/OrderSet.h"
+#include "../util/Profiler.h"
+#include "../util/Serialize.h"
+#include "../util/XMLDoc.h"
+
+#include <GG/utf8/checked.h>
+
+#if FREEORION_BINARY_SERIALIZATION
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#endif
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/lexical_cast.hpp>
+
+#ifndef FREEORION_WIN32
+#include <sys/resource.h>
+#endif
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+/** \file benchmain.cpp
+    Headless server turn-processing benchmark.  Generates or loads a game
+    without any networking or AI clients, then processes a number of turns,
+    reporting the wall-clock time of each turn processing phase and the
+    process's peak memory use.  Orders can be issued by a simple script that
+    keeps each empire's research and production queues stocked, or the turns
+    recorded by a server with the "turn-record-file" option can be replayed
+    from the save that started the recording, checking that the replay
+    produces the same gamestate as the recorded game.  Afterwards, the
+    throughput of encoding and decoding the universe can be measured. */
+
+namespace {
+    void AddOptions(OptionsDB& db) {
+        db.Add("benchmark-turns",           UserStringNop("OPTIONS_DB_BENCHMARK_TURNS_DESC"),           10,     RangedValidator<int>(1, 10000));
+        db.Add("benchmark-systems",         UserStringNop("OPTIONS_DB_BENCHMARK_SYSTEMS_DESC"),         150,    RangedValidator<int>(10, 5000));
+        db.Add("benchmark-empires",         UserStringNop("OPTIONS_DB_BENCHMARK_EMPIRES_DESC"),         4,      RangedValidator<int>(1, 32));
+        db.Add("benchmark-scripted-orders", UserStringNop("OPTIONS_DB_BENCHMARK_SCRIPTED_ORDERS_DESC"), true,   Validator<bool>());
+        db.Add<std::string>("benchmark-seed",   UserStringNop("OPTIONS_DB_BENCHMARK_SEED_DESC"),        "benchmark");
+        db.Add<std::string>("benchmark-load",   UserStringNop("OPTIONS_DB_BENCHMARK_LOAD_DESC"),        "");
+        db.Add("benchmark-replay",          UserStringNop("OPTIONS_DB_BENCHMARK_REPLAY_DESC"),          false,  Validator<bool>());
+        db.Add("benchmark-serialization-repeats",   UserStringNop("OPTIONS_DB_BENCHMARK_SERIALIZATION_REPEATS_DESC"),   0,  RangedValidator<int>(0, 1000));
+    }
+    bool temp_bool = RegisterOptions(&AddOptions);
+
+    /** Wall-clock times in ms of the phases of one processed turn. */
+    struct TurnTimes {
+        TurnTimes() : turn(0), orders(0.0), pre_combat(0.0), combat(0.0), post_combat(0.0), objects(0), peak_memory_kb(-1) {}
+        double Total() const { return orders + pre_combat + combat + post_combat; }
+
+        int     turn;
+        double  orders;
+        double  pre_combat;
+        double  combat;
+        double  post_combat;
+        int     objects;
+        long    peak_memory_kb;
+    };
+
+    double ElapsedMS(const boost::posix_time::ptime& start)
+    { return (boost::posix_time::microsec_clock::universal_time() - start).total_microseconds() / 1000.0; }
+
+    /** Returns the peak resident memory of this process in kB, or -1 if it
+      * isn't available on this platform. */
+    long PeakMemoryKB() {
+#ifndef FREEORION_WIN32
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+            return -1;
+#ifdef FREEORION_MACOSX
+        return usage.ru_maxrss / 1024;  // bytes on OSX
+#else
+        return usage.ru_maxrss;         // kB on Linux
+#endif
+#else
+        return -1;
+#endif
+    }
+
+    /** Returns player setup data for \a num_empires AI empires, indexed by
+      * player id.  Species and colours are assigned in order, so that runs
+      * with the same options generate the same galaxy. */
+    std::map<int, PlayerSetupData> BenchmarkPlayerSetupData(int num_empires) {
+        std::map<int, PlayerSetupData> retval;
+        const SpeciesManager& sm = GetSpeciesManager();
+        const std::vector<GG::Clr>& colours = EmpireColors();
+        SpeciesManager::playable_iterator species_it = sm.playable_begin();
+
+        for (int i = 0; i < num_empires; ++i) {
+            int player_id = i + 1;
+            PlayerSetupData& psd = retval[player_id];
+            psd.m_player_name = "Benchmark_" + boost::lexical_cast<std::string>(player_id);
+            psd.m_empire_name = "Empire_" + boost::lexical_cast<std::string>(player_id);
+            if (!colours.empty())
+                psd.m_empire_color = colours[i % colours.size()];
+            if (species_it != sm.playable_end()) {
+                psd.m_starting_species_name = species_it->first;
+                if (++species_it == sm.playable_end())
+                    species_it = sm.playable_begin();
+            }
+            psd.m_client_type = Networking::CLIENT_TYPE_AI_PLAYER;
+        }
+        return retval;
+    }
+
+    /** Issues simple orders for \a empire, standing in for its player: keeps
+      * the research queue stocked with researchable techs, and the production
+      * queue with the first ship design that can be produced at the capital.
+      * Issuing the orders executes them, as on a client, so the returned
+      * orders have been applied and mustn't be executed again. */
+    void IssueScriptedOrders(Empire* empire, OrderSet& orders) {
+        const int MAX_QUEUED_TECHS = 5;
+        int empire_id = empire->EmpireID();
+
+        if (empire->GetResearchQueue().empty()) {
+            const TechManager& tech_manager = GetTechManager();
+            int queued_techs = 0;
+            for (TechManager::iterator it = tech_manager.begin();
+                 it != tech_manager.end() && queued_techs < MAX_QUEUED_TECHS; ++it)
+            {
+                const std::string& tech_name = (*it)->Name();
+                if (!empire->ResearchableTech(tech_name))
+                    continue;
+                orders.IssueOrder(OrderPtr(new ResearchQueueOrder(empire_id, tech_name, -1)));
+                ++queued_techs;
+            }
+        }
+
+        int capital_id = empire->CapitalID();
+        if (empire->GetProductionQueue().empty() && capital_id != INVALID_OBJECT_ID) {
+            std::set<int> design_ids = empire->AvailableShipDesigns();
+            for (std::set<int>::const_iterator it = design_ids.begin(); it != design_ids.end(); ++it) {
+                if (!empire->ProducibleItem(BT_SHIP, *it, capital_id))
+                    continue;
+                orders.IssueOrder(OrderPtr(new ProductionQueueOrder(empire_id, BT_SHIP, *it, 1, capital_id)));
+                break;
+            }
+        }
+    }
+
+    void PrintTurnTimes(std::ostream& os, const TurnTimes& times) {
+        os << std::setw(6) << times.turn
+           << std::setw(10) << times.objects
+           << std::setw(11) << times.orders
+           << std::setw(11) << times.pre_combat
+           << std::setw(11) << times.combat
+           << std::setw(11) << times.post_combat
+           << std::setw(11) << times.Total()
+           << std::setw(13) << times.peak_memory_kb << std::endl;
+    }
+
+    void PrintHeader(std::ostream& os) {
+        os << std::fixed << std::setprecision(1)
+           << std::setw(6) << "turn" << std::setw(10) << "objects"
+           << std::setw(11) << "orders ms" << std::setw(11) << "pre ms"
+           << std::setw(11) << "combat ms" << std::setw(11) << "post ms"
+           << std::setw(11) << "total ms" << std::setw(13) << "peak mem kB" << std::endl;
+    }
+
+    void PrintSummary(std::ostream& os, const std::vector<TurnTimes>& all_times) {
+        if (all_times.empty())
+            return;
+
+        TurnTimes mean, max;
+        for (std::vector<TurnTimes>::const_iterator it = all_times.begin(); it != all_times.end(); ++it) {
+            mean.orders += it->orders;              max.orders = std::max(max.orders, it->orders);
+            mean.pre_combat += it->pre_combat;      max.pre_combat = std::max(max.pre_combat, it->pre_combat);
+            mean.combat += it->combat;              max.combat = std::max(max.combat, it->combat);
+            mean.post_combat += it->post_combat;    max.post_combat = std::max(max.post_combat, it->post_combat);
+        }
+        mean.orders /= all_times.size();
+        mean.pre_combat /= all_times.size();
+        mean.combat /= all_times.size();
+        mean.post_combat /= all_times.size();
+        mean.objects = max.objects = all_times.back().objects;
+        mean.peak_memory_kb = max.peak_memory_kb = all_times.back().peak_memory_kb;
+
+        os << "mean:" << std::endl;
+        PrintTurnTimes(os, mean);
+        os << "max:" << std::endl;
+        PrintTurnTimes(os, max);
+    }
+
+    /** Processes one turn on \a server, whose orders have already been set,
+      * and stores the time taken by each phase in \a times. */
+    void ProcessTurn(ServerApp& server, TurnTimes& times) {
+        Profiler::BeginTurn(times.turn);
+
+        boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+        server.PreCombatProcessTurns();
+        times.pre_combat = ElapsedMS(start);
+
+        start = boost::posix_time::microsec_clock::universal_time();
+        server.ProcessCombats();
+        times.combat = ElapsedMS(start);
+
+        start = boost::posix_time::microsec_clock::universal_time();
+        server.PostCombatProcessTurns();
+        times.post_combat = ElapsedMS(start);
+
+        Profiler::EndTurn();
+
+        times.objects = server.GetUniverse().Objects().NumObjects();
+        times.peak_memory_kb = PeakMemoryKB();
+    }
+
+    /** Processes the configured number of turns on \a server and writes the
+      * time taken by each turn's phases to std::cout. */
+    void RunBenchmark(ServerApp& server, std::map<int, boost::shared_ptr<OrderSet> > saved_orders) {
+        const int num_turns = GetOptionsDB().Get<int>("benchmark-turns");
+        const bool scripted_orders = GetOptionsDB().Get<bool>("benchmark-scripted-orders");
+
+        PrintHeader(std::cout);
+
+        std::vector<TurnTimes> all_times;
+        for (int i = 0; i < num_turns; ++i) {
+            TurnTimes times;
+            times.turn = server.CurrentTurn();
+
+            // give each empire its orders for this turn.  saved orders haven't
+            // been executed yet, so are passed to the server as if received
+            // from a client.  scripted orders are executed when issued, so are
+            // kept out of the set the server will execute.
+            boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+            for (EmpireManager::iterator it = server.Empires().begin(); it != server.Empires().end(); ++it) {
+                if (server.Empires().Eliminated(it->first))
+                    continue;
+                OrderSet* order_set = new OrderSet();
+                std::map<int, boost::shared_ptr<OrderSet> >::const_iterator saved_it = saved_orders.find(it->first);
+                if (saved_it != saved_orders.end() && saved_it->second) {
+                    *order_set = *saved_it->second;
+                } else if (scripted_orders) {
+                    OrderSet issued_orders;
+                    IssueScriptedOrders(it->second, issued_orders);
+                }
+                server.SetEmpireTurnOrders(it->first, order_set);
+            }
+            saved_orders.clear();   // saved orders only apply to the turn on which the game was saved
+            times.orders = ElapsedMS(start);
+
+            ProcessTurn(server, times);
+
+            PrintTurnTimes(std::cout, times);
+            all_times.push_back(times);
+        }
+
+        PrintSummary(std::cout, all_times);
+    }
+
+    /** Replays \a turn_records on \a server, writing the time taken by each
+      * turn's phases to std::cout, and checks the gamestate after each phase
+      * against the recorded hashes.  The times include hashing the gamestate.
+      * Returns false if the replay diverged from the recording. */
+    bool RunReplay(ServerApp& server, const std::vector<TurnRecord>& turn_records) {
+        PrintHeader(std::cout);
+
+        std::vector<TurnTimes> all_times;
+        for (std::vector<TurnRecord>::const_iterator it = turn_records.begin(); it != turn_records.end(); ++it) {
+            const TurnRecord& record = *it;
+            if (record.m_turn != server.CurrentTurn()) {
+                std::cout << "Recorded turn " << record.m_turn << " doesn't follow turn " << server.CurrentTurn() << std::endl;
+                return false;
+            }
+
+            TurnTimes times;
+            times.turn = server.CurrentTurn();
+
+            boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+            server.SetReplayTurn(record);
+            times.orders = ElapsedMS(start);
+
+            ProcessTurn(server, times);
+
+            PrintTurnTimes(std::cout, times);
+            all_times.push_back(times);
+
+            const TurnRecord& replayed = server.LastTurnRecord();
+            const char* diverged_phase = 0;
+            if (replayed.m_pre_combat_hash != record.m_pre_combat_hash)
+                diverged_phase = "pre-combat";
+            else if (replayed.m_combat_hash != record.m_combat_hash)
+                diverged_phase = "combat";
+            else if (replayed.m_effects_seed != record.m_effects_seed)
+                diverged_phase = "effects seeding";
+            else if (replayed.m_post_combat_hash != record.m_post_combat_hash)
+                diverged_phase = "post-combat";
+            if (diverged_phase) {
+                std::cout << "Turn " << record.m_turn << " replay diverged from recording after "
+                          << diverged_phase << " processing" << std::endl;
+                return false;
+            }
+        }
+
+        PrintSummary(std::cout, all_times);
+        std::cout << "Replayed " << turn_records.size() << " turns identically to the recording" << std::endl;
+        return true;
+    }
+
+    /** Encodes \a universe \a repeats times to an OArchive, then decodes
+      * the result \a repeats times from an IArchive into a separate
+      * Universe, and writes the encoded size and the mean time and throughput
+      * of encoding and decoding to std::cout. */
+    template <class OArchive, class IArchive>
+    void TimeUniverseSerialization(const std::string& archive_name, const Universe& universe, int repeats) {
+        std::string encoded;
+        boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+        for (int i = 0; i < repeats; ++i) {
+            std::ostringstream os;
+            {
+                OArchive oa(os);
+                Serialize(oa, universe);
+            }
+            encoded = os.str();
+        }
+        double encode_ms = ElapsedMS(start) / repeats;
+
+        Universe decoded_universe;
+        start = boost::posix_time::microsec_clock::universal_time();
+        for (int i = 0; i < repeats; ++i) {
+            std::istringstream is(encoded);
+            IArchive ia(is);
+            Deserialize(ia, decoded_universe);
+        }
+        double decode_ms = ElapsedMS(start) / repeats;
+
+        double megabytes = encoded.size() / (1024.0 * 1024.0);
+        std::cout << std::setw(14) << archive_name
+                  << std::setw(12) << encoded.size()
+                  << std::setw(12) << encode_ms
+                  << std::setw(12) << (encode_ms > 0.0 ? megabytes * 1000.0 / encode_ms : 0.0)
+                  << std::setw(12) << decode_ms
+                  << std::setw(12) << (decode_ms > 0.0 ? megabytes * 1000.0 / decode_ms : 0.0) << std::endl;
+    }
+
+    /** Compares the encoding and decoding throughput of the universe with
+      * the compact binary archive used for saves and network messages, and
+      * with boost's standard binary archive. */
+    void RunSerializationBenchmark(const Universe& universe, int repeats) {
+        std::cout << std::setw(14) << "archive" << std::setw(12) << "bytes"
+                  << std::setw(12) << "encode ms" << std::setw(12) << "encode MB/s"
+                  << std::setw(12) << "decode ms" << std::setw(12) << "decode MB/s" << std::endl;
+        TimeUniverseSerialization<freeorion_oarchive, freeorion_iarchive>("freeorion", universe, repeats);
+#if FREEORION_BINARY_SERIALIZATION
+        TimeUniverseSerialization<boost::archive::binary_oarchive, boost::archive::binary_iarchive>(
+            "boost binary", universe, repeats);
+#endif
+    }
+}
+
+#ifndef FREEORION_WIN32
+int main(int argc, char* argv[]) {
+    InitDirs(argv[0]);
+    std::vector<std::string> args;
+    for (int i = 0; i < argc; ++i)
+        args.push_back(argv[i]);
+
+#else
+int wmain(int argc, wchar_t* argv[], wchar_t* envp[]) {
+    // copy UTF-16 command line arguments to UTF-8 vector
+    std::vector<std::string> args;
+    for (int i = 0; i < argc; ++i) {
+        std::wstring argi16(argv[i]);
+        std::string argi8;
+        utf8::utf16to8(argi16.begin(), argi16.end(), std::back_inserter(argi8));
+        args.push_back(argi8);
+    }
+    InitDirs((args.empty() ? "" : *args.begin()));
+#endif
+
+    try {
+        GetOptionsDB().AddFlag('h', "help", "Print this help message.");
+
+        // read config.xml and set options entries from it, if present
+        XMLDoc doc;
+        {
+            boost::filesystem::ifstream ifs(GetConfigPath());
+            if (ifs) {
+                doc.ReadDoc(ifs);
+                GetOptionsDB().SetFromXML(doc);
+            }
+        }
+
+        GetOptionsDB().SetFromCommandLine(args);
+
+        if (GetOptionsDB().Get<bool>("help")) {
+            GetOptionsDB().GetUsage(std::cerr);
+            return 0;
+        }
+
+        parse::init();
+
+        ServerApp server;
+
+        std::map<int, boost::shared_ptr<OrderSet> > saved_orders;
+        const std::string load_filename = GetOptionsDB().Get<std::string>("benchmark-load");
+        boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+        if (!load_filename.empty()) {
+            server.LoadHeadlessGameInit(load_filename, saved_orders);
+            std::cout << "Loaded " << load_filename;
+        } else {
+            GalaxySetupData galaxy_setup_data;
+            galaxy_setup_data.m_seed = GetOptionsDB().Get<std::string>("benchmark-seed");
+            galaxy_setup_data.m_size = GetOptionsDB().Get<int>("benchmark-systems");
+            server.NewHeadlessGameInit(galaxy_setup_data,
+                                       BenchmarkPlayerSetupData(GetOptionsDB().Get<int>("benchmark-empires")));
+            std::cout << "Generated " << galaxy_setup_data.m_size << " system galaxy with seed \""
+                      << galaxy_setup_data.m_seed << "\"";
+        }
+        std::cout << " in " << ElapsedMS(start) << " ms: "
+                  << server.Empires().NumEmpires() << " empires, "
+                  << server.GetUniverse().Objects().NumObjects() << " objects" << std::endl;
+
+        if (GetOptionsDB().Get<bool>("benchmark-replay")) {
+            if (load_filename.empty())
+                throw std::invalid_argument("benchmark-replay requires a save file to be given with benchmark-load");
+            std::vector<TurnRecord> turn_records;
+            LoadTurnRecords(load_filename, turn_records);
+            if (!RunReplay(server, turn_records))
+                return 1;
+        } else {
+            RunBenchmark(server, saved_orders);
+        }
+
+        const int serialization_repeats = GetOptionsDB().Get<int>("benchmark-serialization-repeats");
+        if (serialization_repeats > 0)
+            RunSerializationBenchmark(server.GetUniverse(), serialization_repeats);
+
+    } catch (const std::invalid_argument& e) {
+        Logger().errorStream() << "main() caught exception(std::invalid_arg): " << e.what();
+        std::cerr << "main() caught exception(std::invalid_arg): " << e.what() << std::endl;
+        return 1;
+    } catch (const std::runtime_error& e) {
+        Logger().errorStream() << "main() caught exception(std::runtime_error): " << e.what();
+        std::cerr << "main() caught exception(std::runtime_error): " << e.what() << std::endl;
+        return 1;
+    } catch (const std::exception& e) {
+        Logger().errorStream() << "main() caught exception(std::exception): " << e.what();
+        std::cerr << "main() caught exception(std::exception): " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        Logger().errorStream() << "main() caught unknown exception.";
+        std::cerr << "main() caught unknown exception." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -27,12 +27,13 @@ Building::Building(int empire_id, const std::string& building_type,
                    int produced_by_empire_id/* = ALL_EMPIRES*/) :
     UniverseObject(),
     m_building_type(building_type),
+    m_building_type_id(InternString(building_type)),
     m_planet_id(INVALID_OBJECT_ID),
     m_ordered_scrapped(false),
     m_produced_by_empire_id(produced_by_empire_id)
 {
     UniverseObject::SetOwner(empire_id);
-    const BuildingType* type = GetBuildingType(m_building_type);
+    const BuildingType* type = GetBuildingType(m_building_type_id);
     if (type)
         Rename(UserString(type->Name()));
     else
@@ -74,6 +75,7 @@ void Building::Copy(TemporaryPtr<const UniverseObject> copied_object, int empire
             this->m_name =                      copied_building->m_name;
 
             this->m_building_type =             copied_building->m_building_type;
+            this->m_building_type_id =          copied_building->m_building_type_id;
             this->m_produced_by_empire_id = copied_building->m_produced_by_empire_id;
 
             if (vis >= VIS_FULL_VISIBILITY) {
@@ -83,15 +85,28 @@ void Building::Copy(TemporaryPtr<const UniverseObject> copied_object, int empire
     }
 }
 
+bool Building::UpdateState(const UniverseObject& updated_object) {
+    const Building& updated_building = dynamic_cast<const Building&>(updated_object);
+    bool changed = UniverseObject::UpdateState(updated_object);
+    if (UpdateMember(m_building_type,                   updated_building.m_building_type)) {
+        m_building_type_id = updated_building.m_building_type_id;
+        changed = true;
+    }
+    changed |= UpdateMember(m_planet_id,                updated_building.m_planet_id);
+    changed |= UpdateMember(m_ordered_scrapped,         updated_building.m_ordered_scrapped);
+    changed |= UpdateMember(m_produced_by_empire_id,    updated_building.m_produced_by_empire_id);
+    return changed;
+}
+
 std::set<std::string> Building::Tags() const {
-    const BuildingType* type = ::GetBuildingType(m_building_type);
+    const BuildingType* type = ::GetBuildingType(m_building_type_id);
     if (!type)
         return std::set<std::string>();
     return type->Tags();
 }
 
 bool Building::HasTag(const std::string& name) const {
-    const BuildingType* type = GetBuildingType(m_building_type);
+    const BuildingType* type = GetBuildingType(m_building_type_id);
 
     return type && type->Tags().count(name);
 }
@@ -305,6 +320,12 @@ BuildingTypeManager::BuildingTypeManager() {
     s_instance = this;
 
     parse::buildings(GetResourceDir() / "buildings.txt", m_building_types);
+    for (std::map<std::string, BuildingType*>::iterator it = m_building_types.begin(); it != m_building_types.end(); ++it) {
+        std::size_t name_id = InternString(it->first);
+        if (m_building_types_by_name_id.size() <= name_id)
+            m_building_types_by_name_id.resize(name_id + 1, 0);
+        m_building_types_by_name_id[name_id] = it->second;
+    }
 
     if (GetOptionsDB().Get<bool>("verbose-logging")) {
         Logger().debugStream() << "Building Types:";
@@ -325,6 +346,12 @@ const BuildingType* BuildingTypeManager::GetBuildingType(const std::string& name
     return it != m_building_types.end() ? it->second : 0;
 }
 
+const BuildingType* BuildingTypeManager::GetBuildingType(int name_id) const {
+    if (name_id < 0 || static_cast<std::size_t>(name_id) >= m_building_types_by_name_id.size())
+        return 0;
+    return m_building_types_by_name_id[name_id];
+}
+
 BuildingTypeManager& BuildingTypeManager::GetBuildingTypeManager() {
     static BuildingTypeManager manager;
     return manager;
@@ -338,3 +365,6 @@ BuildingTypeManager& GetBuildingTypeManager()
 
 const BuildingType* GetBuildingType(const std::string& name)
 { return GetBuildingTypeManager().GetBuildingType(name); }
+
+const BuildingType* GetBuildingType(int name_id)
+{ return GetBuildingTypeManager().GetBuildingType(name_id); }
@@ -6,6 +6,7 @@
 #include "ObjectMap.h"
 #include "ValueRefFwd.h"
 #include "../util/Export.h"
+#include "../util/StringInterner.h"
 
 class BuildingType;
 namespace Effect {
@@ -27,6 +28,7 @@ public:
     virtual std::string         Dump() const;
 
     const std::string&      BuildingTypeName() const    { return m_building_type; };        ///< returns the name of the BuildingType object for this building
+    int                     BuildingTypeID() const      { return m_building_type_id; }      ///< returns the interned id of BuildingTypeName()
 
     virtual int             ContainerObjectID() const   { return m_planet_id; }             ///< returns id of the object that directly contains this object, if any, or INVALID_OBJECT_ID if this object is not contained by any other
     virtual bool            ContainedBy(int object_id) const;                               ///< returns true if there is an object with id \a object_id that contains this UniverseObject
@@ -59,6 +61,7 @@ protected:
     Building() :
         UniverseObject(),
         m_building_type(),
+        m_building_type_id(INVALID_STRING_ID),
         m_planet_id(INVALID_OBJECT_ID),
         m_ordered_scrapped(false),
         m_produced_by_empire_id(ALL_EMPIRES)
@@ -73,8 +76,11 @@ protected:
     virtual Building*       Clone(int empire_id = ALL_EMPIRES) const;   ///< returns new copy of this Building
     //@}
 
+    virtual bool            UpdateState(const UniverseObject& updated_object);
+
 private:
     std::string m_building_type;
+    int         m_building_type_id; ///< interned id of m_building_type; not serialized, as ids differ between processes
     int         m_planet_id;
     bool        m_ordered_scrapped;
     int         m_produced_by_empire_id;
@@ -179,6 +185,11 @@ public:
       * free function GetBuildingType(...) instead, mainly to save some typing. */
     const BuildingType*         GetBuildingType(const std::string& name) const;
 
+    /** returns the building type whose name has the interned id \a name_id,
+      * as returned by InternString(), or 0 if there is no such building
+      * type. */
+    const BuildingType*         GetBuildingType(int name_id) const;
+
     /** iterator to the first building type */
     iterator                    begin() const   { return m_building_types.begin(); }
 
@@ -195,6 +206,7 @@ private:
     ~BuildingTypeManager();
 
     std::map<std::string, BuildingType*> m_building_types;
+    std::vector<BuildingType*>           m_building_types_by_name_id;   ///< building types indexed by the interned ids of their names, or 0 for ids of other strings
 
     static BuildingTypeManager* s_instance;
 };
@@ -206,4 +218,8 @@ FO_COMMON_API BuildingTypeManager& GetBuildingTypeManager();
   * type \a name.  If no such BuildingType exists, 0 is returned instead. */
 FO_COMMON_API const BuildingType* GetBuildingType(const std::string& name);
 
+/** Returns the BuildingType whose name has interned id \a name_id.  If no
+  * such BuildingType exists, 0 is returned instead. */
+FO_COMMON_API const BuildingType* GetBuildingType(int name_id);
+
 #endif // _Building_h_
@@ -1754,8 +1754,12 @@ bool Condition::Building::operator==(const Condition::ConditionBase& rhs) const
 
 namespace {
     struct BuildingSimpleMatch {
-        BuildingSimpleMatch(const std::vector<std::string>& names) :
-            m_names(names)
+        /** \a name_ids are the interned ids of the names of the building
+          * types to match.  Every building's type name is interned, so names
+          * that haven't been interned can't match and aren't included. */
+        BuildingSimpleMatch(const std::vector<int>& name_ids, bool match_any) :
+            m_name_ids(name_ids),
+            m_match_any(match_any)
         {}
 
         bool operator()(TemporaryPtr<const UniverseObject> candidate) const {
@@ -1768,14 +1772,15 @@ namespace {
                 return false;
 
             // if no name supplied, match any building
-            if (m_names.empty())
+            if (m_match_any)
                 return true;
 
             // is it one of the specified building types?
-            return std::find(m_names.begin(), m_names.end(), building->BuildingTypeName()) != m_names.end();
+            return std::find(m_name_ids.begin(), m_name_ids.end(), building->BuildingTypeID()) != m_name_ids.end();
         }
 
-        const std::vector<std::string>& m_names;
+        const std::vector<int>& m_name_ids;
+        bool                    m_match_any;
     };
 }
 
@@ -1797,14 +1802,16 @@ void Condition::Building::Eval(const ScriptingContext& parent_context,
     }
     if (simple_eval_safe) {
         // evaluate names once, and use to check all candidate objects
-        std::vector<std::string> names;
+        std::vector<int> name_ids;
         // get all names from valuerefs
         for (std::vector<const ValueRef::ValueRefBase<std::string>*>::const_iterator it = m_names.begin();
              it != m_names.end(); ++it)
         {
-            names.push_back((*it)->Eval(parent_context));
+            int name_id = FindInternedString((*it)->Eval(parent_context));
+            if (name_id != INVALID_STRING_ID)
+                name_ids.push_back(name_id);
         }
-        EvalImpl(matches, non_matches, search_domain, BuildingSimpleMatch(names));
+        EvalImpl(matches, non_matches, search_domain, BuildingSimpleMatch(name_ids, m_names.empty()));
     } else {
         // re-evaluate allowed building types range for each candidate object
         Condition::ConditionBase::Eval(parent_context, matches, non_matches, search_domain);
@@ -5274,7 +5281,7 @@ bool Condition::OwnerHasTech::Match(const ScriptingContext& local_context) const
         return false;
 
     if (const Empire* empire = Empires().Lookup(candidate->Owner()))
-        return empire->TechResearched(m_name);
+        return empire->TechResearched(m_name_id);
     else
         return false;
 }
@@ -7,6 +7,7 @@
 #include "ValueRefFwd.h"
 
 #include "../util/Export.h"
+#include "../util/StringInterner.h"
 
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/nvp.hpp>
@@ -1414,7 +1415,8 @@ private:
 /** Matches all objects whose owner who has tech \a name. */
 struct FO_COMMON_API Condition::OwnerHasTech : public Condition::ConditionBase {
     OwnerHasTech(const std::string& name) :
-        m_name(name)
+        m_name(name),
+        m_name_id(InternString(name))
     {}
     virtual bool        operator==(const Condition::ConditionBase& rhs) const;
     virtual bool        RootCandidateInvariant() const { return true; }
@@ -1428,6 +1430,7 @@ private:
     virtual bool        Match(const ScriptingContext& local_context) const;
 
     std::string m_name;
+    int         m_name_id;  ///< interned id of m_name
 
     friend class boost::serialization::access;
     template <class Archive>
@@ -2165,6 +2168,8 @@ void Condition::OwnerHasTech::serialize(Archive& ar, const unsigned int version)
 {
     ar  & BOOST_SERIALIZATION_BASE_OBJECT_NVP(ConditionBase)
         & BOOST_SERIALIZATION_NVP(m_name);
+    if (Archive::is_loading::value)
+        m_name_id = InternString(m_name);
 }
 
 template <class Archive>
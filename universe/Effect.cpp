@@ -32,6 +32,8 @@ using boost::lexical_cast;
 extern int g_indent;
 
 namespace {
+    OptionHandle<bool> verbose_logging("verbose-logging");
+
     boost::tuple<bool, ValueRef::OpType, double>
     SimpleMeterModification(MeterType meter, const ValueRef::ValueRefBase<double>* ref) {
         boost::tuple<bool, ValueRef::OpType, double> retval(false, ValueRef::PLUS, 0.0);
@@ -399,7 +401,7 @@ void EffectBase::Execute(const Effect::TargetsCauses& targets_causes,
                            bool only_appearance_effects/* = false*/,
                            bool include_empire_meter_effects/* = false*/) const
 {
-    bool log_verbose = GetOptionsDB().Get<bool>("verbose-logging");
+    bool log_verbose = verbose_logging.Get();
 
     std::set<int> non_stacking_targets;
     MeterType meter_type = INVALID_METER_TYPE;
@@ -441,16 +443,16 @@ void EffectBase::Execute(const Effect::TargetsCauses& targets_causes,
         Effect::TargetSet                  targets               = targets_and_cause.target_set;
 
         if (log_verbose) {
-            Logger().debugStream() << "ExecuteEffects effectsgroup: \n" << Dump();
-            Logger().debugStream() << "ExecuteEffects Targets before: ";
+            DebugLogger() << "ExecuteEffects effectsgroup: \n" << Dump();
+            DebugLogger() << "ExecuteEffects Targets before: ";
             for (Effect::TargetSet::const_iterator t_it = targets.begin(); t_it != targets.end(); ++t_it)
-                Logger().debugStream() << " ... " << (*t_it)->Dump();
+                DebugLogger() << " ... " << (*t_it)->Dump();
         }
 
         if (log_verbose) {
-            Logger().debugStream() << "ExecuteEffects Targets after: ";
+            DebugLogger() << "ExecuteEffects Targets after: ";
             for (Effect::TargetSet::const_iterator t_it = targets.begin(); t_it != targets.end(); ++t_it)
-                Logger().debugStream() << " ... " << (*t_it)->Dump();
+                DebugLogger() << " ... " << (*t_it)->Dump();
         }
 
         // for non-meter effects, can do default batch execute
@@ -672,7 +674,7 @@ SetShipPartMeter::~SetShipPartMeter()
 
 void SetShipPartMeter::Execute(const ScriptingContext& context) const {
     if (!context.effect_target) {
-        Logger().debugStream() << "SetShipPartMeter::Execute passed null target pointer";
+        DebugLogger() << "SetShipPartMeter::Execute passed null target pointer";
         return;
     }
 
@@ -684,7 +686,7 @@ void SetShipPartMeter::Execute(const ScriptingContext& context) const {
     }
 
     if (m_part_class == PC_FIGHTERS && !m_part_name.empty()) {
-        Logger().debugStream() << "SetShipPartMeter::Execute aborting due to part class being PC_FIGHTERS and part name being not empty";
+        DebugLogger() << "SetShipPartMeter::Execute aborting due to part class being PC_FIGHTERS and part name being not empty";
         return;
     }
 
@@ -810,13 +812,13 @@ void SetEmpireMeter::Execute(const ScriptingContext& context) const {
 
     Empire* empire = Empires().Lookup(empire_id);
     if (!empire) {
-        Logger().debugStream() << "SetEmpireMeter::Execute unable to find empire with id " << empire_id;
+        DebugLogger() << "SetEmpireMeter::Execute unable to find empire with id " << empire_id;
         return;
     }
 
     Meter* meter = empire->GetMeter(m_meter);
     if (!meter) {
-        Logger().debugStream() << "SetEmpireMeter::Execute empire " << empire->Name() << " doesn't have a meter named " << m_meter;
+        DebugLogger() << "SetEmpireMeter::Execute empire " << empire->Name() << " doesn't have a meter named " << m_meter;
         return;
     }
 
@@ -877,7 +879,7 @@ void SetEmpireStockpile::Execute(const ScriptingContext& context) const {
 
     Empire* empire = Empires().Lookup(empire_id);
     if (!empire) {
-        Logger().debugStream() << "SetEmpireStockpile::Execute couldn't find an empire with id " << empire_id;
+        DebugLogger() << "SetEmpireStockpile::Execute couldn't find an empire with id " << empire_id;
         return;
     }
 
@@ -1133,14 +1135,14 @@ CreatePlanet::CreatePlanet(const ValueRef::ValueRefBase<PlanetType>* type,
     m_type(type),
     m_size(size)
 {
-    Logger().debugStream() << "CreatePlanet::CreatePlanet";
-    Logger().debugStream() << "    type: " << (m_type ? m_type->Dump() : "no type");
-    Logger().debugStream() << "    size: " << (m_size ? m_size->Dump() : "no size");
-    Logger().debugStream() << Dump();
+    DebugLogger() << "CreatePlanet::CreatePlanet";
+    DebugLogger() << "    type: " << (m_type ? m_type->Dump() : "no type");
+    DebugLogger() << "    size: " << (m_size ? m_size->Dump() : "no size");
+    DebugLogger() << Dump();
 }
 
 CreatePlanet::~CreatePlanet() {
-    Logger().debugStream() << "CreatePlanet::~CreatePlanet";
+    DebugLogger() << "CreatePlanet::~CreatePlanet";
     delete m_type;
     delete m_size;
 }
@@ -1201,7 +1203,7 @@ std::string CreatePlanet::Description() const {
 
 std::string CreatePlanet::Dump() const
 {
-    Logger().debugStream() << "CreatePlanet::Dump()";
+    DebugLogger() << "CreatePlanet::Dump()";
     return DumpIndent() + "CreatePlanet size = " + m_size->Dump() + " type = " + m_type->Dump() + "\n";
 }
 
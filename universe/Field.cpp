@@ -92,6 +92,13 @@ void Field::Copy(TemporaryPtr<const UniverseObject> copied_object, int empire_id
     }
 }
 
+bool Field::UpdateState(const UniverseObject& updated_object) {
+    const Field& updated_field = dynamic_cast<const Field&>(updated_object);
+    bool changed = UniverseObject::UpdateState(updated_object);
+    changed |= UpdateMember(m_type_name, updated_field.m_type_name);
+    return changed;
+}
+
 std::set<std::string> Field::Tags() const {
     const FieldType* type = GetFieldType(m_type_name);
     if (!type)
@@ -55,6 +55,8 @@ protected:
     virtual Field*              Clone(int empire_id = ALL_EMPIRES) const;   ///< returns new copy of this Field
     //@}
 
+    virtual bool                UpdateState(const UniverseObject& updated_object);
+
 private:
     virtual void                ClampMeters();
 
@@ -106,7 +106,7 @@ void Fleet::Copy(TemporaryPtr<const UniverseObject> copied_object, int empire_id
                         travel_distance -= GetUniverse().ShortestPath(travel_route.back(),
                                                                       copied_fleet_route.back()).second;
                     } catch (...) {
-                        Logger().debugStream() << "Fleet::Copy couldn't find route to system(s):"
+                        DebugLogger() << "Fleet::Copy couldn't find route to system(s):"
                                                << " travel route back: " << travel_route.back()
                                                << " or copied fleet route back: " << copied_fleet_route.back();
                     }
@@ -120,6 +120,22 @@ void Fleet::Copy(TemporaryPtr<const UniverseObject> copied_object, int empire_id
     }
 }
 
+bool Fleet::UpdateState(const UniverseObject& updated_object) {
+    const Fleet& updated_fleet = dynamic_cast<const Fleet&>(updated_object);
+    bool changed = UniverseObject::UpdateState(updated_object);
+    changed |= UpdateMember(m_ships,                        updated_fleet.m_ships);
+    changed |= UpdateMember(m_moving_to,                    updated_fleet.m_moving_to);
+    changed |= UpdateMember(m_prev_system,                  updated_fleet.m_prev_system);
+    changed |= UpdateMember(m_next_system,                  updated_fleet.m_next_system);
+    changed |= UpdateMember(m_aggressive,                   updated_fleet.m_aggressive);
+    changed |= UpdateMember(m_ordered_given_to_empire_id,   updated_fleet.m_ordered_given_to_empire_id);
+    changed |= UpdateMember(m_travel_route,                 updated_fleet.m_travel_route);
+    changed |= UpdateMember(m_travel_distance,              updated_fleet.m_travel_distance);
+    changed |= UpdateMember(m_arrived_this_turn,            updated_fleet.m_arrived_this_turn);
+    changed |= UpdateMember(m_arrival_starlane,             updated_fleet.m_arrival_starlane);
+    return changed;
+}
+
 UniverseObjectType Fleet::ObjectType() const
 { return OBJ_FLEET; }
 
@@ -1022,7 +1038,7 @@ void Fleet::CalculateRoute() const {
         try {
             path = GetUniverse().ShortestPath(m_prev_system, m_moving_to, this->Owner());
         } catch (...) {
-            Logger().debugStream() << "Fleet::CalculateRoute couldn't find route to system(s):"
+            DebugLogger() << "Fleet::CalculateRoute couldn't find route to system(s):"
                                    << " fleet's previous: " << m_prev_system << " or moving to: " << m_moving_to;
         }
         m_travel_route = path.first;
@@ -1065,7 +1081,7 @@ void Fleet::CalculateRoute() const {
         try {
             path1 = GetUniverse().ShortestPath(m_next_system, dest_system_id, this->Owner());
         } catch (...) {
-            Logger().debugStream() << "Fleet::CalculateRoute couldn't find route to system(s):"
+            DebugLogger() << "Fleet::CalculateRoute couldn't find route to system(s):"
                                    << " fleet's next: " << m_next_system << " or destination: " << dest_system_id;
         }
         const std::list<int>& sys_list1 = path1.first;
@@ -1086,7 +1102,7 @@ void Fleet::CalculateRoute() const {
         try {
             path2 = GetUniverse().ShortestPath(m_prev_system, dest_system_id, this->Owner());
         } catch (...) {
-            Logger().debugStream() << "Fleet::CalculateRoute couldn't find route to system(s):"
+            DebugLogger() << "Fleet::CalculateRoute couldn't find route to system(s):"
                                    << " fleet's previous: " << m_prev_system << " or destination: " << dest_system_id;
         }
         const std::list<int>& sys_list2 = path2.first;
@@ -1118,7 +1134,7 @@ void Fleet::CalculateRoute() const {
         try {
             route = GetUniverse().ShortestPath(m_next_system, dest_system_id, this->Owner());
         } catch (...) {
-            Logger().debugStream() << "Fleet::CalculateRoute couldn't find route to system(s):"
+            DebugLogger() << "Fleet::CalculateRoute couldn't find route to system(s):"
                                    << " fleet's next: " << m_next_system << " or destination: " << dest_system_id;
         }
         const std::list<int>& sys_list = route.first;
@@ -1159,7 +1175,7 @@ bool Fleet::BlockadedAtSystem(int start_system_id, int dest_system_id) const {
     // blockade by themselves, but may reinforce a preexisting blockade, and may possibly contribute to detection
     TemporaryPtr<System> current_system = GetSystem(start_system_id);
     if (!current_system) {
-        Logger().debugStream() << "Fleet::BlockadedAtSystem fleet " << ID() << " considering system (" << start_system_id << ") but can't retrieve system copy";
+        DebugLogger() << "Fleet::BlockadedAtSystem fleet " << ID() << " considering system (" << start_system_id << ") but can't retrieve system copy";
         return false;
     }
 
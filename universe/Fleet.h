@@ -158,6 +158,8 @@ protected:
     virtual Fleet*          Clone(int empire_id = ALL_EMPIRES) const;  ///< returns new copy of this Fleet
     //@}
 
+    virtual bool            UpdateState(const UniverseObject& updated_object);
+
 private:
     ///< removes any systems on the route after the specified system
     void                    ShortenRouteToEndAtSystem(std::list<int>& travel_route, int last_system);
@@ -35,6 +35,12 @@ std::string Meter::Dump() const {
     return strstm.str();
 }
 
+bool Meter::operator==(const Meter& rhs) const
+{ return m_current_value == rhs.m_current_value && m_initial_value == rhs.m_initial_value; }
+
+bool Meter::operator!=(const Meter& rhs) const
+{ return !(*this == rhs); }
+
 void Meter::SetCurrent(float current_value)
 { m_current_value = current_value; }
 
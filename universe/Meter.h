@@ -25,6 +25,9 @@ public:
     float      Initial() const;                     ///< returns the value of the meter as it was at the beginning of the turn
 
     std::string Dump() const;                       ///< returns text of meter values
+
+    bool        operator==(const Meter& rhs) const; ///< returns true iff this and \a rhs have the same current and initial values
+    bool        operator!=(const Meter& rhs) const; ///< returns true iff this and \a rhs have different current or initial values
     //@}
 
     /** \name Mutators */ //@{
@@ -330,31 +330,74 @@ void ObjectMap::AuditContainment(const std::set<int>& destroyed_object_ids) {
             contained_ships[alt_id].insert(contained_id);
     }
 
-    // set contained objects of all possible containers
-    for (iterator<> it = begin(); it != end(); ++it) {
-        TemporaryPtr<UniverseObject> obj = *it;
+    // set contained objects of all possible containers.  objects in this map
+    // may be shared with other ObjectMaps, such as other empires' latest
+    // known objects, so a container whose contents change is replaced in
+    // this map by a copy, which is then changed.
+    std::vector<UniverseObject*> changed_containers;
+    for (const_iterator<> it = const_begin(); it != const_end(); ++it) {
+        TemporaryPtr<const UniverseObject> obj = *it;
+        int obj_id = obj->ID();
         if (obj->ObjectType() == OBJ_SYSTEM) {
-            TemporaryPtr<System> sys = boost::dynamic_pointer_cast<System>(obj);
+            TemporaryPtr<const System> sys = boost::dynamic_pointer_cast<const System>(obj);
             if (!sys)
                 continue;
-            sys->m_objects =    contained_objs[sys->ID()];
-            sys->m_planets =    contained_planets[sys->ID()];
-            sys->m_buildings =  contained_buildings[sys->ID()];
-            sys->m_fleets =     contained_fleets[sys->ID()];
-            sys->m_ships =      contained_ships[sys->ID()];
-            sys->m_fields =     contained_fields[sys->ID()];
+            if (sys->m_objects ==   contained_objs[obj_id] &&
+                sys->m_planets ==   contained_planets[obj_id] &&
+                sys->m_buildings == contained_buildings[obj_id] &&
+                sys->m_fleets ==    contained_fleets[obj_id] &&
+                sys->m_ships ==     contained_ships[obj_id] &&
+                sys->m_fields ==    contained_fields[obj_id])
+            { continue; }
+            System* sys_copy = static_cast<System*>(CopyForChange(obj));
+            if (!sys_copy)
+                continue;
+            sys_copy->m_objects =   contained_objs[obj_id];
+            sys_copy->m_planets =   contained_planets[obj_id];
+            sys_copy->m_buildings = contained_buildings[obj_id];
+            sys_copy->m_fleets =    contained_fleets[obj_id];
+            sys_copy->m_ships =     contained_ships[obj_id];
+            sys_copy->m_fields =    contained_fields[obj_id];
+            changed_containers.push_back(sys_copy);
         } else if (obj->ObjectType() == OBJ_PLANET) {
-            TemporaryPtr<Planet> plt = boost::dynamic_pointer_cast<Planet>(obj);
+            TemporaryPtr<const Planet> plt = boost::dynamic_pointer_cast<const Planet>(obj);
             if (!plt)
                 continue;
-            plt->m_buildings =  contained_buildings[plt->ID()];
+            if (plt->m_buildings == contained_buildings[obj_id])
+                continue;
+            Planet* plt_copy = dynamic_cast<Planet*>(CopyForChange(obj));
+            if (!plt_copy)
+                continue;
+            plt_copy->m_buildings = contained_buildings[obj_id];
+            changed_containers.push_back(plt_copy);
         } else if (obj->ObjectType() == OBJ_FLEET) {
-            TemporaryPtr<Fleet> flt = boost::dynamic_pointer_cast<Fleet>(obj);
+            TemporaryPtr<const Fleet> flt = boost::dynamic_pointer_cast<const Fleet>(obj);
             if (!flt)
                 continue;
-            flt->m_ships =      contained_ships[flt->ID()];
+            if (flt->m_ships == contained_ships[obj_id])
+                continue;
+            Fleet* flt_copy = static_cast<Fleet*>(CopyForChange(obj));
+            if (!flt_copy)
+                continue;
+            flt_copy->m_ships =     contained_ships[obj_id];
+            changed_containers.push_back(flt_copy);
         }
     }
+
+    for (std::vector<UniverseObject*>::iterator it = changed_containers.begin();
+         it != changed_containers.end(); ++it)
+    { Insert(*it); }
+}
+
+UniverseObject* ObjectMap::CopyForChange(TemporaryPtr<const UniverseObject> obj) {
+    if (!obj)
+        return 0;
+    // cloning for ALL_EMPIRES copies all of obj's state, except that the
+    // specials it copies are those the actual object in the universe has now
+    UniverseObject* retval = obj->Clone(ALL_EMPIRES);
+    if (retval)
+        retval->m_specials = obj->m_specials;
+    return retval;
 }
 
 void ObjectMap::CopyObjectsToSpecializedMaps() {
@@ -367,6 +367,11 @@ public:
       * unchanged. */
     void                CopyObject(TemporaryPtr<const UniverseObject> source, int empire_id = ALL_EMPIRES);
 
+    /** Returns a new copy of \a obj with all of its state, including its
+      * specials, which can be changed and inserted into an ObjectMap in place
+      * of \a obj without changing other ObjectMaps that share \a obj. */
+    static UniverseObject*  CopyForChange(TemporaryPtr<const UniverseObject> obj);
+
     /** Adds object \a obj to the map under its ID, if it is a valid object.
       * If there already was an object in the map with the id \a id then
       * that object will be removed.  A TemporaryPtr to the new object is
@@ -399,7 +404,9 @@ public:
       * on what other objects exist in this ObjectMap. Useful to eliminate
       * cases where there are inconsistencies between whan an object thinks it
       * contains, and what other objects think they are contained by the first
-      * object. */
+      * object.  Containers whose contained objects change are replaced in
+      * this map by changed copies, so that the objects this map shares with
+      * other ObjectMaps, for example after CopyForSerialize, are unchanged. */
     void                AuditContainment(const std::set<int>& destroyed_object_ids);
     //@}
 
@@ -0,0 +1,186 @@
+#include "ObjectVisibilityTable.h"
+
+#include "../util/AppInterface.h"
+
+namespace {
+    /** Ids less than this many past twice the number of entries are stored in
+      * the array, growing it if necessary. */
+    const int DENSE_ENTRIES_SLACK = 1024;
+}
+
+ObjectVisibilityTable::Entry::Entry() :
+    vis(INVALID_VISIBILITY),
+    basic_vis_turn(INVALID_GAME_TURN),
+    partial_vis_turn(INVALID_GAME_TURN),
+    full_vis_turn(INVALID_GAME_TURN)
+{}
+
+ObjectVisibilityTable::ObjectVisibilityTable() :
+    m_entries(),
+    m_sparse_entries()
+{}
+
+bool ObjectVisibilityTable::HasVisibility(int object_id) const {
+    const Entry* entry = FindEntry(object_id);
+    return entry && entry->vis != INVALID_VISIBILITY;
+}
+
+Visibility ObjectVisibilityTable::GetVisibility(int object_id) const {
+    const Entry* entry = FindEntry(object_id);
+    if (!entry || entry->vis == INVALID_VISIBILITY)
+        return VIS_NO_VISIBILITY;
+    return Visibility(entry->vis);
+}
+
+int ObjectVisibilityTable::LastTurnVisible(int object_id, Visibility vis) const {
+    const Entry* entry = FindEntry(object_id);
+    if (!entry)
+        return INVALID_GAME_TURN;
+    switch (vis) {
+    case VIS_BASIC_VISIBILITY:      return entry->basic_vis_turn;
+    case VIS_PARTIAL_VISIBILITY:    return entry->partial_vis_turn;
+    case VIS_FULL_VISIBILITY:       return entry->full_vis_turn;
+    default:                        return INVALID_GAME_TURN;
+    }
+}
+
+std::map<Visibility, int> ObjectVisibilityTable::VisibilityTurns(int object_id) const {
+    std::map<Visibility, int> retval;
+    for (int vis = VIS_BASIC_VISIBILITY; vis <= VIS_FULL_VISIBILITY; ++vis) {
+        int turn = LastTurnVisible(object_id, Visibility(vis));
+        if (turn != INVALID_GAME_TURN)
+            retval[Visibility(vis)] = turn;
+    }
+    return retval;
+}
+
+void ObjectVisibilityTable::GetVisibleObjectIDs(std::vector<int>& object_ids) const {
+    for (int object_id = 0; object_id < static_cast<int>(m_entries.size()); ++object_id) {
+        if (m_entries[object_id].vis > VIS_NO_VISIBILITY)
+            object_ids.push_back(object_id);
+    }
+    for (std::map<int, Entry>::const_iterator it = m_sparse_entries.begin(); it != m_sparse_entries.end(); ++it) {
+        if (it->second.vis > VIS_NO_VISIBILITY)
+            object_ids.push_back(it->first);
+    }
+}
+
+void ObjectVisibilityTable::GetVisibilities(std::map<int, Visibility>& visibilities) const {
+    for (int object_id = 0; object_id < static_cast<int>(m_entries.size()); ++object_id) {
+        if (m_entries[object_id].vis != INVALID_VISIBILITY)
+            visibilities[object_id] = Visibility(m_entries[object_id].vis);
+    }
+    for (std::map<int, Entry>::const_iterator it = m_sparse_entries.begin(); it != m_sparse_entries.end(); ++it) {
+        if (it->second.vis != INVALID_VISIBILITY)
+            visibilities[it->first] = Visibility(it->second.vis);
+    }
+}
+
+void ObjectVisibilityTable::GetVisibilityTurns(std::map<int, std::map<Visibility, int> >& visibility_turns) const {
+    for (int object_id = 0; object_id < static_cast<int>(m_entries.size()); ++object_id) {
+        if (m_entries[object_id].basic_vis_turn == INVALID_GAME_TURN &&
+            m_entries[object_id].partial_vis_turn == INVALID_GAME_TURN &&
+            m_entries[object_id].full_vis_turn == INVALID_GAME_TURN)
+        { continue; }
+        visibility_turns[object_id] = VisibilityTurns(object_id);
+    }
+    for (std::map<int, Entry>::const_iterator it = m_sparse_entries.begin(); it != m_sparse_entries.end(); ++it) {
+        if (it->second.basic_vis_turn == INVALID_GAME_TURN &&
+            it->second.partial_vis_turn == INVALID_GAME_TURN &&
+            it->second.full_vis_turn == INVALID_GAME_TURN)
+        { continue; }
+        visibility_turns[it->first] = VisibilityTurns(it->first);
+    }
+}
+
+void ObjectVisibilityTable::SetVisibility(int object_id, Visibility vis) {
+    if (Entry* entry = EntryForID(object_id))
+        entry->vis = static_cast<signed char>(vis);
+}
+
+void ObjectVisibilityTable::RaiseVisibility(int object_id, Visibility vis) {
+    Entry* entry = EntryForID(object_id);
+    if (!entry)
+        return;
+    if (entry->vis == INVALID_VISIBILITY)
+        entry->vis = VIS_NO_VISIBILITY;
+    if (vis > entry->vis)
+        entry->vis = static_cast<signed char>(vis);
+}
+
+void ObjectVisibilityTable::SetLastTurnVisible(int object_id, Visibility vis, int turn) {
+    if (vis < VIS_BASIC_VISIBILITY)
+        return;
+    Entry* entry = EntryForID(object_id);
+    if (!entry)
+        return;
+    entry->basic_vis_turn = turn;
+    if (vis >= VIS_PARTIAL_VISIBILITY)
+        entry->partial_vis_turn = turn;
+    if (vis >= VIS_FULL_VISIBILITY)
+        entry->full_vis_turn = turn;
+}
+
+void ObjectVisibilityTable::ClearVisibilities() {
+    for (std::vector<Entry>::iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+        it->vis = INVALID_VISIBILITY;
+    for (std::map<int, Entry>::iterator it = m_sparse_entries.begin(); it != m_sparse_entries.end(); ++it)
+        it->second.vis = INVALID_VISIBILITY;
+}
+
+void ObjectVisibilityTable::SetVisibilities(const std::map<int, Visibility>& visibilities) {
+    for (std::map<int, Visibility>::const_iterator it = visibilities.begin(); it != visibilities.end(); ++it)
+        SetVisibility(it->first, it->second);
+}
+
+void ObjectVisibilityTable::SetVisibilityTurns(const std::map<int, std::map<Visibility, int> >& visibility_turns) {
+    for (std::map<int, std::map<Visibility, int> >::const_iterator object_it = visibility_turns.begin();
+         object_it != visibility_turns.end(); ++object_it)
+    {
+        Entry* entry = EntryForID(object_it->first);
+        if (!entry)
+            continue;
+        for (std::map<Visibility, int>::const_iterator vis_it = object_it->second.begin();
+             vis_it != object_it->second.end(); ++vis_it)
+        {
+            switch (vis_it->first) {
+            case VIS_BASIC_VISIBILITY:      entry->basic_vis_turn = vis_it->second;     break;
+            case VIS_PARTIAL_VISIBILITY:    entry->partial_vis_turn = vis_it->second;   break;
+            case VIS_FULL_VISIBILITY:       entry->full_vis_turn = vis_it->second;      break;
+            default:                                                                    break;
+            }
+        }
+    }
+}
+
+const ObjectVisibilityTable::Entry* ObjectVisibilityTable::FindEntry(int object_id) const {
+    if (object_id < 0)
+        return 0;
+    if (object_id < static_cast<int>(m_entries.size()))
+        return &m_entries[object_id];
+    std::map<int, Entry>::const_iterator it = m_sparse_entries.find(object_id);
+    return it != m_sparse_entries.end() ? &it->second : 0;
+}
+
+ObjectVisibilityTable::Entry* ObjectVisibilityTable::EntryForID(int object_id) {
+    if (object_id < 0)
+        return 0;
+    if (object_id < static_cast<int>(m_entries.size()))
+        return &m_entries[object_id];
+
+    // only grow the array if it stays proportional to the number of entries;
+    // otherwise an arbitrary id would allocate an entry for every lower id
+    std::size_t num_entries = m_entries.size() + m_sparse_entries.size();
+    if (static_cast<std::size_t>(object_id) >= 2 * num_entries + DENSE_ENTRIES_SLACK)
+        return &m_sparse_entries[object_id];
+
+    m_entries.resize(object_id + 1);
+
+    // move sparse entries now covered by the array into it
+    std::map<int, Entry>::iterator it = m_sparse_entries.begin();
+    while (it != m_sparse_entries.end() && it->first <= object_id) {
+        m_entries[it->first] = it->second;
+        m_sparse_entries.erase(it++);
+    }
+    return &m_entries[object_id];
+}
@@ -0,0 +1,106 @@
+// -*- C++ -*-
+#ifndef _ObjectVisibilityTable_h_
+#define _ObjectVisibilityTable_h_
+
+#include <map>
+#include <vector>
+
+#include "Enums.h"
+#include "../util/Export.h"
+
+/** One empire's visibility of each object on the current turn, and the most
+  * recent turns on which the empire had basic, partial and full visibility of
+  * each object.  Object ids are allocated consecutively from zero, so entries
+  * are stored in an array indexed by object id, rather than in maps, which
+  * makes lookups constant time and avoids allocating a tree node per entry.
+  * The array is only grown while it stays within a constant factor of the
+  * number of entries; ids far beyond it, which a well-formed universe doesn't
+  * produce, are kept in a map instead, so that an arbitrary id can't cause a
+  * huge allocation.
+  *
+  * As with the std::map representation used for serialization, an object may
+  * have no visibility entry on the current turn, or an entry with
+  * VIS_NO_VISIBILITY, which visibility propagation adds for objects that were
+  * checked but aren't visible.  GetVisibility() returns VIS_NO_VISIBILITY
+  * in both cases. */
+class FO_COMMON_API ObjectVisibilityTable {
+public:
+    /** \name Structors */ //@{
+    ObjectVisibilityTable();
+    //@}
+
+    /** \name Accessors */ //@{
+    /** Returns true iff there is a visibility entry for object with id
+      * \a object_id on the current turn, even if it is VIS_NO_VISIBILITY. */
+    bool        HasVisibility(int object_id) const;
+
+    /** Returns the current visibility of the object with id \a object_id, or
+      * VIS_NO_VISIBILITY if it has no entry. */
+    Visibility  GetVisibility(int object_id) const;
+
+    /** Returns the most recent turn on which the object with id \a object_id
+      * was seen with visibility \a vis or better, or INVALID_GAME_TURN if it
+      * hasn't been. */
+    int         LastTurnVisible(int object_id, Visibility vis) const;
+
+    /** Returns the map from visibility level to most recent turn on which the
+      * object with id \a object_id was seen at that level or better, with
+      * entries only for the levels it has been seen at. */
+    std::map<Visibility, int>   VisibilityTurns(int object_id) const;
+
+    /** Adds the ids of objects with current visibility better than
+      * VIS_NO_VISIBILITY to \a object_ids, in increasing order. */
+    void        GetVisibleObjectIDs(std::vector<int>& object_ids) const;
+
+    /** Adds the current visibility entries to \a visibilities, keyed by
+      * object id. */
+    void        GetVisibilities(std::map<int, Visibility>& visibilities) const;
+
+    /** Adds the visibility turns of each object that has been seen to
+      * \a visibility_turns, keyed by object id. */
+    void        GetVisibilityTurns(std::map<int, std::map<Visibility, int> >& visibility_turns) const;
+    //@}
+
+    /** \name Mutators */ //@{
+    /** Sets the current visibility of the object with id \a object_id to
+      * \a vis. */
+    void        SetVisibility(int object_id, Visibility vis);
+
+    /** Sets the current visibility of the object with id \a object_id to
+      * \a vis, if that is higher than its current visibility, or if it has no
+      * entry yet. */
+    void        RaiseVisibility(int object_id, Visibility vis);
+
+    /** Records that the object with id \a object_id was seen on turn \a turn
+      * with visibility \a vis, and so also at all lower visibility levels
+      * above VIS_NO_VISIBILITY. */
+    void        SetLastTurnVisible(int object_id, Visibility vis, int turn);
+
+    /** Removes all current visibility entries, leaving visibility turns. */
+    void        ClearVisibilities();
+
+    /** Adds the entries in \a visibilities as current visibilities. */
+    void        SetVisibilities(const std::map<int, Visibility>& visibilities);
+
+    /** Adds the turns in \a visibility_turns as visibility turns. */
+    void        SetVisibilityTurns(const std::map<int, std::map<Visibility, int> >& visibility_turns);
+    //@}
+
+private:
+    struct Entry {
+        Entry();
+
+        signed char vis;                // INVALID_VISIBILITY if there is no entry on the current turn
+        int         basic_vis_turn;     // INVALID_GAME_TURN if not yet seen with at least this visibility
+        int         partial_vis_turn;
+        int         full_vis_turn;
+    };
+
+    const Entry*    FindEntry(int object_id) const;
+    Entry*          EntryForID(int object_id);
+
+    std::vector<Entry>      m_entries;          // indexed by object id
+    std::map<int, Entry>    m_sparse_entries;   // entries for ids at or beyond m_entries.size()
+};
+
+#endif // _ObjectVisibilityTable_h_
@@ -166,15 +166,39 @@ void Planet::Copy(TemporaryPtr<const UniverseObject> copied_object, int empire_i
     }
 }
 
+bool Planet::UpdateState(const UniverseObject& updated_object) {
+    const Planet& updated_planet = dynamic_cast<const Planet&>(updated_object);
+    bool changed = UniverseObject::UpdateState(updated_object);
+    changed |= PopCenterUpdateState(updated_planet);
+    changed |= ResourceCenterUpdateState(updated_planet);
+    changed |= UpdateMember(m_type,                         updated_planet.m_type);
+    changed |= UpdateMember(m_original_type,                updated_planet.m_original_type);
+    changed |= UpdateMember(m_size,                         updated_planet.m_size);
+    changed |= UpdateMember(m_orbital_period,               updated_planet.m_orbital_period);
+    changed |= UpdateMember(m_initial_orbital_position,     updated_planet.m_initial_orbital_position);
+    changed |= UpdateMember(m_rotational_period,            updated_planet.m_rotational_period);
+    changed |= UpdateMember(m_axial_tilt,                   updated_planet.m_axial_tilt);
+    changed |= UpdateMember(m_buildings,                    updated_planet.m_buildings);
+    changed |= UpdateMember(m_just_conquered,               updated_planet.m_just_conquered);
+    changed |= UpdateMember(m_is_about_to_be_colonized,     updated_planet.m_is_about_to_be_colonized);
+    changed |= UpdateMember(m_is_about_to_be_invaded,       updated_planet.m_is_about_to_be_invaded);
+    changed |= UpdateMember(m_is_about_to_be_bombarded,     updated_planet.m_is_about_to_be_bombarded);
+    changed |= UpdateMember(m_ordered_given_to_empire_id,   updated_planet.m_ordered_given_to_empire_id);
+    changed |= UpdateMember(m_last_turn_attacked_by_ship,   updated_planet.m_last_turn_attacked_by_ship);
+    // not serialized, so reset as on a deserialized planet until effects set it again
+    changed |= UpdateMember(m_surface_texture,              updated_planet.m_surface_texture);
+    return changed;
+}
+
 std::set<std::string> Planet::Tags() const {
-    const Species* species = GetSpecies(SpeciesName());
+    const Species* species = GetSpecies(SpeciesID());
     if (!species)
         return std::set<std::string>();
     return species->Tags();
 }
 
 bool Planet::HasTag(const std::string& name) const {
-    const Species* species = GetSpecies(SpeciesName());
+    const Species* species = GetSpecies(SpeciesID());
 
     return species && species->Tags().count(name);
 }
@@ -505,7 +529,7 @@ std::vector<std::string> Planet::AvailableFoci() const {
     if (!this_planet)
         return retval;
     ScriptingContext context(this_planet);
-    if (const Species* species = GetSpecies(this_planet->SpeciesName())) {
+    if (const Species* species = GetSpecies(this_planet->SpeciesID())) {
         const std::vector<FocusType>& foci = species->Foci();
         for (std::vector<FocusType>::const_iterator it = foci.begin(); it != foci.end(); ++it) {
             const FocusType& focus_type = *it;
@@ -520,7 +544,7 @@ std::vector<std::string> Planet::AvailableFoci() const {
 }
 
 const std::string& Planet::FocusIcon(const std::string& focus_name) const {
-    if (const Species* species = GetSpecies(this->SpeciesName())) {
+    if (const Species* species = GetSpecies(this->SpeciesID())) {
         const std::vector<FocusType>& foci = species->Foci();
         for (std::vector<FocusType>::const_iterator it = foci.begin(); it != foci.end(); ++it) {
             const FocusType& focus_type = *it;
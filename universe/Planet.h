@@ -196,6 +196,8 @@ protected:
     virtual Planet*         Clone(int empire_id = ALL_EMPIRES) const;  ///< returns new copy of this Planet
     //@}
 
+    virtual bool            UpdateState(const UniverseObject& updated_object);
+
 private:
     void Init();
 
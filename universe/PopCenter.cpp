@@ -16,11 +16,13 @@ class Species;
 const Species* GetSpecies(const std::string& name);
 
 PopCenter::PopCenter(const std::string& species_name) :
-    m_species_name(species_name)
+    m_species_name(species_name),
+    m_species_id(InternString(species_name))
 {}
 
 PopCenter::PopCenter() :
-    m_species_name()
+    m_species_name(),
+    m_species_id(INVALID_STRING_ID)
 {}
 
 PopCenter::~PopCenter()
@@ -36,9 +38,17 @@ void PopCenter::Copy(TemporaryPtr<const PopCenter> copied_object, Visibility vis
 
     if (vis >= VIS_PARTIAL_VISIBILITY) {
         this->m_species_name =      copied_object->m_species_name;
+        this->m_species_id =        copied_object->m_species_id;
     }
 }
 
+bool PopCenter::PopCenterUpdateState(const PopCenter& updated_object) {
+    if (!UpdateMember(m_species_name, updated_object.m_species_name))
+        return false;
+    m_species_id = updated_object.m_species_id;
+    return true;
+}
+
 void PopCenter::Init() {
     //Logger().debugStream() << "PopCenter::Init";
     AddMeter(METER_POPULATION);
@@ -146,6 +156,7 @@ void PopCenter::Reset() {
     GetMeter(METER_HAPPINESS)->Reset();
     GetMeter(METER_TARGET_HAPPINESS)->Reset();
     m_species_name.clear();
+    m_species_id = INVALID_STRING_ID;
 }
 
 void PopCenter::Depopulate() {
@@ -159,4 +170,5 @@ void PopCenter::SetSpecies(const std::string& species_name) {
         Logger().errorStream() << "PopCenter::SetSpecies couldn't get species with name " << species_name;
     }
     m_species_name = species_name;
+    m_species_id = InternString(species_name);
 }
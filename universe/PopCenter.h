@@ -7,6 +7,7 @@
 #include <boost/serialization/nvp.hpp>
 
 #include "../util/Export.h"
+#include "../util/StringInterner.h"
 #include "TemporaryPtr.h"
 #include "UniverseObject.h"
 
@@ -28,6 +29,7 @@ public:
 
     /** \name Accessors */ //@{
     const std::string&  SpeciesName() const {return m_species_name;}        ///< returns the name of the species that populates this planet
+    int                 SpeciesID() const {return m_species_id;}            ///< returns the interned id of SpeciesName(), or INVALID_STRING_ID if there is no species
 
     std::string         Dump() const;
 
@@ -54,12 +56,15 @@ protected:
 
     void    PopCenterPopGrowthProductionResearchPhase();
 
+    bool    PopCenterUpdateState(const PopCenter& updated_object);  ///< used by derived classes' UpdateState
+
 private:
     virtual Meter*          GetMeter(MeterType type) = 0;       ///< implementation should return the requested Meter, or 0 if no such Meter of that type is found in this object
     virtual const Meter*    GetMeter(MeterType type) const = 0; ///< implementation should return the requested Meter, or 0 if no such Meter of that type is found in this object
     virtual void            AddMeter(MeterType meter_type) = 0; ///< implementation should add a meter to the object so that it can be accessed with the GetMeter() functions
 
     std::string m_species_name;                                 ///< the name of the species that occupies this planet
+    int         m_species_id;                                   ///< interned id of m_species_name; not serialized, as ids differ between processes
 
     friend class boost::serialization::access;
     template <class Archive>
@@ -71,6 +76,8 @@ template <class Archive>
 void PopCenter::serialize(Archive& ar, const unsigned int version)
 {
     ar  & BOOST_SERIALIZATION_NVP(m_species_name);
+    if (Archive::is_loading::value)
+        m_species_id = InternString(m_species_name);
 }
 
 #endif // _PopCenter_h_
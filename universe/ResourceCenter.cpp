@@ -43,6 +43,13 @@ void ResourceCenter::Copy(TemporaryPtr<const ResourceCenter> copied_object, Visi
     }
 }
 
+bool ResourceCenter::ResourceCenterUpdateState(const ResourceCenter& updated_object) {
+    bool changed = false;
+    changed |= UpdateMember(m_focus,                    updated_object.m_focus);
+    changed |= UpdateMember(m_last_turn_focus_changed,  updated_object.m_last_turn_focus_changed);
+    return changed;
+}
+
 void ResourceCenter::Init() {
     //Logger().debugStream() << "ResourceCenter::Init";
     AddMeter(METER_INDUSTRY);
@@ -63,6 +63,8 @@ protected:
 
     void            ResourceCenterPopGrowthProductionResearchPhase();
 
+    bool            ResourceCenterUpdateState(const ResourceCenter& updated_object);   ///< used by derived classes' UpdateState
+
 
 private:
     std::string m_focus;
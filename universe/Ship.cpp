@@ -3,6 +3,7 @@
 #include "../util/i18n.h"
 #include "../util/Logger.h"
 #include "../util/Random.h"
+#include "../util/StringInterner.h"
 #include "Fleet.h"
 #include "Predicates.h"
 #include "ShipDesign.h"
@@ -22,6 +23,7 @@ Ship::Ship() :
     m_ordered_invade_planet_id(INVALID_OBJECT_ID),
     m_ordered_bombard_planet_id(INVALID_OBJECT_ID),
     m_last_turn_active_in_combat(INVALID_GAME_TURN),
+    m_species_id(INVALID_STRING_ID),
     m_produced_by_empire_id(ALL_EMPIRES)
 {}
 
@@ -35,6 +37,7 @@ Ship::Ship(int empire_id, int design_id, const std::string& species_name,
     m_ordered_bombard_planet_id(INVALID_OBJECT_ID),
     m_last_turn_active_in_combat(INVALID_GAME_TURN),
     m_species_name(species_name),
+    m_species_id(InternString(species_name)),
     m_produced_by_empire_id(produced_by_empire_id)
 {
     if (!GetShipDesign(design_id))
@@ -156,6 +159,7 @@ void Ship::Copy(TemporaryPtr<const UniverseObject> copied_object, int empire_id)
                  it != copied_ship->m_part_meters.end(); ++it)
             { this->m_part_meters[it->first]; }
             this->m_species_name =          copied_ship->m_species_name;
+            this->m_species_id =            copied_ship->m_species_id;
 
             if (vis >= VIS_FULL_VISIBILITY) {
                 this->m_ordered_scrapped =          copied_ship->m_ordered_scrapped;
@@ -170,6 +174,27 @@ void Ship::Copy(TemporaryPtr<const UniverseObject> copied_object, int empire_id)
     }
 }
 
+bool Ship::UpdateState(const UniverseObject& updated_object) {
+    const Ship& updated_ship = dynamic_cast<const Ship&>(updated_object);
+    bool changed = UniverseObject::UpdateState(updated_object);
+    changed |= UpdateMember(m_design_id,                    updated_ship.m_design_id);
+    changed |= UpdateMember(m_fleet_id,                     updated_ship.m_fleet_id);
+    changed |= UpdateMember(m_ordered_scrapped,             updated_ship.m_ordered_scrapped);
+    changed |= UpdateMember(m_ordered_colonize_planet_id,   updated_ship.m_ordered_colonize_planet_id);
+    changed |= UpdateMember(m_ordered_invade_planet_id,     updated_ship.m_ordered_invade_planet_id);
+    changed |= UpdateMember(m_ordered_bombard_planet_id,    updated_ship.m_ordered_bombard_planet_id);
+    changed |= UpdateMember(m_last_turn_active_in_combat,   updated_ship.m_last_turn_active_in_combat);
+    changed |= UpdateMember(m_fighters,                     updated_ship.m_fighters);
+    changed |= UpdateMember(m_missiles,                     updated_ship.m_missiles);
+    changed |= UpdateMember(m_part_meters,                  updated_ship.m_part_meters);
+    if (UpdateMember(m_species_name,                        updated_ship.m_species_name)) {
+        m_species_id = updated_ship.m_species_id;
+        changed = true;
+    }
+    changed |= UpdateMember(m_produced_by_empire_id,        updated_ship.m_produced_by_empire_id);
+    return changed;
+}
+
 std::set<std::string> Ship::Tags() const {
     std::set<std::string> retval;
 
@@ -212,7 +237,7 @@ bool Ship::HasTag(const std::string& name) const {
         }
     }
     // check species for tag
-    const Species* species = GetSpecies(SpeciesName());
+    const Species* species = GetSpecies(SpeciesID());
     if (species && species->Tags().count(name))
         return true;
 
@@ -286,7 +311,7 @@ bool Ship::IsArmed() const {
 bool Ship::CanColonize() const {
     if (m_species_name.empty())
         return false;
-    const Species* species = GetSpecies(m_species_name);
+    const Species* species = GetSpecies(m_species_id);
     if (!species)
         return false;
     if (!species->CanColonize())
@@ -482,6 +507,7 @@ void Ship::SetSpecies(const std::string& species_name) {
     if (!GetSpecies(species_name))
         Logger().errorStream() << "Ship::SetSpecies couldn't get species with name " << species_name;
     m_species_name = species_name;
+    m_species_id = InternString(species_name);
 }
 
 void Ship::SetOrderedScrapped(bool b) {
@@ -45,6 +45,7 @@ public:
     bool                        HasTroops() const;
     bool                        CanBombard() const;
     const std::string&          SpeciesName() const         { return m_species_name; }
+    int                         SpeciesID() const           { return m_species_id; }    ///< returns the interned id of SpeciesName()
     float                       Speed() const;
 
     const ConsumablesMap&       Fighters() const            { return m_fighters; }
@@ -114,6 +115,8 @@ protected:
     virtual Ship*   Clone(int empire_id = ALL_EMPIRES) const;   ///< returns new copy of this Ship
     //@}
 
+    virtual bool    UpdateState(const UniverseObject& updated_object);
+
 
 private:
     virtual void    PopGrowthProductionResearchPhase();
@@ -130,6 +133,7 @@ private:
     ConsumablesMap  m_missiles;
     PartMeterMap    m_part_meters;
     std::string     m_species_name;
+    int             m_species_id;   ///< interned id of m_species_name; not serialized, as ids differ between processes
     int             m_produced_by_empire_id;
 
     friend class boost::serialization::access;
@@ -109,6 +109,9 @@ const PartTypeManager& GetPartTypeManager()
 const PartType* GetPartType(const std::string& name)
 { return GetPartTypeManager().GetPartType(name); }
 
+const PartType* GetPartType(int name_id)
+{ return GetPartTypeManager().GetPartType(name_id); }
+
 const HullTypeManager& GetHullTypeManager()
 { return HullTypeManager::GetHullTypeManager(); }
 
@@ -132,6 +135,12 @@ PartTypeManager::PartTypeManager() {
     s_instance = this;
 
     parse::ship_parts(GetResourceDir() / "ship_parts.txt", m_parts);
+    for (std::map<std::string, PartType*>::iterator it = m_parts.begin(); it != m_parts.end(); ++it) {
+        std::size_t name_id = InternString(it->first);
+        if (m_parts_by_name_id.size() <= name_id)
+            m_parts_by_name_id.resize(name_id + 1, 0);
+        m_parts_by_name_id[name_id] = it->second;
+    }
 
     if (GetOptionsDB().Get<bool>("verbose-logging")) {
         Logger().debugStream() << "Part Types:";
@@ -153,6 +162,12 @@ const PartType* PartTypeManager::GetPartType(const std::string& name) const {
     return it != m_parts.end() ? it->second : 0;
 }
 
+const PartType* PartTypeManager::GetPartType(int name_id) const {
+    if (name_id < 0 || static_cast<std::size_t>(name_id) >= m_parts_by_name_id.size())
+        return 0;
+    return m_parts_by_name_id[name_id];
+}
+
 const PartTypeManager& PartTypeManager::GetPartTypeManager() {
     static PartTypeManager manager;
     return manager;
@@ -936,6 +951,11 @@ bool ShipDesign::ValidDesign(const std::string& hull, const std::vector<std::str
 }
 
 void ShipDesign::BuildStatCaches() {
+    m_part_ids.clear();
+    m_part_ids.reserve(m_parts.size());
+    for (std::vector<std::string>::const_iterator it = m_parts.begin(); it != m_parts.end(); ++it)
+        m_part_ids.push_back(it->empty() ? INVALID_STRING_ID : InternString(*it));
+
     const HullType* hull = GetHullType(m_hull);
     if (!hull) {
         Logger().errorStream() << "ShipDesign::BuildStatCaches couldn't get hull with name " << m_hull;
@@ -17,6 +17,7 @@
 #include "Enums.h"
 
 #include "../util/Export.h"
+#include "../util/StringInterner.h"
 
 namespace Condition {
     struct ConditionBase;
@@ -250,6 +251,10 @@ public:
     /** returns the part type with the name \a name; you should use the free function GetPartType() instead */
     const PartType* GetPartType(const std::string& name) const;
 
+    /** returns the part type whose name has the interned id \a name_id, as
+      * returned by InternString(), or 0 if there is no such part type */
+    const PartType* GetPartType(int name_id) const;
+
     /** iterator to the first part type */
     iterator begin() const;
 
@@ -265,6 +270,7 @@ private:
     ~PartTypeManager();
 
     std::map<std::string, PartType*>    m_parts;
+    std::vector<PartType*>              m_parts_by_name_id; ///< part types indexed by the interned ids of their names, or 0 for ids of other strings
     static PartTypeManager*             s_instance;
 };
 
@@ -276,6 +282,10 @@ FO_COMMON_API const PartTypeManager& GetPartTypeManager();
   * such PartType exists, 0 is returned instead. */
 FO_COMMON_API const PartType* GetPartType(const std::string& name);
 
+/** Returns the ship PartType whose name has interned id \a name_id.  If no
+  * such PartType exists, 0 is returned instead. */
+FO_COMMON_API const PartType* GetPartType(int name_id);
+
 /** Hull stats.  Used by parser due to limits on number of sub-items per
   * parsed main item. */
 struct HullTypeStats {
@@ -577,6 +587,7 @@ public:
     { return GetHullTypeManager().GetHullType(m_hull); }                            ///< returns HullType on which design is based
 
     const std::vector<std::string>& Parts() const           { return m_parts; }     ///< returns vector of names of all parts in design
+    const std::vector<int>&         PartIDs() const         { return m_part_ids; }  ///< returns vector of interned ids of the names returned by Parts(), with INVALID_STRING_ID for empty slots
     std::vector<std::string>        Parts(ShipSlotType slot_type) const;            ///< returns vector of names of parts in slots of indicated type
 
     std::vector<std::string>        Tags() const;
@@ -630,6 +641,7 @@ private:
 
     // Note that these are fine to compute on demand and cache here -- it is
     // not necessary to serialize them.
+    std::vector<int>    m_part_ids;
     bool    m_is_armed;
     bool    m_can_bombard;
     float   m_detection;
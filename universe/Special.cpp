@@ -6,6 +6,7 @@
 #include "../util/OptionsDB.h"
 #include "../util/Directories.h"
 #include "../util/Logger.h"
+#include "../util/StringInterner.h"
 
 #include <boost/filesystem/fstream.hpp>
 
@@ -14,6 +15,14 @@ namespace {
     public:
         SpecialManager() {
             parse::specials(GetResourceDir() / "specials.txt", m_specials);
+            for (std::map<std::string, Special*>::iterator it = m_specials.begin();
+                it != m_specials.end(); ++it)
+            {
+                std::size_t name_id = InternString(it->first);
+                if (m_specials_by_name_id.size() <= name_id)
+                    m_specials_by_name_id.resize(name_id + 1, 0);
+                m_specials_by_name_id[name_id] = it->second;
+            }
             if (GetOptionsDB().Get<bool>("verbose-logging")) {
                 Logger().debugStream() << "Specials:";
                 for (std::map<std::string, Special*>::iterator it = m_specials.begin();
@@ -37,8 +46,14 @@ namespace {
             std::map<std::string, Special*>::const_iterator it = m_specials.find(name);
             return it != m_specials.end() ? it->second : 0;
         }
+        const Special* GetSpecial(int name_id) const {
+            if (name_id < 0 || static_cast<std::size_t>(name_id) >= m_specials_by_name_id.size())
+                return 0;
+            return m_specials_by_name_id[name_id];
+        }
     private:
         std::map<std::string, Special*> m_specials;
+        std::vector<Special*>           m_specials_by_name_id;  // indexed by interned ids of names
     };
     const SpecialManager& GetSpecialManager() {
         static SpecialManager special_manager;
@@ -86,5 +101,8 @@ std::string Special::Dump() const {
 const Special* GetSpecial(const std::string& name)
 { return GetSpecialManager().GetSpecial(name); }
 
+const Special* GetSpecial(int name_id)
+{ return GetSpecialManager().GetSpecial(name_id); }
+
 std::vector<std::string> SpecialNames()
 { return GetSpecialManager().SpecialNames(); }
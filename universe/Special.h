@@ -78,6 +78,10 @@ private:
   * If no such Special exists, 0 is returned instead. */
 FO_COMMON_API const Special* GetSpecial(const std::string& name);
 
+/** Returns the Special whose name has the interned id \a name_id, as returned
+  * by InternString().  If no such Special exists, 0 is returned instead. */
+FO_COMMON_API const Special* GetSpecial(int name_id);
+
 /** Returns names of all specials. */
 FO_COMMON_API std::vector<std::string> SpecialNames();
 
@@ -7,6 +7,7 @@
 #include "../util/Directories.h"
 #include "../util/Logger.h"
 #include "../util/Random.h"
+#include "../util/StringInterner.h"
 
 #include <boost/filesystem/fstream.hpp>
 
@@ -252,6 +253,12 @@ SpeciesManager::SpeciesManager() {
         throw std::runtime_error("Attempted to create more than one SpeciesManager.");
     s_instance = this;
     parse::species(GetResourceDir() / "species.txt", m_species);
+    for (std::map<std::string, Species*>::iterator it = m_species.begin(); it != m_species.end(); ++it) {
+        std::size_t name_id = InternString(it->first);
+        if (m_species_by_name_id.size() <= name_id)
+            m_species_by_name_id.resize(name_id + 1, 0);
+        m_species_by_name_id[name_id] = it->second;
+    }
     if (GetOptionsDB().Get<bool>("verbose-logging")) {
         Logger().debugStream() << "Species:";
         for (iterator it = begin(); it != end(); ++it) {
@@ -280,6 +287,12 @@ Species* SpeciesManager::GetSpecies(const std::string& name) {
     return it != m_species.end() ? it->second : 0;
 }
 
+const Species* SpeciesManager::GetSpecies(int name_id) const {
+    if (name_id < 0 || static_cast<std::size_t>(name_id) >= m_species_by_name_id.size())
+        return 0;
+    return m_species_by_name_id[name_id];
+}
+
 int SpeciesManager::GetSpeciesID(const std::string& name) const {
     iterator it = m_species.find(name);
     if (it == m_species.end())
@@ -395,3 +408,6 @@ SpeciesManager& GetSpeciesManager()
 
 const Species* GetSpecies(const std::string& name)
 { return SpeciesManager::GetSpeciesManager().GetSpecies(name); }
+
+const Species* GetSpecies(int name_id)
+{ return SpeciesManager::GetSpeciesManager().GetSpecies(name_id); }
@@ -175,6 +175,11 @@ public:
     const Species*          GetSpecies(const std::string& name) const;
     Species*                GetSpecies(const std::string& name);
 
+    /** returns the species whose name has the interned id \a name_id, as
+      * returned by InternString(), or 0 if there is no such species.  This
+      * avoids looking up names for objects that cache their species' id. */
+    const Species*          GetSpecies(int name_id) const;
+
     /** returns a unique numeric id for reach species, or -1 for an invalid species name. */
     int                     GetSpeciesID(const std::string& name) const;
 
@@ -231,6 +236,7 @@ private:
     std::map<std::string, std::set<int> >   GetSpeciesHomeworldsMap(int encoding_empire = ALL_EMPIRES) const;
 
     std::map<std::string, Species*> m_species;
+    std::vector<Species*>           m_species_by_name_id;   ///< species indexed by the interned ids of their names, or 0 for ids of other strings
 
     static SpeciesManager* s_instance;
 
@@ -246,4 +252,8 @@ FO_COMMON_API SpeciesManager& GetSpeciesManager();
   * If no such Species exists, 0 is returned instead. */
 FO_COMMON_API const Species* GetSpecies(const std::string& name);
 
+/** Returns the Species object whose name has interned id \a name_id.  If no
+  * such Species exists, 0 is returned instead. */
+FO_COMMON_API const Species* GetSpecies(int name_id);
+
 #endif // _Species_h_
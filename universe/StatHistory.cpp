@@ -0,0 +1,225 @@
+#include "StatHistory.h"
+
+#include "../util/AppInterface.h"
+
+#include <algorithm>
+#include <limits>
+
+/////////////////////////////////////////////
+// class StatColumn
+/////////////////////////////////////////////
+const float StatColumn::MISSING_VALUE = -std::numeric_limits<float>::max();
+
+StatColumn::StatColumn() :
+    m_downsampled_first_turn(INVALID_GAME_TURN),
+    m_stride(1),
+    m_downsampled_values(),
+    m_first_turn(INVALID_GAME_TURN),
+    m_values()
+{}
+
+bool StatColumn::Empty() const
+{ return m_values.empty() && m_downsampled_values.empty(); }
+
+int StatColumn::FirstTurn() const {
+    if (!m_downsampled_values.empty())
+        return m_downsampled_first_turn;
+    if (!m_values.empty())
+        return m_first_turn;
+    return INVALID_GAME_TURN;
+}
+
+int StatColumn::LastTurn() const {
+    if (!m_values.empty())
+        return m_first_turn + static_cast<int>(m_values.size()) - 1;
+    if (!m_downsampled_values.empty())
+        return m_downsampled_first_turn + (static_cast<int>(m_downsampled_values.size()) - 1) * m_stride;
+    return INVALID_GAME_TURN;
+}
+
+int StatColumn::FirstFullResolutionTurn() const
+{ return m_first_turn; }
+
+int StatColumn::Stride() const
+{ return m_stride; }
+
+float StatColumn::Value(int turn) const {
+    if (!m_values.empty() && turn >= m_first_turn) {
+        std::size_t index = turn - m_first_turn;
+        return index < m_values.size() ? m_values[index] : MISSING_VALUE;
+    }
+    if (!m_downsampled_values.empty() && turn >= m_downsampled_first_turn &&
+        (turn - m_downsampled_first_turn) % m_stride == 0)
+    {
+        std::size_t index = (turn - m_downsampled_first_turn) / m_stride;
+        return index < m_downsampled_values.size() ? m_downsampled_values[index] : MISSING_VALUE;
+    }
+    return MISSING_VALUE;
+}
+
+void StatColumn::GetPoints(std::vector<std::pair<double, double> >& points) const {
+    points.reserve(points.size() + m_downsampled_values.size() + m_values.size());
+    for (std::size_t i = 0; i < m_downsampled_values.size(); ++i) {
+        if (m_downsampled_values[i] != MISSING_VALUE)
+            points.push_back(std::make_pair(m_downsampled_first_turn + static_cast<double>(i * m_stride),
+                                            static_cast<double>(m_downsampled_values[i])));
+    }
+    for (std::size_t i = 0; i < m_values.size(); ++i) {
+        if (m_values[i] != MISSING_VALUE)
+            points.push_back(std::make_pair(m_first_turn + static_cast<double>(i),
+                                            static_cast<double>(m_values[i])));
+    }
+}
+
+void StatColumn::GetValuesFrom(int first_turn, std::vector<float>& values) const {
+    if (m_values.empty())
+        return;
+    int last_turn = m_first_turn + static_cast<int>(m_values.size()) - 1;
+    for (int turn = first_turn; turn <= last_turn; ++turn)
+        values.push_back(turn < m_first_turn ? MISSING_VALUE : m_values[turn - m_first_turn]);
+}
+
+void StatColumn::SetValue(int turn, float value) {
+    if (Empty()) {
+        m_first_turn = turn;
+        m_values.push_back(value);
+        return;
+    }
+
+    if (turn < m_first_turn) {
+        if (!m_downsampled_values.empty())
+            return;
+        m_values.insert(m_values.begin(), m_first_turn - turn, MISSING_VALUE);
+        m_first_turn = turn;
+    }
+
+    std::size_t index = turn - m_first_turn;
+    if (index >= m_values.size())
+        m_values.resize(index + 1, MISSING_VALUE);
+    m_values[index] = value;
+}
+
+void StatColumn::Truncate(int turn) {
+    if (Empty())
+        return;
+
+    if (turn > m_first_turn) {
+        std::size_t size = turn - m_first_turn;
+        if (size < m_values.size())
+            m_values.resize(size);
+        return;
+    }
+
+    m_values.clear();
+    if (m_downsampled_values.empty() || turn <= m_downsampled_first_turn) {
+        m_downsampled_values.clear();
+        m_downsampled_first_turn = INVALID_GAME_TURN;
+        m_first_turn = INVALID_GAME_TURN;
+        return;
+    }
+
+    // keep the downsampled turns before turn; the full resolution column
+    // then starts where the next downsampled value would have been
+    std::size_t size = (turn - m_downsampled_first_turn + m_stride - 1) / m_stride;
+    if (size < m_downsampled_values.size())
+        m_downsampled_values.resize(size);
+    m_first_turn = m_downsampled_first_turn + static_cast<int>(m_downsampled_values.size()) * m_stride;
+}
+
+void StatColumn::Downsample(int full_resolution_turns, int stride) {
+    if (full_resolution_turns <= 0)
+        return;
+    if (m_downsampled_values.empty())
+        m_stride = std::max(1, stride);
+    if (m_values.size() < static_cast<std::size_t>(full_resolution_turns + m_stride))
+        return;
+
+    if (m_downsampled_values.empty())
+        m_downsampled_first_turn = m_first_turn;
+
+    // move whole strides, so that the full resolution column still starts
+    // one stride after the last downsampled value
+    std::size_t num_moved = (m_values.size() - full_resolution_turns) / m_stride;
+    for (std::size_t i = 0; i < num_moved; ++i)
+        m_downsampled_values.push_back(m_values[i * m_stride]);
+    m_values.erase(m_values.begin(), m_values.begin() + num_moved * m_stride);
+    m_first_turn += static_cast<int>(num_moved) * m_stride;
+}
+
+
+/////////////////////////////////////////////
+// class StatHistory
+/////////////////////////////////////////////
+StatHistory::StatHistory() :
+    m_columns(),
+    m_last_turn(INVALID_GAME_TURN),
+    m_full_resolution_turns(0),
+    m_downsample_stride(1)
+{}
+
+void StatHistory::GetRowsFrom(int first_turn, RowMap& rows) const {
+    rows.clear();
+    for (StatColumnMap::const_iterator stat_it = m_columns.begin(); stat_it != m_columns.end(); ++stat_it) {
+        for (EmpireColumnMap::const_iterator empire_it = stat_it->second.begin();
+             empire_it != stat_it->second.end(); ++empire_it)
+        {
+            if (empire_it->second.LastTurn() == INVALID_GAME_TURN || empire_it->second.LastTurn() < first_turn)
+                continue;
+            empire_it->second.GetValuesFrom(first_turn, rows[stat_it->first][empire_it->first]);
+        }
+    }
+}
+
+void StatHistory::Clear() {
+    m_columns.clear();
+    m_last_turn = INVALID_GAME_TURN;
+}
+
+void StatHistory::SetDownsampling(int full_resolution_turns, int stride) {
+    m_full_resolution_turns = std::max(0, full_resolution_turns);
+    m_downsample_stride = std::max(1, stride);
+}
+
+void StatHistory::SetValue(const std::string& stat_name, int empire_id, int turn, float value) {
+    m_columns[stat_name][empire_id].SetValue(turn, value);
+    if (m_last_turn == INVALID_GAME_TURN || turn > m_last_turn)
+        m_last_turn = turn;
+}
+
+void StatHistory::SetRowsFrom(int first_turn, const RowMap& rows) {
+    m_last_turn = INVALID_GAME_TURN;
+    for (StatColumnMap::iterator stat_it = m_columns.begin(); stat_it != m_columns.end(); ++stat_it) {
+        for (EmpireColumnMap::iterator empire_it = stat_it->second.begin();
+             empire_it != stat_it->second.end(); ++empire_it)
+        {
+            empire_it->second.Truncate(first_turn);
+            int last_turn = empire_it->second.LastTurn();
+            if (last_turn != INVALID_GAME_TURN && (m_last_turn == INVALID_GAME_TURN || last_turn > m_last_turn))
+                m_last_turn = last_turn;
+        }
+    }
+
+    for (RowMap::const_iterator stat_it = rows.begin(); stat_it != rows.end(); ++stat_it) {
+        for (std::map<int, std::vector<float> >::const_iterator empire_it = stat_it->second.begin();
+             empire_it != stat_it->second.end(); ++empire_it)
+        {
+            const std::vector<float>& values = empire_it->second;
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                if (values[i] != StatColumn::MISSING_VALUE)
+                    SetValue(stat_it->first, empire_it->first, first_turn + static_cast<int>(i), values[i]);
+            }
+        }
+    }
+
+    Downsample();
+}
+
+void StatHistory::Downsample() {
+    if (m_full_resolution_turns <= 0)
+        return;
+    for (StatColumnMap::iterator stat_it = m_columns.begin(); stat_it != m_columns.end(); ++stat_it) {
+        for (EmpireColumnMap::iterator empire_it = stat_it->second.begin();
+             empire_it != stat_it->second.end(); ++empire_it)
+        { empire_it->second.Downsample(m_full_resolution_turns, m_downsample_stride); }
+    }
+}
@@ -0,0 +1,138 @@
+// -*- C++ -*-
+#ifndef _StatHistory_h_
+#define _StatHistory_h_
+
+#include <boost/serialization/access.hpp>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../util/Export.h"
+
+/** The values of one statistic for one empire, with one value per turn.  The
+  * most recent turns are stored at full resolution in a dense column that
+  * starts at FirstFullResolutionTurn().  Older turns may be downsampled by
+  * Downsample(), after which only every Stride()-th turn of them is kept, in
+  * a second dense column that ends just before the full resolution turns.
+  * Turns for which the statistic couldn't be evaluated are stored as
+  * MISSING_VALUE, and are omitted from the results of GetPoints(). */
+class FO_COMMON_API StatColumn {
+public:
+    /** \name Structors */ //@{
+    StatColumn();
+    //@}
+
+    /** \name Accessors */ //@{
+    bool    Empty() const;
+    int     FirstTurn() const;                  ///< returns the first turn with a stored value, or INVALID_GAME_TURN if there are none
+    int     LastTurn() const;                   ///< returns the last turn with a stored value, or INVALID_GAME_TURN if there are none
+    int     FirstFullResolutionTurn() const;    ///< returns the turn of the first value in the full resolution column
+    int     Stride() const;                     ///< returns the number of turns between downsampled values
+
+    /** Returns the value stored for turn \a turn, or MISSING_VALUE if no
+      * value is stored for that turn. */
+    float   Value(int turn) const;
+
+    /** Appends (turn, value) pairs to \a points for each stored turn that has
+      * a value, in order of increasing turn. */
+    void    GetPoints(std::vector<std::pair<double, double> >& points) const;
+
+    /** Appends the full resolution values for turns \a first_turn and later
+      * to \a values.  Turns before FirstFullResolutionTurn() are stored as
+      * MISSING_VALUE. */
+    void    GetValuesFrom(int first_turn, std::vector<float>& values) const;
+    //@}
+
+    /** \name Mutators */ //@{
+    /** Stores \a value for turn \a turn.  Turns between the current last
+      * turn and \a turn are stored as MISSING_VALUE.  Values for downsampled
+      * turns can't be changed, so are ignored. */
+    void    SetValue(int turn, float value);
+
+    /** Removes the values for turns \a turn and later. */
+    void    Truncate(int turn);
+
+    /** Moves all but the most recent \a full_resolution_turns turns from the
+      * full resolution column to the downsampled column, keeping only every
+      * \a stride -th turn of them.  The stride of a column can't be changed
+      * once it has downsampled values. */
+    void    Downsample(int full_resolution_turns, int stride);
+    //@}
+
+    static const float MISSING_VALUE;
+
+private:
+    int                 m_downsampled_first_turn;
+    int                 m_stride;
+    std::vector<float>  m_downsampled_values;
+    int                 m_first_turn;
+    std::vector<float>  m_values;
+
+    friend class boost::serialization::access;
+    template <class Archive>
+    void serialize(Archive& ar, const unsigned int version);
+};
+
+/** The history of all empire statistics over the course of a game, stored as
+  * one StatColumn per statistic and empire.  If the number of full resolution
+  * turns is nonzero, each column is downsampled after new values are set so
+  * that at most that many recent turns are kept at full resolution.
+  *
+  * To update a client, only the values set since its last update need to be
+  * sent: GetRowsFrom() gets the values of each column from a turn on, and
+  * SetRowsFrom() replaces the values of those turns. */
+class FO_COMMON_API StatHistory {
+public:
+    typedef std::map<int, StatColumn>                                   EmpireColumnMap;    ///< columns of a statistic, indexed by empire id
+    typedef std::map<std::string, EmpireColumnMap>                      StatColumnMap;      ///< columns indexed by statistic name
+    typedef std::map<std::string, std::map<int, std::vector<float> > >  RowMap;             ///< values from a turn on, indexed by statistic name and empire id
+
+    /** \name Structors */ //@{
+    StatHistory();
+    //@}
+
+    /** \name Accessors */ //@{
+    const StatColumnMap&    Columns() const { return m_columns; }
+    int                     LastTurn() const { return m_last_turn; }    ///< returns the most recent turn for which values were set, or INVALID_GAME_TURN if none were
+    int                     FullResolutionTurns() const { return m_full_resolution_turns; }
+    int                     DownsampleStride() const { return m_downsample_stride; }
+
+    /** Fills \a rows with the full resolution values of each column for turns
+      * \a first_turn and later. */
+    void                    GetRowsFrom(int first_turn, RowMap& rows) const;
+    //@}
+
+    /** \name Mutators */ //@{
+    void    Clear();
+
+    /** Sets the number of most recent turns kept at full resolution, or 0 to
+      * keep all turns at full resolution, and the stride with which older
+      * turns are downsampled. */
+    void    SetDownsampling(int full_resolution_turns, int stride);
+
+    /** Stores \a value for statistic \a stat_name of empire \a empire_id on
+      * turn \a turn. */
+    void    SetValue(const std::string& stat_name, int empire_id, int turn, float value);
+
+    /** Replaces the values of each column for turns \a first_turn and later
+      * with \a rows, as obtained from GetRowsFrom(). */
+    void    SetRowsFrom(int first_turn, const RowMap& rows);
+
+    /** Downsamples all columns according to the current settings. */
+    void    Downsample();
+    //@}
+
+private:
+    StatColumnMap   m_columns;
+    int             m_last_turn;
+    int             m_full_resolution_turns;
+    int             m_downsample_stride;
+
+    friend class boost::serialization::access;
+    template <class Archive>
+    void serialize(Archive& ar, const unsigned int version);
+};
+
+#endif // _StatHistory_h_
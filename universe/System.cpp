@@ -185,6 +185,25 @@ void System::Copy(TemporaryPtr<const UniverseObject> copied_object, int empire_i
     }
 }
 
+bool System::UpdateState(const UniverseObject& updated_object) {
+    const System& updated_system = dynamic_cast<const System&>(updated_object);
+    bool changed = UniverseObject::UpdateState(updated_object);
+    changed |= UpdateMember(m_star,                     updated_system.m_star);
+    changed |= UpdateMember(m_orbits,                   updated_system.m_orbits);
+    changed |= UpdateMember(m_objects,                  updated_system.m_objects);
+    changed |= UpdateMember(m_planets,                  updated_system.m_planets);
+    changed |= UpdateMember(m_buildings,                updated_system.m_buildings);
+    changed |= UpdateMember(m_fleets,                   updated_system.m_fleets);
+    changed |= UpdateMember(m_ships,                    updated_system.m_ships);
+    changed |= UpdateMember(m_fields,                   updated_system.m_fields);
+    changed |= UpdateMember(m_starlanes_wormholes,      updated_system.m_starlanes_wormholes);
+    changed |= UpdateMember(m_last_turn_battle_here,    updated_system.m_last_turn_battle_here);
+    // not serialized, so reset as on a deserialized system until effects set them again
+    changed |= UpdateMember(m_overlay_texture,          updated_system.m_overlay_texture);
+    changed |= UpdateMember(m_overlay_size,             updated_system.m_overlay_size);
+    return changed;
+}
+
 UniverseObjectType System::ObjectType() const
 { return OBJ_SYSTEM; }
 
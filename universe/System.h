@@ -140,6 +140,8 @@ protected:
     virtual System*         Clone(int empire_id = ALL_EMPIRES) const;   ///< returns new copy of this System
     //@}
 
+    virtual bool            UpdateState(const UniverseObject& updated_object);
+
 private:
     StarType            m_star;
     std::vector<int>    m_orbits;                   ///< indexed by orbit number, indicates the id of the planet in that orbit
@@ -7,6 +7,7 @@
 #include "../util/OptionsDB.h"
 #include "../util/Directories.h"
 #include "../util/Logger.h"
+#include "../util/StringInterner.h"
 #include "../Empire/Empire.h"
 #include "../Empire/EmpireManager.h"
 #include "ValueRef.h"
@@ -375,6 +376,8 @@ TechManager::TechManager() {
     if (!redundant_dependency.empty())
         Logger().errorStream() << redundant_dependency;
 
+    BuildTechGraph();
+
 #ifdef OUTPUT_TECH_LIST
     for (iterator it = begin(); it != end(); ++it) {
         const Tech* tech = *it;
@@ -524,6 +527,33 @@ void TechManager::AllChildren(const Tech* tech, std::map<std::string, std::strin
     }
 }
 
+void TechManager::BuildTechGraph() {
+    m_techs_by_index.assign(begin(), end());
+
+    m_tech_name_ids.clear();
+    m_tech_indices_by_name_id.clear();
+    for (std::size_t i = 0; i < m_techs_by_index.size(); ++i) {
+        int name_id = InternString(m_techs_by_index[i]->Name());
+        m_tech_name_ids.push_back(name_id);
+        if (m_tech_indices_by_name_id.size() <= static_cast<std::size_t>(name_id))
+            m_tech_indices_by_name_id.resize(name_id + 1, -1);
+        m_tech_indices_by_name_id[name_id] = static_cast<int>(i);
+    }
+
+    m_prerequisite_sets.assign(m_techs_by_index.size(), boost::dynamic_bitset<>(m_techs_by_index.size()));
+    m_unlocked_tech_indices.assign(m_techs_by_index.size(), std::vector<int>());
+    for (std::size_t i = 0; i < m_techs_by_index.size(); ++i) {
+        const std::set<std::string>& prereqs = m_techs_by_index[i]->Prerequisites();
+        for (std::set<std::string>::const_iterator prereq_it = prereqs.begin(); prereq_it != prereqs.end(); ++prereq_it) {
+            int prereq_index = TechIndex(*prereq_it);
+            if (prereq_index == -1)
+                continue;   // FindIllegalDependencies would have thrown
+            m_prerequisite_sets[i].set(prereq_index);
+            m_unlocked_tech_indices[prereq_index].push_back(static_cast<int>(i));
+        }
+    }
+}
+
 TechManager& TechManager::GetTechManager() {
     static TechManager manager;
     return manager;
@@ -570,6 +600,30 @@ std::vector<std::string> TechManager::RecursivePrereqs(const std::string& tech_n
     return retval;
 }
 
+std::size_t TechManager::NumTechs() const
+{ return m_techs_by_index.size(); }
+
+int TechManager::TechIndex(const std::string& name) const
+{ return TechIndex(FindInternedString(name)); }
+
+int TechManager::TechIndex(int name_id) const {
+    if (name_id < 0 || static_cast<std::size_t>(name_id) >= m_tech_indices_by_name_id.size())
+        return -1;
+    return m_tech_indices_by_name_id[name_id];
+}
+
+const Tech* TechManager::TechAt(int tech_index) const
+{ return m_techs_by_index.at(tech_index); }
+
+int TechManager::TechNameID(int tech_index) const
+{ return m_tech_name_ids.at(tech_index); }
+
+const boost::dynamic_bitset<>& TechManager::PrerequisiteSet(int tech_index) const
+{ return m_prerequisite_sets.at(tech_index); }
+
+const std::vector<int>& TechManager::UnlockedTechIndices(int tech_index) const
+{ return m_unlocked_tech_indices.at(tech_index); }
+
 ///////////////////////////////////////////////////////////
 // Free Functions                                        //
 ///////////////////////////////////////////////////////////
@@ -7,6 +7,7 @@
 #include "Enums.h"
 #include "../util/Export.h"
 
+#include <boost/dynamic_bitset.hpp>
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/key_extractors.hpp>
 #include <boost/multi_index/ordered_index.hpp>
@@ -263,6 +264,33 @@ public:
     /** Returns names of indicated tech's prerequisites, and all prereqs of
       * those techs, etc. recursively. */
     std::vector<std::string>        RecursivePrereqs(const std::string& tech_name, int empire_id) const;
+
+    /** returns the number of techs.  Each tech has an index from 0 to
+      * NumTechs() - 1, in order of name, so per-tech data can be stored in
+      * vectors and bitsets instead of being looked up by name. */
+    std::size_t                     NumTechs() const;
+
+    /** returns the index of the tech with the name \a name, or -1 if there
+      * is no such tech */
+    int                             TechIndex(const std::string& name) const;
+
+    /** returns the index of the tech whose name has interned id \a name_id,
+      * or -1 if there is no such tech */
+    int                             TechIndex(int name_id) const;
+
+    /** returns the tech with index \a tech_index */
+    const Tech*                     TechAt(int tech_index) const;
+
+    /** returns the interned id of the name of the tech with index \a tech_index */
+    int                             TechNameID(int tech_index) const;
+
+    /** returns the set of indices of the prerequisites of the tech with index
+      * \a tech_index */
+    const boost::dynamic_bitset<>&  PrerequisiteSet(int tech_index) const;
+
+    /** returns the indices of the techs that have the tech with index
+      * \a tech_index as a prerequisite */
+    const std::vector<int>&         UnlockedTechIndices(int tech_index) const;
     //@}
 
     /** returns the instance of this singleton class; you should use the free function GetTechManager() instead */
@@ -286,9 +314,19 @@ private:
 
     void AllChildren(const Tech* tech, std::map<std::string, std::string>& children);
 
+    /** indexes the loaded techs and records their prerequisites and unlocked
+      * techs by index */
+    void BuildTechGraph();
+
     std::map<std::string, TechCategory*>    m_categories;
     TechContainer                           m_techs;
 
+    std::vector<const Tech*>                m_techs_by_index;
+    std::vector<int>                        m_tech_name_ids;            ///< interned ids of tech names, by tech index
+    std::vector<int>                        m_tech_indices_by_name_id;  ///< tech indices by interned name id, or -1 for ids of other strings
+    std::vector<boost::dynamic_bitset<> >   m_prerequisite_sets;        ///< prerequisite tech indices, by tech index
+    std::vector<std::vector<int> >          m_unlocked_tech_indices;    ///< indices of unlocked techs, by tech index
+
     static TechManager*                     s_instance;
 };
 
@@ -6,8 +6,10 @@
 #include "../util/i18n.h"
 #include "../util/Logger.h"
 #include "../util/Random.h"
+#include "../util/Profiler.h"
 #include "../util/RunQueue.h"
 #include "../util/ScopedTimer.h"
+#include "../util/StringInterner.h"
 #include "../parse/Parse.h"
 #include "../Empire/Empire.h"
 #include "../Empire/EmpireManager.h"
@@ -44,6 +46,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <list>
 #include <stdexcept>
 
@@ -54,9 +57,44 @@ namespace {
     void AddOptions(OptionsDB& db) {
         db.Add("verbose-logging",   UserStringNop("OPTIONS_DB_VERBOSE_LOGGING_DESC"),   false,  Validator<bool>());
         db.Add("effects-threads",   UserStringNop("OPTIONS_DB_EFFECTS_THREADS_DESC"),   8,      RangedValidator<int>(1, 32));
+        db.Add("pathing-threads",   UserStringNop("OPTIONS_DB_PATHING_THREADS_DESC"),   4,      RangedValidator<int>(1, 32));
+        db.Add("stat-history-full-resolution-turns",    UserStringNop("OPTIONS_DB_STAT_HISTORY_FULL_RESOLUTION_TURNS_DESC"),    0,  RangedValidator<int>(0, 100000));
+        db.Add("stat-history-downsample-stride",        UserStringNop("OPTIONS_DB_STAT_HISTORY_DOWNSAMPLE_STRIDE_DESC"),        5,  RangedValidator<int>(1, 1000));
     }
     bool temp_bool = RegisterOptions(&AddOptions);
 
+    // options read during turn processing, including by worker threads
+    OptionHandle<bool>  verbose_logging("verbose-logging");
+    OptionHandle<int>   effects_threads("effects-threads");
+    OptionHandle<int>   pathing_threads("pathing-threads");
+
+    /** Runs and deletes each of \a work_items, on up to as many threads as
+      * the effects-threads option allows. */
+    template <class WorkItem>
+    void RunWorkItems(const std::vector<WorkItem*>& work_items) {
+        if (work_items.empty())
+            return;
+
+        // not worth starting threads for a single work item
+        unsigned int num_threads = static_cast<unsigned int>(std::max(1, effects_threads.Get()));
+        if (num_threads <= 1 || work_items.size() == 1) {
+            for (std::size_t i = 0; i < work_items.size(); ++i) {
+                (*work_items[i])();
+                delete work_items[i];
+            }
+            return;
+        }
+
+        RunQueue<WorkItem> run_queue(std::min<unsigned int>(num_threads, work_items.size()));
+        boost::shared_mutex wait_mutex;
+        boost::unique_lock<boost::shared_mutex> wait_lock(wait_mutex); // create after run_queue, destroy before run_queue
+
+        for (std::size_t i = 0; i < work_items.size(); ++i)
+            run_queue.AddWork(work_items[i]);
+
+        run_queue.Wait(wait_lock);
+    }
+
     const double    OFFROAD_SLOWDOWN_FACTOR = 1000000000.0; // the factor by which non-starlane travel is slower than starlane travel
     const double    WORMHOLE_TRAVEL_DISTANCE = 0.1;         // the effective distance for ships travelling along a wormhole, for determining how much of their speed is consumed by the jump
 
@@ -329,6 +367,196 @@ namespace SystemPathing {
         { retval.insert(std::make_pair(edge_weight_map[*it], sys_id_property_map[boost::target(*it, graph)])); }
         return retval;
     }
+
+    /** Fills \a distances, indexed by graph index, with the shortest travel
+      * distance along the edges of \a graph from the vertex with index
+      * \a system_index to every vertex.  Vertices that can't be reached are
+      * given distance -1.0 */
+    template <class Graph>
+    void ShortestPathDistancesImpl(const Graph& graph, size_t system_index, std::vector<double>& distances)
+    {
+        typedef typename boost::property_map<Graph, boost::vertex_index_t>::const_type  ConstIndexPropertyMap;
+        typedef typename boost::property_map<Graph, boost::edge_weight_t>::const_type   ConstEdgeWeightPropertyMap;
+
+        const double UNREACHABLE = std::numeric_limits<double>::max();
+
+        std::vector<int> predecessors(boost::num_vertices(graph));
+        distances.assign(boost::num_vertices(graph), UNREACHABLE);
+
+        ConstIndexPropertyMap index_map = boost::get(boost::vertex_index, graph);
+        ConstEdgeWeightPropertyMap edge_weight_map = boost::get(boost::edge_weight, graph);
+
+        // no short-circuiting visitor: all destinations are wanted
+        boost::dijkstra_shortest_paths(graph, system_index, &predecessors[0], &distances[0], edge_weight_map, index_map,
+                                       std::less<double>(), std::plus<double>(), UNREACHABLE, 0.0,
+                                       boost::make_dijkstra_visitor(boost::null_visitor()));
+
+        for (std::vector<double>::iterator it = distances.begin(); it != distances.end(); ++it)
+            if (*it == UNREACHABLE)
+                *it = -1.0;
+    }
+
+    /** Fills \a jumps, indexed by graph index, with the number of edges on
+      * the path with the fewest jumps from the vertex with index
+      * \a system_index to every vertex.  Vertices that can't be reached are
+      * given -1 jumps. */
+    template <class Graph>
+    void LeastJumpsDistancesImpl(const Graph& graph, size_t system_index, std::vector<int>& jumps)
+    {
+        typedef boost::iterator_property_map<std::vector<int>::iterator, boost::identity_property_map> DistancePropertyMap;
+
+        jumps.assign(boost::num_vertices(graph), INT_MAX);
+        jumps[system_index] = 0;
+
+        DistancePropertyMap distance_property_map(jumps.begin());
+        boost::distance_recorder<DistancePropertyMap, boost::on_tree_edge> distance_recorder(distance_property_map);
+
+        boost::queue<int> buf;
+        std::vector<int> colors(boost::num_vertices(graph));
+        boost::breadth_first_search(graph, system_index, buf, boost::make_bfs_visitor(distance_recorder), &colors[0]);
+
+        for (std::vector<int>::iterator it = jumps.begin(); it != jumps.end(); ++it)
+            if (*it == INT_MAX)
+                *it = -1;
+    }
+
+    /** Dijkstra visitor that records, in order of increasing distance, the
+      * systems for which a predicate is true, and stops the search once
+      * enough of them have been found. */
+    template <class SystemIDPropertyMap>
+    struct NearestMatchingSystemsVisitor : public boost::base_visitor<NearestMatchingSystemsVisitor<SystemIDPropertyMap> >
+    {
+        typedef boost::on_finish_vertex event_filter;
+
+        struct FoundEnough {};  // exception type thrown when enough matches are found
+
+        NearestMatchingSystemsVisitor(const SystemIDPropertyMap& sys_id_property_map, const double* distances,
+                                      const boost::function<bool (int)>& predicate, unsigned int count,
+                                      std::vector<std::pair<int, double> >* matches) :
+            m_sys_id_property_map(sys_id_property_map),
+            m_distances(distances),
+            m_predicate(&predicate),
+            m_count(count),
+            m_matches(matches)
+        {}
+
+        template <class Vertex, class Graph>
+        void operator()(Vertex u, Graph& g)
+        {
+            // vertices are finished in order of increasing distance, so
+            // matches are found nearest first
+            int system_id = m_sys_id_property_map[u];
+            if (!(*m_predicate)(system_id))
+                return;
+            m_matches->push_back(std::make_pair(system_id, m_distances[static_cast<int>(u)]));
+            if (m_matches->size() >= m_count)
+                throw FoundEnough();
+        }
+
+        SystemIDPropertyMap                     m_sys_id_property_map;
+        const double*                           m_distances;
+        const boost::function<bool (int)>*      m_predicate;
+        unsigned int                            m_count;
+        std::vector<std::pair<int, double> >*   m_matches;
+    };
+
+    /** Returns up to \a count of the systems nearest to the vertex with index
+      * \a system_index in \a graph for which \a predicate is true, and their
+      * distances, nearest first.  The search stops as soon as \a count
+      * matches have been found. */
+    template <class Graph>
+    std::vector<std::pair<int, double> > NearestSystemsImpl(const Graph& graph, size_t system_index,
+                                                            const boost::function<bool (int)>& predicate,
+                                                            unsigned int count)
+    {
+        typedef typename boost::property_map<Graph, vertex_system_id_t>::const_type     ConstSystemIDPropertyMap;
+        typedef typename boost::property_map<Graph, boost::vertex_index_t>::const_type  ConstIndexPropertyMap;
+        typedef typename boost::property_map<Graph, boost::edge_weight_t>::const_type   ConstEdgeWeightPropertyMap;
+        typedef NearestMatchingSystemsVisitor<ConstSystemIDPropertyMap>                 Visitor;
+
+        std::vector<std::pair<int, double> > retval;
+        if (count == 0 || !predicate)
+            return retval;
+
+        std::vector<int> predecessors(boost::num_vertices(graph));
+        std::vector<double> distances(boost::num_vertices(graph));
+
+        ConstSystemIDPropertyMap sys_id_property_map = boost::get(vertex_system_id_t(), graph);
+        ConstIndexPropertyMap index_map = boost::get(boost::vertex_index, graph);
+        ConstEdgeWeightPropertyMap edge_weight_map = boost::get(boost::edge_weight, graph);
+
+        try {
+            boost::dijkstra_shortest_paths(graph, system_index, &predecessors[0], &distances[0], edge_weight_map, index_map,
+                                           std::less<double>(), std::plus<double>(), std::numeric_limits<double>::max(), 0.0,
+                                           boost::make_dijkstra_visitor(Visitor(sys_id_property_map, &distances[0],
+                                                                                predicate, count, &retval)));
+        } catch (const typename Visitor::FoundEnough&) {
+            // catching this just means that enough matches were found, and so the algorithm was exited early, via exception
+        }
+
+        return retval;
+    }
+
+    /** Computes one row of a shortest path distance matrix: the distances from
+      * one source vertex to each of a list of destination vertices. */
+    template <class Graph>
+    class ShortestPathDistancesWorkItem {
+    public:
+        ShortestPathDistancesWorkItem(const Graph& graph, size_t source_index,
+                                      const std::vector<size_t>& destination_indices,
+                                      std::vector<double>::iterator row) :
+            m_graph(graph),
+            m_source_index(source_index),
+            m_destination_indices(destination_indices),
+            m_row(row)
+        {}
+
+        void operator ()() {
+            std::vector<double> distances;
+            ShortestPathDistancesImpl(m_graph, m_source_index, distances);
+            for (std::size_t i = 0; i < m_destination_indices.size(); ++i)
+                *(m_row + i) = distances[m_destination_indices[i]];
+        }
+
+    private:
+        const Graph&                    m_graph;
+        size_t                          m_source_index;
+        const std::vector<size_t>&      m_destination_indices;
+        std::vector<double>::iterator   m_row;  // each work item writes a separate row, so no locking is needed
+    };
+
+    /** Fills \a matrix (which must be presized to the number of sources times
+      * the number of destinations) in row-major order with the shortest path
+      * distances from each of \a source_indices to each of
+      * \a destination_indices, with one search per source.  The searches are
+      * run on up to \a num_threads threads. */
+    template <class Graph>
+    void ShortestPathDistanceMatrixImpl(const Graph& graph, const std::vector<size_t>& source_indices,
+                                        const std::vector<size_t>& destination_indices,
+                                        unsigned int num_threads, std::vector<double>& matrix)
+    {
+        typedef ShortestPathDistancesWorkItem<Graph> WorkItem;
+
+        if (source_indices.empty() || destination_indices.empty())
+            return;
+
+        // not worth starting threads for a single search
+        if (num_threads <= 1 || source_indices.size() == 1) {
+            for (std::size_t i = 0; i < source_indices.size(); ++i)
+                WorkItem(graph, source_indices[i], destination_indices, matrix.begin() + i * destination_indices.size())();
+            return;
+        }
+
+        RunQueue<WorkItem> run_queue(std::min<unsigned int>(num_threads, source_indices.size()));
+        boost::shared_mutex wait_mutex;
+        boost::unique_lock<boost::shared_mutex> wait_lock(wait_mutex); // create after run_queue, destroy before run_queue
+
+        for (std::size_t i = 0; i < source_indices.size(); ++i)
+            run_queue.AddWork(new WorkItem(graph, source_indices[i], destination_indices,
+                                           matrix.begin() + i * destination_indices.size()));
+
+        run_queue.Wait(wait_lock);
+    }
 }
 using namespace SystemPathing;  // to keep GCC 4.2 on OSX happy
 
@@ -428,12 +656,19 @@ namespace EmpireStatistics {
 /////////////////////////////////////////////
 Universe::Universe() :
     m_graph_impl(new GraphImpl),
+    m_system_graph_current(false),
+    m_system_graph_empire_id(ALL_EMPIRES),
     m_last_allocated_object_id(-1), // this is conicidentally equal to INVALID_OBJECT_ID as of this writing, but the reason for this to be -1 is so that the first object has id 0, and all object ids are non-negative
     m_last_allocated_design_id(-1), // same, but for ShipDesign::INVALID_DESIGN_ID
     m_universe_width(1000.0),
     m_inhibit_universe_object_signals(false),
+    m_batch_universe_object_signals(false),
+    m_universe_object_signal_batch_depth(0),
+    m_update_objects_in_place(false),
     m_encoding_empire(ALL_EMPIRES),
-    m_all_objects_visible(false)
+    m_all_objects_visible(false),
+    m_stat_history(),
+    m_stat_history_encoding_turn(INVALID_GAME_TURN)
 {}
 
 Universe::~Universe() {
@@ -455,11 +690,11 @@ void Universe::Clear() {
     m_destroyed_object_ids.clear();
 
     m_empire_object_visibility.clear();
-    m_empire_object_visibility_turns.clear();
 
     m_empire_object_visible_specials.clear();
 
     m_system_id_to_graph_index.clear();
+    m_system_graph_current = false;
     m_effect_accounting_map.clear();
     m_effect_discrepancy_map.clear();
 
@@ -555,7 +790,7 @@ const ShipDesign* Universe::GetShipDesign(int ship_design_id) const {
 void Universe::RenameShipDesign(int design_id, const std::string& name/* = ""*/, const std::string& description/* = ""*/) {
     ShipDesignMap::iterator design_it = m_ship_designs.find(design_id);
     if (design_it == m_ship_designs.end()) {
-        Logger().debugStream() << "Universe::RenameShipDesign tried to rename a ship design that doesn't exist!";
+        DebugLogger() << "Universe::RenameShipDesign tried to rename a ship design that doesn't exist!";
         return;
     }
     ShipDesign* design = design_it->second;
@@ -592,32 +827,19 @@ Visibility Universe::GetObjectVisibilityByEmpire(int object_id, int empire_id) c
     if (empire_id == ALL_EMPIRES || GetUniverse().AllObjectsVisible())
         return VIS_FULL_VISIBILITY;
 
-    EmpireObjectVisibilityMap::const_iterator empire_it = m_empire_object_visibility.find(empire_id);
+    std::map<int, ObjectVisibilityTable>::const_iterator empire_it = m_empire_object_visibility.find(empire_id);
     if (empire_it == m_empire_object_visibility.end())
         return VIS_NO_VISIBILITY;
 
-    const ObjectVisibilityMap& vis_map = empire_it->second;
-
-    ObjectVisibilityMap::const_iterator vis_map_it = vis_map.find(object_id);
-    if (vis_map_it == vis_map.end())
-        return VIS_NO_VISIBILITY;
-
-    return vis_map_it->second;
+    return empire_it->second.GetVisibility(object_id);
 }
 
-const Universe::VisibilityTurnMap& Universe::GetObjectVisibilityTurnMapByEmpire(int object_id, int empire_id) const {
-    static const std::map<Visibility, int> empty_map;
-
-    EmpireObjectVisibilityTurnMap::const_iterator empire_it = m_empire_object_visibility_turns.find(empire_id);
-    if (empire_it == m_empire_object_visibility_turns.end())
-        return empty_map;
-
-    const ObjectVisibilityTurnMap& obj_vis_turn_map = empire_it->second;
-    ObjectVisibilityTurnMap::const_iterator object_it = obj_vis_turn_map.find(object_id);
-    if (object_it == obj_vis_turn_map.end())
-        return empty_map;
+Universe::VisibilityTurnMap Universe::GetObjectVisibilityTurnMapByEmpire(int object_id, int empire_id) const {
+    std::map<int, ObjectVisibilityTable>::const_iterator empire_it = m_empire_object_visibility.find(empire_id);
+    if (empire_it == m_empire_object_visibility.end())
+        return VisibilityTurnMap();
 
-    return object_it->second;
+    return empire_it->second.VisibilityTurns(object_id);
 }
 
 std::set<std::string> Universe::GetObjectVisibleSpecialsByEmpire(int object_id, int empire_id) const {
@@ -901,6 +1123,130 @@ std::multimap<double, int> Universe::ImmediateNeighbors(int system_id, int empir
     return std::multimap<double, int>();
 }
 
+std::map<int, double> Universe::ShortestPathDistances(int system_id, int empire_id/* = ALL_EMPIRES*/) const {
+    size_t system_index;
+    try {
+        system_index = m_system_id_to_graph_index.at(system_id);
+    } catch (const std::out_of_range&) {
+        Logger().errorStream() << "Universe::ShortestPathDistances passed invalid system id: " << system_id;
+        throw;
+    }
+
+    std::vector<double> distances;
+    if (empire_id == ALL_EMPIRES) {
+        ShortestPathDistancesImpl(m_graph_impl->system_graph, system_index, distances);
+    } else {
+        GraphImpl::EmpireViewSystemGraphMap::const_iterator graph_it =
+            m_graph_impl->empire_system_graph_views.find(empire_id);
+        if (graph_it == m_graph_impl->empire_system_graph_views.end()) {
+            Logger().errorStream() << "Universe::ShortestPathDistances passed unknown empire id: " << empire_id;
+            throw std::out_of_range("Universe::ShortestPathDistances passed unknown empire id");
+        }
+        ShortestPathDistancesImpl(*graph_it->second, system_index, distances);
+    }
+
+    std::map<int, double> retval;
+    const GraphImpl::SystemGraph& system_graph = m_graph_impl->system_graph;
+    GraphImpl::ConstSystemIDPropertyMap sys_id_property_map = boost::get(vertex_system_id_t(), system_graph);
+    for (size_t i = 0; i < distances.size(); ++i)
+        if (distances[i] >= 0.0)
+            retval[sys_id_property_map[i]] = distances[i];
+    return retval;
+}
+
+std::map<int, int> Universe::LeastJumpsDistances(int system_id, int empire_id/* = ALL_EMPIRES*/,
+                                                 int max_jumps/* = INT_MAX*/) const
+{
+    size_t system_index;
+    try {
+        system_index = m_system_id_to_graph_index.at(system_id);
+    } catch (const std::out_of_range&) {
+        Logger().errorStream() << "Universe::LeastJumpsDistances passed invalid system id: " << system_id;
+        throw;
+    }
+
+    std::vector<int> jumps;
+    if (empire_id == ALL_EMPIRES) {
+        LeastJumpsDistancesImpl(m_graph_impl->system_graph, system_index, jumps);
+    } else {
+        GraphImpl::EmpireViewSystemGraphMap::const_iterator graph_it =
+            m_graph_impl->empire_system_graph_views.find(empire_id);
+        if (graph_it == m_graph_impl->empire_system_graph_views.end()) {
+            Logger().errorStream() << "Universe::LeastJumpsDistances passed unknown empire id: " << empire_id;
+            throw std::out_of_range("Universe::LeastJumpsDistances passed unknown empire id");
+        }
+        LeastJumpsDistancesImpl(*graph_it->second, system_index, jumps);
+    }
+
+    std::map<int, int> retval;
+    const GraphImpl::SystemGraph& system_graph = m_graph_impl->system_graph;
+    GraphImpl::ConstSystemIDPropertyMap sys_id_property_map = boost::get(vertex_system_id_t(), system_graph);
+    for (size_t i = 0; i < jumps.size(); ++i)
+        if (jumps[i] >= 0 && jumps[i] <= max_jumps)
+            retval[sys_id_property_map[i]] = jumps[i];
+    return retval;
+}
+
+std::vector<double> Universe::ShortestPathDistanceMatrix(const std::vector<int>& from_system_ids,
+                                                         const std::vector<int>& to_system_ids,
+                                                         int empire_id/* = ALL_EMPIRES*/) const
+{
+    std::vector<size_t> source_indices, destination_indices;
+    source_indices.reserve(from_system_ids.size());
+    destination_indices.reserve(to_system_ids.size());
+    try {
+        for (std::vector<int>::const_iterator it = from_system_ids.begin(); it != from_system_ids.end(); ++it)
+            source_indices.push_back(m_system_id_to_graph_index.at(*it));
+        for (std::vector<int>::const_iterator it = to_system_ids.begin(); it != to_system_ids.end(); ++it)
+            destination_indices.push_back(m_system_id_to_graph_index.at(*it));
+    } catch (const std::out_of_range&) {
+        Logger().errorStream() << "Universe::ShortestPathDistanceMatrix passed invalid system id(s)";
+        throw;
+    }
+
+    std::vector<double> retval(source_indices.size() * destination_indices.size(), -1.0);
+    unsigned int num_threads = static_cast<unsigned int>(std::max(1, pathing_threads.Get()));
+
+    if (empire_id == ALL_EMPIRES) {
+        ShortestPathDistanceMatrixImpl(m_graph_impl->system_graph, source_indices, destination_indices,
+                                       num_threads, retval);
+        return retval;
+    }
+
+    GraphImpl::EmpireViewSystemGraphMap::const_iterator graph_it =
+        m_graph_impl->empire_system_graph_views.find(empire_id);
+    if (graph_it == m_graph_impl->empire_system_graph_views.end()) {
+        Logger().errorStream() << "Universe::ShortestPathDistanceMatrix passed unknown empire id: " << empire_id;
+        throw std::out_of_range("Universe::ShortestPathDistanceMatrix passed unknown empire id");
+    }
+    ShortestPathDistanceMatrixImpl(*graph_it->second, source_indices, destination_indices,
+                                   num_threads, retval);
+    return retval;
+}
+
+std::vector<std::pair<int, double> > Universe::NearestSystems(int system_id, const boost::function<bool (int)>& predicate,
+                                                              unsigned int count, int empire_id/* = ALL_EMPIRES*/) const
+{
+    size_t system_index;
+    try {
+        system_index = m_system_id_to_graph_index.at(system_id);
+    } catch (const std::out_of_range&) {
+        Logger().errorStream() << "Universe::NearestSystems passed invalid system id: " << system_id;
+        throw;
+    }
+
+    if (empire_id == ALL_EMPIRES)
+        return NearestSystemsImpl(m_graph_impl->system_graph, system_index, predicate, count);
+
+    GraphImpl::EmpireViewSystemGraphMap::const_iterator graph_it =
+        m_graph_impl->empire_system_graph_views.find(empire_id);
+    if (graph_it == m_graph_impl->empire_system_graph_views.end()) {
+        Logger().errorStream() << "Universe::NearestSystems passed unknown empire id: " << empire_id;
+        throw std::out_of_range("Universe::NearestSystems passed unknown empire id");
+    }
+    return NearestSystemsImpl(*graph_it->second, system_index, predicate, count);
+}
+
 int Universe::GenerateObjectID() {
     if (m_last_allocated_object_id + 1 < MAX_ID)
         return ++m_last_allocated_object_id;
@@ -943,7 +1289,7 @@ TemporaryPtr<T> Universe::InsertID(T* obj, int id) {
     TemporaryPtr<T> result = m_objects.Insert(obj);
     if (id > m_last_allocated_object_id )
         m_last_allocated_object_id = id;
-    Logger().debugStream() << "Inserting object with id " << id;
+    DebugLogger() << "Inserting object with id " << id;
     return result;
 }
 
@@ -990,7 +1336,7 @@ bool Universe::DeleteShipDesign(int design_id) {
 }
 
 void Universe::ApplyAllEffectsAndUpdateMeters() {
-    ScopedTimer timer("Universe::ApplyAllEffectsAndUpdateMeters");
+    ScopedTimer timer("Universe::ApplyAllEffectsAndUpdateMeters", false, true);
 
     // cache all activation and scoping condition results before applying
     // Effects, since the application of these Effects may affect the activation
@@ -1048,7 +1394,7 @@ void Universe::ApplyMeterEffectsAndUpdateMeters(const std::vector<int>& object_i
 }
 
 void Universe::ApplyMeterEffectsAndUpdateMeters() {
-    ScopedTimer timer("Universe::ApplyMeterEffectsAndUpdateMeters on all objects");
+    ScopedTimer timer("Universe::ApplyMeterEffectsAndUpdateMeters on all objects", false, true);
 
     Effect::TargetsCauses targets_causes;
     GetEffectsAndTargets(targets_causes);
@@ -1066,7 +1412,7 @@ void Universe::ApplyMeterEffectsAndUpdateMeters() {
 }
 
 void Universe::ApplyMeterEffectsAndUpdateTargetMaxUnpairedMeters() {
-    ScopedTimer timer("Universe::ApplyMeterEffectsAndUpdateMeters on all objects");
+    ScopedTimer timer("Universe::ApplyMeterEffectsAndUpdateMeters on all objects", false, true);
 
     Effect::TargetsCauses targets_causes;
     GetEffectsAndTargets(targets_causes);
@@ -1093,7 +1439,7 @@ void Universe::ApplyAppearanceEffects(const std::vector<int>& object_ids) {
 }
 
 void Universe::ApplyAppearanceEffects() {
-    ScopedTimer timer("Universe::ApplyAppearanceEffects on all objects");
+    ScopedTimer timer("Universe::ApplyAppearanceEffects on all objects", false, true);
 
     // cache all activation and scoping condition results before applying
     // Effects, since the application of these Effects may affect the
@@ -1104,8 +1450,8 @@ void Universe::ApplyAppearanceEffects() {
 }
 
 void Universe::InitMeterEstimatesAndDiscrepancies() {
-    Logger().debugStream() << "Universe::InitMeterEstimatesAndDiscrepancies";
-    ScopedTimer timer("Universe::InitMeterEstimatesAndDiscrepancies");
+    DebugLogger() << "Universe::InitMeterEstimatesAndDiscrepancies";
+    ScopedTimer timer("Universe::InitMeterEstimatesAndDiscrepancies", false, true);
 
     // clear old discrepancies and accounting
     m_effect_discrepancy_map.clear();
@@ -1226,6 +1572,7 @@ void Universe::UpdateMeterEstimates(const std::vector<int>& objects_vec) {
 
 void Universe::UpdateMeterEstimatesImpl(const std::vector<int>& objects_vec) {
     ScopedTimer timer("Universe::UpdateMeterEstimatesImpl on " + boost::lexical_cast<std::string>(objects_vec.size()) + " objects", true);
+    ScopedUniverseObjectSignalBatch signal_batch(*this);
 
     // get all pointers to objects once, to avoid having to do so repeatedly
     // when iterating over the list in the following code
@@ -1262,11 +1609,11 @@ void Universe::UpdateMeterEstimatesImpl(const std::vector<int>& objects_vec) {
         }
     }
 
-    if (GetOptionsDB().Get<bool>("verbose-logging")) {
-        Logger().debugStream() << "UpdateMeterEstimatesImpl after resetting meters objects:";
+    if (verbose_logging.Get()) {
+        DebugLogger() << "UpdateMeterEstimatesImpl after resetting meters objects:";
         for (std::vector<TemporaryPtr<UniverseObject> >::iterator obj_it = object_ptrs.begin();
              obj_it != object_ptrs.end(); ++obj_it)
-        { Logger().debugStream() << (*obj_it)->Dump(); }
+        { DebugLogger() << (*obj_it)->Dump(); }
     }
 
     // cache all activation and scoping condition results before applying Effects, since the application of
@@ -1277,11 +1624,11 @@ void Universe::UpdateMeterEstimatesImpl(const std::vector<int>& objects_vec) {
     // Apply and record effect meter adjustments
     ExecuteEffects(targets_causes, true, true, false, false);
 
-    if (GetOptionsDB().Get<bool>("verbose-logging")) {
-        Logger().debugStream() << "UpdateMeterEstimatesImpl after executing effects objects:";
+    if (verbose_logging.Get()) {
+        DebugLogger() << "UpdateMeterEstimatesImpl after executing effects objects:";
         for (std::vector<TemporaryPtr<UniverseObject> >::iterator obj_it = object_ptrs.begin();
              obj_it != object_ptrs.end(); ++obj_it)
-        { Logger().debugStream() << (*obj_it)->Dump(); }
+        { DebugLogger() << (*obj_it)->Dump(); }
     }
 
     // Apply known discrepancies between expected and calculated meter maxes at start of turn.  This
@@ -1312,8 +1659,8 @@ void Universe::UpdateMeterEstimatesImpl(const std::vector<int>& objects_vec) {
                 Meter* meter = obj->GetMeter(type);
 
                 if (meter) {
-                    if (GetOptionsDB().Get<bool>("verbose-logging"))
-                        Logger().debugStream() << "object " << obj_id << " has meter " << type
+                    if (verbose_logging.Get())
+                        DebugLogger() << "object " << obj_id << " has meter " << type
                                                << ": discrepancy: " << discrepancy
                                                << " and : " << meter->Dump();
 
@@ -1340,11 +1687,11 @@ void Universe::UpdateMeterEstimatesImpl(const std::vector<int>& objects_vec) {
         (*obj_it)->ClampMeters();
     }
 
-    if (GetOptionsDB().Get<bool>("verbose-logging")) {
-        Logger().debugStream() << "UpdateMeterEstimatesImpl after discrepancies and clamping objects:";
+    if (verbose_logging.Get()) {
+        DebugLogger() << "UpdateMeterEstimatesImpl after discrepancies and clamping objects:";
         for (std::vector<TemporaryPtr<UniverseObject> >::iterator obj_it = object_ptrs.begin();
              obj_it != object_ptrs.end(); ++obj_it)
-        { Logger().debugStream() << (*obj_it)->Dump(); }
+        { DebugLogger() << (*obj_it)->Dump(); }
     }
 }
 
@@ -1521,6 +1868,7 @@ namespace {
             // move matches from candidates in target_objects into target_set
             Condition::ObjectSet& potential_target_objects =
                 *reinterpret_cast<Condition::ObjectSet *>(&target_objects);
+            Profiler::Count("scope condition candidate objects", potential_target_objects.size());
 
             // move matches from candidates in target_objects into target_set
             cond->Eval(source_context, matched_target_objects, potential_target_objects);
@@ -1531,17 +1879,20 @@ namespace {
 
         cached_condition_matches.MarkComplete(cache_entry);
 
+        Profiler::Count("scope conditions evaluated");
+        Profiler::Count("scope condition matches", target_set->size());
+
         //Logger().debugStream() << "Generated new target set!";
         return *target_set; 
     }
     
     void StoreTargetsAndCausesOfEffectsGroupsWorkItem::operator ()()
     {
-        ScopedTimer timer("StoreTargetsAndCausesOfEffectsGroups");
+        ScopedTimer timer("StoreTargetsAndCausesOfEffectsGroups", false, true);
 
-        if (GetOptionsDB().Get<bool>("verbose-logging")) {
+        if (verbose_logging.Get()) {
             boost::unique_lock<boost::shared_mutex> guard(*m_global_mutex);
-            Logger().debugStream() << "StoreTargetsAndCausesOfEffectsGroups(effects group: " << m_effects_group->AccountingLabel() << ", , , specific cause: " << m_specific_cause_name << ", , )";
+            DebugLogger() << "StoreTargetsAndCausesOfEffectsGroups(effects group: " << m_effects_group->AccountingLabel() << ", , , specific cause: " << m_specific_cause_name << ", , )";
         }
 
         // get objects matched by scope
@@ -1614,16 +1965,16 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes) {
 void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
                                     const std::vector<int>& target_objects)
 {
-    ScopedTimer timer("Universe::GetEffectsAndTargets");
+    ScopedTimer timer("Universe::GetEffectsAndTargets", false, true);
 
     // transfer target objects from input vector to a set
     Effect::TargetSet all_potential_targets = m_objects.FindObjects(target_objects);
 
-    if (GetOptionsDB().Get<bool>("verbose-logging")) {
-        Logger().debugStream() << "target objects:";
+    if (verbose_logging.Get()) {
+        DebugLogger() << "target objects:";
         for (Effect::TargetSet::const_iterator it = all_potential_targets.begin();
              it != all_potential_targets.end(); ++it)
-        { Logger().debugStream() << (*it)->Dump(); }
+        { DebugLogger() << (*it)->Dump(); }
     }
 
 
@@ -1647,7 +1998,7 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
     boost::timer eval_timer;
 
     std::list<Effect::TargetsCauses> targets_causes_reorder_buffer; // create before run_queue, destroy after run_queue
-    unsigned int num_threads = static_cast<unsigned int>(std::max(1, GetOptionsDB().Get<int>("effects-threads")));
+    unsigned int num_threads = static_cast<unsigned int>(std::max(1, effects_threads.Get()));
     RunQueue<StoreTargetsAndCausesOfEffectsGroupsWorkItem> run_queue(num_threads);
     boost::shared_mutex global_mutex;
     boost::unique_lock<boost::shared_mutex> global_lock(global_mutex); // create after run_queue, destroy before run_queue
@@ -1655,12 +2006,14 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
     eval_timer.restart();
 
     // 1) EffectsGroups from Species
-    if (GetOptionsDB().Get<bool>("verbose-logging"))
-        Logger().debugStream() << "Universe::GetEffectsAndTargets for SPECIES";
+    if (verbose_logging.Get())
+        DebugLogger() << "Universe::GetEffectsAndTargets for SPECIES";
     type_timer.restart();
 
-    // find each species planets in single pass, maintaining object map order per-species
-    std::map<std::string, std::vector<TemporaryPtr<const UniverseObject> > > species_objects;
+    // find each species planets in single pass, maintaining object map order per-species.
+    // objects are grouped by the interned ids of their species' names, to
+    // avoid comparing names for every object
+    std::vector<std::vector<TemporaryPtr<const UniverseObject> > > species_objects(NumInternedStrings());
     std::vector<TemporaryPtr<Planet> > planets = m_objects.FindObjects<Planet>();
     for (std::vector<TemporaryPtr<Planet> >::const_iterator planet_it = planets.begin();
          planet_it != planets.end(); ++planet_it)
@@ -1668,15 +2021,14 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
         TemporaryPtr<const Planet> planet = *planet_it;
         if (m_destroyed_object_ids.find(planet->ID()) != m_destroyed_object_ids.end())
             continue;
-        const std::string& species_name = planet->SpeciesName();
-        if (species_name.empty())
+        int species_id = planet->SpeciesID();
+        if (species_id == INVALID_STRING_ID)
             continue;
-        const Species* species = GetSpecies(species_name);
-        if (!species) {
-            Logger().errorStream() << "GetEffectsAndTargets couldn't get Species " << species_name;
+        if (!GetSpecies(species_id)) {
+            Logger().errorStream() << "GetEffectsAndTargets couldn't get Species " << planet->SpeciesName();
             continue;
         }
-        species_objects[species_name].push_back(planet);
+        species_objects[species_id].push_back(planet);
     }
 
     double planet_species_time = type_timer.elapsed();
@@ -1690,15 +2042,14 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
         TemporaryPtr<const Ship> ship = *ship_it;
         if (m_destroyed_object_ids.find(ship->ID()) != m_destroyed_object_ids.end())
             continue;
-        const std::string& species_name = ship->SpeciesName();
-        if (species_name.empty())
+        int species_id = ship->SpeciesID();
+        if (species_id == INVALID_STRING_ID)
             continue;
-        const Species* species = GetSpecies(species_name);
-        if (!species) {
-            Logger().errorStream() << "GetEffectsAndTargets couldn't get Species " << species_name;
+        if (!GetSpecies(species_id)) {
+            Logger().errorStream() << "GetEffectsAndTargets couldn't get Species " << ship->SpeciesName();
             continue;
         }
-        species_objects[species_name].push_back(ship);
+        species_objects[species_id].push_back(ship);
     }
     double ship_species_time = type_timer.elapsed();
 
@@ -1706,17 +2057,16 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
     for (SpeciesManager::iterator species_it  = GetSpeciesManager().begin(); species_it != GetSpeciesManager().end(); ++species_it) {
         const std::string& species_name = species_it->first;
         const Species*     species      = species_it->second;
-        std::map<std::string, std::vector<TemporaryPtr<const UniverseObject> > >::iterator species_objects_it = species_objects.find(species_name);
-        
-        if (species_objects_it == species_objects.end())
+        int                species_id   = FindInternedString(species_name);
+        if (species_id == INVALID_STRING_ID || species_objects[species_id].empty())
             continue;
-        
+
         const std::vector<boost::shared_ptr<const Effect::EffectsGroup> >& effects_groups = species->Effects();
         std::vector<boost::shared_ptr<const Effect::EffectsGroup> >::const_iterator effects_group_it;
         for (effects_group_it = effects_groups.begin(); effects_group_it != effects_groups.end(); ++effects_group_it) {
             targets_causes_reorder_buffer.push_back(Effect::TargetsCauses());
             run_queue.AddWork(new StoreTargetsAndCausesOfEffectsGroupsWorkItem(
-                                                 *effects_group_it, species_objects_it->second, ECT_SPECIES, species_name,
+                                                 *effects_group_it, species_objects[species_id], ECT_SPECIES, species_name,
                                                  all_potential_targets, targets_causes_reorder_buffer.back(),
                                                  cached_source_condition_matches,
                                                  invariant_condition_matches,
@@ -1725,10 +2075,12 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
     }
 
     // 2) EffectsGroups from Specials
-    if (GetOptionsDB().Get<bool>("verbose-logging"))
-        Logger().debugStream() << "Universe::GetEffectsAndTargets for SPECIALS";
+    if (verbose_logging.Get())
+        DebugLogger() << "Universe::GetEffectsAndTargets for SPECIALS";
     type_timer.restart();
-    std::map<std::string, std::vector<TemporaryPtr<const UniverseObject> > > specials_objects;
+    // objects' specials are keyed by name, but are grouped here by the
+    // interned ids of those names
+    std::vector<std::vector<TemporaryPtr<const UniverseObject> > > specials_objects(NumInternedStrings());
     // determine objects with specials in a single pass
     for (ObjectMap::const_iterator<> obj_it = m_objects.const_begin(); obj_it != m_objects.const_end(); ++obj_it) {
         int source_object_id = obj_it->ID();
@@ -1737,22 +2089,21 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
         const std::map<std::string, int>& specials = obj_it->Specials();
         for (std::map<std::string, int>::const_iterator special_it = specials.begin(); special_it != specials.end(); ++special_it) {
             const std::string& special_name = special_it->first;
-            const Special*     special      = GetSpecial(special_name);
-            if (!special) {
+            int                special_id   = FindInternedString(special_name);
+            if (!GetSpecial(special_id)) {
                 Logger().errorStream() << "GetEffectsAndTargets couldn't get Special " << special_name;
                 continue;
             }
-            specials_objects[special_name].push_back(*obj_it);
+            specials_objects[special_id].push_back(*obj_it);
         }
     }
     // enforce specials effects order
     std::vector<std::string> special_names = SpecialNames();
     for (std::vector<std::string>::iterator special_it = special_names.begin(); special_it !=special_names.end(); ++special_it) {
         const std::string& special_name = *special_it;
-        const Special*     special      = GetSpecial(special_name);
-        std::map<std::string, std::vector<TemporaryPtr<const UniverseObject> > >::iterator specials_objects_it = specials_objects.find(special_name);
-        
-        if (specials_objects_it == specials_objects.end())
+        int                special_id   = FindInternedString(special_name);
+        const Special*     special      = GetSpecial(special_id);
+        if (!special || specials_objects[special_id].empty())
             continue;
         
         const std::vector<boost::shared_ptr<const Effect::EffectsGroup> >& effects_groups = special->Effects();
@@ -1760,7 +2111,7 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
         for (effects_group_it = effects_groups.begin(); effects_group_it != effects_groups.end(); ++effects_group_it) {
             targets_causes_reorder_buffer.push_back(Effect::TargetsCauses());
             run_queue.AddWork(new StoreTargetsAndCausesOfEffectsGroupsWorkItem(
-                                                 *effects_group_it, specials_objects_it->second, ECT_SPECIAL, special_name,
+                                                 *effects_group_it, specials_objects[special_id], ECT_SPECIAL, special_name,
                                                  all_potential_targets, targets_causes_reorder_buffer.back(),
                                                  cached_source_condition_matches,
                                                  invariant_condition_matches,
@@ -1770,8 +2121,8 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
     double special_time = type_timer.elapsed();
 
     // 3) EffectsGroups from Techs
-    if (GetOptionsDB().Get<bool>("verbose-logging"))
-        Logger().debugStream() << "Universe::GetEffectsAndTargets for TECHS";
+    if (verbose_logging.Get())
+        DebugLogger() << "Universe::GetEffectsAndTargets for TECHS";
     type_timer.restart();
     std::list< std::vector< TemporaryPtr<const UniverseObject> > > tech_sources;
     for (EmpireManager::const_iterator it = Empires().begin(); it != Empires().end(); ++it) {
@@ -1827,12 +2178,13 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
     double tech_time = type_timer.elapsed();
 
     // 4) EffectsGroups from Buildings
-    if (GetOptionsDB().Get<bool>("verbose-logging"))
-        Logger().debugStream() << "Universe::GetEffectsAndTargets for BUILDINGS";
+    if (verbose_logging.Get())
+        DebugLogger() << "Universe::GetEffectsAndTargets for BUILDINGS";
     type_timer.restart();
 
-    // determine buildings of each type in a single pass
-    std::map<std::string, std::vector<TemporaryPtr<const UniverseObject> > > buildings_by_type;
+    // determine buildings of each type in a single pass, grouped by the
+    // interned ids of their building types' names
+    std::vector<std::vector<TemporaryPtr<const UniverseObject> > > buildings_by_type(NumInternedStrings());
     std::vector<TemporaryPtr<Building> > buildings = m_objects.FindObjects<Building>();
     for (std::vector<TemporaryPtr<Building> >::const_iterator building_it = buildings.begin();
          building_it != buildings.end(); ++building_it)
@@ -1840,23 +2192,21 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
         TemporaryPtr<const Building> building = *building_it;
         if (m_destroyed_object_ids.find(building->ID()) != m_destroyed_object_ids.end())
             continue;
-        const std::string&  building_type_name = building->BuildingTypeName();
-        const BuildingType* building_type = GetBuildingType(building_type_name);
-        if (!building_type) {
+        int building_type_id = building->BuildingTypeID();
+        if (!GetBuildingType(building_type_id)) {
             Logger().errorStream() << "GetEffectsAndTargets couldn't get BuildingType " << building->BuildingTypeName();
             continue;
         }
 
-        buildings_by_type[building_type_name].push_back(building);
+        buildings_by_type[building_type_id].push_back(building);
     }
 
     // enforce building types effects order
     for (BuildingTypeManager::iterator building_type_it  = GetBuildingTypeManager().begin(); building_type_it != GetBuildingTypeManager().end(); ++building_type_it) {
         const std::string&  building_type_name = building_type_it->first;
         const BuildingType* building_type      = building_type_it->second;
-        std::map<std::string, std::vector<TemporaryPtr<const UniverseObject> > >::iterator buildings_by_type_it = buildings_by_type.find(building_type_name);
-        
-        if (buildings_by_type_it == buildings_by_type.end())
+        int                 building_type_id   = FindInternedString(building_type_name);
+        if (building_type_id == INVALID_STRING_ID || buildings_by_type[building_type_id].empty())
             continue;
         
         const std::vector<boost::shared_ptr<const Effect::EffectsGroup> >& effects_groups = building_type->Effects();
@@ -1864,7 +2214,7 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
         for (effects_group_it = effects_groups.begin(); effects_group_it != effects_groups.end(); ++effects_group_it) {
             targets_causes_reorder_buffer.push_back(Effect::TargetsCauses());
             run_queue.AddWork(new StoreTargetsAndCausesOfEffectsGroupsWorkItem(
-                                                 *effects_group_it, buildings_by_type_it->second, ECT_BUILDING, building_type_name,
+                                                 *effects_group_it, buildings_by_type[building_type_id], ECT_BUILDING, building_type_name,
                                                  all_potential_targets, targets_causes_reorder_buffer.back(),
                                                  cached_source_condition_matches,
                                                  invariant_condition_matches,
@@ -1874,14 +2224,14 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
     double building_time = type_timer.elapsed();
 
     // 5) EffectsGroups from Ship Hull and Ship Parts
-    if (GetOptionsDB().Get<bool>("verbose-logging"))
-        Logger().debugStream() << "Universe::GetEffectsAndTargets for SHIPS hulls and parts";
+    if (verbose_logging.Get())
+        DebugLogger() << "Universe::GetEffectsAndTargets for SHIPS hulls and parts";
     type_timer.restart();
     // determine ship hulls and parts of each type in a single pass
     // the same ship might be added multiple times if it contains the part multiple times
     // recomputing targets for the same ship and part is kind of silly here, but shouldn't hurt
     std::map<std::string, std::vector<TemporaryPtr<const UniverseObject> > > ships_by_hull_type;
-    std::map<std::string, std::vector<TemporaryPtr<const UniverseObject> > > ships_by_part_type;
+    std::vector<std::vector<TemporaryPtr<const UniverseObject> > > ships_by_part_type(NumInternedStrings());
     ships = m_objects.FindObjects<Ship>();
     for (std::vector<TemporaryPtr<Ship> >::const_iterator ship_it = ships.begin(); ship_it != ships.end(); ++ship_it) {
         TemporaryPtr<const Ship> ship = *ship_it;
@@ -1901,18 +2251,17 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
         
         ships_by_hull_type[hull_type->Name()].push_back(ship);
 
-        const std::vector<std::string>& parts = ship_design->Parts();
-        for (std::vector<std::string>::const_iterator part_it = parts.begin(); part_it != parts.end(); ++part_it) {
-            const std::string& part = *part_it;
-            if (part.empty())
+        const std::vector<int>& part_ids = ship_design->PartIDs();
+        for (std::vector<int>::const_iterator part_it = part_ids.begin(); part_it != part_ids.end(); ++part_it) {
+            int part_id = *part_it;
+            if (part_id == INVALID_STRING_ID)
                 continue;
-            const PartType* part_type = GetPartType(*part_it);
-            if (!part_type) {
+            if (!GetPartType(part_id)) {
                 Logger().errorStream() << "GetEffectsAndTargets couldn't get PartType";
                 continue;
             }
             
-            ships_by_part_type[part].push_back(ship);
+            ships_by_part_type[part_id].push_back(ship);
         }
     }
 
@@ -1941,9 +2290,8 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
     for (PartTypeManager::iterator part_type_it  = GetPartTypeManager().begin(); part_type_it != GetPartTypeManager().end(); ++part_type_it) {
         const std::string& part_type_name = part_type_it->first;
         const PartType*    part_type      = part_type_it->second;
-        std::map<std::string, std::vector<TemporaryPtr<const UniverseObject> > >::iterator ships_by_part_type_it = ships_by_part_type.find(part_type_name);
-
-        if (ships_by_part_type_it == ships_by_part_type.end())
+        int                part_type_id   = FindInternedString(part_type_name);
+        if (part_type_id == INVALID_STRING_ID || ships_by_part_type[part_type_id].empty())
             continue;
 
         const std::vector<boost::shared_ptr<const Effect::EffectsGroup> >& effects_groups = part_type->Effects();
@@ -1951,7 +2299,7 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
         for (effects_group_it = effects_groups.begin(); effects_group_it != effects_groups.end(); ++effects_group_it) {
             targets_causes_reorder_buffer.push_back(Effect::TargetsCauses());
             run_queue.AddWork(new StoreTargetsAndCausesOfEffectsGroupsWorkItem(
-                                                 *effects_group_it, ships_by_part_type_it->second, ECT_SHIP_PART, part_type_name,
+                                                 *effects_group_it, ships_by_part_type[part_type_id], ECT_SHIP_PART, part_type_name,
                                                  all_potential_targets, targets_causes_reorder_buffer.back(),
                                                  cached_source_condition_matches,
                                                  invariant_condition_matches,
@@ -1961,8 +2309,8 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
     double ships_time = type_timer.elapsed();
 
     // 6) EffectsGroups from Fields
-    if (GetOptionsDB().Get<bool>("verbose-logging"))
-        Logger().debugStream() << "Universe::GetEffectsAndTargets for FIELDS";
+    if (verbose_logging.Get())
+        DebugLogger() << "Universe::GetEffectsAndTargets for FIELDS";
     type_timer.restart();
     // determine fields of each type in a single pass
     std::map<std::string, std::vector<TemporaryPtr<const UniverseObject> > > fields_by_type;
@@ -2020,14 +2368,14 @@ void Universe::GetEffectsAndTargets(Effect::TargetsCauses& targets_causes,
         }
     }
     double reorder_time = eval_timer.elapsed();
-    Logger().debugStream() << "Issue times: planet species: " << planet_species_time*1000
+    DebugLogger() << "Issue times: planet species: " << planet_species_time*1000
                            << " ship species: " << ship_species_time*1000
                            << " specials: " << special_time*1000
                            << " techs: " << tech_time*1000
                            << " buildings: " << building_time*1000
                            << " hulls/parts: " << ships_time*1000
                            << " fields: " << fields_time*1000;
-    Logger().debugStream() << "Evaluation time: " << eval_time*1000
+    DebugLogger() << "Evaluation time: " << eval_time*1000
                            << " reorder time: " << reorder_time*1000;
 }
 
@@ -2037,12 +2385,12 @@ void Universe::ExecuteEffects(const Effect::TargetsCauses& targets_causes,
                               bool only_appearance_effects/* = false*/,
                               bool include_empire_meter_effects/* = false*/)
 {
-    ScopedTimer timer("Universe::ExecuteEffects", true);
+    ScopedTimer timer("Universe::ExecuteEffects", true, true);
 
     m_marked_destroyed.clear();
     m_marked_for_victory.clear();
     std::map< std::string, std::set<int> > executed_nonstacking_effects;
-    bool log_verbose = GetOptionsDB().Get<bool>("verbose-logging");
+    bool log_verbose = verbose_logging.Get();
     
     // grouping targets causes by effects group
     // sorting by effects group has already been done in GetEffectsAndTargets()
@@ -2122,7 +2470,12 @@ void Universe::ExecuteEffects(const Effect::TargetsCauses& targets_causes,
             continue;
 
         if (log_verbose)
-            Logger().debugStream() << " * * * * * * * * * * * (new effects group log entry)";
+            DebugLogger() << " * * * * * * * * * * * (new effects group log entry)";
+
+        Profiler::Count("effects groups executed");
+        for (Effect::TargetsCauses::const_iterator targets_it = group_targets_causes.begin();
+             targets_it != group_targets_causes.end(); ++targets_it)
+        { Profiler::Count("effects group targets", targets_it->second.target_set.size()); }
 
         // execute Effects in the EffectsGroup
         effects_group->Execute( group_targets_causes,
@@ -2140,37 +2493,37 @@ void Universe::ExecuteEffects(const Effect::TargetsCauses& targets_causes,
         RecursiveDestroy(*it);
 }
 
+namespace {
+    /** Raises the visibility of object \a object_id in one empire's
+      * \a vis_table to \a vis if it is lower, and adds the design of the object
+      * to that empire's \a known_design_ids if the object is a ship that is at
+      * least partially visible. */
+    void SetObjectVisibility(ObjectVisibilityTable& vis_table, std::set<int>& known_design_ids,
+                             int object_id, Visibility vis)
+    {
+        // increase stored value if new visibility is higher than last recorded
+        vis_table.RaiseVisibility(object_id, vis);
+
+        // if object is a ship, empire also gets knowledge of its design
+        if (vis >= VIS_PARTIAL_VISIBILITY) {
+            if (TemporaryPtr<const Ship> ship = GetShip(object_id)) {
+                int design_id = ship->DesignID();
+                if (design_id == ShipDesign::INVALID_DESIGN_ID) {
+                    Logger().errorStream() << "SetEmpireObjectVisibility got invalid design id for ship with id " << object_id;
+                } else {
+                    known_design_ids.insert(design_id);
+                }
+            }
+        }
+    }
+}
+
 void Universe::SetEmpireObjectVisibility(int empire_id, int object_id, Visibility vis) {
     if (empire_id == ALL_EMPIRES || object_id == INVALID_OBJECT_ID)
         return;
 
-    // get visibility map for empire and find object in it
-    Universe::ObjectVisibilityMap& vis_map = m_empire_object_visibility[empire_id];
-    Universe::ObjectVisibilityMap::iterator vis_map_it = vis_map.find(object_id);
-
-    // if object not already present, store default value (which may be replaced)
-    if (vis_map_it == vis_map.end()) {
-        vis_map[object_id] = VIS_NO_VISIBILITY;
-
-        // get iterator pointing at newly-created entry
-        vis_map_it = vis_map.find(object_id);
-    }
-
-    // increase stored value if new visibility is higher than last recorded
-    if (vis > vis_map_it->second)
-        vis_map_it->second = vis;
-
-    // if object is a ship, empire also gets knowledge of its design
-    if (vis >= VIS_PARTIAL_VISIBILITY) {
-        if (TemporaryPtr<const Ship> ship = GetShip(object_id)) {
-            int design_id = ship->DesignID();
-            if (design_id == ShipDesign::INVALID_DESIGN_ID) {
-                Logger().errorStream() << "SetEmpireObjectVisibility got invalid design id for ship with id " << object_id;
-            } else {
-                m_empire_known_ship_design_ids[empire_id].insert(design_id);
-            }
-        }
-    }
+    SetObjectVisibility(m_empire_object_visibility[empire_id], m_empire_known_ship_design_ids[empire_id],
+                        object_id, vis);
 }
 
 void Universe::SetEmpireSpecialVisibility(int empire_id, int object_id,
@@ -2361,118 +2714,80 @@ namespace {
         }
     }
 
-    /** sets visibility of field objects for empires based on input locations
+    /** sets visibility of field objects for \a empire based on input locations
       * and stealth of fields in supplied ObjectMap and input empire detection
       * ranges at locations. the rules for detection of fields are more
       * permissive than other object types, so a special function for them is
       * needed in addition to SetEmpireObjectVisibilitiesFromRanges(...) */
     void SetEmpireFieldVisibilitiesFromRanges(
-        const std::map<int, std::map<std::pair<double, double>, float> >&
-            empire_location_detection_ranges,
-        const ObjectMap& objects)
+        const Empire* empire,
+        const std::map<std::pair<double, double>, float>& detector_position_ranges,
+        const ObjectMap& objects,
+        ObjectVisibilityTable& vis_table,
+        std::set<int>& known_design_ids)
     {
-        std::vector<TemporaryPtr<const Field> > fields = objects.FindObjects<Field>();
-        Universe& universe = GetUniverse();
+        const Meter* meter = empire->GetMeter("METER_DETECTION_STRENGTH");
+        if (!meter)
+            return;
+        double detection_strength = meter->Current();
 
-        for (std::map<int, std::map<std::pair<double, double>, float> >::const_iterator
-             detecting_empire_it = empire_location_detection_ranges.begin();
-             detecting_empire_it != empire_location_detection_ranges.end();
-             ++detecting_empire_it)
+        // for each field, try to find a detector position in range for this empire
+        for (ObjectMap::const_iterator<Field> field_it = objects.const_begin<Field>();
+             field_it != objects.const_end<Field>(); ++field_it)
         {
-            int detecting_empire_id = detecting_empire_it->first;
-            double detection_strength = 0.0;
-            const Empire* empire = Empires().Lookup(detecting_empire_id);
-            if (!empire)
-                continue;
-            const Meter* meter = empire->GetMeter("METER_DETECTION_STRENGTH");
-            if (!meter)
+            TemporaryPtr<const Field> field = *field_it;
+            if (field->GetMeter(METER_STEALTH)->Current() > detection_strength)
                 continue;
-            detection_strength = meter->Current();
+            double field_size = field->GetMeter(METER_SIZE)->Current();
+            const std::pair<double, double> object_pos(field->X(), field->Y());
 
-            // get empire's locations of detection ranges
-            const std::map<std::pair<double, double>, float>& detector_position_ranges =
-                detecting_empire_it->second;
-
-            // for each field, try to find a detector position in range for this empire
-            for (ObjectMap::const_iterator<Field> field_it = objects.const_begin<Field>();
-                 field_it != objects.const_end<Field>(); ++field_it)
+            // search through detector positions until one is found in range
+            for (std::map<std::pair<double, double>, float>::const_iterator
+                 detector_position_it = detector_position_ranges.begin();
+                 detector_position_it != detector_position_ranges.end();
+                 ++detector_position_it)
             {
-                TemporaryPtr<const Field> field = *field_it;
-                if (field->GetMeter(METER_STEALTH)->Current() > detection_strength)
-                    continue;
-                double field_size = field->GetMeter(METER_SIZE)->Current();
-                const std::pair<double, double> object_pos(field->X(), field->Y());
-
-                // search through detector positions until one is found in range
-                for (std::map<std::pair<double, double>, float>::const_iterator
-                     detector_position_it = detector_position_ranges.begin();
-                     detector_position_it != detector_position_ranges.end();
-                     ++detector_position_it)
-                {
-                    // check range for this detector location, for field of this
-                    // size, against distance between field and detector
-                    float detector_range = detector_position_it->second;
-                    const std::pair<double, double>& detector_pos = detector_position_it->first;
-                    double x_dist = detector_pos.first - object_pos.first;
-                    double y_dist = detector_pos.second - object_pos.second;
-                    double dist = std::sqrt(x_dist*x_dist + y_dist*y_dist);
-                    double effective_dist = dist - field_size;
-                    if (effective_dist > detector_range)
-                        continue;   // object out of range
-
-                    universe.SetEmpireObjectVisibility(detecting_empire_id, field->ID(),
-                                                       VIS_PARTIAL_VISIBILITY);
-                }
+                // check range for this detector location, for field of this
+                // size, against distance between field and detector
+                float detector_range = detector_position_it->second;
+                const std::pair<double, double>& detector_pos = detector_position_it->first;
+                double x_dist = detector_pos.first - object_pos.first;
+                double y_dist = detector_pos.second - object_pos.second;
+                double dist = std::sqrt(x_dist*x_dist + y_dist*y_dist);
+                double effective_dist = dist - field_size;
+                if (effective_dist > detector_range)
+                    continue;   // object out of range
+
+                SetObjectVisibility(vis_table, known_design_ids, field->ID(), VIS_PARTIAL_VISIBILITY);
             }
         }
     }
 
-    /** sets visibility of objects for empires based on input locations of
+    /** sets visibility of objects for an empire based on input locations of
       * potentially detectable objects (if in range) and and input empire
       * detection ranges at locations. */
     void SetEmpireObjectVisibilitiesFromRanges(
-        const std::map<int, std::map<std::pair<double, double>, float> >&
-            empire_location_detection_ranges,
-        const std::map<int, std::map<std::pair<double, double>, std::vector<int> > >&
-            empire_location_potentially_detectable_objects)
+        const std::map<std::pair<double, double>, float>& detector_position_ranges,
+        const std::map<std::pair<double, double>, std::vector<int> >& detectable_position_objects,
+        ObjectVisibilityTable& vis_table,
+        std::set<int>& known_design_ids)
     {
-        Universe& universe = GetUniverse();
-
-        for (std::map<int, std::map<std::pair<double, double>, float> >::const_iterator
-             detecting_empire_it = empire_location_detection_ranges.begin();
-             detecting_empire_it != empire_location_detection_ranges.end();
-             ++detecting_empire_it)
-        {
-            int detecting_empire_id = detecting_empire_it->first;
-            // get empire's locations of detection ability
-            const std::map<std::pair<double, double>, float>& detector_position_ranges =
-                detecting_empire_it->second;
-            // for this empire, get objects it could potentially detect
-            const std::map<int, std::map<std::pair<double, double>, std::vector<int> > >::const_iterator
-                empire_detectable_objects_it = empire_location_potentially_detectable_objects.find(detecting_empire_id);
-            if (empire_detectable_objects_it == empire_location_potentially_detectable_objects.end())
-                continue;   // empire can't detect anything!
-            const std::map<std::pair<double, double>, std::vector<int> >& detectable_position_objects =
-                empire_detectable_objects_it->second;
-            if (detectable_position_objects.empty())
-                continue;
+        if (detectable_position_objects.empty())
+            return;
 
-            // filter potentially detectable objects by which are within range
-            // of a detector
-            std::vector<int> in_range_detectable_objects =
-                FilterObjectPositionsByDetectorPositionsAndRanges(detectable_position_objects,
-                                                                  detector_position_ranges);
-            if (in_range_detectable_objects.empty())
-                continue;
+        // filter potentially detectable objects by which are within range
+        // of a detector
+        std::vector<int> in_range_detectable_objects =
+            FilterObjectPositionsByDetectorPositionsAndRanges(detectable_position_objects,
+                                                              detector_position_ranges);
 
-            // set all in-range detectable objects as partially visible (unless
-            // any are already full vis, in which case do nothing)
-            for (std::vector<int>::const_iterator detected_object_it = in_range_detectable_objects.begin();
-                 detected_object_it != in_range_detectable_objects.end(); ++detected_object_it)
-            {
-                universe.SetEmpireObjectVisibility(detecting_empire_id, *detected_object_it,
-                                                   VIS_PARTIAL_VISIBILITY);
-            }
+        // set all in-range detectable objects as partially visible (unless
+        // any are already full vis, in which case do nothing)
+        for (std::vector<int>::const_iterator detected_object_it = in_range_detectable_objects.begin();
+             detected_object_it != in_range_detectable_objects.end(); ++detected_object_it)
+        {
+            SetObjectVisibility(vis_table, known_design_ids, *detected_object_it,
+                                VIS_PARTIAL_VISIBILITY);
         }
     }
 
@@ -2563,7 +2878,7 @@ namespace {
     }
 
     void PropegateVisibilityToContainerObjects(const ObjectMap& objects,
-                                               Universe::EmpireObjectVisibilityMap& empire_object_visibility)
+                                               ObjectVisibilityTable& vis_table)
     {
         // propegate visibility from contained to container objects
         for (ObjectMap::const_iterator<> container_object_it = objects.const_begin();
@@ -2595,124 +2910,91 @@ namespace {
 
                 //Logger().debugStream() << " ... contained object (" << contained_obj_id << ")";
 
-                // for each empire with a visibility map
-                for (Universe::EmpireObjectVisibilityMap::iterator empire_it = empire_object_visibility.begin();
-                     empire_it != empire_object_visibility.end(); ++empire_it)
-                {
-                    Universe::ObjectVisibilityMap& vis_map = empire_it->second;
-
-                    //Logger().debugStream() << " ... ... empire id " << empire_it->first;
-
-                    // find current empire's visibility entry for current container object
-                    Universe::ObjectVisibilityMap::iterator container_vis_it = vis_map.find(container_obj_id);
-                    // if no entry yet stored for this object, default to not visible
-                    if (container_vis_it == vis_map.end()) {
-                        vis_map[container_obj_id] = VIS_NO_VISIBILITY;
-
-                        // get iterator pointing at newly-created entry
-                        container_vis_it = vis_map.find(container_obj_id);
-                    } else {
-                        // check whether having a contained object would change container's visibility
-                        if (container_fleet) {
-                            // special case for fleets: grant partial visibility if
-                            // a contained ship is seen with partial visibility or
-                            // higher visibilitly
-                            if (container_vis_it->second >= VIS_PARTIAL_VISIBILITY)
-                                continue;
-                        } else if (container_vis_it->second >= VIS_BASIC_VISIBILITY) {
-                            // general case: for non-fleets, having visible
-                            // contained object grants basic vis only.  if
-                            // container already has this or better for the current
-                            // empire, don't need to propegate anything
+                // if no entry yet stored for current container object, default to not visible
+                if (!vis_table.HasVisibility(container_obj_id)) {
+                    vis_table.SetVisibility(container_obj_id, VIS_NO_VISIBILITY);
+                } else {
+                    // check whether having a contained object would change container's visibility
+                    Visibility container_vis = vis_table.GetVisibility(container_obj_id);
+                    if (container_fleet) {
+                        // special case for fleets: grant partial visibility if
+                        // a contained ship is seen with partial visibility or
+                        // higher visibilitly
+                        if (container_vis >= VIS_PARTIAL_VISIBILITY)
                             continue;
-                        }
+                    } else if (container_vis >= VIS_BASIC_VISIBILITY) {
+                        // general case: for non-fleets, having visible
+                        // contained object grants basic vis only.  if
+                        // container already has this or better for the
+                        // empire, don't need to propegate anything
+                        continue;
                     }
+                }
 
 
-                    // find contained object's entry in visibility map
-                    Universe::ObjectVisibilityMap::iterator contained_vis_it = vis_map.find(contained_obj_id);
-                    if (contained_vis_it != vis_map.end()) {
-                        // get contained object's visibility for current empire
-                        Visibility contained_obj_vis = contained_vis_it->second;
-
-                        // no need to propegate if contained object isn't visible to current empire
-                        if (contained_obj_vis <= VIS_NO_VISIBILITY)
-                            continue;
-
-                        //Logger().debugStream() << " ... ... contained object vis: " << contained_obj_vis;
+                // find contained object's entry in visibility table
+                if (vis_table.HasVisibility(contained_obj_id)) {
+                    // get contained object's visibility for empire
+                    Visibility contained_obj_vis = vis_table.GetVisibility(contained_obj_id);
 
-                        // contained object is at least basically visible.
-                        // container should be at least partially visible, but don't
-                        // want to decrease visibility of container if it is already
-                        // higher than partially visible
-                        if (container_vis_it->second < VIS_BASIC_VISIBILITY)
-                            container_vis_it->second = VIS_BASIC_VISIBILITY;
+                    // no need to propegate if contained object isn't visible to empire
+                    if (contained_obj_vis <= VIS_NO_VISIBILITY)
+                        continue;
 
-                        // special case for fleets: grant partial visibility if
-                        // visible contained object is partially or better visible
-                        // this way fleet ownership is known to players who can 
-                        // see ships with partial or better visibility (and thus
-                        // know the owner of the ships and thus should know the
-                        // owners of the fleet)
-                        if (container_fleet && contained_obj_vis >= VIS_PARTIAL_VISIBILITY &&
-                            container_vis_it->second < VIS_PARTIAL_VISIBILITY)
-                        { container_vis_it->second = VIS_PARTIAL_VISIBILITY; }
-                    }
-                }   // end for empire visibility entries
+                    //Logger().debugStream() << " ... ... contained object vis: " << contained_obj_vis;
+
+                    // contained object is at least basically visible.
+                    // container should be at least partially visible, but don't
+                    // want to decrease visibility of container if it is already
+                    // higher than partially visible
+                    vis_table.RaiseVisibility(container_obj_id, VIS_BASIC_VISIBILITY);
+
+                    // special case for fleets: grant partial visibility if
+                    // visible contained object is partially or better visible
+                    // this way fleet ownership is known to players who can 
+                    // see ships with partial or better visibility (and thus
+                    // know the owner of the ships and thus should know the
+                    // owners of the fleet)
+                    if (container_fleet && contained_obj_vis >= VIS_PARTIAL_VISIBILITY)
+                        vis_table.RaiseVisibility(container_obj_id, VIS_PARTIAL_VISIBILITY);
+                }
             }   // end for contained objects
         }   // end for container objects
     }
 
     void PropegateVisibilityToSystemsAlongStarlanes(const ObjectMap& objects,
-                                                    Universe::EmpireObjectVisibilityMap& empire_object_visibility) {
-        const std::vector<TemporaryPtr<const System> > systems = objects.FindObjects<System>();
-        for (std::vector<TemporaryPtr<const System> >::const_iterator it = systems.begin(); it != systems.end(); ++it) {
+                                                    ObjectVisibilityTable& vis_table) {
+        for (ObjectMap::const_iterator<System> it = objects.const_begin<System>();
+             it != objects.const_end<System>(); ++it)
+        {
             TemporaryPtr<const System> system = *it;
             int system_id = system->ID();
 
-            // for each empire with a visibility map
-            for (Universe::EmpireObjectVisibilityMap::iterator empire_it = empire_object_visibility.begin();
-                 empire_it != empire_object_visibility.end(); ++empire_it)
-            {
-                Universe::ObjectVisibilityMap& vis_map = empire_it->second;
-
-                // find current system's visibility
-                Universe::ObjectVisibilityMap::iterator system_vis_it = vis_map.find(system_id);
-                if (system_vis_it == vis_map.end())
-                    continue;
+            // skip systems that aren't at least partially visible; they can't propegate visibility along starlanes
+            Visibility system_vis = vis_table.GetVisibility(system_id);
+            if (system_vis <= VIS_BASIC_VISIBILITY)
+                continue;
 
-                // skip systems that aren't at least partially visible; they can't propegate visibility along starlanes
-                Visibility system_vis = system_vis_it->second;
-                if (system_vis <= VIS_BASIC_VISIBILITY)
+            // get all starlanes emanating from this system, and loop through them
+            const std::map<int, bool>& starlane_map = system->StarlanesWormholes();
+            for (std::map<int, bool>::const_iterator lane_it = starlane_map.begin();
+                 lane_it != starlane_map.end(); ++lane_it)
+            {
+                bool is_wormhole = lane_it->second;
+                if (is_wormhole)
                     continue;
 
-                // get all starlanes emanating from this system, and loop through them
-                const std::map<int, bool>& starlane_map = system->StarlanesWormholes();
-                for (std::map<int, bool>::const_iterator lane_it = starlane_map.begin();
-                     lane_it != starlane_map.end(); ++lane_it)
-                {
-                    bool is_wormhole = lane_it->second;
-                    if (is_wormhole)
-                        continue;
-
-                    // find entry for system on other end of starlane in visibility
-                    // map, and upgrade to basic visibility if not already at that
-                    // leve, so that starlanes will be visible if either system it
-                    // ends at is partially visible or better
-                    int lane_end_sys_id = lane_it->first;
-                    Universe::ObjectVisibilityMap::iterator lane_end_vis_it = vis_map.find(lane_end_sys_id);
-                    if (lane_end_vis_it == vis_map.end())
-                        vis_map[lane_end_sys_id] = VIS_BASIC_VISIBILITY;
-                    else if (lane_end_vis_it->second < VIS_BASIC_VISIBILITY)
-                        lane_end_vis_it->second = VIS_BASIC_VISIBILITY;
-                }
+                // upgrade system on other end of starlane to basic visibility
+                // if not already at that level, so that starlanes will be
+                // visible if either system it ends at is partially visible or
+                // better
+                vis_table.RaiseVisibility(lane_it->first, VIS_BASIC_VISIBILITY);
             }
         }
-
     }
 
     void SetTravelledStarlaneEndpointsVisible(const ObjectMap& objects,
-                                              Universe::EmpireObjectVisibilityMap& empire_object_visibility)
+                                              std::map<int, ObjectVisibilityTable>& empire_object_visibility)
     {
         // ensure systems on either side of a starlane along which a fleet is
         // moving are at least basically visible, so that the starlane itself can /
@@ -2734,81 +3016,108 @@ namespace {
 
             // ensure fleet's owner has at least basic visibility of the next
             // and previous systems on the fleet's path
-            Universe::ObjectVisibilityMap& vis_map = empire_object_visibility[fleet->Owner()];
-
-            Universe::ObjectVisibilityMap::iterator system_vis_it = vis_map.find(prev);
-            if (system_vis_it == vis_map.end()) {
-                vis_map[prev] = VIS_BASIC_VISIBILITY;
-            } else {
-                if (system_vis_it->second < VIS_BASIC_VISIBILITY)
-                    system_vis_it->second = VIS_BASIC_VISIBILITY;
-            }
-
-            system_vis_it = vis_map.find(next);
-            if (system_vis_it == vis_map.end()) {
-                vis_map[next] = VIS_BASIC_VISIBILITY;
-            } else {
-                if (system_vis_it->second < VIS_BASIC_VISIBILITY)
-                    system_vis_it->second = VIS_BASIC_VISIBILITY;
-            }
+            ObjectVisibilityTable& vis_table = empire_object_visibility[fleet->Owner()];
+            vis_table.RaiseVisibility(prev, VIS_BASIC_VISIBILITY);
+            vis_table.RaiseVisibility(next, VIS_BASIC_VISIBILITY);
         }
     }
 
-    void SetEmpireSpecialVisibilities(const ObjectMap& objects,
-                                      Universe::EmpireObjectVisibilityMap& empire_object_visibility,
-                                      Universe::EmpireObjectSpecialsMap& empire_object_visible_specials)
+    void SetEmpireSpecialVisibilities(const Empire* empire, const ObjectMap& objects,
+                                      const ObjectVisibilityTable& obj_vis_table,
+                                      Universe::ObjectSpecialsMap& obj_specials_map)
     {
         // after setting object visibility, similarly set visibility of objects'
-        // specials for each empire
-        for (EmpireManager::iterator empire_it = Empires().begin();
-             empire_it != Empires().end(); ++empire_it)
+        // specials for the empire
+        const Meter* detection_meter = empire->GetMeter("METER_DETECTION_STRENGTH");
+        if (!detection_meter)
+            return;
+        double detection_strength = detection_meter->Current();
+
+        // every object empire has visibility of might have specials
+        std::vector<int> visible_object_ids;
+        obj_vis_table.GetVisibleObjectIDs(visible_object_ids);
+        for (std::vector<int>::const_iterator id_it = visible_object_ids.begin();
+             id_it != visible_object_ids.end(); ++id_it)
         {
-            int empire_id = empire_it->first;
-            Universe::ObjectVisibilityMap& obj_vis_map = empire_object_visibility[empire_id];
-            Universe::ObjectSpecialsMap& obj_specials_map = empire_object_visible_specials[empire_id];
+            int object_id = *id_it;
 
-            const Empire* empire = empire_it->second;
-            const Meter* detection_meter = empire->GetMeter("METER_DETECTION_STRENGTH");
-            if (!detection_meter)
+            TemporaryPtr<const UniverseObject> obj = objects.Object(object_id);
+            if (!obj)
+                continue;
+            const std::map<std::string, int>& all_object_specials = obj->Specials();
+            if (all_object_specials.empty())
                 continue;
-            double detection_strength = detection_meter->Current();
 
-            // every object empire has visibility of might have specials
-            for (Universe::ObjectVisibilityMap::const_iterator obj_it = obj_vis_map.begin();
-                 obj_it != obj_vis_map.end(); ++obj_it)
-            {
-                if (obj_it->second <= VIS_NO_VISIBILITY)
-                    continue;
+            std::set<std::string>& visible_specials = obj_specials_map[object_id];
 
-                int object_id = obj_it->first;
-                TemporaryPtr<const UniverseObject> obj = objects.Object(object_id);
-                if (!obj)
-                    continue;
-                const std::map<std::string, int>& all_object_specials = obj->Specials();
-                if (all_object_specials.empty())
+            // check all object's specials.
+            for (std::map<std::string, int>::const_iterator special_it = all_object_specials.begin();
+                 special_it != all_object_specials.end(); ++special_it)
+            {
+                const Special* special = GetSpecial(special_it->first);
+                if (!special)
                     continue;
-
-                std::set<std::string>& visible_specials = obj_specials_map[object_id];
-
-                // check all object's specials.
-                std::vector<std::string> potentially_detectable_object_specials;
-                for (std::map<std::string, int>::const_iterator special_it = all_object_specials.begin();
-                     special_it != all_object_specials.end(); ++special_it)
-                {
-                    const Special* special = GetSpecial(special_it->first);
-                    if (!special)
-                        continue;
-                    double special_stealth = special->Stealth();
-                    // if special is 0 stealth, or has stealth less than empire's
-                    // detection strength, mark as visible
-                    if (special_stealth <= 0.0 || special_stealth <= detection_strength) {
-                        visible_specials.insert(special_it->first);
-                        //Logger().debugStream() << "Special " << special_it->first << " on " << obj->Name() << " is visible to empire " << empire_id;
-                    }
+                double special_stealth = special->Stealth();
+                // if special is 0 stealth, or has stealth less than empire's
+                // detection strength, mark as visible
+                if (special_stealth <= 0.0 || special_stealth <= detection_strength) {
+                    visible_specials.insert(special_it->first);
+                    //Logger().debugStream() << "Special " << special_it->first << " on " << obj->Name() << " is visible to empire " << empire->EmpireID();
                 }
             }
         }
     }
+
+    /** Sets one empire's visibility of objects that depends only on that
+      * empire's detection and on what else it can see: objects and fields
+      * in range of its detectors, containers of and systems next to objects
+      * it can see, and specials on objects it can see.  Each work item only
+      * changes the maps of its own empire, so work items for different
+      * empires can run concurrently. */
+    class UpdateEmpireVisibilityWorkItem {
+    public:
+        UpdateEmpireVisibilityWorkItem(const Empire* empire, const ObjectMap& objects,
+                                       const std::map<std::pair<double, double>, float>* detector_position_ranges,
+                                       const std::map<std::pair<double, double>, std::vector<int> >* detectable_position_objects,
+                                       ObjectVisibilityTable& vis_table,
+                                       Universe::ObjectSpecialsMap& specials_map,
+                                       std::set<int>& known_design_ids) :
+            m_empire(empire),
+            m_objects(objects),
+            m_detector_position_ranges(detector_position_ranges),
+            m_detectable_position_objects(detectable_position_objects),
+            m_vis_table(vis_table),
+            m_specials_map(specials_map),
+            m_known_design_ids(known_design_ids)
+        {}
+
+        void operator()() {
+            if (m_detector_position_ranges) {
+                if (m_detectable_position_objects)
+                    SetEmpireObjectVisibilitiesFromRanges(*m_detector_position_ranges, *m_detectable_position_objects,
+                                                          m_vis_table, m_known_design_ids);
+                if (m_empire)
+                    SetEmpireFieldVisibilitiesFromRanges(m_empire, *m_detector_position_ranges, m_objects,
+                                                         m_vis_table, m_known_design_ids);
+            }
+
+            PropegateVisibilityToContainerObjects(m_objects, m_vis_table);
+
+            PropegateVisibilityToSystemsAlongStarlanes(m_objects, m_vis_table);
+
+            if (m_empire)
+                SetEmpireSpecialVisibilities(m_empire, m_objects, m_vis_table, m_specials_map);
+        }
+
+    private:
+        const Empire*                                                   m_empire;   // null for ids without an Empire, which have no detection strength
+        const ObjectMap&                                                m_objects;
+        const std::map<std::pair<double, double>, float>*               m_detector_position_ranges;
+        const std::map<std::pair<double, double>, std::vector<int> >*   m_detectable_position_objects;
+        ObjectVisibilityTable&                                          m_vis_table;
+        Universe::ObjectSpecialsMap&                                    m_specials_map;
+        std::set<int>&                                                  m_known_design_ids;
+    };
 }
 
 void Universe::UpdateEmpireObjectVisibilities() {
@@ -2824,7 +3133,11 @@ void Universe::UpdateEmpireObjectVisibilities() {
         { m_empire_known_ship_design_ids[empire_id].insert(*design_it); }
     }
 
-    m_empire_object_visibility.clear();
+    // clear current visibilities, but keep each empire's table, which also
+    // stores the turns on which objects were last seen
+    for (std::map<int, ObjectVisibilityTable>::iterator it = m_empire_object_visibility.begin();
+         it != m_empire_object_visibility.end(); ++it)
+    { it->second.ClearVisibilities(); }
     m_empire_object_visible_specials.clear();
 
     if (m_all_objects_visible) {
@@ -2833,8 +3146,14 @@ void Universe::UpdateEmpireObjectVisibilities() {
     }
 
 
+    // visibility granted by empires' own objects, which is set for the
+    // objects' owners
     SetEmpireOwnedObjectVisibilities();
 
+    SetSameSystemPlanetsVisible(Objects());
+
+    SetTravelledStarlaneEndpointsVisible(Objects(), m_empire_object_visibility);
+
     std::map<int, std::map<std::pair<double, double>, float> >
         empire_position_detection_ranges = GetEmpiresPositionDetectionRanges();
 
@@ -2842,19 +3161,148 @@ void Universe::UpdateEmpireObjectVisibilities() {
         empire_position_potentially_detectable_objects =
             GetEmpiresPositionsPotentiallyDetectableObjects(Objects());
 
-    SetEmpireObjectVisibilitiesFromRanges(empire_position_detection_ranges,
-                                          empire_position_potentially_detectable_objects);
-    SetEmpireFieldVisibilitiesFromRanges(empire_position_detection_ranges, Objects());
+    // the rest of each empire's visibility depends only on its own detection
+    // and visibility, so is set separately for each empire.  create each
+    // empire's maps first, so the work items don't modify the maps of maps
+    std::set<int> empire_ids;
+    for (std::map<int, ObjectVisibilityTable>::const_iterator it = m_empire_object_visibility.begin();
+         it != m_empire_object_visibility.end(); ++it)
+    { empire_ids.insert(it->first); }
+    for (std::map<int, std::map<std::pair<double, double>, float> >::const_iterator
+         it = empire_position_detection_ranges.begin(); it != empire_position_detection_ranges.end(); ++it)
+    { empire_ids.insert(it->first); }
+    for (EmpireManager::iterator empire_it = Empires().begin(); empire_it != Empires().end(); ++empire_it)
+        empire_ids.insert(empire_it->first);
+    empire_ids.erase(ALL_EMPIRES);
+
+    std::vector<UpdateEmpireVisibilityWorkItem*> work_items;
+    for (std::set<int>::const_iterator it = empire_ids.begin(); it != empire_ids.end(); ++it) {
+        int empire_id = *it;
+
+        std::map<int, std::map<std::pair<double, double>, float> >::const_iterator ranges_it =
+            empire_position_detection_ranges.find(empire_id);
+        std::map<int, std::map<std::pair<double, double>, std::vector<int> > >::const_iterator detectable_it =
+            empire_position_potentially_detectable_objects.find(empire_id);
+
+        work_items.push_back(new UpdateEmpireVisibilityWorkItem(
+            Empires().Lookup(empire_id), Objects(),
+            ranges_it != empire_position_detection_ranges.end() ? &ranges_it->second : 0,
+            detectable_it != empire_position_potentially_detectable_objects.end() ? &detectable_it->second : 0,
+            m_empire_object_visibility[empire_id], m_empire_object_visible_specials[empire_id],
+            m_empire_known_ship_design_ids[empire_id]));
+    }
+    RunWorkItems(work_items);
+}
 
-    SetSameSystemPlanetsVisible(Objects());
+namespace {
+    /** The inputs that UniverseObject::Copy and Clone use to make an empire's
+      * latest known version of an object: the empire's previous latest known
+      * version, and what the empire can currently see of the object.  Empires
+      * for which these are the same get identical latest known versions, so
+      * one version can be made and shared by all of them. */
+    struct LatestKnownObjectInputs {
+        LatestKnownObjectInputs() :
+            previous(0),
+            vis(VIS_NO_VISIBILITY),
+            visible_specials(),
+            visible_contained_ids(),
+            visible_lanes()
+        {}
 
-    PropegateVisibilityToContainerObjects(Objects(), m_empire_object_visibility);
+        bool operator<(const LatestKnownObjectInputs& rhs) const {
+            if (previous != rhs.previous)
+                return previous < rhs.previous;
+            if (vis != rhs.vis)
+                return vis < rhs.vis;
+            if (visible_specials != rhs.visible_specials)
+                return visible_specials < rhs.visible_specials;
+            if (visible_contained_ids != rhs.visible_contained_ids)
+                return visible_contained_ids < rhs.visible_contained_ids;
+            return visible_lanes < rhs.visible_lanes;
+        }
 
-    PropegateVisibilityToSystemsAlongStarlanes(Objects(), m_empire_object_visibility);
+        const UniverseObject*   previous;
+        Visibility              vis;
+        std::set<std::string>   visible_specials;
+        std::set<int>           visible_contained_ids;
+        std::map<int, bool>     visible_lanes;
+    };
 
-    SetTravelledStarlaneEndpointsVisible(Objects(), m_empire_object_visibility);
+    struct LatestKnownObjectInputsPtrLess {
+        bool operator()(const LatestKnownObjectInputs* lhs, const LatestKnownObjectInputs* rhs) const
+        { return *lhs < *rhs; }
+    };
+
+    /** Finds what one empire's latest known version of each object it can see
+      * this turn will be made from, in order of object id, and updates the
+      * empire's record of the turns on which it has seen those objects.  Each
+      * work item only changes the maps of its own empire, so work items for
+      * different empires can run concurrently. */
+    class GatherLatestKnownObjectInputsWorkItem {
+    public:
+        GatherLatestKnownObjectInputsWorkItem(int empire_id, int current_turn, const Universe& universe,
+                                              ObjectVisibilityTable& vis_table,
+                                              const ObjectMap& known_object_map,
+                                              std::vector<std::pair<int, LatestKnownObjectInputs> >& inputs) :
+            m_empire_id(empire_id),
+            m_current_turn(current_turn),
+            m_universe(universe),
+            m_vis_table(vis_table),
+            m_known_object_map(known_object_map),
+            m_inputs(inputs)
+        {}
+
+        void operator()() {
+            // for each object empire can detect this turn
+            std::vector<int> visible_object_ids;
+            m_vis_table.GetVisibleObjectIDs(visible_object_ids);
+            for (std::vector<int>::const_iterator id_it = visible_object_ids.begin();
+                 id_it != visible_object_ids.end(); ++id_it)
+            {
+                int object_id = *id_it;
+                const Visibility vis = m_vis_table.GetVisibility(object_id);
+
+                TemporaryPtr<const UniverseObject> full_object = m_universe.Objects().Object(object_id); // not filtered on server by visibility
+                if (!full_object)
+                    continue;
+
+                // empire can see object.  need to update empire's latest known
+                // information about object, and historical turns on which object
+                // was seen at various visibility levels.
+
+                // update empire's visibility turn history for current vis, and lesser vis levels
+                if (vis >= VIS_BASIC_VISIBILITY) {
+                    m_vis_table.SetLastTurnVisible(object_id, vis, m_current_turn);
+                    //Logger().debugStream() << " ... Setting empire " << m_empire_id << " object " << full_object->Name() << " (" << object_id << ") vis " << vis << " (and higher) turn to " << m_current_turn;
+                } else {
+                    Logger().errorStream() << "Universe::UpdateEmpireLatestKnownObjectsAndVisibilityTurns() found invalid visibility for object with id " << object_id << " by empire with id " << m_empire_id;
+                    continue;
+                }
+
+                // find what the empire's latest known data about object will
+                // be made from, so empires that will end up with the same data
+                // can share it
+                m_inputs.push_back(std::make_pair(object_id, LatestKnownObjectInputs()));
+                LatestKnownObjectInputs& inputs = m_inputs.back().second;
+                inputs.previous = m_known_object_map.Object(object_id).get();
+                inputs.vis = vis;
+                inputs.visible_specials = m_universe.GetObjectVisibleSpecialsByEmpire(object_id, m_empire_id);
+                inputs.visible_contained_ids = full_object->VisibleContainedObjectIDs(m_empire_id);
+                if (full_object->ObjectType() == OBJ_SYSTEM) {
+                    if (TemporaryPtr<const System> full_system = boost::dynamic_pointer_cast<const System>(full_object))
+                        inputs.visible_lanes = full_system->VisibleStarlanesWormholes(m_empire_id);
+                }
+            }
+        }
 
-    SetEmpireSpecialVisibilities(Objects(), m_empire_object_visibility, m_empire_object_visible_specials);
+    private:
+        int                                                         m_empire_id;
+        int                                                         m_current_turn;
+        const Universe&                                             m_universe;
+        ObjectVisibilityTable&                                      m_vis_table;
+        const ObjectMap&                                            m_known_object_map;
+        std::vector<std::pair<int, LatestKnownObjectInputs> >&      m_inputs;   // each work item writes a separate vector, so no locking is needed
+    };
 }
 
 void Universe::UpdateEmpireLatestKnownObjectsAndVisibilityTurns() {
@@ -2862,16 +3310,43 @@ void Universe::UpdateEmpireLatestKnownObjectsAndVisibilityTurns() {
 
     // assumes m_empire_object_visibility has been updated
 
-    //  for each object in universe
-    //      for each empire that can see object this turn
-    //          update empire's information about object, based on visibility
+    //  for each empire, concurrently
+    //      for each object empire can see this turn
+    //          find what empire knows and can see of object
     //          update empire's visbilility turn history
+    //  for each object in universe
+    //      group empires that can see object this turn by what they know and can see of it
+    //      for each group
+    //          update group's shared information about object, based on visibility
 
     int current_turn = CurrentTurn();
     if (current_turn == INVALID_GAME_TURN)
         return;
 
-    // for each object in universe
+    // create each empire's maps first, so the work items don't modify the maps of maps
+    std::vector<int> empire_ids;
+    for (std::map<int, ObjectVisibilityTable>::const_iterator empire_it = m_empire_object_visibility.begin();
+         empire_it != m_empire_object_visibility.end(); ++empire_it)
+    {
+        int empire_id = empire_it->first;
+        empire_ids.push_back(empire_id);
+        m_empire_latest_known_objects[empire_id];   // creates empty map if none yet present
+    }
+
+    std::vector<std::vector<std::pair<int, LatestKnownObjectInputs> > > empire_inputs(empire_ids.size());
+    std::vector<GatherLatestKnownObjectInputsWorkItem*> work_items;
+    for (std::size_t i = 0; i < empire_ids.size(); ++i) {
+        int empire_id = empire_ids[i];
+        work_items.push_back(new GatherLatestKnownObjectInputsWorkItem(
+            empire_id, current_turn, *this, m_empire_object_visibility[empire_id],
+            m_empire_latest_known_objects[empire_id], empire_inputs[i]));
+    }
+    RunWorkItems(work_items);
+
+    // position in each empire's inputs of the next object it can see
+    std::vector<std::size_t> next_inputs(empire_ids.size(), 0);
+
+    // for each object in universe, in order of id, as the inputs are
     for (ObjectMap::const_iterator<> it = m_objects.const_begin(); it != m_objects.const_end(); ++it) {
         int object_id = it->ID();
         TemporaryPtr<const UniverseObject> full_object = *it; // not filtered on server by visibility
@@ -2880,58 +3355,257 @@ void Universe::UpdateEmpireLatestKnownObjectsAndVisibilityTurns() {
             continue;
         }
 
-        // for each empire with a visibility map
-        for (EmpireObjectVisibilityMap::const_iterator empire_it = m_empire_object_visibility.begin();
-             empire_it != m_empire_object_visibility.end(); ++empire_it)
+        // group empires that can see object by what their latest known
+        // version of it will be made from
+        std::map<const LatestKnownObjectInputs*, std::vector<int>, LatestKnownObjectInputsPtrLess> empire_groups;
+        for (std::size_t i = 0; i < empire_ids.size(); ++i) {
+            const std::vector<std::pair<int, LatestKnownObjectInputs> >& inputs = empire_inputs[i];
+            std::size_t& next = next_inputs[i];
+            while (next < inputs.size() && inputs[next].first < object_id)
+                ++next;
+            if (next < inputs.size() && inputs[next].first == object_id)
+                empire_groups[&inputs[next].second].push_back(empire_ids[i]);
+        }
+
+        // update each group of empires' latest known data about object, based
+        // on current visibility and historical visibility and knowledge of object
+        for (std::map<const LatestKnownObjectInputs*, std::vector<int>, LatestKnownObjectInputsPtrLess>::const_iterator
+             group_it = empire_groups.begin(); group_it != empire_groups.end(); ++group_it)
         {
-            // can empire see object?
-            const ObjectVisibilityMap& vis_map = empire_it->second;    // stores level of visibility empire has for each object it can detect this turn
-            ObjectVisibilityMap::const_iterator vis_it = vis_map.find(object_id);
-            if (vis_it == vis_map.end())
-                continue;   // empire can't see current object, so move to next empire
-            const Visibility vis = vis_it->second;
-            if (vis <= VIS_NO_VISIBILITY)
-                continue;   // empire can't see current object, so move to next empire
+            const std::vector<int>& group_empire_ids = group_it->second;
+            int empire_id = group_empire_ids.front();   // any empire in group gives the same result
+            TemporaryPtr<UniverseObject> known_obj = m_empire_latest_known_objects[empire_id].Object(object_id);
+
+            TemporaryPtr<UniverseObject> updated_obj;
+            if (!known_obj) {
+                // no previously-recorded version of this object for these empires.  create a new one, copying only the information limtied by visibility, leaving the rest as default values
+                updated_obj = TemporaryPtr<UniverseObject>(full_object->Clone(empire_id));
+
+            } else if (NumEmpiresWithLatestKnownObject(object_id, known_obj.get()) > static_cast<int>(group_empire_ids.size())) {
+                // already a stored version of this object, but it is shared
+                // with empires that aren't getting the same update, so update
+                // a copy of it, limited by visibility these empires have for this object this turn
+                updated_obj = TemporaryPtr<UniverseObject>(ObjectMap::CopyForChange(known_obj));
+                if (updated_obj)
+                    updated_obj->Copy(full_object, empire_id);
+
+            } else {
+                // already a stored version of this object used only by these empires.  update it, limited by visibility
+                known_obj->Copy(full_object, empire_id);
+                continue;
+            }
 
-            // empire can see object.  need to update empire's latest known
-            // information about object, and historical turns on which object
-            // was seen at various visibility levels.
+            if (!updated_obj)
+                continue;
+            for (std::vector<int>::const_iterator empire_it = group_empire_ids.begin();
+                 empire_it != group_empire_ids.end(); ++empire_it)
+            { m_empire_latest_known_objects[*empire_it].Insert<UniverseObject>(updated_obj); }
+        }
+    }
+}
 
-            int empire_id = empire_it->first;
+void Universe::CopyObjectToEmpireLatestKnownObjects(TemporaryPtr<const UniverseObject> obj, int empire_id,
+                                                    int visibility_empire_id)
+{
+    if (!obj)
+        return;
+    int object_id = obj->ID();
 
-            ObjectMap&                  known_object_map = m_empire_latest_known_objects[empire_id];        // creates empty map if none yet present
-            ObjectVisibilityTurnMap&    object_vis_turn_map = m_empire_object_visibility_turns[empire_id];  // creates empty map if none yet present
-            VisibilityTurnMap&          vis_turn_map = object_vis_turn_map[object_id];                      // creates empty map if none yet present
+    // can empire see object at all?  if not, skip copying object's info
+    if (GetObjectVisibilityByEmpire(object_id, visibility_empire_id) <= VIS_NO_VISIBILITY)
+        return;
 
+    EmpireObjectMap::iterator map_it = m_empire_latest_known_objects.find(empire_id);
+    if (map_it == m_empire_latest_known_objects.end())
+        return;
+    ObjectMap& known_object_map = map_it->second;
 
-            // update empire's latest known data about object, based on current visibility and historical visibility and knowledge of object
+    TemporaryPtr<UniverseObject> known_obj = known_object_map.Object(object_id);
+    if (!known_obj) {
+        known_object_map.Insert(obj->Clone(), visibility_empire_id);
+        return;
+    }
 
-            // is there already last known version of an UniverseObject stored for this empire?
-            if (TemporaryPtr<UniverseObject> known_obj = known_object_map.Object(object_id)) {
-                known_obj->Copy(full_object, empire_id);                    // already a stored version of this object for this empire.  update it, limited by visibility this empire has for this object this turn
-            } else {
-                if (UniverseObject* new_obj = full_object->Clone(empire_id))    // no previously-recorded version of this object for this empire.  create a new one, copying only the information limtied by visibility, leaving the rest as default values
-                    known_object_map.Insert(new_obj);
+    // don't change other empires' knowledge of object
+    if (NumEmpiresWithLatestKnownObject(object_id, known_obj.get()) > 1) {
+        known_obj = TemporaryPtr<UniverseObject>(ObjectMap::CopyForChange(known_obj));
+        if (!known_obj)
+            return;
+        known_object_map.Insert<UniverseObject>(known_obj, visibility_empire_id);
+    }
+    known_obj->Copy(obj, visibility_empire_id);
+}
+
+int Universe::NumEmpiresWithLatestKnownObject(int object_id, const UniverseObject* known_obj) const {
+    int retval = 0;
+    for (EmpireObjectMap::const_iterator it = m_empire_latest_known_objects.begin();
+         it != m_empire_latest_known_objects.end(); ++it)
+    {
+        if (it->second.Object(object_id).get() == known_obj)
+            ++retval;
+    }
+    return retval;
+}
+
+namespace {
+    /** Updates the set of objects whose latest known state for one empire
+      * appears to be stale.  Each work item only changes the stale set of its
+      * own empire, so work items for different empires can run concurrently. */
+    class UpdateEmpireStaleObjectKnowledgeWorkItem {
+    public:
+        UpdateEmpireStaleObjectKnowledgeWorkItem(int empire_id, const ObjectMap& latest_known_objects,
+                                                 const ObjectVisibilityTable& vis_table,
+                                                 const std::set<int>& destroyed_set,
+                                                 const std::map<int, std::set<int> >& empire_known_destroyed_object_ids,
+                                                 const std::map<std::pair<double, double>, float>* detector_position_ranges,
+                                                 std::set<int>& stale_set) :
+            m_empire_id(empire_id),
+            m_latest_known_objects(latest_known_objects),
+            m_vis_table(vis_table),
+            m_destroyed_set(destroyed_set),
+            m_empire_known_destroyed_object_ids(empire_known_destroyed_object_ids),
+            m_detector_position_ranges(detector_position_ranges),
+            m_stale_set(stale_set)
+        {}
+
+        void operator()() {
+            int empire_id = m_empire_id;
+            const ObjectMap& latest_known_objects = m_latest_known_objects;
+            const ObjectVisibilityTable& vis_table = m_vis_table;
+            std::set<int>& stale_set = m_stale_set;
+            const std::set<int>& destroyed_set = m_destroyed_set;
+
+            // remove stale marking for any known destroyed or currently visible objects
+            for (std::set<int>::iterator stale_it = stale_set.begin(); stale_it != stale_set.end();) {
+                int object_id = *stale_it;
+                if (vis_table.HasVisibility(object_id) ||
+                    destroyed_set.find(object_id) != destroyed_set.end())
+                {
+                    stale_set.erase(stale_it++);
+                } else {
+                    ++stale_it;
+                }
             }
 
-            //Logger().debugStream() << "Empire " << empire_id << " can see object " << object_id << " with vis level " << vis;
 
-            // update empire's visibility turn history for current vis, and lesser vis levels
-            if (vis >= VIS_BASIC_VISIBILITY) {
-                vis_turn_map[VIS_BASIC_VISIBILITY] = current_turn;
-                if (vis >= VIS_PARTIAL_VISIBILITY) {
-                    vis_turn_map[VIS_PARTIAL_VISIBILITY] = current_turn;
-                    if (vis >= VIS_FULL_VISIBILITY) {
-                        vis_turn_map[VIS_FULL_VISIBILITY] = current_turn;
+            // get empire latest known objects that are potentially detectable
+            std::map<int, std::map<std::pair<double, double>, std::vector<int> > >
+                empires_latest_known_objects_that_should_be_detectable =
+                    GetEmpiresPositionsPotentiallyDetectableObjects(latest_known_objects, empire_id);
+
+            const std::map<std::pair<double, double>, std::vector<int> >&
+                empire_latest_known_should_be_still_detectable_objects =
+                    empires_latest_known_objects_that_should_be_detectable[empire_id];
+
+            // get empire detection ranges
+            if (!m_detector_position_ranges)
+                return;
+            const std::map<std::pair<double, double>, float>& empire_detector_positions_ranges =
+                *m_detector_position_ranges;
+
+            // filter should-be-still-detectable objects by whether they are
+            // in range of a detector
+            std::vector<int> should_still_be_detectable_latest_known_objects =
+                FilterObjectPositionsByDetectorPositionsAndRanges(
+                    empire_latest_known_should_be_still_detectable_objects,
+                    empire_detector_positions_ranges);
+
+            // filter to exclude objects that are known to have been destroyed
+            FilterObjectIDsByKnownDestruction(should_still_be_detectable_latest_known_objects,
+                                              empire_id, m_empire_known_destroyed_object_ids);
+
+            // any objects that pass filters but aren't actually still visible
+            // represent out-of-date info in empire's latest known objects.  these
+            // entries need to be removed / flagged to indicate this
+            for (std::vector<int>::const_iterator
+                 should_still_be_detectable_object_it = should_still_be_detectable_latest_known_objects.begin();
+                 should_still_be_detectable_object_it != should_still_be_detectable_latest_known_objects.end();
+                 ++should_still_be_detectable_object_it)
+            {
+                int object_id = *should_still_be_detectable_object_it;
+                if (vis_table.GetVisibility(object_id) < VIS_BASIC_VISIBILITY) {
+                    // object not visible even though the latest known info about it
+                    // for this empire suggests it should be.  info is stale.
+                    stale_set.insert(object_id);
+                }
+            }
+
+            // fleets that are not visible and that contain no ships or only stale ships are stale
+            for (ObjectMap::const_iterator<> obj_it = latest_known_objects.const_begin();
+                 obj_it != latest_known_objects.const_end(); ++obj_it)
+            {
+                if (obj_it->ObjectType() != OBJ_FLEET)
+                    continue;
+                if (obj_it->GetVisibility(empire_id) >= VIS_BASIC_VISIBILITY)
+                    continue;
+                TemporaryPtr<const Fleet> fleet = boost::dynamic_pointer_cast<const Fleet>(*obj_it);
+                if (!fleet)
+                    continue;
+                int fleet_id = obj_it->ID();
+
+                // destroyed? not stale
+                if (destroyed_set.find(fleet_id) != destroyed_set.end()) {
+                    stale_set.insert(fleet_id);
+                    continue;
+                }
+
+                // no ships? -> stale
+                if (fleet->Empty()) {
+                    stale_set.insert(fleet_id);
+                    continue;
+                }
+                const std::set<int>& ship_ids = fleet->ShipIDs();
+
+                bool fleet_stale = true;
+                // check each ship. if any are visible or not visible but not stale,
+                // fleet is not stale
+                for (std::set<int>::const_iterator ship_it = ship_ids.begin();
+                     ship_it != ship_ids.end(); ++ship_it)
+                {
+                    int ship_id = *ship_it;
+                    TemporaryPtr<const Ship> ship = latest_known_objects.Object<Ship>(ship_id);
+
+                    // if ship doesn't think it's in this fleet, doesn't count.
+                    if (!ship || ship->FleetID() != fleet_id)
+                        continue;
+
+                    // if ship is destroyed, doesn't count
+                    if (destroyed_set.find(ship_id) != destroyed_set.end())
+                        continue;
+
+                    // is contained ship visible? If so, fleet is not stale.
+                    if (vis_table.GetVisibility(ship_id) > VIS_NO_VISIBILITY) {
+                        fleet_stale = false;
+                        break;
+                    }
+
+                    // is contained ship not visible and not stale? if so, fleet is not stale
+                    if (stale_set.find(ship_id) == stale_set.end()) {
+                        fleet_stale = false;
+                        break;
                     }
                 }
-                //Logger().debugStream() << " ... Setting empire " << empire_id << " object " << full_object->Name() << " (" << object_id << ") vis " << vis << " (and higher) turn to " << current_turn;
-            } else {
-                Logger().errorStream() << "Universe::UpdateEmpireLatestKnownObjectsAndVisibilityTurns() found invalid visibility for object with id " << object_id << " by empire with id " << empire_id;
-                continue;
+                if (fleet_stale)
+                    stale_set.insert(fleet_id);
             }
+
+            //for (std::set<int>::const_iterator stale_it = stale_set.begin();
+            //     stale_it != stale_set.end(); ++stale_it)
+            //{
+            //    TemporaryPtr<const UniverseObject> obj = latest_known_objects.Object(*stale_it);
+            //    Logger().debugStream() << "Object " << *stale_it << " : " << (obj ? obj->Name() : "(unknown)") << " is stale for empire " << empire_id ;
+            //}
         }
-    }
+
+    private:
+        int                                                 m_empire_id;
+        const ObjectMap&                                    m_latest_known_objects;
+        const ObjectVisibilityTable&                        m_vis_table;
+        const std::set<int>&                                m_destroyed_set;
+        const std::map<int, std::set<int> >&                m_empire_known_destroyed_object_ids;
+        const std::map<std::pair<double, double>, float>*   m_detector_position_ranges;
+        std::set<int>&                                      m_stale_set;
+    };
 }
 
 void Universe::UpdateEmpireStaleObjectKnowledge() {
@@ -2944,140 +3618,23 @@ void Universe::UpdateEmpireStaleObjectKnowledge() {
     const std::map<int, std::map<std::pair<double, double>, float> >
         empire_location_detection_ranges = GetEmpiresPositionDetectionRanges();
 
+    // each empire's update is independent of the others.  create each
+    // empire's maps first, so the work items don't modify the maps of maps
+    std::vector<UpdateEmpireStaleObjectKnowledgeWorkItem*> work_items;
     for (EmpireObjectMap::iterator empire_it = m_empire_latest_known_objects.begin();
          empire_it != m_empire_latest_known_objects.end(); ++empire_it)
     {
         int empire_id = empire_it->first;
-        const ObjectMap& latest_known_objects = empire_it->second;
-        const ObjectVisibilityMap& vis_map = m_empire_object_visibility[empire_id];
-        std::set<int>& stale_set = m_empire_stale_knowledge_object_ids[empire_id];
-        const std::set<int>& destroyed_set = m_empire_known_destroyed_object_ids[empire_id];
-
-        // remove stale marking for any known destroyed or currently visible objects
-        for (std::set<int>::iterator stale_it = stale_set.begin(); stale_it != stale_set.end();) {
-            int object_id = *stale_it;
-            if (vis_map.find(object_id) != vis_map.end() ||
-                destroyed_set.find(object_id) != destroyed_set.end())
-            {
-                stale_set.erase(stale_it++);
-            } else {
-                ++stale_it;
-            }
-        }
-
-
-        // get empire latest known objects that are potentially detectable
-        std::map<int, std::map<std::pair<double, double>, std::vector<int> > >
-            empires_latest_known_objects_that_should_be_detectable =
-                GetEmpiresPositionsPotentiallyDetectableObjects(latest_known_objects, empire_id);
-
-        const std::map<std::pair<double, double>, std::vector<int> >&
-            empire_latest_known_should_be_still_detectable_objects =
-                empires_latest_known_objects_that_should_be_detectable[empire_id];
-
-        // get empire detection ranges
         std::map<int, std::map<std::pair<double, double>, float> >::const_iterator
             empire_detectors_it = empire_location_detection_ranges.find(empire_id);
-        if (empire_detectors_it == empire_location_detection_ranges.end())
-            continue;
-        const std::map<std::pair<double, double>, float>& empire_detector_positions_ranges =
-            empire_detectors_it->second;
-
-        // filter should-be-still-detectable objects by whether they are
-        // in range of a detector
-        std::vector<int> should_still_be_detectable_latest_known_objects =
-            FilterObjectPositionsByDetectorPositionsAndRanges(
-                empire_latest_known_should_be_still_detectable_objects,
-                empire_detector_positions_ranges);
-
-        // filter to exclude objects that are known to have been destroyed
-        FilterObjectIDsByKnownDestruction(should_still_be_detectable_latest_known_objects,
-                                          empire_id, m_empire_known_destroyed_object_ids);
-
-        // any objects that pass filters but aren't actually still visible
-        // represent out-of-date info in empire's latest known objects.  these
-        // entries need to be removed / flagged to indicate this
-        for (std::vector<int>::const_iterator
-             should_still_be_detectable_object_it = should_still_be_detectable_latest_known_objects.begin();
-             should_still_be_detectable_object_it != should_still_be_detectable_latest_known_objects.end();
-             ++should_still_be_detectable_object_it)
-        {
-            int object_id = *should_still_be_detectable_object_it;
-            ObjectVisibilityMap::const_iterator vis_it = vis_map.find(object_id);
-            if (vis_it == vis_map.end() || vis_it->second < VIS_BASIC_VISIBILITY) {
-                // object not visible even though the latest known info about it
-                // for this empire suggests it should be.  info is stale.
-                stale_set.insert(object_id);
-            }
-        }
 
-        // fleets that are not visible and that contain no ships or only stale ships are stale
-        for (ObjectMap::const_iterator<> obj_it = latest_known_objects.const_begin();
-             obj_it != latest_known_objects.const_end(); ++obj_it)
-        {
-            if (obj_it->ObjectType() != OBJ_FLEET)
-                continue;
-            if (obj_it->GetVisibility(empire_id) >= VIS_BASIC_VISIBILITY)
-                continue;
-            TemporaryPtr<const Fleet> fleet = boost::dynamic_pointer_cast<const Fleet>(*obj_it);
-            if (!fleet)
-                continue;
-            int fleet_id = obj_it->ID();
-
-            // destroyed? not stale
-            if (destroyed_set.find(fleet_id) != destroyed_set.end()) {
-                stale_set.insert(fleet_id);
-                continue;
-            }
-
-            // no ships? -> stale
-            if (fleet->Empty()) {
-                stale_set.insert(fleet_id);
-                continue;
-            }
-            const std::set<int>& ship_ids = fleet->ShipIDs();
-
-            bool fleet_stale = true;
-            // check each ship. if any are visible or not visible but not stale,
-            // fleet is not stale
-            for (std::set<int>::const_iterator ship_it = ship_ids.begin();
-                 ship_it != ship_ids.end(); ++ship_it)
-            {
-                int ship_id = *ship_it;
-                TemporaryPtr<const Ship> ship = latest_known_objects.Object<Ship>(ship_id);
-
-                // if ship doesn't think it's in this fleet, doesn't count.
-                if (!ship || ship->FleetID() != fleet_id)
-                    continue;
-
-                // if ship is destroyed, doesn't count
-                if (destroyed_set.find(ship_id) != destroyed_set.end())
-                    continue;
-
-                // is contained ship visible? If so, fleet is not stale.
-                ObjectVisibilityMap::const_iterator vis_it = vis_map.find(ship_id);
-                if (vis_it != vis_map.end() && vis_it->second > VIS_NO_VISIBILITY) {
-                    fleet_stale = false;
-                    break;
-                }
-
-                // is contained ship not visible and not stale? if so, fleet is not stale
-                if (stale_set.find(ship_id) == stale_set.end()) {
-                    fleet_stale = false;
-                    break;
-                }
-            }
-            if (fleet_stale)
-                stale_set.insert(fleet_id);
-        }
-
-        //for (std::set<int>::const_iterator stale_it = stale_set.begin();
-        //     stale_it != stale_set.end(); ++stale_it)
-        //{
-        //    TemporaryPtr<const UniverseObject> obj = latest_known_objects.Object(*stale_it);
-        //    Logger().debugStream() << "Object " << *stale_it << " : " << (obj ? obj->Name() : "(unknown)") << " is stale for empire " << empire_id ;
-        //}
+        work_items.push_back(new UpdateEmpireStaleObjectKnowledgeWorkItem(
+            empire_id, empire_it->second, m_empire_object_visibility[empire_id],
+            m_empire_known_destroyed_object_ids[empire_id], m_empire_known_destroyed_object_ids,
+            empire_detectors_it != empire_location_detection_ranges.end() ? &empire_detectors_it->second : 0,
+            m_empire_stale_knowledge_object_ids[empire_id]));
     }
+    RunWorkItems(work_items);
 }
 
 void Universe::SetEmpireKnowledgeOfDestroyedObject(int object_id, int empire_id) {
@@ -3136,7 +3693,7 @@ std::set<int> Universe::RecursiveDestroy(int object_id) {
 
     TemporaryPtr<UniverseObject> obj = m_objects.Object(object_id);
     if (!obj) {
-        Logger().debugStream() << "Universe::RecursiveDestroy asked to destroy nonexistant object with id " << object_id;
+        DebugLogger() << "Universe::RecursiveDestroy asked to destroy nonexistant object with id " << object_id;
         return retval;
     }
 
@@ -3222,7 +3779,7 @@ std::set<int> Universe::RecursiveDestroy(int object_id) {
 }
 
 bool Universe::Delete(int object_id) {
-    Logger().debugStream() << "Universe::Delete with ID: " << object_id;
+    DebugLogger() << "Universe::Delete with ID: " << object_id;
     // find object amongst existing objects and delete directly, without storing
     // any info about the previous object (as is done for destroying an object)
     TemporaryPtr<UniverseObject> obj = m_objects.Object(object_id);
@@ -3253,6 +3810,13 @@ void Universe::HandleEmpireElimination(int empire_id)
 {}
 
 void Universe::InitializeSystemGraph(int for_empire_id) {
+    if (m_system_graph_current && for_empire_id == m_system_graph_empire_id) {
+        // no systems have been added, removed or changed by updating objects
+        // in place since the graph was initialized, so it is still accurate
+        UpdateEmpireVisibilityFilteredSystemGraphs(for_empire_id);
+        return;
+    }
+
     typedef boost::graph_traits<GraphImpl::SystemGraph>::edge_descriptor EdgeDescriptor;
     boost::shared_ptr<GraphImpl> new_graph_impl(new GraphImpl());
     std::vector<int> system_ids = ::EmpireKnownObjects(for_empire_id).FindObjectIDs<System>();
@@ -3325,6 +3889,11 @@ void Universe::InitializeSystemGraph(int for_empire_id) {
         // NOTE: re-filling the cache is O(#vertices * (#vertices + #edges)) in the worst case!
         m_system_jumps.resize(system_ids.size());
     }
+
+    // system changes are only tracked when updating objects in place
+    m_system_graph_current = m_update_objects_in_place;
+    m_system_graph_empire_id = for_empire_id;
+
     UpdateEmpireVisibilityFilteredSystemGraphs(for_empire_id);
 }
 
@@ -3366,6 +3935,9 @@ void Universe::UpdateEmpireVisibilityFilteredSystemGraphs(int for_empire_id) {
 int& Universe::EncodingEmpire()
 { return m_encoding_empire; }
 
+int& Universe::StatHistoryEncodingTurn()
+{ return m_stat_history_encoding_turn; }
+
 double Universe::UniverseWidth() const
 { return m_universe_width; }
 
@@ -3375,6 +3947,82 @@ const bool& Universe::UniverseObjectSignalsInhibited()
 void Universe::InhibitUniverseObjectSignals(bool inhibit)
 { m_inhibit_universe_object_signals = inhibit; }
 
+const bool& Universe::UniverseObjectSignalsBatched()
+{ return m_batch_universe_object_signals; }
+
+void Universe::BeginUniverseObjectSignalBatch() {
+    ++m_universe_object_signal_batch_depth;
+    m_batch_universe_object_signals = true;
+}
+
+void Universe::EndUniverseObjectSignalBatch() {
+    if (m_universe_object_signal_batch_depth <= 0) {
+        Logger().errorStream() << "Universe::EndUniverseObjectSignalBatch called without a batch to end";
+        return;
+    }
+    if (--m_universe_object_signal_batch_depth > 0)
+        return;
+    m_batch_universe_object_signals = false;
+
+    std::set<int> changed_object_ids;
+    changed_object_ids.swap(m_batched_universe_object_ids);
+    if (changed_object_ids.empty())
+        return;
+
+    for (std::set<int>::const_iterator it = changed_object_ids.begin(); it != changed_object_ids.end(); ++it) {
+        if (TemporaryPtr<UniverseObject> obj = m_objects.Object(*it))
+            obj->StateChangedSignal();
+    }
+    if (!m_inhibit_universe_object_signals)
+        UniverseObjectsChangedSignal(changed_object_ids);
+}
+
+void Universe::DeferUniverseObjectSignal(int object_id) {
+    // objects may be changed by effects evaluated on several threads
+    boost::mutex::scoped_lock lock(m_batched_universe_object_ids_mutex);
+    m_batched_universe_object_ids.insert(object_id);
+}
+
+void Universe::SetUpdateObjectsInPlace(bool in_place)
+{ m_update_objects_in_place = in_place; }
+
+bool Universe::UpdateObjectsInPlace(ObjectMap& objects, ObjectMap& existing_objects,
+                                    std::vector<TemporaryPtr<UniverseObject> >& changed_objects) const
+{
+    // systems were added or removed if not all existing systems are kept
+    int kept_systems = 0;
+    bool systems_changed = false;
+
+    std::vector<TemporaryPtr<UniverseObject> > updated_objects;
+    for (ObjectMap::iterator<> it = objects.begin(); it != objects.end(); ++it) {
+        bool is_system = it->ObjectType() == OBJ_SYSTEM;
+        TemporaryPtr<UniverseObject> existing = existing_objects.Object(it->ID());
+        if (!existing || existing->ObjectType() != it->ObjectType()) {
+            // new objects, and objects that were replaced by ones of another type, are used as deserialized
+            systems_changed = systems_changed || is_system;
+            continue;
+        }
+        if (existing->UpdateState(**it)) {
+            changed_objects.push_back(existing);
+            systems_changed = systems_changed || is_system;
+        }
+        updated_objects.push_back(existing);
+        if (is_system)
+            ++kept_systems;
+    }
+    systems_changed = systems_changed || kept_systems != existing_objects.NumObjects<System>();
+
+    // replace deserialized objects with the updated existing ones
+    for (std::vector<TemporaryPtr<UniverseObject> >::iterator it = updated_objects.begin();
+         it != updated_objects.end(); ++it)
+    { objects.Insert<UniverseObject>(*it); }
+
+    DebugLogger() << "Universe::UpdateObjectsInPlace : kept " << updated_objects.size()
+                  << " of " << objects.NumObjects() << " objects, of which "
+                  << changed_objects.size() << " changed";
+    return systems_changed;
+}
+
 namespace {
     // Looks like there are at least 4 SourceForEmpire functions lying around:
     // one in ShipDesign, one in Tech, one in Building, one here...
@@ -3382,7 +4030,7 @@ namespace {
     TemporaryPtr<const UniverseObject> SourceForEmpire(int empire_id) {
         const Empire* empire = Empires().Lookup(empire_id);
         if (!empire) {
-            Logger().debugStream() << "SourceForEmpire: Unable to get empire with ID: " << empire_id;
+            DebugLogger() << "SourceForEmpire: Unable to get empire with ID: " << empire_id;
             return TemporaryPtr<const UniverseObject>();
         }
         // get a source object, which is owned by the empire with the passed-in
@@ -3401,6 +4049,34 @@ namespace {
         }
         return source;
     }
+
+    /** Evaluates each of a list of empire statistics for one empire, given
+      * the object to use as the source for that empire. */
+    class EvalEmpireStatsWorkItem {
+    public:
+        EvalEmpireStatsWorkItem(const std::vector<const ValueRef::ValueRefBase<double>*>& value_refs,
+                                TemporaryPtr<const UniverseObject> source,
+                                std::vector<float>::iterator values) :
+            m_value_refs(value_refs),
+            m_source(source),
+            m_values(values)
+        {}
+
+        void operator()() {
+            for (std::size_t i = 0; i < m_value_refs.size(); ++i) {
+                const ValueRef::ValueRefBase<double>* value_ref = m_value_refs[i];
+                if (value_ref->SourceInvariant())
+                    m_values[i] = static_cast<float>(value_ref->Eval());
+                else if (m_source)
+                    m_values[i] = static_cast<float>(value_ref->Eval(ScriptingContext(m_source)));
+            }
+        }
+
+    private:
+        const std::vector<const ValueRef::ValueRefBase<double>*>&   m_value_refs;
+        TemporaryPtr<const UniverseObject>                          m_source;
+        std::vector<float>::iterator                                m_values;   // each work item writes a separate row, so no locking is needed
+    };
 }
 
 void Universe::UpdateStatRecords() {
@@ -3408,41 +4084,64 @@ void Universe::UpdateStatRecords() {
     if (current_turn == INVALID_GAME_TURN)
         return;
     if (current_turn == 0)
-        m_stat_records.clear();
+        m_stat_history.Clear();
+
+    ScopedTimer timer("Universe::UpdateStatRecords", true, true);
 
     const EmpireManager& empires = Empires();
     const std::map<std::string, const ValueRef::ValueRefBase<double>*>& stats = EmpireStatistics::GetEmpireStats();
 
-    std::map<int, TemporaryPtr<const UniverseObject> > empire_sources;
-    for (EmpireManager::const_iterator empire_it = empires.begin(); empire_it != empires.end(); ++empire_it)
-    { empire_sources[empire_it->first] = SourceForEmpire(empire_it->first); }
-
-
-    // process each stat
+    std::vector<const std::string*> stat_names;
+    std::vector<const ValueRef::ValueRefBase<double>*> value_refs;
     for (std::map<std::string, const ValueRef::ValueRefBase<double>*>::const_iterator
          stat_it = stats.begin(); stat_it != stats.end(); ++stat_it)
     {
-        const std::string& stat_name = stat_it->first;
-
-        const ValueRef::ValueRefBase<double>* value_ref = stat_it->second;
-        if (!value_ref)
+        if (!stat_it->second)
             continue;
+        stat_names.push_back(&stat_it->first);
+        value_refs.push_back(stat_it->second);
+    }
 
-        std::map<int, std::map<int, double> >& stat_records = m_stat_records[stat_name];
+    std::vector<int> empire_ids;
+    std::vector<TemporaryPtr<const UniverseObject> > empire_sources;
+    for (EmpireManager::const_iterator empire_it = empires.begin(); empire_it != empires.end(); ++empire_it) {
+        empire_ids.push_back(empire_it->first);
+        empire_sources.push_back(SourceForEmpire(empire_it->first));
+    }
 
-        // calculate stat for each empire, store in records for current turn
-        for (std::map<int, TemporaryPtr<const UniverseObject> >::const_iterator empire_it = empire_sources.begin();
-             empire_it != empire_sources.end(); ++empire_it)
-        {
-            int empire_id = empire_it->first;
+    if (value_refs.empty() || empire_ids.empty())
+        return;
 
-            if (value_ref->SourceInvariant()) {
-                stat_records[empire_id][current_turn] = value_ref->Eval();
-            } else if (empire_it->second) {
-                stat_records[empire_id][current_turn] = value_ref->Eval(ScriptingContext(empire_it->second));
-            }
+    // one row of stat values per empire
+    std::vector<float> values(empire_ids.size() * value_refs.size(), StatColumn::MISSING_VALUE);
+
+    unsigned int num_threads = static_cast<unsigned int>(std::max(1, effects_threads.Get()));
+    if (num_threads <= 1 || empire_ids.size() == 1) {
+        for (std::size_t i = 0; i < empire_ids.size(); ++i)
+            EvalEmpireStatsWorkItem(value_refs, empire_sources[i], values.begin() + i * value_refs.size())();
+    } else {
+        RunQueue<EvalEmpireStatsWorkItem> run_queue(std::min<unsigned int>(num_threads, empire_ids.size()));
+        boost::shared_mutex wait_mutex;
+        boost::unique_lock<boost::shared_mutex> wait_lock(wait_mutex); // create after run_queue, destroy before run_queue
+
+        for (std::size_t i = 0; i < empire_ids.size(); ++i)
+            run_queue.AddWork(new EvalEmpireStatsWorkItem(value_refs, empire_sources[i],
+                                                          values.begin() + i * value_refs.size()));
+
+        run_queue.Wait(wait_lock);
+    }
+
+    // store calculated stats for current turn
+    m_stat_history.SetDownsampling(GetOptionsDB().Get<int>("stat-history-full-resolution-turns"),
+                                   GetOptionsDB().Get<int>("stat-history-downsample-stride"));
+    for (std::size_t i = 0; i < empire_ids.size(); ++i) {
+        for (std::size_t j = 0; j < value_refs.size(); ++j) {
+            float value = values[i * value_refs.size() + j];
+            if (value != StatColumn::MISSING_VALUE)
+                m_stat_history.SetValue(*stat_names[j], empire_ids[i], current_turn, value);
         }
     }
+    m_stat_history.Downsample();
 }
 
 void Universe::GetShipDesignsToSerialize(ShipDesignMap& designs_to_serialize, int encoding_empire) const {
@@ -3524,7 +4223,7 @@ void Universe::GetEmpireKnownObjectsToSerialize(EmpireObjectMap& empire_latest_k
     if (&empire_latest_known_objects == &m_empire_latest_known_objects)
         return;
 
-    Logger().debugStream() << "GetEmpireKnownObjectsToSerialize";
+    DebugLogger() << "GetEmpireKnownObjectsToSerialize";
 
     for (EmpireObjectMap::iterator it = empire_latest_known_objects.begin(); it != empire_latest_known_objects.end(); ++it)
         it->second.Clear();
@@ -3549,7 +4248,10 @@ void Universe::GetEmpireKnownObjectsToSerialize(EmpireObjectMap& empire_latest_k
 
 void Universe::GetEmpireObjectVisibilityMap(EmpireObjectVisibilityMap& empire_object_visibility, int encoding_empire) const {
     if (encoding_empire == ALL_EMPIRES) {
-        empire_object_visibility = m_empire_object_visibility;
+        empire_object_visibility.clear();
+        for (std::map<int, ObjectVisibilityTable>::const_iterator it = m_empire_object_visibility.begin();
+             it != m_empire_object_visibility.end(); ++it)
+        { it->second.GetVisibilities(empire_object_visibility[it->first]); }
         return;
     }
 
@@ -3566,16 +4268,30 @@ void Universe::GetEmpireObjectVisibilityMap(EmpireObjectVisibilityMap& empire_ob
 }
 
 void Universe::GetEmpireObjectVisibilityTurnMap(EmpireObjectVisibilityTurnMap& empire_object_visibility_turns, int encoding_empire) const {
+    empire_object_visibility_turns.clear();
     if (encoding_empire == ALL_EMPIRES) {
-        empire_object_visibility_turns = m_empire_object_visibility_turns;
+        for (std::map<int, ObjectVisibilityTable>::const_iterator it = m_empire_object_visibility.begin();
+             it != m_empire_object_visibility.end(); ++it)
+        { it->second.GetVisibilityTurns(empire_object_visibility_turns[it->first]); }
         return;
     }
 
     // include just requested empire's visibility turn information
-    empire_object_visibility_turns.clear();
-    EmpireObjectVisibilityTurnMap::const_iterator it = m_empire_object_visibility_turns.find(encoding_empire);
-    if (it != m_empire_object_visibility_turns.end())
-        empire_object_visibility_turns[encoding_empire] = it->second;
+    std::map<int, ObjectVisibilityTable>::const_iterator it = m_empire_object_visibility.find(encoding_empire);
+    if (it != m_empire_object_visibility.end())
+        it->second.GetVisibilityTurns(empire_object_visibility_turns[encoding_empire]);
+}
+
+void Universe::SetEmpireObjectVisibilityTables(const EmpireObjectVisibilityMap& empire_object_visibility,
+                                               const EmpireObjectVisibilityTurnMap& empire_object_visibility_turns)
+{
+    m_empire_object_visibility.clear();
+    for (EmpireObjectVisibilityMap::const_iterator it = empire_object_visibility.begin();
+         it != empire_object_visibility.end(); ++it)
+    { m_empire_object_visibility[it->first].SetVisibilities(it->second); }
+    for (EmpireObjectVisibilityTurnMap::const_iterator it = empire_object_visibility_turns.begin();
+         it != empire_object_visibility_turns.end(); ++it)
+    { m_empire_object_visibility[it->first].SetVisibilityTurns(it->second); }
 }
 
 void Universe::GetEmpireKnownDestroyedObjects(ObjectKnowledgeMap& empire_known_destroyed_object_ids, int encoding_empire) const {
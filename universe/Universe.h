@@ -4,12 +4,16 @@
 
 #include "Enums.h"
 #include "ObjectMap.h"
+#include "ObjectVisibilityTable.h"
+#include "StatHistory.h"
 #include "TemporaryPtr.h"
 
+#include <boost/function.hpp>
 #include <boost/signals2/signal.hpp>
 #include <boost/unordered_map.hpp>
 #include <boost/numeric/ublas/symmetric.hpp>
 #include <boost/serialization/access.hpp>
+#include <boost/thread/mutex.hpp>
 #include <boost/thread/shared_mutex.hpp>
 
 #include <vector>
@@ -81,6 +85,9 @@ public:
     /** \name Signal Types */ //@{
     /** emitted just before the UniverseObject is deleted */
     typedef boost::signals2::signal<void (TemporaryPtr<const UniverseObject>)> UniverseObjectDeleteSignalType;
+    /** emitted when a batch of UniverseObject signals ends, with the ids of
+      * the objects that changed during the batch */
+    typedef boost::signals2::signal<void (const std::set<int>&)> UniverseObjectsChangedSignalType;
     //@}
 
     /** \name Structors */ //@{
@@ -142,8 +149,7 @@ public:
       * UniverseObject with id \a object_id .  The returned map may be empty or
       * not have entries for all visibility levels, if the empire has not seen
       * the object at that visibility level yet. */
-    const VisibilityTurnMap&
-                            GetObjectVisibilityTurnMapByEmpire(int object_id, int empire_id) const;
+    VisibilityTurnMap       GetObjectVisibilityTurnMapByEmpire(int object_id, int empire_id) const;
 
     /** Returns the set of specials attached to the object with id \a object_id
       * that the empire with id \a empire_id can see this turn. */
@@ -210,6 +216,46 @@ public:
       * ID is out of range. */
     std::multimap<double, int>              ImmediateNeighbors(int system_id, int empire_id = ALL_EMPIRES) const;
 
+    /** Returns the shortest starlane travel distance from system \a system_id
+      * to every system that can be reached from it, indexed by system id.
+      * Systems that can't be reached are omitted.  Only one search is done,
+      * regardless of the number of destinations.  The distances are
+      * calculated using the visibility for empire \a empire_id, or without
+      * regard to visibility if \a empire_id == ALL_EMPIRES.
+      * \throw std::out_of_range This function will throw if the system ID is
+      * out of range or if the empire ID is not known. */
+    std::map<int, double>                   ShortestPathDistances(int system_id, int empire_id = ALL_EMPIRES) const;
+
+    /** Returns the number of starlane jumps from system \a system_id to every
+      * system that can be reached from it in at most \a max_jumps jumps,
+      * indexed by system id.  The jumps are counted using the visibility for
+      * empire \a empire_id, or without regard to visibility if
+      * \a empire_id == ALL_EMPIRES.
+      * \throw std::out_of_range This function will throw if the system ID is
+      * out of range or if the empire ID is not known. */
+    std::map<int, int>                      LeastJumpsDistances(int system_id, int empire_id = ALL_EMPIRES,
+                                                                int max_jumps = INT_MAX) const;
+
+    /** Returns the shortest starlane travel distances from each system in
+      * \a from_system_ids to each system in \a to_system_ids, in row-major
+      * order: the distance from from_system_ids[i] to to_system_ids[j] is at
+      * index i * to_system_ids.size() + j.  Unreachable pairs have distance
+      * -1.0.  One search is done per source system, and the searches are run
+      * in parallel.  \throw std::out_of_range This function will throw if any
+      * system ID is out of range or if the empire ID is not known. */
+    std::vector<double>                     ShortestPathDistanceMatrix(const std::vector<int>& from_system_ids,
+                                                                       const std::vector<int>& to_system_ids,
+                                                                       int empire_id = ALL_EMPIRES) const;
+
+    /** Returns up to \a count systems, with their starlane travel distances,
+      * that are nearest to system \a system_id and for which \a predicate
+      * returns true, nearest first.  \a system_id itself is a candidate.  The
+      * search stops as soon as enough systems have been found.
+      * \throw std::out_of_range This function will throw if the system ID is
+      * out of range or if the empire ID is not known. */
+    std::vector<std::pair<int, double> >    NearestSystems(int system_id, const boost::function<bool (int)>& predicate,
+                                                           unsigned int count, int empire_id = ALL_EMPIRES) const;
+
     /** Returns map, indexed by object id, to map, indexed by MeterType,
       * to vector of EffectAccountInfo for the meter, in order effects
       * were applied to the meter. */
@@ -219,10 +265,12 @@ public:
       * to grant their owners victory. */
     const std::multimap<int, std::string>&  GetMarkedForVictory() const {return m_marked_for_victory;}
 
-    const std::map<std::string, std::map<int, std::map<int, double> > >&
-                                            GetStatRecords() const { return m_stat_records; }
+    /** Returns the history of empire statistics, as updated by
+      * UpdateStatRecords(). */
+    const StatHistory&                      GetStatHistory() const { return m_stat_history; }
 
     mutable UniverseObjectDeleteSignalType UniverseObjectDeleteSignal; ///< the state changed signal object for this UniverseObject
+    mutable UniverseObjectsChangedSignalType UniverseObjectsChangedSignal; ///< the coalesced state changed signal for batched UniverseObject signals
     //@}
 
     /** \name Mutators */ //@{
@@ -310,6 +358,15 @@ public:
       * visibility that the empire has this turn. */
     void            UpdateEmpireLatestKnownObjectsAndVisibilityTurns();
 
+    /** Copies the information about object \a obj that empire
+      * \a visibility_empire_id can see into the latest known information of
+      * empire \a empire_id, as ObjectMap::CopyObject does.  Latest known
+      * versions of an object may be shared by several empires, so a shared
+      * version is copied before it is changed, leaving other empires'
+      * knowledge unchanged. */
+    void            CopyObjectToEmpireLatestKnownObjects(TemporaryPtr<const UniverseObject> obj, int empire_id,
+                                                         int visibility_empire_id);
+
     /** Checks latest known information about each object for each empire and,
       * in cases when the latest known state (stealth and location) suggests
       * that the empire should be able to see the object, but the object can't
@@ -375,6 +432,36 @@ public:
       * is true, and (re)enables UniverseObjectSignals if \a inhibit is false. */
     void            InhibitUniverseObjectSignals(bool inhibit = true);
 
+    /** Starts a batch of UniverseObject signals.  Until the batch ends, the
+      * slots connected to a UniverseObject's StateChangedSignal aren't called
+      * when it is emitted; instead, the id of the object is recorded.  Batches
+      * may be nested; only the outermost EndUniverseObjectSignalBatch() ends
+      * the batch.  Inhibiting signals takes precedence over batching them. */
+    void            BeginUniverseObjectSignalBatch();
+
+    /** Ends a batch of UniverseObject signals started with
+      * BeginUniverseObjectSignalBatch().  When the outermost batch ends,
+      * StateChangedSignal is emitted once for each object in the universe
+      * that emitted it during the batch, and then UniverseObjectsChangedSignal
+      * is emitted once with the ids of all those objects. */
+    void            EndUniverseObjectSignalBatch();
+
+    /** Records that the object with id \a object_id emitted its
+      * StateChangedSignal during a batch of UniverseObject signals. */
+    void            DeferUniverseObjectSignal(int object_id);
+
+    /** Sets whether deserializing replaces all objects in this universe, as
+      * is done by default, or updates in place the existing objects that have
+      * the same id and type as deserialized objects.  Objects updated in place
+      * keep their identity and signal connections, and emit StateChangedSignal
+      * only if their deserialized state differs from their existing state.
+      * InitializeSystemGraph then also reuses the system graph if no systems
+      * were added, removed or changed by deserializing. */
+    void            SetUpdateObjectsInPlace(bool in_place = true);
+
+    /** Evaluates each empire statistic for each empire and stores the
+      * results for the current turn in the statistics history.  Empires are
+      * evaluated in parallel. */
     void            UpdateStatRecords();
     //@}
 
@@ -390,6 +477,9 @@ public:
     /** Returns true if UniverseOjbectSignals are inhibited, false otherwise. */
     const bool&     UniverseObjectSignalsInhibited();
 
+    /** Returns true if UniverseObjectSignals are batched, false otherwise. */
+    const bool&     UniverseObjectSignalsBatched();
+
     /** HACK! This must be set to the encoding empire's id when serializing a
       * Universe, so that only the relevant parts of the Universe are
       * serialized.  The use of this global variable is done just so I don't
@@ -397,6 +487,13 @@ public:
       * empire-dependent visibility. */
     int&            EncodingEmpire();
 
+    /** The first turn of empire statistics to serialize.  If this is
+      * INVALID_GAME_TURN, the full statistics history is serialized.
+      * Otherwise only values for this and later turns are serialized, and
+      * deserializing them replaces those turns of the existing history, so
+      * that turn updates only need to send newly added statistics. */
+    int&            StatHistoryEncodingTurn();
+
     double          UniverseWidth() const;
     void            SetUniverseWidth(double width) { m_universe_width = width; }
     bool            AllObjectsVisible() const { return m_all_objects_visible; }
@@ -465,6 +562,10 @@ private:
     template <class T>
     TemporaryPtr<T>            InsertID(T* obj, int id);
 
+    /** Returns the number of empires whose latest known version of the object
+      * with id \a object_id is \a known_obj. */
+    int                         NumEmpiresWithLatestKnownObject(int object_id, const UniverseObject* known_obj) const;
+
     struct GraphImpl;
 
     /** Clears \a targets_causes, and then populates with all
@@ -500,8 +601,8 @@ private:
 
     std::set<int>                   m_destroyed_object_ids;             ///< all ids of objects that have been destroyed (on server) or that a player knows were destroyed (on clients)
 
-    EmpireObjectVisibilityMap       m_empire_object_visibility;         ///< map from empire id to (map from object id to visibility of that object for that empire)
-    EmpireObjectVisibilityTurnMap   m_empire_object_visibility_turns;   ///< map from empire id to (map from object id to (map from Visibility rating to turn number on which the empire last saw the object at the indicated Visibility rating or higher)
+    std::map<int, ObjectVisibilityTable>
+                                    m_empire_object_visibility;         ///< map from empire id to table of each object's current visibility for that empire, and the turns on which the empire last saw the object at each Visibility rating or higher
 
     EmpireObjectSpecialsMap         m_empire_object_visible_specials;   ///< map from empire id to (map from object id to (set of names of specials that empire can see are on that object) )
 
@@ -515,6 +616,8 @@ private:
                                     m_system_jumps;                     ///< indexed by system graph index (not system id), caches the smallest number of jumps to travel between all the systems
     boost::shared_ptr<GraphImpl>    m_graph_impl;                       ///< a graph in which the systems are vertices and the starlanes are edges
     boost::unordered_map<int, size_t>  m_system_id_to_graph_index;
+    bool                            m_system_graph_current;             ///< true if no systems have changed since the system graph was last initialized.  only tracked when updating objects in place
+    int                             m_system_graph_empire_id;           ///< empire for which the system graph was last initialized
 
     Effect::AccountingMap           m_effect_accounting_map;            ///< map from target object id, to map from target meter, to orderered list of structs with details of an effect and what it does to the meter
     Effect::DiscrepancyMap          m_effect_discrepancy_map;           ///< map from target object id, to map from target meter, to discrepancy between meter's actual initial value, and the initial value that this meter should have as far as the client can tell: the unknown factor affecting the meter
@@ -527,11 +630,16 @@ private:
 
     double                          m_universe_width;
     bool                            m_inhibit_universe_object_signals;
+    bool                            m_batch_universe_object_signals;
+    int                             m_universe_object_signal_batch_depth;
+    std::set<int>                   m_batched_universe_object_ids;      ///< ids of objects that emitted StateChangedSignal during the current batch
+    boost::mutex                    m_batched_universe_object_ids_mutex;
+    bool                            m_update_objects_in_place;          ///< used during deserialization to keep existing objects that are also deserialized
     int                             m_encoding_empire;                  ///< used during serialization to globally set what empire knowledge to use
     bool                            m_all_objects_visible;              ///< flag set to skip visibility tests and make everything visible to all players
 
-    std::map<std::string, std::map<int, std::map<int, double> > >
-                                    m_stat_records;                     ///< storage for statistics calculated for empires. Indexed by stat name (string), contains a map indexed by empire id, contains a map from turn number (int) to stat value (double).
+    StatHistory                     m_stat_history;                     ///< statistics calculated for empires on each turn
+    int                             m_stat_history_encoding_turn;       ///< used during serialization to set the first turn of statistics to serialize
 
     /** Fills \a designs_to_serialize with ShipDesigns known to the empire with
       * the ID \a encoding empire.  If encoding_empire is ALL_EMPIRES, then all
@@ -559,6 +667,20 @@ private:
     /***/
     void    GetEmpireObjectVisibilityTurnMap(EmpireObjectVisibilityTurnMap& empire_object_visibility_turns, int encoding_empire) const;
 
+    /** Replaces the visibility tables of all empires with ones containing the
+      * entries in \a empire_object_visibility and
+      * \a empire_object_visibility_turns, as loaded by serialization. */
+    void    SetEmpireObjectVisibilityTables(const EmpireObjectVisibilityMap& empire_object_visibility,
+                                            const EmpireObjectVisibilityTurnMap& empire_object_visibility_turns);
+
+    /** Replaces each object in \a objects, which were just deserialized, with
+      * the object in \a existing_objects with the same id and type, if there
+      * is one, after updating that object to the deserialized state.  The
+      * updated objects whose state changed are added to \a changed_objects.
+      * Returns true iff any systems were added, removed or changed. */
+    bool    UpdateObjectsInPlace(ObjectMap& objects, ObjectMap& existing_objects,
+                                 std::vector<TemporaryPtr<UniverseObject> >& changed_objects) const;
+
     /***/
     void    GetEmpireKnownDestroyedObjects(ObjectKnowledgeMap& empire_known_destroyed_object_ids, int encoding_empire) const;
 
@@ -573,5 +695,20 @@ private:
     void serialize(Archive& ar, const unsigned int version);
 };
 
+/** Batches the UniverseObject signals of a universe while in scope.  See
+  * Universe::BeginUniverseObjectSignalBatch(). */
+class ScopedUniverseObjectSignalBatch {
+public:
+    explicit ScopedUniverseObjectSignalBatch(Universe& universe) :
+        m_universe(universe)
+    { m_universe.BeginUniverseObjectSignalBatch(); }
+
+    ~ScopedUniverseObjectSignalBatch()
+    { m_universe.EndUniverseObjectSignalBatch(); }
+
+private:
+    Universe&   m_universe;
+};
+
 
 #endif // _Universe_h_
@@ -8,6 +8,7 @@
 #include "Universe.h"
 
 #include <stdexcept>
+#include <boost/bind.hpp>
 #include <boost/lexical_cast.hpp>
 
 
@@ -17,7 +18,10 @@ const int       UniverseObject::INVALID_OBJECT_AGE = -(1 << 30) - 1;  // using b
 const int       UniverseObject::SINCE_BEFORE_TIME_AGE = (1 << 30) + 1;
 
 UniverseObject::UniverseObject() :
-    StateChangedSignal(blocking_combiner<boost::signals2::optional_last_value<void> >(GetUniverse().UniverseObjectSignalsInhibited())),
+    StateChangedSignal(deferring_combiner<boost::signals2::optional_last_value<void> >(
+        GetUniverse().UniverseObjectSignalsInhibited(),
+        GetUniverse().UniverseObjectSignalsBatched(),
+        boost::bind(&UniverseObject::DeferStateChangedSignal, this))),
     m_name(""),
     m_id(INVALID_OBJECT_ID),
     m_x(INVALID_POSITION),
@@ -32,7 +36,10 @@ UniverseObject::UniverseObject() :
 }
 
 UniverseObject::UniverseObject(const std::string name, double x, double y) :
-    StateChangedSignal(blocking_combiner<boost::signals2::optional_last_value<void> >(GetUniverse().UniverseObjectSignalsInhibited())),
+    StateChangedSignal(deferring_combiner<boost::signals2::optional_last_value<void> >(
+        GetUniverse().UniverseObjectSignalsInhibited(),
+        GetUniverse().UniverseObjectSignalsBatched(),
+        boost::bind(&UniverseObject::DeferStateChangedSignal, this))),
     m_name(name),
     m_id(INVALID_OBJECT_ID),
     m_x(x),
@@ -99,6 +106,19 @@ void UniverseObject::Copy(TemporaryPtr<const UniverseObject> copied_object, Visi
     }
 }
 
+bool UniverseObject::UpdateState(const UniverseObject& updated_object) {
+    bool changed = false;
+    changed |= UpdateMember(m_name,             updated_object.m_name);
+    changed |= UpdateMember(m_x,                updated_object.m_x);
+    changed |= UpdateMember(m_y,                updated_object.m_y);
+    changed |= UpdateMember(m_owner_empire_id,  updated_object.m_owner_empire_id);
+    changed |= UpdateMember(m_system_id,        updated_object.m_system_id);
+    changed |= UpdateMember(m_specials,         updated_object.m_specials);
+    changed |= UpdateMember(m_meters,           updated_object.m_meters);
+    changed |= UpdateMember(m_created_on_turn,  updated_object.m_created_on_turn);
+    return changed;
+}
+
 void UniverseObject::Init()
 { AddMeter(METER_STEALTH); }
 
@@ -334,6 +354,9 @@ std::map<MeterType, Meter> UniverseObject::CensoredMeters(Visibility vis) const
     return retval;
 }
 
+void UniverseObject::DeferStateChangedSignal() const
+{ GetUniverse().DeferUniverseObjectSignal(m_id); }
+
 void UniverseObject::ResetTargetMaxUnpairedMeters() {
     if (Meter* meter = GetMeter(METER_STEALTH))
         meter->ResetCurrent();
@@ -42,7 +42,7 @@ struct UniverseObjectVisitor;
 class FO_COMMON_API UniverseObject : virtual public EnableTemporaryFromThis<UniverseObject> {
 public:
     /** \name Signal Types */ //@{
-    typedef boost::signals2::signal<void (), blocking_combiner<boost::signals2::optional_last_value<void> > > StateChangedSignalType;
+    typedef boost::signals2::signal<void (), deferring_combiner<boost::signals2::optional_last_value<void> > > StateChangedSignalType;
     //@}
 
     /** \name Slot Types */ //@{
@@ -198,10 +198,28 @@ protected:
     void                    Copy(TemporaryPtr<const UniverseObject> copied_object, Visibility vis,
                                  const std::set<std::string>& visible_specials);///< used by public UniverseObject::Copy and derived classes' ::Copy methods
 
+    /** Sets the state of this object to that of \a updated_object, which must
+      * be of the same type, and returns true iff any of it differed.  Used by
+      * Universe to update objects in place when deserializing, instead of
+      * replacing them.  Derived classes must update all the state they
+      * serialize, and call their base classes' UpdateState. */
+    virtual bool            UpdateState(const UniverseObject& updated_object);
+
+    /** Sets \a member to \a value and returns true if they differed, or
+      * returns false otherwise.  Used by UpdateState. */
+    template <class T>
+    static bool             UpdateMember(T& member, const T& value) {
+        if (member == value)
+            return false;
+        member = value;
+        return true;
+    }
+
     std::string                 m_name;
 
 private:
     std::map<MeterType, Meter>  CensoredMeters(Visibility vis) const;   ///< returns set of meters of this object that are censored based on the specified Visibility \a vis
+    void                        DeferStateChangedSignal() const;        ///< records with the universe that StateChangedSignal was emitted while UniverseObject signals are batched
 
     int                         m_id;
     double                      m_x;
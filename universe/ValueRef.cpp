@@ -734,9 +734,9 @@ namespace ValueRef {
         } else if (property_name == "PreferredFocus") {
             const Species* species = 0;
             if (TemporaryPtr<const Planet> planet = boost::dynamic_pointer_cast<const Planet>(object)) {
-                species = GetSpecies(planet->SpeciesName());
+                species = GetSpecies(planet->SpeciesID());
             } else if (TemporaryPtr<const Ship> ship = boost::dynamic_pointer_cast<const Ship>(object)) {
-                species = GetSpecies(ship->SpeciesName());
+                species = GetSpecies(ship->SpeciesID());
             }
             if (species)
                 return species->PreferredFocus();
@@ -0,0 +1,50 @@
+// -*- C++ -*-
+#ifndef _TestApp_h_
+#define _TestApp_h_
+
+#include "universe/Universe.h"
+#include "Empire/EmpireManager.h"
+#include "util/AppInterface.h"
+
+/** Minimal application providing the Universe and empires that game code
+  * reaches through GetUniverse() and Empires(), for unit tests. */
+class TestApp : public IApp {
+public:
+    TestApp() :
+        m_universe(),
+        m_empires()
+    {}
+
+    virtual Universe& GetUniverse()
+    { return m_universe; }
+
+    virtual EmpireManager& Empires()
+    { return m_empires; }
+
+    virtual TemporaryPtr<UniverseObject> GetUniverseObject(int object_id)
+    { return m_universe.Objects().Object(object_id); }
+
+    virtual ObjectMap& EmpireKnownObjects(int empire_id)
+    { return m_universe.EmpireKnownObjects(empire_id); }
+
+    virtual TemporaryPtr<UniverseObject> EmpireKnownObject(int object_id, int empire_id)
+    { return m_universe.EmpireKnownObjects(empire_id).Object(object_id); }
+
+    virtual std::string GetVisibleObjectName(TemporaryPtr<const UniverseObject> object)
+    { return object ? object->Name() : ""; }
+
+    virtual int GetNewObjectID()
+    { return m_universe.GenerateObjectID(); }
+
+    virtual int GetNewDesignID()
+    { return m_universe.GenerateDesignID(); }
+
+    virtual int CurrentTurn() const
+    { return 1; }
+
+private:
+    Universe        m_universe;
+    EmpireManager   m_empires;
+};
+
+#endif // _TestApp_h_
@@ -0,0 +1,91 @@
+#include <boost/test/unit_test.hpp>
+
+#include "TestApp.h"
+
+#include "universe/Universe.h"
+#include "universe/System.h"
+#include "universe/Planet.h"
+#include "util/Serialize.h"
+
+#include <sstream>
+
+namespace {
+    const int EMPIRE_A = 1;
+    const int EMPIRE_B = 2;
+
+    /** A system with two planets, which empires A and B both see in the same
+      * way, so they share one latest known version of each object.  Empire A
+      * then learns that the second planet was destroyed, while empire B does
+      * not. */
+    struct SharedKnowledgeFixture {
+        SharedKnowledgeFixture() {
+            Universe& universe = app.GetUniverse();
+            system = universe.CreateSystem(STAR_YELLOW, "System", 100.0, 100.0);
+            planet_1 = universe.CreatePlanet(PT_SWAMP, SZ_MEDIUM);
+            planet_2 = universe.CreatePlanet(PT_TUNDRA, SZ_SMALL);
+            system->Insert(planet_1);
+            system->Insert(planet_2);
+
+            int empire_ids[] = {EMPIRE_A, EMPIRE_B};
+            for (int i = 0; i < 2; ++i) {
+                universe.SetEmpireObjectVisibility(empire_ids[i], system->ID(), VIS_PARTIAL_VISIBILITY);
+                universe.SetEmpireObjectVisibility(empire_ids[i], planet_1->ID(), VIS_PARTIAL_VISIBILITY);
+                universe.SetEmpireObjectVisibility(empire_ids[i], planet_2->ID(), VIS_PARTIAL_VISIBILITY);
+            }
+            universe.UpdateEmpireLatestKnownObjectsAndVisibilityTurns();
+
+            universe.SetEmpireKnowledgeOfDestroyedObject(planet_2->ID(), EMPIRE_A);
+        }
+
+        /** Serializes the universe as it is sent to empire \a empire_id. */
+        void SerializeFor(int empire_id) {
+            Universe& universe = app.GetUniverse();
+            universe.EncodingEmpire() = empire_id;
+            std::ostringstream os;
+            freeorion_oarchive oa(os);
+            Serialize(oa, universe);
+            universe.EncodingEmpire() = ALL_EMPIRES;
+        }
+
+        TemporaryPtr<const System> KnownSystem(int empire_id)
+        { return app.GetUniverse().EmpireKnownObjects(empire_id).Object<System>(system->ID()); }
+
+        TestApp                 app;
+        TemporaryPtr<System>    system;
+        TemporaryPtr<Planet>    planet_1;
+        TemporaryPtr<Planet>    planet_2;
+    };
+}
+
+BOOST_FIXTURE_TEST_SUITE(LatestKnownObjects, SharedKnowledgeFixture)
+
+BOOST_AUTO_TEST_CASE(EmpiresShareIdenticalKnowledge) {
+    BOOST_REQUIRE(KnownSystem(EMPIRE_A));
+    BOOST_CHECK(KnownSystem(EMPIRE_A) == KnownSystem(EMPIRE_B));
+    BOOST_CHECK_EQUAL(KnownSystem(EMPIRE_B)->PlanetIDs().size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(SerializingForOneEmpireLeavesOtherEmpiresKnowledgeUnchanged) {
+    BOOST_REQUIRE(KnownSystem(EMPIRE_A) == KnownSystem(EMPIRE_B));
+    const System* shared_system = KnownSystem(EMPIRE_B).get();
+
+    // encoding for empire A audits its containment, dropping the planet A
+    // knows to be destroyed from the system it is sent
+    SerializeFor(EMPIRE_A);
+
+    TemporaryPtr<const System> known_b = KnownSystem(EMPIRE_B);
+    BOOST_REQUIRE(known_b);
+    BOOST_CHECK(known_b.get() == shared_system);
+    BOOST_CHECK_EQUAL(known_b->PlanetIDs().size(), 2u);
+    BOOST_CHECK(known_b->PlanetIDs().count(planet_2->ID()));
+    BOOST_CHECK(known_b->ContainedObjectIDs().count(planet_2->ID()));
+
+    // the stored knowledge of empire A is not changed by encoding either
+    BOOST_CHECK(KnownSystem(EMPIRE_A) == known_b);
+
+    // and encoding for empire B afterwards still sees its planets
+    SerializeFor(EMPIRE_B);
+    BOOST_CHECK_EQUAL(KnownSystem(EMPIRE_B)->PlanetIDs().size(), 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,104 @@
+#include <boost/test/unit_test.hpp>
+
+#include "TestApp.h"
+
+#include "Empire/Empire.h"
+
+namespace {
+    const int EMPIRE_ID = 1;
+    const int LOCATION_ID = 1;
+    const int UNGROUPED_LOCATION_ID = 99;
+
+    /** A production queue with several buildings sharing one resource group,
+      * so that each item's projected completion depends on the items before
+      * it, and one item outside any group that never completes.  Tests change
+      * the queue after a first Update(), so that the second Update() reuses
+      * the projections of the items before the change, and compare the
+      * result with a queue projected from scratch. */
+    struct ProductionQueueFixture {
+        ProductionQueueFixture() :
+            app(),
+            queue(EMPIRE_ID)
+        {
+            std::set<int> group;
+            group.insert(LOCATION_ID);
+            group.insert(LOCATION_ID + 1);
+            available_pp[group] = 10.0f;
+
+            Add("BLD_A", 1, LOCATION_ID,            30.0f, 5);
+            Add("BLD_B", 2, LOCATION_ID + 1,        20.0f, 2);
+            Add("BLD_C", 1, UNGROUPED_LOCATION_ID,  10.0f, 1);
+            Add("BLD_D", 3, LOCATION_ID,            50.0f, 5);
+            Add("BLD_E", 1, LOCATION_ID,            10.0f, 1);
+            Add("BLD_F", 2, LOCATION_ID + 1,        40.0f, 4);
+
+            queue.Update(available_pp, costs_and_times, producible);
+        }
+
+        void Add(const std::string& name, int remaining, int location, float cost, int turns) {
+            queue.push_back(ProductionQueue::Element(BT_BUILDING, name, EMPIRE_ID, remaining, remaining, location));
+            costs_and_times.push_back(std::make_pair(cost, turns));
+            producible.push_back(true);
+        }
+
+        /** Checks that the projections of the queue match those of a new
+          * queue with the same items, which has no projections to reuse. */
+        void CheckMatchesFullProjection() {
+            queue.Update(available_pp, costs_and_times, producible);
+
+            ProductionQueue fresh_queue(EMPIRE_ID);
+            for (ProductionQueue::const_iterator it = queue.begin(); it != queue.end(); ++it)
+                fresh_queue.push_back(*it);
+            fresh_queue.Update(available_pp, costs_and_times, producible);
+
+            BOOST_REQUIRE_EQUAL(queue.size(), fresh_queue.size());
+            for (int i = 0; i < static_cast<int>(queue.size()); ++i) {
+                BOOST_CHECK_EQUAL(queue[i].turns_left_to_next_item, fresh_queue[i].turns_left_to_next_item);
+                BOOST_CHECK_EQUAL(queue[i].turns_left_to_completion, fresh_queue[i].turns_left_to_completion);
+                BOOST_CHECK_EQUAL(queue[i].allocated_pp, fresh_queue[i].allocated_pp);
+            }
+        }
+
+        TestApp                                 app;
+        ProductionQueue                         queue;
+        std::map<std::set<int>, float>          available_pp;
+        std::vector<std::pair<float, int> >     costs_and_times;
+        std::vector<bool>                       producible;
+    };
+}
+
+BOOST_FIXTURE_TEST_SUITE(ProductionQueueProjection, ProductionQueueFixture)
+
+BOOST_AUTO_TEST_CASE(ProjectsGroupedItems) {
+    BOOST_CHECK_GT(queue[0].turns_left_to_completion, 0);
+    BOOST_CHECK_GT(queue[5].turns_left_to_completion, queue[0].turns_left_to_completion);
+    BOOST_CHECK_EQUAL(queue[2].turns_left_to_completion, -1);
+}
+
+BOOST_AUTO_TEST_CASE(ReusedProjectionsMatchAfterChangedItem) {
+    int last_completion = queue[5].turns_left_to_completion;
+    queue[3].remaining = 1;
+    CheckMatchesFullProjection();
+    BOOST_CHECK_LT(queue[5].turns_left_to_completion, last_completion);
+}
+
+BOOST_AUTO_TEST_CASE(ReusedProjectionsMatchAfterInsertedItem) {
+    queue.insert(queue.begin() + 2, ProductionQueue::Element(BT_BUILDING, "BLD_G", EMPIRE_ID, 2, 2, LOCATION_ID));
+    costs_and_times.insert(costs_and_times.begin() + 2, std::make_pair(15.0f, 3));
+    producible.insert(producible.begin() + 2, true);
+    CheckMatchesFullProjection();
+}
+
+BOOST_AUTO_TEST_CASE(ReusedProjectionsMatchAfterRemovedItem) {
+    queue.erase(3);
+    costs_and_times.erase(costs_and_times.begin() + 3);
+    producible.erase(producible.begin() + 3);
+    CheckMatchesFullProjection();
+}
+
+BOOST_AUTO_TEST_CASE(ReusedProjectionsMatchAfterProgress) {
+    queue[4].progress = 5.0f;
+    CheckMatchesFullProjection();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
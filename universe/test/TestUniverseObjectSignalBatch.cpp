@@ -0,0 +1,133 @@
+#include <boost/test/unit_test.hpp>
+
+#include "TestApp.h"
+
+#include "universe/Universe.h"
+#include "universe/Planet.h"
+
+#include <boost/bind.hpp>
+
+namespace {
+    /** Two planets, with counts of the emissions of their StateChangedSignals
+      * reaching connected slots, and the ids passed to each emission of the
+      * universe's UniverseObjectsChangedSignal. */
+    struct SignalBatchFixture {
+        SignalBatchFixture() :
+            app(),
+            planet_1_signals(0),
+            planet_2_signals(0)
+        {
+            Universe& universe = app.GetUniverse();
+            planet_1 = universe.CreatePlanet(PT_SWAMP, SZ_MEDIUM);
+            planet_2 = universe.CreatePlanet(PT_TUNDRA, SZ_SMALL);
+            planet_1->StateChangedSignal.connect(boost::bind(&SignalBatchFixture::Increment, boost::ref(planet_1_signals)));
+            planet_2->StateChangedSignal.connect(boost::bind(&SignalBatchFixture::Increment, boost::ref(planet_2_signals)));
+            universe.UniverseObjectsChangedSignal.connect(boost::bind(&SignalBatchFixture::ObjectsChanged, this, _1));
+        }
+
+        static void Increment(int& count)
+        { ++count; }
+
+        void ObjectsChanged(const std::set<int>& object_ids)
+        { changed_object_ids.push_back(object_ids); }
+
+        Universe& GetUniverse()
+        { return app.GetUniverse(); }
+
+        TestApp                     app;
+        TemporaryPtr<Planet>        planet_1;
+        TemporaryPtr<Planet>        planet_2;
+        int                         planet_1_signals;
+        int                         planet_2_signals;
+        std::vector<std::set<int> > changed_object_ids;
+    };
+}
+
+BOOST_FIXTURE_TEST_SUITE(UniverseObjectSignalBatch, SignalBatchFixture)
+
+BOOST_AUTO_TEST_CASE(SignalsPassThroughOutsideBatch) {
+    planet_1->StateChangedSignal();
+    BOOST_CHECK_EQUAL(planet_1_signals, 1);
+    BOOST_CHECK(changed_object_ids.empty());
+}
+
+BOOST_AUTO_TEST_CASE(NestedBatchesEmitWhenOutermostEnds) {
+    GetUniverse().BeginUniverseObjectSignalBatch();
+    {
+        ScopedUniverseObjectSignalBatch inner_batch(GetUniverse());
+        planet_1->StateChangedSignal();
+    }
+    BOOST_CHECK(GetUniverse().UniverseObjectSignalsBatched());
+    BOOST_CHECK_EQUAL(planet_1_signals, 0);
+    BOOST_CHECK(changed_object_ids.empty());
+
+    GetUniverse().EndUniverseObjectSignalBatch();
+    BOOST_CHECK(!GetUniverse().UniverseObjectSignalsBatched());
+    BOOST_CHECK_EQUAL(planet_1_signals, 1);
+    BOOST_REQUIRE_EQUAL(changed_object_ids.size(), 1u);
+    BOOST_CHECK_EQUAL(changed_object_ids[0].size(), 1u);
+    BOOST_CHECK(changed_object_ids[0].count(planet_1->ID()));
+
+    // unmatched end is ignored
+    GetUniverse().EndUniverseObjectSignalBatch();
+    BOOST_CHECK_EQUAL(planet_1_signals, 1);
+    BOOST_CHECK_EQUAL(changed_object_ids.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(RepeatedSignalsAreEmittedOnce) {
+    {
+        ScopedUniverseObjectSignalBatch batch(GetUniverse());
+        planet_1->StateChangedSignal();
+        planet_2->StateChangedSignal();
+        planet_1->StateChangedSignal();
+        planet_1->StateChangedSignal();
+    }
+    BOOST_CHECK_EQUAL(planet_1_signals, 1);
+    BOOST_CHECK_EQUAL(planet_2_signals, 1);
+    BOOST_REQUIRE_EQUAL(changed_object_ids.size(), 1u);
+    BOOST_CHECK_EQUAL(changed_object_ids[0].size(), 2u);
+    BOOST_CHECK(changed_object_ids[0].count(planet_1->ID()));
+    BOOST_CHECK(changed_object_ids[0].count(planet_2->ID()));
+}
+
+BOOST_AUTO_TEST_CASE(BatchWithoutSignalsEmitsNothing) {
+    {
+        ScopedUniverseObjectSignalBatch batch(GetUniverse());
+    }
+    BOOST_CHECK_EQUAL(planet_1_signals, 0);
+    BOOST_CHECK(changed_object_ids.empty());
+}
+
+BOOST_AUTO_TEST_CASE(InhibitTakesPrecedenceOverBatching) {
+    // signals emitted while inhibited aren't recorded by the batch
+    GetUniverse().InhibitUniverseObjectSignals(true);
+    {
+        ScopedUniverseObjectSignalBatch batch(GetUniverse());
+        planet_1->StateChangedSignal();
+    }
+    BOOST_CHECK_EQUAL(planet_1_signals, 0);
+    BOOST_CHECK(changed_object_ids.empty());
+    GetUniverse().InhibitUniverseObjectSignals(false);
+
+    // and signals recorded by the batch aren't emitted if inhibited when it ends
+    {
+        ScopedUniverseObjectSignalBatch batch(GetUniverse());
+        planet_2->StateChangedSignal();
+        GetUniverse().InhibitUniverseObjectSignals(true);
+    }
+    BOOST_CHECK_EQUAL(planet_2_signals, 0);
+    BOOST_CHECK(changed_object_ids.empty());
+    GetUniverse().InhibitUniverseObjectSignals(false);
+
+    // nor are they left over for the next batch
+    {
+        ScopedUniverseObjectSignalBatch batch(GetUniverse());
+        planet_1->StateChangedSignal();
+    }
+    BOOST_CHECK_EQUAL(planet_1_signals, 1);
+    BOOST_CHECK_EQUAL(planet_2_signals, 0);
+    BOOST_REQUIRE_EQUAL(changed_object_ids.size(), 1u);
+    BOOST_CHECK_EQUAL(changed_object_ids[0].size(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,27 @@
+// define the boost archive implementation symbols in this library, as boost's
+// own archive sources do
+#define BOOST_ARCHIVE_SOURCE
+#include <boost/serialization/config.hpp>
+
+#include "CompactBinaryArchive.h"
+
+#include <boost/archive/detail/archive_serializer_map.hpp>
+#include <boost/archive/impl/archive_serializer_map.ipp>
+#include <boost/archive/impl/basic_binary_iarchive.ipp>
+#include <boost/archive/impl/basic_binary_iprimitive.ipp>
+#include <boost/archive/impl/basic_binary_oarchive.ipp>
+#include <boost/archive/impl/basic_binary_oprimitive.ipp>
+
+// explicit instantiation of the archive implementations for the compact
+// archives, as is done for boost's own binary archives
+namespace boost { namespace archive {
+    template class detail::archive_serializer_map<compact_binary_oarchive>;
+    template class basic_binary_oprimitive<compact_binary_oarchive, std::ostream::char_type, std::ostream::traits_type>;
+    template class basic_binary_oarchive<compact_binary_oarchive>;
+    template class binary_oarchive_impl<compact_binary_oarchive, std::ostream::char_type, std::ostream::traits_type>;
+
+    template class detail::archive_serializer_map<compact_binary_iarchive>;
+    template class basic_binary_iprimitive<compact_binary_iarchive, std::istream::char_type, std::istream::traits_type>;
+    template class basic_binary_iarchive<compact_binary_iarchive>;
+    template class binary_iarchive_impl<compact_binary_iarchive, std::istream::char_type, std::istream::traits_type>;
+} }
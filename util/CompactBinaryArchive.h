@@ -0,0 +1,168 @@
+// -*- C++ -*-
+#ifndef _CompactBinaryArchive_h_
+#define _CompactBinaryArchive_h_
+
+#include <boost/archive/archive_exception.hpp>
+#include <boost/archive/binary_iarchive_impl.hpp>
+#include <boost/archive/binary_oarchive_impl.hpp>
+#include <boost/archive/detail/register_archive.hpp>
+#include <boost/cstdint.hpp>
+
+#include <istream>
+#include <ostream>
+
+#include "Export.h"
+
+/** \file CompactBinaryArchive.h
+    Boost.Serialization archives used for saved games and network messages.
+    They are boost's binary archives, except that integers of int size and
+    larger are written as variable-length integers: seven bits per byte,
+    least significant first, with the high bit set on all but the last byte.
+    Signed integers are zig-zag encoded first, so that small negative values
+    such as INVALID_OBJECT_ID and ALL_EMPIRES also take one byte.  Object
+    ids, empire ids, turn numbers, enum values, and container and string
+    lengths thus mostly take one or two bytes instead of four or eight.
+    Integer sizes also no longer depend on the platform, so unlike boost's
+    binary archives, longs can be exchanged between 32 and 64 bit builds.
+
+    Contiguous arrays of bitwise serializable types, such as std::vector<int>
+    or packed meter records, are still written as one raw block of bytes. */
+
+namespace CompactBinary {
+    /** Writes \a value as a variable-length integer to \a buffer, which must
+      * have room for at least 10 bytes, and returns the number of bytes
+      * written. */
+    inline int EncodeVarint(boost::uint64_t value, unsigned char* buffer) {
+        int size = 0;
+        while (value >= 0x80) {
+            buffer[size++] = static_cast<unsigned char>(value | 0x80);
+            value >>= 7;
+        }
+        buffer[size++] = static_cast<unsigned char>(value);
+        return size;
+    }
+
+    inline boost::uint64_t ZigZagEncode(boost::int64_t value)
+    { return (static_cast<boost::uint64_t>(value) << 1) ^ static_cast<boost::uint64_t>(value >> 63); }
+
+    inline boost::int64_t ZigZagDecode(boost::uint64_t value)
+    { return static_cast<boost::int64_t>(value >> 1) ^ -static_cast<boost::int64_t>(value & 1); }
+
+    /** Returns true if the archive at the current position of \a is was
+      * written by boost's standard binary_oarchive, as binary saves were
+      * before the compact archives were used, rather than by a
+      * compact_binary_oarchive.  Both archives begin with the length of the
+      * "serialization::archive" signature, which boost's archive writes as a
+      * size_t and the compact archive as a single varint byte, followed by
+      * the signature.  The position of \a is is left unchanged. */
+    inline bool IsStandardBinaryArchive(std::istream& is) {
+        const char SIGNATURE_LENGTH = 22;
+        const std::istream::pos_type start = is.tellg();
+        char header[2] = {0, 0};
+        is.read(header, 2);
+        bool retval = is.gcount() == 2 && header[0] == SIGNATURE_LENGTH && header[1] == 0;
+        is.clear();
+        is.seekg(start);
+        return retval;
+    }
+}
+
+class FO_COMMON_API compact_binary_oarchive :
+    public boost::archive::binary_oarchive_impl<compact_binary_oarchive,
+                                                std::ostream::char_type,
+                                                std::ostream::traits_type>
+{
+public:
+    /** Writes to \a os.  The archive header is written here rather than by
+      * the base class, as different boost versions write it from different
+      * constructors. */
+    compact_binary_oarchive(std::ostream& os, unsigned int flags = 0) :
+        boost::archive::binary_oarchive_impl<compact_binary_oarchive,
+                                             std::ostream::char_type,
+                                             std::ostream::traits_type>(os, flags | boost::archive::no_header)
+    { init(flags); }
+
+private:
+    friend class boost::archive::save_access;
+    friend class boost::archive::basic_binary_oprimitive<compact_binary_oarchive,
+                                                         std::ostream::char_type,
+                                                         std::ostream::traits_type>;
+    typedef boost::archive::basic_binary_oprimitive<compact_binary_oarchive,
+                                                    std::ostream::char_type,
+                                                    std::ostream::traits_type> primitive_base;
+    using primitive_base::save;
+
+    void save(const int& t)                 { SaveSigned(t); }
+    void save(const long& t)                { SaveSigned(t); }
+    void save(const long long& t)           { SaveSigned(t); }
+    void save(const unsigned int& t)        { SaveUnsigned(t); }
+    void save(const unsigned long& t)       { SaveUnsigned(t); }
+    void save(const unsigned long long& t)  { SaveUnsigned(t); }
+
+    void SaveSigned(boost::int64_t value)
+    { SaveUnsigned(CompactBinary::ZigZagEncode(value)); }
+
+    void SaveUnsigned(boost::uint64_t value) {
+        unsigned char buffer[10];
+        save_binary(buffer, CompactBinary::EncodeVarint(value, buffer));
+    }
+};
+
+class FO_COMMON_API compact_binary_iarchive :
+    public boost::archive::binary_iarchive_impl<compact_binary_iarchive,
+                                                std::istream::char_type,
+                                                std::istream::traits_type>
+{
+public:
+    /** Reads from \a is, which must have been written by a
+      * compact_binary_oarchive. */
+    compact_binary_iarchive(std::istream& is, unsigned int flags = 0) :
+        boost::archive::binary_iarchive_impl<compact_binary_iarchive,
+                                             std::istream::char_type,
+                                             std::istream::traits_type>(is, flags | boost::archive::no_header)
+    { init(flags); }
+
+private:
+    friend class boost::archive::load_access;
+    friend class boost::archive::basic_binary_iprimitive<compact_binary_iarchive,
+                                                         std::istream::char_type,
+                                                         std::istream::traits_type>;
+    typedef boost::archive::basic_binary_iprimitive<compact_binary_iarchive,
+                                                    std::istream::char_type,
+                                                    std::istream::traits_type> primitive_base;
+    using primitive_base::load;
+
+    void load(int& t)                   { t = static_cast<int>(LoadSigned()); }
+    void load(long& t)                  { t = static_cast<long>(LoadSigned()); }
+    void load(long long& t)             { t = static_cast<long long>(LoadSigned()); }
+    void load(unsigned int& t)          { t = static_cast<unsigned int>(LoadUnsigned()); }
+    void load(unsigned long& t)         { t = static_cast<unsigned long>(LoadUnsigned()); }
+    void load(unsigned long long& t)    { t = static_cast<unsigned long long>(LoadUnsigned()); }
+
+    boost::int64_t LoadSigned()
+    { return CompactBinary::ZigZagDecode(LoadUnsigned()); }
+
+    boost::uint64_t LoadUnsigned() {
+        boost::uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            std::istream::int_type byte = m_sb.sbumpc();
+            if (std::istream::traits_type::eq_int_type(byte, std::istream::traits_type::eof()))
+                boost::serialization::throw_exception(
+                    boost::archive::archive_exception(boost::archive::archive_exception::input_stream_error));
+            value |= static_cast<boost::uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80))
+                return value;
+        }
+        boost::serialization::throw_exception(
+            boost::archive::archive_exception(boost::archive::archive_exception::input_stream_error));
+        return value;
+    }
+};
+
+// required by BOOST_CLASS_EXPORT
+BOOST_SERIALIZATION_REGISTER_ARCHIVE(compact_binary_oarchive)
+BOOST_SERIALIZATION_REGISTER_ARCHIVE(compact_binary_iarchive)
+BOOST_SERIALIZATION_USE_ARRAY_OPTIMIZATION(compact_binary_oarchive)
+BOOST_SERIALIZATION_USE_ARRAY_OPTIMIZATION(compact_binary_iarchive)
+
+#endif // _CompactBinaryArchive_h_
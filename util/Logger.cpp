@@ -1,14 +1,217 @@
 #include "Logger.h"
 
+#include "OptionsDB.h"
+#include "i18n.h"
+
 #include <fstream>
 
 #include <log4cpp/Appender.hh>
 #include <log4cpp/Category.hh>
+#include <log4cpp/LayoutAppender.hh>
+#include <log4cpp/LoggingEvent.hh>
 #include <log4cpp/PatternLayout.hh>
 #include <log4cpp/FileAppender.hh>
 
+#include <boost/bind.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/tss.hpp>
+
+#include <list>
+#include <vector>
+
 int g_indent = 0;
 
+namespace {
+    void AddOptions(OptionsDB& db) {
+        db.Add("async-logging",             UserStringNop("OPTIONS_DB_ASYNC_LOGGING_DESC"),             false,  Validator<bool>());
+        db.Add("async-logging-buffer-size", UserStringNop("OPTIONS_DB_ASYNC_LOGGING_BUFFER_SIZE_DESC"), 4096,   RangedValidator<int>(16, 1 << 20));
+    }
+    bool temp_bool = RegisterOptions(&AddOptions);
+
+    const int WRITE_INTERVAL_MS = 100;
+
+    /** Appends logging events to a file from a background writer thread.
+      * Each logging thread queues its events in its own buffer, which is only
+      * locked by the writer when it takes the queued events, so logging
+      * threads don't contend with each other or wait for the file.  Events
+      * are formatted by the layout on the writer thread.  Events of ERROR
+      * priority or higher wake the writer immediately; others are written at
+      * least every WRITE_INTERVAL_MS.  A logging thread whose buffer is full
+      * waits for the writer to take its events, so no events are dropped. */
+    class AsyncFileAppender : public log4cpp::LayoutAppender {
+    public:
+        AsyncFileAppender(const std::string& name, const std::string& filename, std::size_t buffer_size) :
+            log4cpp::LayoutAppender(name),
+            m_filename(filename),
+            m_file(filename.c_str(), std::ios_base::out | std::ios_base::app),
+            m_buffer_size(buffer_size),
+            m_thread_buffer(&DoNotDeleteBuffer),
+            m_stopping(false),
+            m_write_requested(false),
+            m_closed(false),
+            m_writer()
+        { m_writer.reset(new boost::thread(boost::bind(&AsyncFileAppender::WriteEvents, this))); }
+
+        virtual ~AsyncFileAppender()
+        { close(); }
+
+        virtual bool reopen() {
+            boost::mutex::scoped_lock lock(m_file_mutex);
+            m_file.close();
+            m_file.clear();
+            m_file.open(m_filename.c_str(), std::ios_base::out | std::ios_base::app);
+            return m_file.good();
+        }
+
+        /** Writes all queued events and stops the writer thread. */
+        virtual void close() {
+            if (!m_writer)
+                return;
+            {
+                boost::mutex::scoped_lock lock(m_wake_mutex);
+                m_stopping = true;
+            }
+            m_wake.notify_one();
+            m_writer->join();
+            m_writer.reset();
+            m_closed = true;
+            WriteQueuedEvents();    // events queued after the writer's last pass
+        }
+
+    protected:
+        virtual void _append(const log4cpp::LoggingEvent& event) {
+            if (m_closed) {
+                // without a writer thread, events are written immediately
+                boost::mutex::scoped_lock lock(m_file_mutex);
+                m_file << _getLayout().format(event);
+                m_file.flush();
+                return;
+            }
+
+            ThreadBuffer& buffer = CurrentThreadBuffer();
+            bool buffer_full = false;
+            {
+                boost::mutex::scoped_lock lock(buffer.mutex);
+                buffer.events.push_back(event);
+                buffer_full = buffer.events.size() >= m_buffer_size;
+            }
+
+            if (buffer_full || event.priority <= log4cpp::Priority::ERROR)
+                RequestWrite();
+
+            if (buffer_full) {
+                boost::mutex::scoped_lock lock(buffer.mutex);
+                while (buffer.events.size() >= m_buffer_size && !m_closed)
+                    buffer.taken.wait(lock);
+            }
+        }
+
+    private:
+        /** Events queued by one logging thread.  Lists are used as events
+          * can't be assigned, and can be swapped out in constant time. */
+        struct ThreadBuffer {
+            boost::mutex                        mutex;
+            boost::condition_variable           taken;  ///< notified when the writer takes the queued events
+            std::list<log4cpp::LoggingEvent>    events;
+        };
+
+        /** Buffers are owned by m_buffers, so that events queued by a thread
+          * that has exited are still written. */
+        static void DoNotDeleteBuffer(ThreadBuffer*)
+        {}
+
+        ThreadBuffer& CurrentThreadBuffer() {
+            ThreadBuffer* buffer = m_thread_buffer.get();
+            if (buffer)
+                return *buffer;
+
+            boost::mutex::scoped_lock lock(m_buffers_mutex);
+            m_buffers.push_back(boost::shared_ptr<ThreadBuffer>(new ThreadBuffer()));
+            buffer = m_buffers.back().get();
+            m_thread_buffer.reset(buffer);
+            return *buffer;
+        }
+
+        void RequestWrite() {
+            {
+                boost::mutex::scoped_lock lock(m_wake_mutex);
+                m_write_requested = true;
+            }
+            m_wake.notify_one();
+        }
+
+        static bool EarlierEvent(const log4cpp::LoggingEvent& lhs, const log4cpp::LoggingEvent& rhs) {
+            if (lhs.timeStamp.getSeconds() != rhs.timeStamp.getSeconds())
+                return lhs.timeStamp.getSeconds() < rhs.timeStamp.getSeconds();
+            return lhs.timeStamp.getMicroSeconds() < rhs.timeStamp.getMicroSeconds();
+        }
+
+        /** Body of the writer thread. */
+        void WriteEvents() {
+            bool stopping = false;
+            while (!stopping) {
+                {
+                    boost::mutex::scoped_lock lock(m_wake_mutex);
+                    if (!m_stopping && !m_write_requested)
+                        m_wake.timed_wait(lock, boost::posix_time::milliseconds(WRITE_INTERVAL_MS));
+                    m_write_requested = false;
+                    stopping = m_stopping;
+                }
+                WriteQueuedEvents();
+            }
+        }
+
+        /** Takes the events queued by each thread and writes them to the file. */
+        void WriteQueuedEvents() {
+            std::vector<boost::shared_ptr<ThreadBuffer> > buffers;
+            {
+                boost::mutex::scoped_lock lock(m_buffers_mutex);
+                buffers = m_buffers;
+            }
+            std::list<log4cpp::LoggingEvent> events;
+            for (std::vector<boost::shared_ptr<ThreadBuffer> >::iterator it = buffers.begin();
+                 it != buffers.end(); ++it)
+            {
+                std::list<log4cpp::LoggingEvent> thread_events;
+                {
+                    boost::mutex::scoped_lock lock((*it)->mutex);
+                    thread_events.swap((*it)->events);
+                }
+                (*it)->taken.notify_all();
+                // interleave the threads' events in the order they were logged
+                events.merge(thread_events, &EarlierEvent);
+            }
+
+            if (events.empty())
+                return;
+
+            boost::mutex::scoped_lock lock(m_file_mutex);
+            for (std::list<log4cpp::LoggingEvent>::const_iterator it = events.begin(); it != events.end(); ++it)
+                m_file << _getLayout().format(*it);
+            m_file.flush();
+        }
+
+        const std::string                               m_filename;
+        std::ofstream                                   m_file;
+        boost::mutex                                    m_file_mutex;
+        const std::size_t                               m_buffer_size;
+
+        std::vector<boost::shared_ptr<ThreadBuffer> >   m_buffers;
+        boost::mutex                                    m_buffers_mutex;
+        boost::thread_specific_ptr<ThreadBuffer>        m_thread_buffer;
+
+        boost::mutex                                    m_wake_mutex;
+        boost::condition_variable                       m_wake;
+        bool                                            m_stopping;
+        bool                                            m_write_requested;
+        volatile bool                                   m_closed;   ///< true once the writer thread has stopped
+        boost::shared_ptr<boost::thread>                m_writer;
+    };
+}
+
 std::string DumpIndent()
 { return std::string(g_indent * 4, ' '); }
 
@@ -19,7 +222,12 @@ void InitLogger(const std::string& logFile, const std::string& pattern)
     temp.close();
 
     // establish debug logging
-    log4cpp::Appender* appender = new log4cpp::FileAppender("FileAppender", logFile);
+    log4cpp::Appender* appender = 0;
+    if (GetOptionsDB().OptionExists("async-logging") && GetOptionsDB().Get<bool>("async-logging"))
+        appender = new AsyncFileAppender("AsyncFileAppender", logFile,
+                                         GetOptionsDB().Get<int>("async-logging-buffer-size"));
+    else
+        appender = new log4cpp::FileAppender("FileAppender", logFile);
     log4cpp::PatternLayout* layout = new log4cpp::PatternLayout();
     layout->setConversionPattern(pattern);
     appender->setLayout(layout);
@@ -50,4 +258,3 @@ int PriorityValue(const std::string& name)
     }
     return priority_map[name];
 }
-
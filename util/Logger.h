@@ -7,12 +7,21 @@
 #include "Export.h"
 
 /** Initializes the logging system. Log to the given file.
- * If the file already exists it will be deleted. */
+ * If the file already exists it will be deleted.  If the "async-logging"
+ * option is set, log messages are written to the file by a background
+ * thread rather than by the logging thread. */
 FO_COMMON_API void InitLogger(const std::string& logFile, const std::string& pattern);
 
 /** Accessor for the App's logger */
 FO_COMMON_API log4cpp::Category& Logger();
 
+/** Debug stream for the App's logger that is only created if debug logging
+  * is enabled.  Unlike Logger().debugStream(), the expressions streamed to it
+  * aren't evaluated at all when debug logging is disabled, so it should be
+  * preferred where the logged values are expensive to produce, as in
+  * DebugLogger() << objects.Dump(); */
+#define DebugLogger()   if (!Logger().isDebugEnabled()) {} else Logger().debugStream()
+
 extern int g_indent;
 
 /** A function that returns the correct amount of spacing for the current
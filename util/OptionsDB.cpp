@@ -18,6 +18,11 @@ namespace {
         return options_db_registry;
     }
 
+    std::vector<boost::function<void (OptionsDB&)> >& OptionHandleRegistry() {
+        static std::vector<boost::function<void (OptionsDB&)> > option_handle_registry;
+        return option_handle_registry;
+    }
+
     std::string PreviousSectionName(const std::vector<XMLElement*>& elem_stack) {
         std::string retval;
         for (unsigned int i = 1; i < elem_stack.size(); ++i) {
@@ -51,6 +56,9 @@ bool RegisterOptions(OptionsDBFn function) {
     return true;
 }
 
+void RegisterOptionHandle(const boost::function<void (OptionsDB&)>& function)
+{ OptionHandleRegistry().push_back(function); }
+
 OptionsDB& GetOptionsDB() {
     static OptionsDB options_db;
     if (unsigned int registry_size = OptionsRegistry().size()) {
@@ -58,6 +66,13 @@ OptionsDB& GetOptionsDB() {
             OptionsRegistry()[i](options_db);
         OptionsRegistry().clear();
     }
+    if (!OptionHandleRegistry().empty()) {
+        // connecting a handle calls GetOptionsDB(), so swap out the registry first
+        std::vector<boost::function<void (OptionsDB&)> > handle_registry;
+        handle_registry.swap(OptionHandleRegistry());
+        for (unsigned int i = 0; i < handle_registry.size(); ++i)
+            handle_registry[i](options_db);
+    }
     return options_db;
 }
 
@@ -323,7 +338,7 @@ void OptionsDB::SetFromCommandLine(const std::vector<std::string>& args) {
                 option.value = true;
             }
 
-            //option_changed = true;
+            (*option.option_changed_sig_ptr)();
         } else if (current_token.find('-') == 0
 #ifdef FREEORION_MACOSX
                 && current_token.find("-psn") != 0 // Mac OS X passes a process serial number to all applications using Carbon or Cocoa, it should be ignored here
@@ -357,6 +372,8 @@ void OptionsDB::SetFromCommandLine(const std::vector<std::string>& args) {
                     } else {
                         option.value = true;
                     }
+
+                    (*option.option_changed_sig_ptr)();
                 }
             }
         }
@@ -397,7 +414,10 @@ void OptionsDB::SetFromXMLRecursive(const XMLElement& elem, const std::string& s
                 option.SetFromString(elem.Text());
             } catch (const std::exception& e) {
                 Logger().errorStream() << "OptionsDB::SetFromXMLRecursive() : while processing config.xml the following exception was caught when attemptimg to set option \"" << option_name << "\": " << e.what();
+                return;
             }
         }
+
+        (*option.option_changed_sig_ptr)();
     }
 }
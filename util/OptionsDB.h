@@ -7,6 +7,9 @@
 #include "XMLDoc.h"
 
 #include <boost/any.hpp>
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
 #include <boost/signals2/signal.hpp>
 
 #include <map>
@@ -26,6 +29,12 @@ typedef void (*OptionsDBFn)(OptionsDB&); ///< the function signature for functio
   * "bool unused_bool = RegisterOption(&foo)"). */
 FO_COMMON_API bool RegisterOptions(OptionsDBFn function);
 
+/** adds \a function to a vector of functions that connect OptionHandles to
+  * the OptionsDB.  They are called by GetOptionsDB(), after the functions
+  * registered with RegisterOptions(), so that handles constructed at static
+  * initialization time don't access the OptionsDB before it is used. */
+FO_COMMON_API void RegisterOptionHandle(const boost::function<void (OptionsDB&)>& function);
+
 /** returns the single instance of the OptionsDB class */
 FO_COMMON_API OptionsDB& GetOptionsDB();
 
@@ -279,4 +288,76 @@ private:
     friend OptionsDB& GetOptionsDB();
 };
 
+/** A typed handle to the value of an option, for code that reads the option
+  * often, such as in loops or on worker threads.  The handle is connected to
+  * the OptionsDB by the first GetOptionsDB() call after it is constructed, and
+  * caches the option's value when it is added, or immediately if it already
+  * exists.  Reading the value then doesn't involve a lookup, any_cast or lock.
+  * The cached value is updated when the option's OptionChangedSignal is
+  * emitted, on the thread that adds or sets options, as with the OptionsDB
+  * itself.  Handles should have static storage duration, such as at namespace
+  * scope; reading the value of an option that doesn't exist throws, as
+  * OptionsDB::Get() does. */
+template <class T>
+class OptionHandle : private boost::noncopyable {
+public:
+    explicit OptionHandle(const std::string& name) :
+        m_name(name),
+        m_value(),
+        m_exists(false)
+    { RegisterOptionHandle(boost::bind(&OptionHandle::Connect, this, _1)); }
+
+    /** returns the value of the option */
+    T                   Get() const
+    {
+        if (!m_exists)
+            return GetOptionsDB().Get<T>(m_name);   // connects pending handles, or throws if option doesn't exist
+        return m_value;
+    }
+
+    /** returns the name of the option */
+    const std::string&  Name() const
+    { return m_name; }
+
+private:
+    void                Connect(OptionsDB& db)
+    {
+        m_added_connection = db.OptionAddedSignal.connect(
+            boost::bind(&OptionHandle::OptionAdded, this, _1));
+        m_removed_connection = db.OptionRemovedSignal.connect(
+            boost::bind(&OptionHandle::OptionRemoved, this, _1));
+        if (db.OptionExists(m_name))
+            OptionAdded(m_name);
+    }
+
+    void                OptionAdded(const std::string& name)
+    {
+        if (name != m_name)
+            return;
+        OptionsDB& db = GetOptionsDB();
+        m_value = db.Get<T>(m_name);
+        m_changed_connection = db.OptionChangedSignal(m_name).connect(
+            boost::bind(&OptionHandle::OptionChanged, this));
+        m_exists = true;
+    }
+
+    void                OptionChanged()
+    { m_value = GetOptionsDB().Get<T>(m_name); }
+
+    void                OptionRemoved(const std::string& name)
+    {
+        if (name != m_name)
+            return;
+        m_changed_connection.disconnect();
+        m_exists = false;
+    }
+
+    const std::string                           m_name;
+    T                                           m_value;
+    bool                                        m_exists;
+    boost::signals2::scoped_connection          m_added_connection;
+    boost::signals2::scoped_connection          m_changed_connection;
+    boost::signals2::scoped_connection          m_removed_connection;
+};
+
 #endif // _OptionsDB_h_
@@ -0,0 +1,382 @@
+#include "Profiler.h"
+
+#include "Directories.h"
+#include "i18n.h"
+#include "Logger.h"
+#include "OptionsDB.h"
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <vector>
+
+
+namespace {
+    void AddOptions(OptionsDB& db) {
+        db.Add("profiling",                 UserStringNop("OPTIONS_DB_PROFILING_DESC"),             false,   Validator<bool>());
+        db.Add("profiling-buffer-size",     UserStringNop("OPTIONS_DB_PROFILING_BUFFER_SIZE_DESC"), 16384,  RangedValidator<int>(256, 1 << 22));
+        db.Add<std::string>("profiling-trace-file", UserStringNop("OPTIONS_DB_PROFILING_TRACE_FILE_DESC"), "");
+    }
+    bool temp_bool = RegisterOptions(&AddOptions);
+
+    const std::size_t DEFAULT_BUFFER_SIZE = 16384;
+
+    /** A completed scope, as stored in a thread's ring buffer. */
+    struct ProfileEvent {
+        ProfileEvent() : name(), start(0), duration(0), depth(0), thread_id(0), turn(0) {}
+        std::string     name;       // assigned in place, so that slots reuse their string storage once the buffer wraps
+        boost::int64_t  start;      // microseconds since the profiler epoch
+        boost::int64_t  duration;   // microseconds
+        int             depth;
+        int             thread_id;
+        int             turn;
+    };
+
+    /** A counter total recorded at the end of a turn, for trace export. */
+    struct CounterSample {
+        CounterSample() : name(), time(0), value(0) {}
+        CounterSample(const std::string& name_, boost::int64_t time_, boost::int64_t value_) :
+            name(name_), time(time_), value(value_)
+        {}
+        std::string     name;
+        boost::int64_t  time;
+        boost::int64_t  value;
+    };
+
+    /** Per-thread recording state.  The mutex is only contended while the
+      * buffer is read for a summary or trace export. */
+    struct ThreadProfile {
+        ThreadProfile(std::size_t capacity) :
+            thread_id(0),
+            events(capacity),
+            next(0),
+            size(0),
+            depth(0),
+            counters()
+        {}
+
+        int                                     thread_id;
+        std::vector<ProfileEvent>               events;     // ring buffer
+        std::size_t                             next;       // index of the slot to be written next
+        std::size_t                             size;       // number of valid events in the buffer
+        int                                     depth;
+        std::map<const char*, boost::int64_t>   counters;   // keyed by name pointer; merged by name when reported
+        boost::mutex                            mutex;
+    };
+
+    typedef std::vector<boost::shared_ptr<ThreadProfile> > ThreadProfiles;
+
+    boost::mutex                s_registry_mutex;
+    ThreadProfiles              s_thread_profiles;      // all profiles, including those of exited threads
+    std::vector<ThreadProfile*> s_free_profiles;        // profiles of exited threads, available for reuse
+    int                         s_next_thread_id = 1;
+    std::vector<CounterSample>  s_counter_samples;      // ring buffer of counter totals at the end of each turn
+    std::size_t                 s_next_counter_sample = 0;
+    std::size_t                 s_dropped_counter_samples = 0;  // samples overwritten in s_counter_samples before being exported
+
+    boost::mutex                s_state_mutex;          // guards s_enabled and s_current_turn, which BeginTurn() sets from the main thread
+    bool                        s_enabled = false;
+    int                         s_current_turn = 0;
+
+    /** Returns true and sets \a turn to the current turn if the profiler is
+      * recording. */
+    bool RecordingTurn(int& turn) {
+        boost::mutex::scoped_lock lock(s_state_mutex);
+        turn = s_current_turn;
+        return s_enabled;
+    }
+
+    const boost::posix_time::ptime s_epoch = boost::posix_time::microsec_clock::universal_time();
+
+    boost::int64_t Now()
+    { return (boost::posix_time::microsec_clock::universal_time() - s_epoch).total_microseconds(); }
+
+    /** Returns the profile of a thread that has exited to the pool of free
+      * profiles, so that short-lived worker threads don't each allocate a
+      * new ring buffer.  Its recorded events are kept for export. */
+    void ReleaseThreadProfile(ThreadProfile* profile) {
+        boost::mutex::scoped_lock lock(s_registry_mutex);
+        s_free_profiles.push_back(profile);
+    }
+
+    boost::thread_specific_ptr<ThreadProfile> s_thread_profile(&ReleaseThreadProfile);
+
+    ThreadProfile& CurrentThreadProfile() {
+        ThreadProfile* profile = s_thread_profile.get();
+        if (profile)
+            return *profile;
+
+        boost::mutex::scoped_lock lock(s_registry_mutex);
+        if (!s_free_profiles.empty()) {
+            profile = s_free_profiles.back();
+            s_free_profiles.pop_back();
+        } else {
+            std::size_t capacity = DEFAULT_BUFFER_SIZE;
+            if (GetOptionsDB().OptionExists("profiling-buffer-size"))
+                capacity = static_cast<std::size_t>(GetOptionsDB().Get<int>("profiling-buffer-size"));
+            s_thread_profiles.push_back(boost::shared_ptr<ThreadProfile>(new ThreadProfile(capacity)));
+            profile = s_thread_profiles.back().get();
+        }
+        profile->thread_id = s_next_thread_id++;
+        profile->depth = 0;
+        s_thread_profile.reset(profile);
+        return *profile;
+    }
+
+    struct ScopeTotals {
+        ScopeTotals() : calls(0), total(0), max(0), min_depth(-1) {}
+        boost::int64_t  calls;
+        boost::int64_t  total;
+        boost::int64_t  max;
+        int             min_depth;
+    };
+
+    bool LongerTotal(const std::pair<std::string, ScopeTotals>& lhs, const std::pair<std::string, ScopeTotals>& rhs)
+    { return lhs.second.total > rhs.second.total; }
+
+    /** Sums the counters of all threads by name. */
+    std::map<std::string, boost::int64_t> CounterTotals() {
+        std::map<std::string, boost::int64_t> retval;
+        boost::mutex::scoped_lock lock(s_registry_mutex);
+        for (ThreadProfiles::const_iterator it = s_thread_profiles.begin(); it != s_thread_profiles.end(); ++it) {
+            boost::mutex::scoped_lock profile_lock((*it)->mutex);
+            for (std::map<const char*, boost::int64_t>::const_iterator counter_it = (*it)->counters.begin();
+                 counter_it != (*it)->counters.end(); ++counter_it)
+            { retval[counter_it->first] += counter_it->second; }
+        }
+        return retval;
+    }
+
+    std::string JSONEscape(const std::string& text) {
+        std::string retval;
+        retval.reserve(text.size());
+        for (std::string::const_iterator it = text.begin(); it != text.end(); ++it) {
+            switch (*it) {
+            case '"':   retval += "\\\""; break;
+            case '\\':  retval += "\\\\"; break;
+            case '\n':  retval += "\\n"; break;
+            case '\t':  retval += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(*it) < 0x20) {
+                    char buf[8];
+                    std::sprintf(buf, "\\u%04x", static_cast<unsigned int>(static_cast<unsigned char>(*it)));
+                    retval += buf;
+                } else {
+                    retval += *it;
+                }
+            }
+        }
+        return retval;
+    }
+}
+
+namespace Profiler {
+    ////////////////////////////////////////
+    // Scope
+    ////////////////////////////////////////
+    Scope::Scope(const char* name) :
+        m_name(name),
+        m_start(-1),
+        m_turn(0)
+    {
+        if (!m_name || !RecordingTurn(m_turn))
+            return;
+        ++CurrentThreadProfile().depth;
+        m_start = Now();
+    }
+
+    Scope::~Scope() {
+        if (m_start < 0)
+            return;
+        boost::int64_t end = Now();
+
+        ThreadProfile& profile = CurrentThreadProfile();
+        --profile.depth;
+
+        boost::mutex::scoped_lock lock(profile.mutex);
+        ProfileEvent& event = profile.events[profile.next];
+        event.name.assign(m_name);
+        event.start = m_start;
+        event.duration = end - m_start;
+        event.depth = profile.depth;
+        event.thread_id = profile.thread_id;
+        event.turn = m_turn;
+        profile.next = (profile.next + 1) % profile.events.size();
+        profile.size = (std::min)(profile.size + 1, profile.events.size());
+    }
+
+    ////////////////////////////////////////
+    // Free Functions
+    ////////////////////////////////////////
+    void Count(const char* name, boost::int64_t amount/* = 1*/) {
+        int turn;
+        if (!name || !RecordingTurn(turn))
+            return;
+        ThreadProfile& profile = CurrentThreadProfile();
+        boost::mutex::scoped_lock lock(profile.mutex);
+        profile.counters[name] += amount;
+    }
+
+    void BeginTurn(int turn) {
+        bool enabled = GetOptionsDB().Get<bool>("profiling");
+        boost::mutex::scoped_lock lock(s_state_mutex);
+        s_enabled = enabled;
+        s_current_turn = turn;
+    }
+
+    void EndTurn() {
+        int turn;
+        if (!RecordingTurn(turn))
+            return;
+
+        Logger().debugStream() << "Profile of turn " << turn << ":\n" << TurnSummary();
+
+        // keep the turn's counter totals for trace export, then reset them
+        std::map<std::string, boost::int64_t> counters = CounterTotals();
+        boost::int64_t now = Now();
+        std::size_t dropped_counter_samples = 0;
+        {
+            boost::mutex::scoped_lock lock(s_registry_mutex);
+            for (std::map<std::string, boost::int64_t>::const_iterator it = counters.begin(); it != counters.end(); ++it) {
+                CounterSample sample(it->first, now, it->second);
+                if (s_counter_samples.size() < DEFAULT_BUFFER_SIZE) {
+                    s_counter_samples.push_back(sample);
+                } else {
+                    s_counter_samples[s_next_counter_sample] = sample;
+                    s_next_counter_sample = (s_next_counter_sample + 1) % s_counter_samples.size();
+                    ++dropped_counter_samples;
+                }
+            }
+            s_dropped_counter_samples += dropped_counter_samples;
+            for (ThreadProfiles::iterator it = s_thread_profiles.begin(); it != s_thread_profiles.end(); ++it) {
+                boost::mutex::scoped_lock profile_lock((*it)->mutex);
+                (*it)->counters.clear();
+            }
+        }
+        if (dropped_counter_samples)
+            Logger().debugStream() << "Profiler::EndTurn: counter sample buffer full; overwrote the oldest "
+                                   << dropped_counter_samples << " samples, which won't appear in traces";
+
+        const std::string trace_file = GetOptionsDB().Get<std::string>("profiling-trace-file");
+        if (!trace_file.empty()) {
+            boost::filesystem::path trace_path(trace_file);
+            if (!trace_path.has_root_directory())
+                trace_path = GetUserDir() / trace_path;
+            WriteChromeTrace(PathString(trace_path));
+        }
+    }
+
+    std::string TurnSummary() {
+        int turn;
+        RecordingTurn(turn);
+
+        std::map<std::string, ScopeTotals> totals;
+        {
+            boost::mutex::scoped_lock lock(s_registry_mutex);
+            for (ThreadProfiles::const_iterator it = s_thread_profiles.begin(); it != s_thread_profiles.end(); ++it) {
+                const ThreadProfile& profile = **it;
+                boost::mutex::scoped_lock profile_lock((*it)->mutex);
+                for (std::size_t i = 0; i < profile.size; ++i) {
+                    const ProfileEvent& event = profile.events[i];
+                    if (event.turn != turn)
+                        continue;
+                    ScopeTotals& scope_totals = totals[event.name];
+                    ++scope_totals.calls;
+                    scope_totals.total += event.duration;
+                    scope_totals.max = (std::max)(scope_totals.max, event.duration);
+                    if (scope_totals.min_depth < 0 || event.depth < scope_totals.min_depth)
+                        scope_totals.min_depth = event.depth;
+                }
+            }
+        }
+
+        std::vector<std::pair<std::string, ScopeTotals> > sorted_totals(totals.begin(), totals.end());
+        std::sort(sorted_totals.begin(), sorted_totals.end(), LongerTotal);
+
+        std::stringstream ss;
+        ss << std::setw(12) << "total ms" << std::setw(12) << "max ms" << std::setw(10) << "calls" << "  scope\n";
+        ss << std::fixed << std::setprecision(2);
+        for (std::vector<std::pair<std::string, ScopeTotals> >::const_iterator it = sorted_totals.begin();
+             it != sorted_totals.end(); ++it)
+        {
+            ss << std::setw(12) << (it->second.total / 1000.0)
+               << std::setw(12) << (it->second.max / 1000.0)
+               << std::setw(10) << it->second.calls << "  "
+               << std::string(2 * (std::max)(0, it->second.min_depth), ' ') << it->first << "\n";
+        }
+
+        std::map<std::string, boost::int64_t> counters = CounterTotals();
+        for (std::map<std::string, boost::int64_t>::const_iterator it = counters.begin(); it != counters.end(); ++it)
+            ss << std::setw(34) << it->second << "  " << it->first << "\n";
+
+        std::size_t dropped_counter_samples;
+        {
+            boost::mutex::scoped_lock lock(s_registry_mutex);
+            dropped_counter_samples = s_dropped_counter_samples;
+        }
+        if (dropped_counter_samples)
+            ss << std::setw(34) << dropped_counter_samples << "  counter samples dropped from trace buffer\n";
+
+        return ss.str();
+    }
+
+    bool WriteChromeTrace(const std::string& filename) {
+        boost::filesystem::ofstream ofs(filename);
+        if (!ofs) {
+            Logger().errorStream() << "Profiler::WriteChromeTrace couldn't open file " << filename;
+            return false;
+        }
+
+        ofs << "{\"traceEvents\":[\n";
+        bool first = true;
+        {
+            boost::mutex::scoped_lock lock(s_registry_mutex);
+            for (ThreadProfiles::const_iterator it = s_thread_profiles.begin(); it != s_thread_profiles.end(); ++it) {
+                const ThreadProfile& profile = **it;
+                boost::mutex::scoped_lock profile_lock((*it)->mutex);
+                for (std::size_t i = 0; i < profile.size; ++i) {
+                    const ProfileEvent& event = profile.events[i];
+                    ofs << (first ? "" : ",\n")
+                        << "{\"name\":\"" << JSONEscape(event.name) << "\",\"ph\":\"X\",\"pid\":1"
+                        << ",\"tid\":" << event.thread_id
+                        << ",\"ts\":" << event.start << ",\"dur\":" << event.duration
+                        << ",\"args\":{\"turn\":" << event.turn << "}}";
+                    first = false;
+                }
+            }
+            for (std::vector<CounterSample>::const_iterator it = s_counter_samples.begin(); it != s_counter_samples.end(); ++it) {
+                ofs << (first ? "" : ",\n")
+                    << "{\"name\":\"" << JSONEscape(it->name) << "\",\"ph\":\"C\",\"pid\":1"
+                    << ",\"ts\":" << it->time << ",\"args\":{\"value\":" << it->value << "}}";
+                first = false;
+            }
+            if (s_dropped_counter_samples) {
+                // record that older counter samples are missing from the trace
+                ofs << (first ? "" : ",\n")
+                    << "{\"name\":\"dropped_counter_samples\",\"ph\":\"M\",\"pid\":1"
+                    << ",\"args\":{\"count\":" << s_dropped_counter_samples << "}}";
+                first = false;
+            }
+        }
+        ofs << "\n]}\n";
+
+        if (!ofs) {
+            Logger().errorStream() << "Profiler::WriteChromeTrace failed writing to file " << filename;
+            return false;
+        }
+        return true;
+    }
+
+    bool Enabled() {
+        int turn;
+        return RecordingTurn(turn);
+    }
+}
@@ -0,0 +1,73 @@
+// -*- C++ -*-
+#ifndef _Profiler_h_
+#define _Profiler_h_
+
+#if defined(_MSC_VER) && defined(int64_t)
+#undef int64_t
+#endif
+
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <string>
+
+#include "Export.h"
+
+/** \file Profiler.h
+    Low-overhead wall-clock profiling of turn processing.
+
+    Each thread records the scopes it executes, with their nesting depth,
+    into its own fixed-size ring buffer, so recording a scope never formats
+    strings or touches shared data on the hot path.  Threads also keep
+    per-turn counters, such as the number of objects evaluated.  At the end
+    of a turn, the recorded scopes and counters are summarized into a table
+    that is written to the log, and the contents of the ring buffers can be
+    exported as Chrome trace-event JSON, which can be viewed in
+    chrome://tracing or other trace viewers. */
+namespace Profiler {
+    /** Records the wall-clock time between its construction and destruction
+      * as a scope on the calling thread.  Scopes may be nested.  \a name
+      * must remain valid until the Scope is destroyed.  If \a name is null,
+      * nothing is recorded. */
+    class FO_COMMON_API Scope : private boost::noncopyable {
+    public:
+        explicit Scope(const char* name);
+        ~Scope();
+
+    private:
+        const char*     m_name;
+        boost::int64_t  m_start;    ///< microseconds since the profiler was started, or -1 if not recording
+        int             m_turn;     ///< the turn during which the scope started
+    };
+
+    /** Adds \a amount to the counter named \a name on the calling thread for
+      * the current turn.  \a name must be a string literal or otherwise
+      * outlive the profiler; counters are grouped by name when reported. */
+    FO_COMMON_API void          Count(const char* name, boost::int64_t amount = 1);
+
+    /** Marks the start of processing for turn \a turn.  Scopes recorded until
+      * the next call to EndTurn() are attributed to this turn. */
+    FO_COMMON_API void          BeginTurn(int turn);
+
+    /** Marks the end of processing for the current turn.  Logs the turn
+      * summary, writes the trace file if one is configured, and resets the
+      * turn's counters. */
+    FO_COMMON_API void          EndTurn();
+
+    /** Returns a table of the total and maximum wall-clock time and number
+      * of calls of each scope recorded during the current turn, followed by
+      * the turn's counters. */
+    FO_COMMON_API std::string   TurnSummary();
+
+    /** Writes the scopes and counters still held in the ring buffers to the
+      * file \a filename in Chrome trace-event JSON format, with a metadata
+      * event giving the number of counter samples that were overwritten
+      * before being exported, if any.  Returns false if the file couldn't be
+      * written. */
+    FO_COMMON_API bool          WriteChromeTrace(const std::string& filename);
+
+    /** Returns true if scopes and counters are being recorded. */
+    FO_COMMON_API bool          Enabled();
+}
+
+#endif // _Profiler_h_
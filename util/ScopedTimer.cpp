@@ -2,28 +2,35 @@
 
 #include "OptionsDB.h"
 #include "Logger.h"
+#include "Profiler.h"
 
-#include <boost/timer.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
 
+namespace {
+    OptionHandle<bool> verbose_logging("verbose-logging");
+}
 
 class ScopedTimer::ScopedTimerImpl {
 public:
-    ScopedTimerImpl(const std::string& timed_name, bool always_output) :
-        m_timer(),
+    ScopedTimerImpl(const std::string& timed_name, bool always_output, bool profile) :
+        m_start(boost::posix_time::microsec_clock::universal_time()),
         m_name(timed_name),
-        m_always_output(always_output)
+        m_always_output(always_output),
+        m_profiler_scope(profile ? m_name.c_str() : 0)
     {}
     ~ScopedTimerImpl() {
-        if (m_timer.elapsed() * 1000.0 > 1 && ( m_always_output || GetOptionsDB().Get<bool>("verbose-logging")))
-            Logger().debugStream() << m_name << " time: " << (m_timer.elapsed() * 1000.0);
+        double elapsed_ms = (boost::posix_time::microsec_clock::universal_time() - m_start).total_microseconds() / 1000.0;
+        if (elapsed_ms > 1 && ( m_always_output || verbose_logging.Get()))
+            Logger().debugStream() << m_name << " time: " << elapsed_ms;
     }
-    boost::timer    m_timer;
-    std::string     m_name;
-    bool            m_always_output;
+    boost::posix_time::ptime    m_start;
+    std::string                 m_name;
+    bool                        m_always_output;
+    Profiler::Scope             m_profiler_scope;   // declared after m_name, which it refers to
 };
 
-ScopedTimer::ScopedTimer(const std::string& timed_name, bool always_output) :
-    m_impl(new ScopedTimerImpl(timed_name, always_output))
+ScopedTimer::ScopedTimer(const std::string& timed_name, bool always_output, bool profile) :
+    m_impl(new ScopedTimerImpl(timed_name, always_output, profile))
 {}
 
 ScopedTimer::~ScopedTimer()
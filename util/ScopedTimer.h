@@ -6,13 +6,16 @@
 
 #include "Export.h"
 
-/** Wrapper for boost::timer that outputs time during which this object
-  * existed.  Created in the scope of a function, and passed the appropriate
-  * name, it will output to Logger().debugStream() the time elapsed while
-  * the function was executing. */
+/** Measures the wall-clock time during which this object existed.  Created
+  * in the scope of a function, and passed the appropriate name, it will
+  * output to Logger().debugStream() the time elapsed while the function was
+  * executing.  If \a profile is true, the time is also recorded as a
+  * Profiler::Scope, so that it appears in the turn profile summary and trace
+  * export; this should only be done for timers with fixed names, as the
+  * summary has a row for each distinct name. */
 class FO_COMMON_API ScopedTimer {
 public:
-    ScopedTimer(const std::string& timed_name, bool always_output = false);
+    ScopedTimer(const std::string& timed_name, bool always_output = false, bool profile = false);
     ~ScopedTimer();
 private:
     class ScopedTimerImpl;
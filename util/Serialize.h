@@ -2,14 +2,14 @@
 #ifndef _Serialize_h_
 #define _Serialize_h_
 
-// Set this to true to do all serialization using binary archives.  Otherwise, XML archives will be used.
+// Set this to true to do all serialization using compact binary archives.  Otherwise, XML archives will be used,
+// which are slower and larger, but readable when debugging.
 #define FREEORION_BINARY_SERIALIZATION 1
 
 #if FREEORION_BINARY_SERIALIZATION
-#  include <boost/archive/binary_iarchive.hpp>
-#  include <boost/archive/binary_oarchive.hpp>
-typedef boost::archive::binary_iarchive freeorion_iarchive;
-typedef boost::archive::binary_oarchive freeorion_oarchive;
+#  include "CompactBinaryArchive.h"
+typedef compact_binary_iarchive freeorion_iarchive;
+typedef compact_binary_oarchive freeorion_oarchive;
 #else
 #  include <boost/archive/xml_iarchive.hpp>
 #  include <boost/archive/xml_oarchive.hpp>
@@ -37,7 +37,7 @@ FO_COMMON_API void Serialize(freeorion_oarchive& oa, const Universe& universe);
 void Serialize(freeorion_oarchive& oa, const std::map<int, TemporaryPtr<UniverseObject> >& objects);
 
 /** Serializes \a order_set to output archive \a oa. */
-void Serialize(freeorion_oarchive& oa, const OrderSet& order_set);
+FO_COMMON_API void Serialize(freeorion_oarchive& oa, const OrderSet& order_set);
 
 /** Serializes \a pathing_engine to output archive \a oa. */
 void Serialize(freeorion_oarchive& oa, const PathingEngine& pathing_engine);
@@ -49,9 +49,25 @@ FO_COMMON_API void Deserialize(freeorion_iarchive& ia, Universe& universe);
 void Deserialize(freeorion_iarchive& ia, std::map<int, TemporaryPtr<UniverseObject> >& objects);
 
 /** Deserializes \a order_set from input archive \a ia. */
-void Deserialize(freeorion_iarchive& ia, OrderSet& order_set);
+FO_COMMON_API void Deserialize(freeorion_iarchive& ia, OrderSet& order_set);
 
 /** Deserializes \a pathing_engine from input archive \a ia. */
 void Deserialize(freeorion_iarchive& ia, PathingEngine& pathing_engine);
 
+#if FREEORION_BINARY_SERIALIZATION
+namespace boost { namespace archive {
+    class binary_oarchive;
+    class binary_iarchive;
+} }
+
+/** Serializes \a universe to boost's standard binary archive \a oa, rather
+    than a freeorion_oarchive.  Only used to compare the two in benchmarks. */
+FO_COMMON_API void Serialize(boost::archive::binary_oarchive& oa, const Universe& universe);
+
+/** Deserializes \a universe from boost's standard binary archive \a ia.
+    Used to load saves written before the compact binary archive was used,
+    and to compare it with freeorion_iarchive in benchmarks. */
+FO_COMMON_API void Deserialize(boost::archive::binary_iarchive& ia, Universe& universe);
+#endif
+
 #endif // _Serialize_h_
@@ -7,6 +7,10 @@
 
 #include "Serialize.ipp"
 
+#if FREEORION_BINARY_SERIALIZATION
+#  include <boost/archive/binary_iarchive.hpp>
+#endif
+
 
 template <class Archive>
 void ResearchQueue::Element::serialize(Archive& ar, const unsigned int version)
@@ -124,6 +128,9 @@ void Empire::serialize(Archive& ar, const unsigned int version)
             & BOOST_SERIALIZATION_NVP(m_species_planets_depoped)
             & BOOST_SERIALIZATION_NVP(m_species_planets_bombed);
     }
+
+    if (Archive::is_loading::value)
+        UpdateResearchedTechIDs();
 }
 
 template void Empire::serialize<freeorion_oarchive>(freeorion_oarchive&, const unsigned int);
@@ -151,6 +158,10 @@ void EmpireManager::serialize(Archive& ar, const unsigned int version)
 
 template void EmpireManager::serialize<freeorion_oarchive>(freeorion_oarchive&, const unsigned int);
 template void EmpireManager::serialize<freeorion_iarchive>(freeorion_iarchive&, const unsigned int);
+#if FREEORION_BINARY_SERIALIZATION
+// for loading saves written with boost's standard binary archive
+template void EmpireManager::serialize<boost::archive::binary_iarchive>(boost::archive::binary_iarchive&, const unsigned int);
+#endif
 
 template <class Archive>
 void DiplomaticMessage::serialize(Archive& ar, const unsigned int version)
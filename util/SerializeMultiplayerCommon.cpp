@@ -5,6 +5,10 @@
 
 #include "Serialize.ipp"
 
+#if FREEORION_BINARY_SERIALIZATION
+#  include <boost/archive/binary_iarchive.hpp>
+#endif
+
 
 template <class Archive>
 void GalaxySetupData::serialize(Archive& ar, const unsigned int version)
@@ -23,6 +27,10 @@ void GalaxySetupData::serialize(Archive& ar, const unsigned int version)
 
 template void GalaxySetupData::serialize<freeorion_oarchive>(freeorion_oarchive&, const unsigned int);
 template void GalaxySetupData::serialize<freeorion_iarchive>(freeorion_iarchive&, const unsigned int);
+#if FREEORION_BINARY_SERIALIZATION
+// for loading saves written with boost's standard binary archive
+template void GalaxySetupData::serialize<boost::archive::binary_iarchive>(boost::archive::binary_iarchive&, const unsigned int);
+#endif
 
 template <class Archive>
 void SinglePlayerSetupData::serialize(Archive& ar, const unsigned int version)
@@ -47,6 +55,9 @@ void SaveGameUIData::serialize(Archive& ar, const unsigned int version)
 
 template void SaveGameUIData::serialize<freeorion_oarchive>(freeorion_oarchive&, const unsigned int);
 template void SaveGameUIData::serialize<freeorion_iarchive>(freeorion_iarchive&, const unsigned int);
+#if FREEORION_BINARY_SERIALIZATION
+template void SaveGameUIData::serialize<boost::archive::binary_iarchive>(boost::archive::binary_iarchive&, const unsigned int);
+#endif
 
 template <class Archive>
 void SaveGameEmpireData::serialize(Archive& ar, const unsigned int version)
@@ -59,6 +70,9 @@ void SaveGameEmpireData::serialize(Archive& ar, const unsigned int version)
 
 template void SaveGameEmpireData::serialize<freeorion_oarchive>(freeorion_oarchive&, const unsigned int);
 template void SaveGameEmpireData::serialize<freeorion_iarchive>(freeorion_iarchive&, const unsigned int);
+#if FREEORION_BINARY_SERIALIZATION
+template void SaveGameEmpireData::serialize<boost::archive::binary_iarchive>(boost::archive::binary_iarchive&, const unsigned int);
+#endif
 
 template <class Archive>
 void PlayerSetupData::serialize(Archive& ar, const unsigned int version)
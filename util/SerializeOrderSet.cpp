@@ -8,6 +8,12 @@
 
 #include "Serialize.ipp"
 
+// included before the exports below, so that orders in saves written with
+// boost's standard binary archive can be loaded
+#if FREEORION_BINARY_SERIALIZATION
+#  include <boost/archive/binary_iarchive.hpp>
+#endif
+
 
 ////////////////////////////////////////////////////////////
 // Galaxy Map orders
@@ -1,6 +1,8 @@
 #include "Serialize.h"
 
+#include "AppInterface.h"
 #include "Logger.h"
+#include "StringInterner.h"
 #include "Serialize.ipp"
 
 #include "../universe/Building.h"
@@ -13,13 +15,135 @@
 #include "../universe/Field.h"
 #include "../universe/Universe.h"
 
+#if FREEORION_BINARY_SERIALIZATION
+#  include <boost/archive/binary_iarchive.hpp>
+#  include <boost/archive/binary_oarchive.hpp>
+#endif
+#include <boost/serialization/is_bitwise_serializable.hpp>
+#include <boost/serialization/level.hpp>
+#include <boost/serialization/tracking.hpp>
+
+namespace {
+    /** A meter and its type, laid out so that binary archives can write a
+      * vector of them as one block of bytes, instead of writing each meter of
+      * a std::map<MeterType, Meter> as a separately tracked object. */
+    struct PackedMeter {
+        PackedMeter() :
+            type(INVALID_METER_TYPE),
+            current(Meter::DEFAULT_VALUE),
+            initial(Meter::DEFAULT_VALUE)
+        {}
+        PackedMeter(MeterType type_, const Meter& meter) :
+            type(type_),
+            current(meter.Current()),
+            initial(meter.Initial())
+        {}
+
+        template <class Archive>
+        void serialize(Archive& ar, const unsigned int version) {
+            ar  & BOOST_SERIALIZATION_NVP(type)
+                & BOOST_SERIALIZATION_NVP(current)
+                & BOOST_SERIALIZATION_NVP(initial);
+        }
+
+        int     type;
+        float   current;
+        float   initial;
+    };
+
+    /** A ship part meter, with the part name stored as an index into a
+      * separate list of the names, so that each name is written once. */
+    struct PackedPartMeter {
+        PackedPartMeter() :
+            type(INVALID_METER_TYPE),
+            part_name_index(0),
+            current(Meter::DEFAULT_VALUE),
+            initial(Meter::DEFAULT_VALUE)
+        {}
+
+        template <class Archive>
+        void serialize(Archive& ar, const unsigned int version) {
+            ar  & BOOST_SERIALIZATION_NVP(type)
+                & BOOST_SERIALIZATION_NVP(part_name_index)
+                & BOOST_SERIALIZATION_NVP(current)
+                & BOOST_SERIALIZATION_NVP(initial);
+        }
+
+        int     type;
+        int     part_name_index;
+        float   current;
+        float   initial;
+    };
+
+    void PackMeters(const std::map<MeterType, Meter>& meters, std::vector<PackedMeter>& packed_meters) {
+        packed_meters.reserve(meters.size());
+        for (std::map<MeterType, Meter>::const_iterator it = meters.begin(); it != meters.end(); ++it)
+            packed_meters.push_back(PackedMeter(it->first, it->second));
+    }
+
+    void UnpackMeters(const std::vector<PackedMeter>& packed_meters, std::map<MeterType, Meter>& meters) {
+        meters.clear();
+        // meters were packed in order of type, so each is inserted at the end
+        for (std::vector<PackedMeter>::const_iterator it = packed_meters.begin(); it != packed_meters.end(); ++it)
+            meters.insert(meters.end(), std::make_pair(MeterType(it->type), Meter(it->current, it->initial)));
+    }
+
+    void PackPartMeters(const Ship::PartMeterMap& part_meters, std::vector<std::string>& part_names,
+                        std::vector<PackedPartMeter>& packed_part_meters)
+    {
+        std::map<std::string, int> part_name_indices;
+        packed_part_meters.reserve(part_meters.size());
+        for (Ship::PartMeterMap::const_iterator it = part_meters.begin(); it != part_meters.end(); ++it) {
+            const std::string& part_name = it->first.second;
+            std::map<std::string, int>::iterator index_it = part_name_indices.find(part_name);
+            if (index_it == part_name_indices.end()) {
+                index_it = part_name_indices.insert(std::make_pair(part_name, static_cast<int>(part_names.size()))).first;
+                part_names.push_back(part_name);
+            }
+            PackedPartMeter packed_meter;
+            packed_meter.type = it->first.first;
+            packed_meter.part_name_index = index_it->second;
+            packed_meter.current = it->second.Current();
+            packed_meter.initial = it->second.Initial();
+            packed_part_meters.push_back(packed_meter);
+        }
+    }
+
+    void UnpackPartMeters(const std::vector<std::string>& part_names,
+                          const std::vector<PackedPartMeter>& packed_part_meters,
+                          Ship::PartMeterMap& part_meters)
+    {
+        part_meters.clear();
+        for (std::vector<PackedPartMeter>::const_iterator it = packed_part_meters.begin();
+             it != packed_part_meters.end(); ++it)
+        {
+            if (it->part_name_index < 0 || it->part_name_index >= static_cast<int>(part_names.size())) {
+                Logger().errorStream() << "UnpackPartMeters got invalid part name index " << it->part_name_index;
+                continue;
+            }
+            part_meters.insert(part_meters.end(),
+                               std::make_pair(std::make_pair(MeterType(it->type), part_names[it->part_name_index]),
+                                              Meter(it->current, it->initial)));
+        }
+    }
+}
+
+BOOST_IS_BITWISE_SERIALIZABLE(PackedMeter)
+BOOST_CLASS_IMPLEMENTATION(PackedMeter, boost::serialization::object_serializable)
+BOOST_CLASS_TRACKING(PackedMeter, boost::serialization::track_never)
+BOOST_IS_BITWISE_SERIALIZABLE(PackedPartMeter)
+BOOST_CLASS_IMPLEMENTATION(PackedPartMeter, boost::serialization::object_serializable)
+BOOST_CLASS_TRACKING(PackedPartMeter, boost::serialization::track_never)
+
 BOOST_CLASS_EXPORT(System)
 BOOST_CLASS_EXPORT(Field)
 BOOST_CLASS_EXPORT(Planet)
 BOOST_CLASS_EXPORT(Building)
 BOOST_CLASS_EXPORT(Fleet)
 BOOST_CLASS_EXPORT(Ship)
-BOOST_CLASS_VERSION(Ship, 1)
+BOOST_CLASS_VERSION(UniverseObject, 1)
+BOOST_CLASS_VERSION(Ship, 2)
+BOOST_CLASS_VERSION(Universe, 1)
 //BOOST_CLASS_EXPORT(ShipDesign)
 //BOOST_CLASS_VERSION(ShipDesign, 1)
 
@@ -34,6 +158,25 @@ void ObjectMap::serialize(Archive& ar, const unsigned int version)
     }
 }
 
+template <class Archive>
+void StatColumn::serialize(Archive& ar, const unsigned int version)
+{
+    ar  & BOOST_SERIALIZATION_NVP(m_downsampled_first_turn)
+        & BOOST_SERIALIZATION_NVP(m_stride)
+        & BOOST_SERIALIZATION_NVP(m_downsampled_values)
+        & BOOST_SERIALIZATION_NVP(m_first_turn)
+        & BOOST_SERIALIZATION_NVP(m_values);
+}
+
+template <class Archive>
+void StatHistory::serialize(Archive& ar, const unsigned int version)
+{
+    ar  & BOOST_SERIALIZATION_NVP(m_columns)
+        & BOOST_SERIALIZATION_NVP(m_last_turn)
+        & BOOST_SERIALIZATION_NVP(m_full_resolution_turns)
+        & BOOST_SERIALIZATION_NVP(m_downsample_stride);
+}
+
 template <class Archive>
 void Universe::serialize(Archive& ar, const unsigned int version)
 {
@@ -60,7 +203,16 @@ void Universe::serialize(Archive& ar, const unsigned int version)
         GetShipDesignsToSerialize(          ship_designs,                       m_encoding_empire);
     }
 
+    ObjectMap                       existing_objects;
+    boost::unordered_map<int, size_t> system_id_to_graph_index;
+    bool                            system_graph_current = false;
     if (Archive::is_loading::value) {
+        if (m_update_objects_in_place) {
+            existing_objects.swap(m_objects);   // keep existing objects to update them in place once deserialized
+            // keep system graph lookup, to be restored if no systems change
+            system_id_to_graph_index.swap(m_system_id_to_graph_index);
+            system_graph_current = m_system_graph_current;
+        }
         Clear();    // clean up any existing dynamically allocated contents before replacing containers with deserialized data
     }
 
@@ -83,7 +235,37 @@ void Universe::serialize(Archive& ar, const unsigned int version)
     ar  & BOOST_SERIALIZATION_NVP(m_last_allocated_object_id);
     ar  & BOOST_SERIALIZATION_NVP(m_last_allocated_design_id);
     Logger().debugStream() << "Universe::serialize : (de)serializing stats";
-    ar  & BOOST_SERIALIZATION_NVP(m_stat_records);
+    if (version < 1) {
+        std::map<std::string, std::map<int, std::map<int, double> > > m_stat_records;
+        ar  & BOOST_SERIALIZATION_NVP(m_stat_records);
+        if (Archive::is_loading::value) {
+            m_stat_history.Clear();
+            for (std::map<std::string, std::map<int, std::map<int, double> > >::const_iterator
+                 stat_it = m_stat_records.begin(); stat_it != m_stat_records.end(); ++stat_it)
+            {
+                for (std::map<int, std::map<int, double> >::const_iterator empire_it = stat_it->second.begin();
+                     empire_it != stat_it->second.end(); ++empire_it)
+                {
+                    for (std::map<int, double>::const_iterator turn_it = empire_it->second.begin();
+                         turn_it != empire_it->second.end(); ++turn_it)
+                    { m_stat_history.SetValue(stat_it->first, empire_it->first, turn_it->first, turn_it->second); }
+                }
+            }
+        }
+    } else {
+        int stat_history_first_turn = m_stat_history_encoding_turn;
+        ar  & BOOST_SERIALIZATION_NVP(stat_history_first_turn);
+        if (stat_history_first_turn == INVALID_GAME_TURN) {
+            ar  & BOOST_SERIALIZATION_NVP(m_stat_history);
+        } else {
+            StatHistory::RowMap stat_history_rows;
+            if (Archive::is_saving::value)
+                m_stat_history.GetRowsFrom(stat_history_first_turn, stat_history_rows);
+            ar  & BOOST_SERIALIZATION_NVP(stat_history_rows);
+            if (Archive::is_loading::value)
+                m_stat_history.SetRowsFrom(stat_history_first_turn, stat_history_rows);
+        }
+    }
     Logger().debugStream() << "Universe::serialize : (de)serializing done";
 
     if (Archive::is_saving::value) {
@@ -96,13 +278,21 @@ void Universe::serialize(Archive& ar, const unsigned int version)
     }
 
     if (Archive::is_loading::value) {
+        std::vector<TemporaryPtr<UniverseObject> > changed_objects;
+        if (m_update_objects_in_place) {
+            Logger().debugStream() << "Universe::serialize : Updating existing objects in place";
+            if (!UpdateObjectsInPlace(objects, existing_objects, changed_objects)) {
+                m_system_id_to_graph_index.swap(system_id_to_graph_index);
+                m_system_graph_current = system_graph_current;
+            }
+        }
+
         Logger().debugStream() << "Universe::serialize : Swapping old/new data, with Encoding Empire "
                                << EncodingEmpire();
         m_objects.swap(objects);
         m_destroyed_object_ids.swap(destroyed_object_ids);
         m_empire_latest_known_objects.swap(empire_latest_known_objects);
-        m_empire_object_visibility.swap(empire_object_visibility);
-        m_empire_object_visibility_turns.swap(empire_object_visibility_turns);
+        SetEmpireObjectVisibilityTables(empire_object_visibility, empire_object_visibility_turns);
         m_empire_known_destroyed_object_ids.swap(empire_known_destroyed_object_ids);
         m_empire_stale_knowledge_object_ids.swap(empire_stale_knowledge_object_ids);
         m_ship_designs.swap(ship_designs);
@@ -116,6 +306,13 @@ void Universe::serialize(Archive& ar, const unsigned int version)
             if (destroyed_ids_it != m_empire_known_destroyed_object_ids.end())
                 it->second.UpdateCurrentDestroyedObjects(destroyed_ids_it->second);
         }
+
+        // signal only once the whole universe has been loaded, so that
+        // responses to the signals see consistent data
+        ScopedUniverseObjectSignalBatch signal_batch(*this);
+        for (std::vector<TemporaryPtr<UniverseObject> >::iterator it = changed_objects.begin();
+             it != changed_objects.end(); ++it)
+        { (*it)->StateChangedSignal(); }
     }
 }
 
@@ -128,9 +325,18 @@ void UniverseObject::serialize(Archive& ar, const unsigned int version)
         & BOOST_SERIALIZATION_NVP(m_y)
         & BOOST_SERIALIZATION_NVP(m_owner_empire_id)
         & BOOST_SERIALIZATION_NVP(m_system_id)
-        & BOOST_SERIALIZATION_NVP(m_specials)
-        & BOOST_SERIALIZATION_NVP(m_meters)
-        & BOOST_SERIALIZATION_NVP(m_created_on_turn);
+        & BOOST_SERIALIZATION_NVP(m_specials);
+    if (version < 1) {
+        ar  & BOOST_SERIALIZATION_NVP(m_meters);
+    } else {
+        std::vector<PackedMeter> meters;
+        if (Archive::is_saving::value)
+            PackMeters(m_meters, meters);
+        ar  & boost::serialization::make_nvp("m_meters", meters);
+        if (Archive::is_loading::value)
+            UnpackMeters(meters, m_meters);
+    }
+    ar  & BOOST_SERIALIZATION_NVP(m_created_on_turn);
 }
 
 template <class Archive>
@@ -186,6 +392,8 @@ void Building::serialize(Archive& ar, const unsigned int version)
         & BOOST_SERIALIZATION_NVP(m_planet_id)
         & BOOST_SERIALIZATION_NVP(m_ordered_scrapped)
         & BOOST_SERIALIZATION_NVP(m_produced_by_empire_id);
+    if (Archive::is_loading::value)
+        m_building_type_id = InternString(m_building_type);
 }
 
 template <class Archive>
@@ -215,13 +423,26 @@ void Ship::serialize(Archive& ar, const unsigned int version)
         & BOOST_SERIALIZATION_NVP(m_ordered_invade_planet_id)
         & BOOST_SERIALIZATION_NVP(m_ordered_bombard_planet_id)
         & BOOST_SERIALIZATION_NVP(m_fighters)
-        & BOOST_SERIALIZATION_NVP(m_missiles)
-        & BOOST_SERIALIZATION_NVP(m_part_meters)
-        & BOOST_SERIALIZATION_NVP(m_species_name)
+        & BOOST_SERIALIZATION_NVP(m_missiles);
+    if (version < 2) {
+        ar  & BOOST_SERIALIZATION_NVP(m_part_meters);
+    } else {
+        std::vector<std::string> part_names;
+        std::vector<PackedPartMeter> part_meters;
+        if (Archive::is_saving::value)
+            PackPartMeters(m_part_meters, part_names, part_meters);
+        ar  & BOOST_SERIALIZATION_NVP(part_names)
+            & boost::serialization::make_nvp("m_part_meters", part_meters);
+        if (Archive::is_loading::value)
+            UnpackPartMeters(part_names, part_meters, m_part_meters);
+    }
+    ar  & BOOST_SERIALIZATION_NVP(m_species_name)
         & BOOST_SERIALIZATION_NVP(m_produced_by_empire_id);
     if (version >= 1) {
         ar  & BOOST_SERIALIZATION_NVP(m_last_turn_active_in_combat);
     }
+    if (Archive::is_loading::value)
+        m_species_id = InternString(m_species_name);
 }
 
 template <class Archive>
@@ -249,6 +470,12 @@ void SpeciesManager::serialize<freeorion_oarchive>(freeorion_oarchive& ar, const
 template
 void SpeciesManager::serialize<freeorion_iarchive>(freeorion_iarchive& ar, const unsigned int version);
 
+#if FREEORION_BINARY_SERIALIZATION
+// for loading saves written with boost's standard binary archive
+template
+void SpeciesManager::serialize<boost::archive::binary_iarchive>(boost::archive::binary_iarchive& ar, const unsigned int version);
+#endif
+
 template <class Archive>
 void SpeciesManager::serialize(Archive& ar, const unsigned int version)
 {
@@ -289,3 +516,11 @@ void Deserialize(freeorion_iarchive& ia, Universe& universe)
 
 void Deserialize(freeorion_iarchive& ia, std::map<int, TemporaryPtr<UniverseObject> >& objects)
 { ia >> BOOST_SERIALIZATION_NVP(objects); }
+
+#if FREEORION_BINARY_SERIALIZATION
+void Serialize(boost::archive::binary_oarchive& oa, const Universe& universe)
+{ oa << BOOST_SERIALIZATION_NVP(universe); }
+
+void Deserialize(boost::archive::binary_iarchive& ia, Universe& universe)
+{ ia >> BOOST_SERIALIZATION_NVP(universe); }
+#endif
@@ -0,0 +1,87 @@
+#include "StringInterner.h"
+
+#include <boost/thread/locks.hpp>
+#include <boost/thread/shared_mutex.hpp>
+#include <boost/unordered_map.hpp>
+
+#include <deque>
+
+const int INVALID_STRING_ID = 0;
+
+namespace {
+    /** Interned strings are stored in a deque, which doesn't move its
+      * elements when more are appended, so references returned by
+      * InternedString() remain valid.  The empty string is always stored
+      * first, so that it has id INVALID_STRING_ID. */
+    class StringInterner {
+    public:
+        StringInterner() :
+            m_strings(1, std::string())
+        {}
+
+        int Intern(const std::string& str) {
+            if (str.empty())
+                return INVALID_STRING_ID;
+            {
+                boost::shared_lock<boost::shared_mutex> lock(m_mutex);
+                IDMap::const_iterator it = m_ids.find(str);
+                if (it != m_ids.end())
+                    return it->second;
+            }
+            boost::unique_lock<boost::shared_mutex> lock(m_mutex);
+            // another thread may have interned str since the shared lock was released
+            std::pair<IDMap::iterator, bool> result =
+                m_ids.insert(std::make_pair(str, static_cast<int>(m_strings.size())));
+            if (result.second)
+                m_strings.push_back(str);
+            return result.first->second;
+        }
+
+        int Find(const std::string& str) const {
+            if (str.empty())
+                return INVALID_STRING_ID;
+            boost::shared_lock<boost::shared_mutex> lock(m_mutex);
+            IDMap::const_iterator it = m_ids.find(str);
+            return it != m_ids.end() ? it->second : INVALID_STRING_ID;
+        }
+
+        const std::string& String(int id) const {
+            boost::shared_lock<boost::shared_mutex> lock(m_mutex);
+            if (id < 0 || static_cast<std::size_t>(id) >= m_strings.size())
+                return m_strings.front();
+            return m_strings[id];
+        }
+
+        std::size_t Size() const {
+            boost::shared_lock<boost::shared_mutex> lock(m_mutex);
+            return m_strings.size();
+        }
+
+    private:
+        typedef boost::unordered_map<std::string, int> IDMap;
+
+        std::deque<std::string>         m_strings;
+        IDMap                           m_ids;
+        mutable boost::shared_mutex     m_mutex;
+    };
+
+    StringInterner& GetStringInterner() {
+        static StringInterner interner;
+        return interner;
+    }
+
+    // ensure the interner is constructed before any threads might use it
+    StringInterner& temp_interner = GetStringInterner();
+}
+
+int InternString(const std::string& str)
+{ return GetStringInterner().Intern(str); }
+
+int FindInternedString(const std::string& str)
+{ return GetStringInterner().Find(str); }
+
+const std::string& InternedString(int id)
+{ return GetStringInterner().String(id); }
+
+std::size_t NumInternedStrings()
+{ return GetStringInterner().Size(); }
@@ -0,0 +1,43 @@
+// -*- C++ -*-
+#ifndef _StringInterner_h_
+#define _StringInterner_h_
+
+#include <cstddef>
+#include <string>
+
+#include "Export.h"
+
+/** \file StringInterner.h
+    Maps content names, such as those of species, techs, building types,
+    specials and ship parts, to compact integer ids.  Each distinct string is
+    assigned the next unused id when it is first interned, and keeps that id
+    for the rest of the process, so ids can be compared and used as indices
+    instead of repeatedly comparing or hashing names.
+
+    Ids depend on the order in which strings are interned, so they are not
+    the same in different processes, and must not be serialized or sent
+    between the server and clients; names are used for that instead.  All
+    functions are thread safe. */
+
+/** The id of the empty string, and the id returned for strings that haven't
+    been interned. */
+FO_COMMON_API extern const int INVALID_STRING_ID;
+
+/** Returns the id of \a str, interning it first if necessary. */
+FO_COMMON_API int InternString(const std::string& str);
+
+/** Returns the id of \a str if it has been interned, or INVALID_STRING_ID
+    otherwise.  Unlike InternString(), this never adds a new string, so is
+    suitable for looking up names that may not be content names. */
+FO_COMMON_API int FindInternedString(const std::string& str);
+
+/** Returns the string with id \a id, or an empty string if no string has
+    that id.  The returned reference remains valid for the rest of the
+    process. */
+FO_COMMON_API const std::string& InternedString(int id);
+
+/** Returns the number of strings that have been interned.  All ids are less
+    than this number, so it can be used to size id-indexed containers. */
+FO_COMMON_API std::size_t NumInternedStrings();
+
+#endif // _StringInterner_h_
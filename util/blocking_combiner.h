@@ -2,6 +2,8 @@
 #ifndef _blocking_combiner_h_
 #define _blocking_combiner_h_
 
+#include <boost/function.hpp>
+
 /** Implementation of a combiner to block or unblock signals emitted by
  * boost::signals calls. Sample usage:
  *
@@ -37,4 +39,40 @@ private:
     inner_combiner m_combiner;
 };
 
+/** Combiner that, like blocking_combiner, blocks signals while \a blocking is
+ * true, and that defers signals while \a deferring is true, by calling
+ * \a defer instead of any connected slots.  \a defer is called even if no
+ * slots are connected, so that the emitter can record that the signal is to
+ * be emitted again later, for example once for several deferred emissions.
+ * Blocking takes precedence over deferring.
+ */
+template <typename inner_combiner>
+struct deferring_combiner
+{
+    typedef typename inner_combiner::result_type result_type;
+
+    deferring_combiner(const bool& blocking, const bool& deferring, const boost::function<void ()>& defer) :
+        m_blocking(blocking), m_deferring(deferring), m_defer(defer), m_combiner() {}
+
+    template <typename input_iterator>
+    result_type operator()(input_iterator first, input_iterator last)
+    {
+        if(m_blocking)
+            return result_type();
+        if(m_deferring) {
+            m_defer();
+            return result_type();
+        }
+        if(first != last)
+            return m_combiner(first, last);
+        return result_type();
+    }
+
+private:
+    const bool& m_blocking;
+    const bool& m_deferring;
+    boost::function<void ()> m_defer;
+    inner_combiner m_combiner;
+};
+
 #endif // _blocking_combiner_h_
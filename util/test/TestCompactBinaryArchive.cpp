@@ -0,0 +1,209 @@
+#include <boost/test/unit_test.hpp>
+
+#include "../CompactBinaryArchive.h"
+
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/map.hpp>
+#include <boost/serialization/set.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <limits>
+#include <sstream>
+
+namespace {
+    struct Thing {
+        Thing() : m_id(0) {}
+        explicit Thing(int id, const std::string& name) : m_id(id), m_name(name) {}
+
+        int         m_id;
+        std::string m_name;
+
+        template <class Archive>
+        void serialize(Archive& ar, const unsigned int version)
+        { ar & m_id & m_name; }
+    };
+
+    /** Serializes \a in with a compact_binary_oarchive and deserializes the
+      * result into \a out with a compact_binary_iarchive. */
+    template <class T>
+    void RoundTrip(const T& in, T& out) {
+        std::stringstream ss;
+        {
+            compact_binary_oarchive oa(ss);
+            oa << in;
+        }
+        compact_binary_iarchive ia(ss);
+        ia >> out;
+    }
+
+    template <class T>
+    T RoundTrip(const T& in) {
+        T retval = T();
+        RoundTrip(in, retval);
+        return retval;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(CompactBinaryArchive)
+
+BOOST_AUTO_TEST_CASE(Integers) {
+    BOOST_CHECK_EQUAL(RoundTrip(0), 0);
+    BOOST_CHECK_EQUAL(RoundTrip(1), 1);
+    BOOST_CHECK_EQUAL(RoundTrip(-1), -1);
+    BOOST_CHECK_EQUAL(RoundTrip(127), 127);
+    BOOST_CHECK_EQUAL(RoundTrip(-128), -128);
+    BOOST_CHECK_EQUAL(RoundTrip(123456789), 123456789);
+    BOOST_CHECK_EQUAL(RoundTrip(std::numeric_limits<int>::max()), std::numeric_limits<int>::max());
+    BOOST_CHECK_EQUAL(RoundTrip(std::numeric_limits<int>::min()), std::numeric_limits<int>::min());
+    BOOST_CHECK_EQUAL(RoundTrip(std::numeric_limits<long>::max()), std::numeric_limits<long>::max());
+    BOOST_CHECK_EQUAL(RoundTrip(std::numeric_limits<long>::min()), std::numeric_limits<long>::min());
+    BOOST_CHECK_EQUAL(RoundTrip(std::numeric_limits<long long>::max()), std::numeric_limits<long long>::max());
+    BOOST_CHECK_EQUAL(RoundTrip(std::numeric_limits<long long>::min()), std::numeric_limits<long long>::min());
+    BOOST_CHECK_EQUAL(RoundTrip(std::numeric_limits<unsigned int>::max()), std::numeric_limits<unsigned int>::max());
+    BOOST_CHECK_EQUAL(RoundTrip(std::numeric_limits<unsigned long>::max()), std::numeric_limits<unsigned long>::max());
+    BOOST_CHECK_EQUAL(RoundTrip(std::numeric_limits<unsigned long long>::max()), std::numeric_limits<unsigned long long>::max());
+    BOOST_CHECK_EQUAL(RoundTrip(static_cast<short>(-12345)), static_cast<short>(-12345));
+    BOOST_CHECK_EQUAL(RoundTrip('x'), 'x');
+    BOOST_CHECK_EQUAL(RoundTrip(true), true);
+}
+
+BOOST_AUTO_TEST_CASE(SmallIntegersAreCompact) {
+    std::stringstream header_only;
+    {
+        compact_binary_oarchive oa(header_only);
+    }
+
+    std::stringstream ss;
+    {
+        compact_binary_oarchive oa(ss);
+        int invalid_id = -1;
+        oa << invalid_id;
+    }
+    BOOST_CHECK_EQUAL(ss.str().size(), header_only.str().size() + 1);
+}
+
+BOOST_AUTO_TEST_CASE(FloatingPoint) {
+    BOOST_CHECK_EQUAL(RoundTrip(0.0), 0.0);
+    BOOST_CHECK_EQUAL(RoundTrip(-1.5), -1.5);
+    BOOST_CHECK_EQUAL(RoundTrip(3.14159265358979), 3.14159265358979);
+    BOOST_CHECK_EQUAL(RoundTrip(std::numeric_limits<double>::max()), std::numeric_limits<double>::max());
+    BOOST_CHECK_EQUAL(RoundTrip(std::numeric_limits<double>::min()), std::numeric_limits<double>::min());
+    BOOST_CHECK_EQUAL(RoundTrip(0.25f), 0.25f);
+}
+
+BOOST_AUTO_TEST_CASE(Strings) {
+    BOOST_CHECK_EQUAL(RoundTrip(std::string()), std::string());
+    BOOST_CHECK_EQUAL(RoundTrip(std::string("SP_HUMAN")), std::string("SP_HUMAN"));
+    const std::string long_string(1000, 'a');
+    BOOST_CHECK_EQUAL(RoundTrip(long_string), long_string);
+}
+
+BOOST_AUTO_TEST_CASE(Containers) {
+    std::vector<int> ints;
+    for (int i = -300; i < 300; i += 7)
+        ints.push_back(i * 1000);
+    BOOST_CHECK(RoundTrip(ints) == ints);
+
+    std::vector<double> doubles;
+    doubles.push_back(1.0);
+    doubles.push_back(-2.5);
+    doubles.push_back(1e100);
+    BOOST_CHECK(RoundTrip(doubles) == doubles);
+
+    std::vector<std::string> strings;
+    strings.push_back("one");
+    strings.push_back("");
+    strings.push_back("three");
+    BOOST_CHECK(RoundTrip(strings) == strings);
+
+    std::map<int, std::string> map;
+    map[-1] = "invalid";
+    map[0] = "zero";
+    map[100000] = "big";
+    BOOST_CHECK(RoundTrip(map) == map);
+
+    std::set<int> set;
+    set.insert(-5);
+    set.insert(0);
+    set.insert(std::numeric_limits<int>::max());
+    BOOST_CHECK(RoundTrip(set) == set);
+
+    BOOST_CHECK(RoundTrip(std::vector<int>()).empty());
+}
+
+BOOST_AUTO_TEST_CASE(ObjectPointers) {
+    Thing* thing = new Thing(42, "fleet");
+    Thing* const in[2] = {thing, thing};
+    Thing* out[2] = {0, 0};
+
+    std::stringstream ss;
+    {
+        compact_binary_oarchive oa(ss);
+        oa << in;
+    }
+    {
+        compact_binary_iarchive ia(ss);
+        ia >> out;
+    }
+
+    BOOST_REQUIRE(out[0]);
+    BOOST_CHECK_EQUAL(out[0]->m_id, 42);
+    BOOST_CHECK_EQUAL(out[0]->m_name, "fleet");
+    // tracked pointers to the same object are restored as one object
+    BOOST_CHECK_EQUAL(out[0], out[1]);
+
+    delete thing;
+    delete out[0];
+}
+
+BOOST_AUTO_TEST_CASE(SharedPointers) {
+    std::vector<boost::shared_ptr<Thing> > in;
+    in.push_back(boost::shared_ptr<Thing>(new Thing(1, "ship")));
+    in.push_back(in.front());
+    in.push_back(boost::shared_ptr<Thing>());
+    in.push_back(boost::shared_ptr<Thing>(new Thing(-1, "planet")));
+
+    std::vector<boost::shared_ptr<Thing> > out = RoundTrip(in);
+
+    BOOST_REQUIRE_EQUAL(out.size(), 4u);
+    BOOST_REQUIRE(out[0]);
+    BOOST_CHECK_EQUAL(out[0]->m_id, 1);
+    BOOST_CHECK_EQUAL(out[0]->m_name, "ship");
+    BOOST_CHECK_EQUAL(out[0], out[1]);
+    BOOST_CHECK(!out[2]);
+    BOOST_REQUIRE(out[3]);
+    BOOST_CHECK_EQUAL(out[3]->m_id, -1);
+    BOOST_CHECK_EQUAL(out[3]->m_name, "planet");
+}
+
+BOOST_AUTO_TEST_CASE(DetectsStandardBinaryArchive) {
+    std::stringstream standard;
+    {
+        boost::archive::binary_oarchive oa(standard);
+        int value = 5;
+        oa << value;
+    }
+    BOOST_CHECK(CompactBinary::IsStandardBinaryArchive(standard));
+    // the stream position is left unchanged
+    BOOST_CHECK_EQUAL(standard.tellg(), std::istream::pos_type(0));
+
+    std::stringstream compact;
+    {
+        compact_binary_oarchive oa(compact);
+        int value = 5;
+        oa << value;
+    }
+    BOOST_CHECK(!CompactBinary::IsStandardBinaryArchive(compact));
+    compact_binary_iarchive ia(compact);
+    int value = 0;
+    ia >> value;
+    BOOST_CHECK_EQUAL(value, 5);
+
+    std::stringstream empty;
+    BOOST_CHECK(!CompactBinary::IsStandardBinaryArchive(empty));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,86 @@
+#include <boost/test/unit_test.hpp>
+
+#include "../blocking_combiner.h"
+
+#include <boost/bind.hpp>
+#include <boost/signals2/signal.hpp>
+
+namespace {
+    typedef boost::signals2::signal<void (), deferring_combiner<boost::signals2::optional_last_value<void> > >
+        DeferringSignal;
+
+    void Increment(int& count)
+    { ++count; }
+
+    /** A signal with a deferring_combiner, and counts of the calls of its slot
+      * and of its defer function. */
+    struct DeferringSignalFixture {
+        DeferringSignalFixture() :
+            blocking(false),
+            deferring(false),
+            slot_calls(0),
+            defer_calls(0),
+            signal(deferring_combiner<boost::signals2::optional_last_value<void> >(
+                blocking, deferring, boost::bind(&Increment, boost::ref(defer_calls))))
+        {}
+
+        void Connect()
+        { signal.connect(boost::bind(&Increment, boost::ref(slot_calls))); }
+
+        bool            blocking;
+        bool            deferring;
+        int             slot_calls;
+        int             defer_calls;
+        DeferringSignal signal;
+    };
+}
+
+BOOST_FIXTURE_TEST_SUITE(DeferringCombiner, DeferringSignalFixture)
+
+BOOST_AUTO_TEST_CASE(CallsSlotsWhenNotBlockingOrDeferring) {
+    Connect();
+    signal();
+    signal();
+    BOOST_CHECK_EQUAL(slot_calls, 2);
+    BOOST_CHECK_EQUAL(defer_calls, 0);
+}
+
+BOOST_AUTO_TEST_CASE(DefersInsteadOfCallingSlots) {
+    Connect();
+    deferring = true;
+    signal();
+    signal();
+    BOOST_CHECK_EQUAL(slot_calls, 0);
+    BOOST_CHECK_EQUAL(defer_calls, 2);
+
+    deferring = false;
+    signal();
+    BOOST_CHECK_EQUAL(slot_calls, 1);
+    BOOST_CHECK_EQUAL(defer_calls, 2);
+}
+
+BOOST_AUTO_TEST_CASE(DefersWithoutConnectedSlots) {
+    deferring = true;
+    signal();
+    BOOST_CHECK_EQUAL(defer_calls, 1);
+
+    deferring = false;
+    signal();
+    BOOST_CHECK_EQUAL(defer_calls, 1);
+}
+
+BOOST_AUTO_TEST_CASE(BlockingTakesPrecedenceOverDeferring) {
+    Connect();
+    blocking = true;
+    deferring = true;
+    signal();
+    BOOST_CHECK_EQUAL(slot_calls, 0);
+    BOOST_CHECK_EQUAL(defer_calls, 0);
+
+    blocking = false;
+    signal();
+    BOOST_CHECK_EQUAL(slot_calls, 0);
+    BOOST_CHECK_EQUAL(defer_calls, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,3 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "Freeorion util unit tests"
+#include <boost/test/unit_test.hpp>